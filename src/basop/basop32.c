@@ -74,6 +74,8 @@ HISTORY:
 
    30 Nov 09   v2.3     round() function is now round_fx().
                         saturate() is not referencable from outside application
+   17 Oct 26   v2.4     Overflow and Carry are thread-local (BASOP_TLS) with
+                        BASOP_THREADS.
   =============================================================================
 */
 
@@ -127,8 +129,8 @@ HISTORY:
 
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif
 
 
@@ -137,7 +139,9 @@ extern int currCounter;
  |   Local Functions                                                         |
  |___________________________________________________________________________|
 */
+#ifndef BASOP_INLINE
 static Word16 saturate (Word32 L_var1);
+#endif
 
 
 /*___________________________________________________________________________
@@ -145,8 +149,8 @@ static Word16 saturate (Word32 L_var1);
  |   Constants and Globals                                                   |
  |___________________________________________________________________________|
 */
-Flag Overflow = 0;
-Flag Carry = 0;
+BASOP_TLS Flag Overflow = 0;
+BASOP_TLS Flag Carry = 0;
 
 
 /*___________________________________________________________________________
@@ -154,6 +158,7 @@ Flag Carry = 0;
  |   Functions                                                               |
  |___________________________________________________________________________|
 */
+#ifndef BASOP_INLINE            /* else defined in basop_inline.h */
 
 /*___________________________________________________________________________
  |                                                                           |
@@ -2424,6 +2429,7 @@ Word32 L_msu0 (Word32 L_var3, Word16 var1, Word16 var2) {
 #endif
   return (L_var_out);
 }
+#endif /* ifndef BASOP_INLINE */
 
 
 /* end of file */
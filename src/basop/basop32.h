@@ -37,6 +37,8 @@
 
    30 Nov 09   v2.3     round() function is now round_fx().
                         saturate() is not referencable from outside application
+   17 Oct 26   v2.4     Operators are static inline when BASOP_INLINE is
+                        defined (see basop_inline.h).
   ============================================================================
 */
 
@@ -51,8 +53,8 @@
  | $Id $
  |___________________________________________________________________________|
 */
-extern Flag Overflow;
-extern Flag Carry;
+extern BASOP_TLS Flag Overflow;
+extern BASOP_TLS Flag Carry;
 
 #define MAX_32 (Word32)0x7fffffffL
 #define MIN_32 (Word32)0x80000000L
@@ -60,62 +62,73 @@ extern Flag Carry;
 #define MAX_16 (Word16)0x7fff
 #define MIN_16 (Word16)0x8000
 
+/*
+ * Storage class of the operators of basop32.c, enh1632.c and enh40.c:
+ * with BASOP_INLINE, they are static inline functions, defined in
+ * basop_inline.h, and complexity counting (WMOPS) is compiled out.
+ */
+#ifdef BASOP_INLINE
+#define BASOP_STATIC static __inline
+#else
+#define BASOP_STATIC
+#endif
+
 /*___________________________________________________________________________
  |                                                                           |
  |   Prototypes for basic arithmetic operators                               |
  |___________________________________________________________________________|
 */
 
-Word16 add (Word16 var1, Word16 var2);  /* Short add, 1 */
-Word16 sub (Word16 var1, Word16 var2);  /* Short sub, 1 */
-Word16 abs_s (Word16 var1);     /* Short abs, 1 */
-Word16 shl (Word16 var1, Word16 var2);  /* Short shift left, 1 */
-Word16 shr (Word16 var1, Word16 var2);  /* Short shift right, 1 */
-Word16 mult (Word16 var1, Word16 var2); /* Short mult, 1 */
-Word32 L_mult (Word16 var1, Word16 var2);       /* Long mult, 1 */
-Word16 negate (Word16 var1);    /* Short negate, 1 */
-Word16 extract_h (Word32 L_var1);       /* Extract high, 1 */
-Word16 extract_l (Word32 L_var1);       /* Extract low, 1 */
-Word16 round_fx (Word32 L_var1);        /* Round, 1 */
-Word32 L_mac (Word32 L_var3, Word16 var1, Word16 var2); /* Mac, 1 */
-Word32 L_msu (Word32 L_var3, Word16 var1, Word16 var2); /* Msu, 1 */
-Word32 L_macNs (Word32 L_var3, Word16 var1, Word16 var2);       /* Mac without sat, 1 */
-Word32 L_msuNs (Word32 L_var3, Word16 var1, Word16 var2);       /* Msu without sat, 1 */
-Word32 L_add (Word32 L_var1, Word32 L_var2);    /* Long add, 1 */
-Word32 L_sub (Word32 L_var1, Word32 L_var2);    /* Long sub, 1 */
-Word32 L_add_c (Word32 L_var1, Word32 L_var2);  /* Long add with c, 2 */
-Word32 L_sub_c (Word32 L_var1, Word32 L_var2);  /* Long sub with c, 2 */
-Word32 L_negate (Word32 L_var1);        /* Long negate, 1 */
-Word16 mult_r (Word16 var1, Word16 var2);       /* Mult with round, 1 */
-Word32 L_shl (Word32 L_var1, Word16 var2);      /* Long shift left, 1 */
-Word32 L_shr (Word32 L_var1, Word16 var2);      /* Long shift right, 1 */
-Word16 shr_r (Word16 var1, Word16 var2);        /* Shift right with round, 2 */
-Word16 mac_r (Word32 L_var3, Word16 var1, Word16 var2); /* Mac with rounding, 1 */
-Word16 msu_r (Word32 L_var3, Word16 var1, Word16 var2); /* Msu with rounding, 1 */
-Word32 L_deposit_h (Word16 var1);       /* 16 bit var1 -> MSB, 1 */
-Word32 L_deposit_l (Word16 var1);       /* 16 bit var1 -> LSB, 1 */
-
-Word32 L_shr_r (Word32 L_var1, Word16 var2);    /* Long shift right with round, 3 */
-Word32 L_abs (Word32 L_var1);   /* Long abs, 1 */
-Word32 L_sat (Word32 L_var1);   /* Long saturation, 4 */
-Word16 norm_s (Word16 var1);    /* Short norm, 1 */
-Word16 div_s (Word16 var1, Word16 var2);        /* Short division, 18 */
-Word16 norm_l (Word32 L_var1);  /* Long norm, 1 */
+BASOP_STATIC Word16 add (Word16 var1, Word16 var2);  /* Short add, 1 */
+BASOP_STATIC Word16 sub (Word16 var1, Word16 var2);  /* Short sub, 1 */
+BASOP_STATIC Word16 abs_s (Word16 var1);     /* Short abs, 1 */
+BASOP_STATIC Word16 shl (Word16 var1, Word16 var2);  /* Short shift left, 1 */
+BASOP_STATIC Word16 shr (Word16 var1, Word16 var2);  /* Short shift right, 1 */
+BASOP_STATIC Word16 mult (Word16 var1, Word16 var2); /* Short mult, 1 */
+BASOP_STATIC Word32 L_mult (Word16 var1, Word16 var2);       /* Long mult, 1 */
+BASOP_STATIC Word16 negate (Word16 var1);    /* Short negate, 1 */
+BASOP_STATIC Word16 extract_h (Word32 L_var1);       /* Extract high, 1 */
+BASOP_STATIC Word16 extract_l (Word32 L_var1);       /* Extract low, 1 */
+BASOP_STATIC Word16 round_fx (Word32 L_var1);        /* Round, 1 */
+BASOP_STATIC Word32 L_mac (Word32 L_var3, Word16 var1, Word16 var2); /* Mac, 1 */
+BASOP_STATIC Word32 L_msu (Word32 L_var3, Word16 var1, Word16 var2); /* Msu, 1 */
+BASOP_STATIC Word32 L_macNs (Word32 L_var3, Word16 var1, Word16 var2);       /* Mac without sat, 1 */
+BASOP_STATIC Word32 L_msuNs (Word32 L_var3, Word16 var1, Word16 var2);       /* Msu without sat, 1 */
+BASOP_STATIC Word32 L_add (Word32 L_var1, Word32 L_var2);    /* Long add, 1 */
+BASOP_STATIC Word32 L_sub (Word32 L_var1, Word32 L_var2);    /* Long sub, 1 */
+BASOP_STATIC Word32 L_add_c (Word32 L_var1, Word32 L_var2);  /* Long add with c, 2 */
+BASOP_STATIC Word32 L_sub_c (Word32 L_var1, Word32 L_var2);  /* Long sub with c, 2 */
+BASOP_STATIC Word32 L_negate (Word32 L_var1);        /* Long negate, 1 */
+BASOP_STATIC Word16 mult_r (Word16 var1, Word16 var2);       /* Mult with round, 1 */
+BASOP_STATIC Word32 L_shl (Word32 L_var1, Word16 var2);      /* Long shift left, 1 */
+BASOP_STATIC Word32 L_shr (Word32 L_var1, Word16 var2);      /* Long shift right, 1 */
+BASOP_STATIC Word16 shr_r (Word16 var1, Word16 var2);        /* Shift right with round, 2 */
+BASOP_STATIC Word16 mac_r (Word32 L_var3, Word16 var1, Word16 var2); /* Mac with rounding, 1 */
+BASOP_STATIC Word16 msu_r (Word32 L_var3, Word16 var1, Word16 var2); /* Msu with rounding, 1 */
+BASOP_STATIC Word32 L_deposit_h (Word16 var1);       /* 16 bit var1 -> MSB, 1 */
+BASOP_STATIC Word32 L_deposit_l (Word16 var1);       /* 16 bit var1 -> LSB, 1 */
+
+BASOP_STATIC Word32 L_shr_r (Word32 L_var1, Word16 var2);    /* Long shift right with round, 3 */
+BASOP_STATIC Word32 L_abs (Word32 L_var1);   /* Long abs, 1 */
+BASOP_STATIC Word32 L_sat (Word32 L_var1);   /* Long saturation, 4 */
+BASOP_STATIC Word16 norm_s (Word16 var1);    /* Short norm, 1 */
+BASOP_STATIC Word16 div_s (Word16 var1, Word16 var2);        /* Short division, 18 */
+BASOP_STATIC Word16 norm_l (Word32 L_var1);  /* Long norm, 1 */
 
 
 /*
  * Additional G.723.1 operators
 */
-Word32 L_mls (Word32, Word16);  /* Weight FFS; currently assigned 5 */
-Word16 div_l (Word32, Word16);  /* Weight FFS; currently assigned 32 */
-Word16 i_mult (Word16 a, Word16 b);     /* Weight FFS; currently assigned 3 */
+BASOP_STATIC Word32 L_mls (Word32, Word16);  /* Weight FFS; currently assigned 5 */
+BASOP_STATIC Word16 div_l (Word32, Word16);  /* Weight FFS; currently assigned 32 */
+BASOP_STATIC Word16 i_mult (Word16 a, Word16 b);     /* Weight FFS; currently assigned 3 */
 
 /*
  *  New shiftless operators, not used in G.729/G.723.1
 */
-Word32 L_mult0 (Word16 v1, Word16 v2);  /* 32-bit Multiply w/o shift 1 */
-Word32 L_mac0 (Word32 L_v3, Word16 v1, Word16 v2);      /* 32-bit Mac w/o shift 1 */
-Word32 L_msu0 (Word32 L_v3, Word16 v1, Word16 v2);      /* 32-bit Msu w/o shift 1 */
+BASOP_STATIC Word32 L_mult0 (Word16 v1, Word16 v2);  /* 32-bit Multiply w/o shift 1 */
+BASOP_STATIC Word32 L_mac0 (Word32 L_v3, Word16 v1, Word16 v2);      /* 32-bit Mac w/o shift 1 */
+BASOP_STATIC Word32 L_msu0 (Word32 L_v3, Word16 v1, Word16 v2);      /* 32-bit Msu w/o shift 1 */
 
 
 #endif /* ifndef _BASIC_OP_H */
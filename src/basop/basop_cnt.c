@@ -291,6 +291,12 @@ const char basops[][20] = {     /* all basicop commands */
   "Mpy_32_16_uu",
   "norm_ul",
   "UL_deposit_l",
+  /* vector basic operators */
+  "L_dot_v",
+  "L_mac_v",
+  "norm_l_v",
+  "scale_v",
+  "L_conv_v",
   /* new control code STL basic operators */
   "LT_16",
   "GT_16",
@@ -331,6 +337,8 @@ const char blocklist[][20] = {  /* to recognize standard C functions (memory all
 #endif
   "fwc",
   "WMOPS_output",
+  "WMOPS_output_merged",
+  "WMOPS_merge",
   "Reset_WMOPS_counter",
   "Init_WMOPS_counter",
   "setCounter",
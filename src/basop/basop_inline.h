@@ -0,0 +1,1938 @@
+/*
+  ===========================================================================
+   File: BASOP_INLINE.H                                  v.2.4 - 17.Oct.2026
+  ===========================================================================
+
+            ITU-T STL  BASIC OPERATORS
+
+            STATIC INLINE OPERATORS WITHOUT COMPLEXITY COUNTING
+
+   History:
+   17 Oct 26   v2.4     Static inline copies of the operators of basop32.c,
+                        enh1632.c and enh40.c, included by stl.h when
+                        BASOP_INLINE is defined (CMake option STL_BASOP_INLINE).
+                        count.h then leaves WMOPS undefined, so that the
+                        complexity counting of all the operators and of the
+                        move16()/test()/... calls of the codecs is compiled
+                        out. The results, Overflow and Carry included, are
+                        the same as with the functions of the .c files; the
+                        test framework runs against both variants.
+   17 Oct 26   v2.4     Operators of enh64.c and enh32.c added. With GCC and
+                        Clang, BASOP_BUILTIN selects versions of the most used
+                        operators based on the compiler builtins for overflow
+                        detection (__builtin_add_overflow, ...) and bit
+                        counting (__builtin_clz), with the same results;
+                        BASOP_NO_BUILTIN keeps the portable versions.
+   17 Oct 26   v2.4     The portable versions of L_add(), L_sub(),
+                        L_add_c(), L_sub_c(), W_add(), W_sub(), ... add and
+                        subtract in UWord32/UWord64: a signed overflow is
+                        undefined, and once inlined the compiler could drop
+                        the saturation test that follows it.
+
+  ============================================================================
+*/
+
+
+#ifndef _BASOP_INLINE_H
+#define _BASOP_INLINE_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "stl.h"
+
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(BASOP_NO_BUILTIN)
+#define BASOP_BUILTIN
+#endif
+
+static __inline Word16 saturate (Word32 L_var1);
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Operators of basop32.c                                                  |
+ |___________________________________________________________________________|
+*/
+static __inline Word16 saturate (Word32 L_var1) {
+  Word16 var_out;
+
+  if (L_var1 > 0X00007fffL) {
+    Overflow = 1;
+    var_out = MAX_16;
+  } else if (L_var1 < (Word32) 0xffff8000L) {
+    Overflow = 1;
+    var_out = MIN_16;
+  } else {
+    var_out = extract_l (L_var1);
+  }
+
+  return (var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word16 add (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (__builtin_add_overflow (var1, var2, &var_out)) {
+    Overflow = 1;
+    var_out = (var1 < 0) ? MIN_16 : MAX_16;
+  }
+
+  return (var_out);
+}
+#else
+static __inline Word16 add (Word16 var1, Word16 var2) {
+  Word16 var_out;
+  Word32 L_sum;
+
+  L_sum = (Word32) var1 + var2;
+  var_out = saturate (L_sum);
+
+  return (var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+#ifdef BASOP_BUILTIN
+static __inline Word16 sub (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (__builtin_sub_overflow (var1, var2, &var_out)) {
+    Overflow = 1;
+    var_out = (var1 < 0) ? MIN_16 : MAX_16;
+  }
+
+  return (var_out);
+}
+#else
+static __inline Word16 sub (Word16 var1, Word16 var2) {
+  Word16 var_out;
+  Word32 L_diff;
+
+  L_diff = (Word32) var1 - var2;
+  var_out = saturate (L_diff);
+
+  return (var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word16 abs_s (Word16 var1) {
+  Word16 var_out;
+
+  if (var1 == (Word16) MIN_16) {
+    var_out = MAX_16;
+  } else {
+    if (var1 < 0) {
+      var_out = -var1;
+    } else {
+      var_out = var1;
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 shl (Word16 var1, Word16 var2) {
+  Word16 var_out;
+  Word32 result;
+
+  if (var2 < 0) {
+    if (var2 < -16)
+      var2 = -16;
+    var2 = -var2;
+    var_out = shr (var1, var2);
+
+  } else {
+    result = (Word32) var1 *((Word32) 1 << var2);
+
+    if ((var2 > 15 && var1 != 0) || (result != (Word32) ((Word16) result))) {
+      Overflow = 1;
+      var_out = (var1 > 0) ? MAX_16 : MIN_16;
+    } else {
+      var_out = extract_l (result);
+
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 shr (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 < 0) {
+    if (var2 < -16)
+      var2 = -16;
+    var2 = -var2;
+    var_out = shl (var1, var2);
+
+  } else {
+    if (var2 >= 15) {
+      var_out = (var1 < 0) ? -1 : 0;
+    } else {
+      if (var1 < 0) {
+        var_out = ~((~var1) >> var2);
+      } else {
+        var_out = var1 >> var2;
+      }
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 mult (Word16 var1, Word16 var2) {
+  Word16 var_out;
+  Word32 L_product;
+
+  L_product = (Word32) var1 *(Word32) var2;
+
+  L_product = (L_product & (Word32) 0xffff8000L) >> 15;
+
+  if (L_product & (Word32) 0x00010000L)
+    L_product = L_product | (Word32) 0xffff0000L;
+
+  var_out = saturate (L_product);
+
+  return (var_out);
+}
+
+static __inline Word32 L_mult (Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) var1 *(Word32) var2;
+
+  if (L_var_out != (Word32) 0x40000000L) {
+    L_var_out *= 2;
+  } else {
+    Overflow = 1;
+    L_var_out = MAX_32;
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word16 negate (Word16 var1) {
+  Word16 var_out;
+
+  var_out = (var1 == MIN_16) ? MAX_16 : -var1;
+
+  return (var_out);
+}
+
+static __inline Word16 extract_h (Word32 L_var1) {
+  Word16 var_out;
+
+  var_out = (Word16) (L_var1 >> 16);
+
+  return (var_out);
+}
+
+static __inline Word16 extract_l (Word32 L_var1) {
+  Word16 var_out;
+
+  var_out = (Word16) L_var1;
+
+  return (var_out);
+}
+
+static __inline Word16 round_fx (Word32 L_var1) {
+  Word16 var_out;
+  Word32 L_rounded;
+
+  L_rounded = L_add (L_var1, (Word32) 0x00008000L);
+  var_out = extract_h (L_rounded);
+
+  return (var_out);
+}
+
+static __inline Word32 L_mac (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+  Word32 L_product;
+
+  L_product = L_mult (var1, var2);
+  L_var_out = L_add (L_var3, L_product);
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_msu (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+  Word32 L_product;
+
+  L_product = L_mult (var1, var2);
+  L_var_out = L_sub (L_var3, L_product);
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_macNs (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = L_mult (var1, var2);
+  L_var_out = L_add_c (L_var3, L_var_out);
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_msuNs (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = L_mult (var1, var2);
+  L_var_out = L_sub_c (L_var3, L_var_out);
+
+  return (L_var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word32 L_add (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  if (__builtin_add_overflow (L_var1, L_var2, &L_var_out)) {
+    L_var_out = (L_var1 < 0) ? MIN_32 : MAX_32;
+    Overflow = 1;
+  }
+  return (L_var_out);
+}
+#else
+static __inline Word32 L_add (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) ((UWord32) L_var1 + (UWord32) L_var2);
+
+  if (((L_var1 ^ L_var2) & MIN_32) == 0) {
+    if ((L_var_out ^ L_var1) & MIN_32) {
+      L_var_out = (L_var1 < 0) ? MIN_32 : MAX_32;
+      Overflow = 1;
+    }
+  }
+  return (L_var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+#ifdef BASOP_BUILTIN
+static __inline Word32 L_sub (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  if (__builtin_sub_overflow (L_var1, L_var2, &L_var_out)) {
+    L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
+    Overflow = 1;
+  }
+  return (L_var_out);
+}
+#else
+static __inline Word32 L_sub (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) ((UWord32) L_var1 - (UWord32) L_var2);
+
+  if (((L_var1 ^ L_var2) & MIN_32) != 0) {
+    if ((L_var_out ^ L_var1) & MIN_32) {
+      L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
+      Overflow = 1;
+    }
+  }
+  return (L_var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word32 L_add_c (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word32 L_test;
+  Flag carry_int = 0;
+
+  L_var_out = (Word32) ((UWord32) L_var1 + (UWord32) L_var2 + (UWord32) Carry);
+
+  L_test = (Word32) ((UWord32) L_var1 + (UWord32) L_var2);
+
+  if ((L_var1 > 0) && (L_var2 > 0) && (L_test < 0)) {
+    Overflow = 1;
+    carry_int = 0;
+  } else {
+    if ((L_var1 < 0) && (L_var2 < 0)) {
+      if (L_test >= 0) {
+        Overflow = 1;
+        carry_int = 1;
+      } else {
+        Overflow = 0;
+        carry_int = 1;
+      }
+    } else {
+      if (((L_var1 ^ L_var2) < 0) && (L_test >= 0)) {
+        Overflow = 0;
+        carry_int = 1;
+      } else {
+        Overflow = 0;
+        carry_int = 0;
+      }
+    }
+  }
+
+  if (Carry) {
+    if (L_test == MAX_32) {
+      Overflow = 1;
+      Carry = carry_int;
+    } else {
+      if (L_test == (Word32) 0xFFFFFFFFL) {
+        Carry = 1;
+      } else {
+        Carry = carry_int;
+      }
+    }
+  } else {
+    Carry = carry_int;
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_sub_c (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word32 L_test;
+  Flag carry_int = 0;
+
+  if (Carry) {
+    Carry = 0;
+    if (L_var2 != MIN_32) {
+      L_var_out = L_add_c (L_var1, -L_var2);
+    } else {
+      L_var_out = (Word32) ((UWord32) L_var1 - (UWord32) L_var2);
+      if (L_var1 > 0L) {
+        Overflow = 1;
+        Carry = 0;
+      }
+    }
+  } else {
+    L_var_out = (Word32) ((UWord32) L_var1 - (UWord32) L_var2 - (UWord32) 0X00000001L);
+    L_test = (Word32) ((UWord32) L_var1 - (UWord32) L_var2);
+
+    if ((L_test < 0) && (L_var1 > 0) && (L_var2 < 0)) {
+      Overflow = 1;
+      carry_int = 0;
+    } else if ((L_test > 0) && (L_var1 < 0) && (L_var2 > 0)) {
+      Overflow = 1;
+      carry_int = 1;
+    } else if ((L_test > 0) && ((L_var1 ^ L_var2) > 0)) {
+      Overflow = 0;
+      carry_int = 1;
+    }
+    if (L_test == MIN_32) {
+      Overflow = 1;
+      Carry = carry_int;
+    } else {
+      Carry = carry_int;
+    }
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_negate (Word32 L_var1) {
+  Word32 L_var_out;
+
+  L_var_out = (L_var1 == MIN_32) ? MAX_32 : -L_var1;
+
+  return (L_var_out);
+}
+
+static __inline Word16 mult_r (Word16 var1, Word16 var2) {
+  Word16 var_out;
+  Word32 L_product_arr;
+
+  L_product_arr = (Word32) var1 *(Word32) var2; /* product */
+  L_product_arr += (Word32) 0x00004000L;        /* round */
+  L_product_arr &= (Word32) 0xffff8000L;
+  L_product_arr >>= 15;         /* shift */
+
+  if (L_product_arr & (Word32) 0x00010000L) {   /* sign extend when necessary */
+    L_product_arr |= (Word32) 0xffff0000L;
+  }
+  var_out = saturate (L_product_arr);
+
+  return (var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word32 L_shl (Word32 L_var1, Word16 var2) {
+
+  Word32 L_var_out = 0L;
+
+  if (var2 <= 0) {
+    if (var2 < -32)
+      var2 = -32;
+    var2 = -var2;
+    L_var_out = L_shr (L_var1, var2);
+  } else if (L_var1 != 0) {
+    /* the bits shifted out must all equal the sign bit */
+    if (var2 <= norm_l (L_var1)) {
+      L_var_out = (Word32) ((UWord32) L_var1 << var2);
+    } else {
+      Overflow = 1;
+      L_var_out = (L_var1 < 0) ? MIN_32 : MAX_32;
+    }
+  }
+  return (L_var_out);
+}
+#else
+static __inline Word32 L_shl (Word32 L_var1, Word16 var2) {
+
+  Word32 L_var_out = 0L;
+
+  if (var2 <= 0) {
+    if (var2 < -32)
+      var2 = -32;
+    var2 = -var2;
+    L_var_out = L_shr (L_var1, var2);
+  } else {
+    for (; var2 > 0; var2--) {
+      if (L_var1 > (Word32) 0X3fffffffL) {
+        Overflow = 1;
+        L_var_out = MAX_32;
+        break;
+      } else {
+        if (L_var1 < (Word32) 0xc0000000L) {
+          Overflow = 1;
+          L_var_out = MIN_32;
+          break;
+        }
+      }
+      L_var1 *= 2;
+      L_var_out = L_var1;
+    }
+  }
+  return (L_var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word32 L_shr (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  if (var2 < 0) {
+    if (var2 < -32)
+      var2 = -32;
+    var2 = -var2;
+    L_var_out = L_shl (L_var1, var2);
+  } else {
+    if (var2 >= 31) {
+      L_var_out = (L_var1 < 0L) ? -1 : 0;
+    } else {
+      if (L_var1 < 0) {
+        L_var_out = ~((~L_var1) >> var2);
+      } else {
+        L_var_out = L_var1 >> var2;
+      }
+    }
+  }
+  return (L_var_out);
+}
+
+static __inline Word16 shr_r (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 > 15) {
+    var_out = 0;
+  } else {
+    var_out = shr (var1, var2);
+
+    if (var2 > 0) {
+      if ((var1 & ((Word16) 1 << (var2 - 1))) != 0) {
+        var_out++;
+      }
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 mac_r (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  L_var3 = L_mac (L_var3, var1, var2);
+  L_var3 = L_add (L_var3, (Word32) 0x00008000L);
+  var_out = extract_h (L_var3);
+
+  return (var_out);
+}
+
+static __inline Word16 msu_r (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  L_var3 = L_msu (L_var3, var1, var2);
+  L_var3 = L_add (L_var3, (Word32) 0x00008000L);
+  var_out = extract_h (L_var3);
+
+  return (var_out);
+}
+
+static __inline Word32 L_deposit_h (Word16 var1) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) var1 << 16;
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_deposit_l (Word16 var1) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) var1;
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_shr_r (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  if (var2 > 31) {
+    L_var_out = 0;
+  } else {
+    L_var_out = L_shr (L_var1, var2);
+
+    if (var2 > 0) {
+      if ((L_var1 & ((Word32) 1 << (var2 - 1))) != 0) {
+        L_var_out++;
+      }
+    }
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_abs (Word32 L_var1) {
+  Word32 L_var_out;
+
+  if (L_var1 == MIN_32) {
+    L_var_out = MAX_32;
+  } else {
+    if (L_var1 < 0) {
+      L_var_out = -L_var1;
+    } else {
+      L_var_out = L_var1;
+    }
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_sat (Word32 L_var1) {
+  Word32 L_var_out;
+
+  L_var_out = L_var1;
+
+  if (Overflow) {
+
+    if (Carry) {
+      L_var_out = MIN_32;
+    } else {
+      L_var_out = MAX_32;
+    }
+
+    Carry = 0;
+    Overflow = 0;
+  }
+  return (L_var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word16 norm_s (Word16 var1) {
+  Word16 var_out;
+
+  if (var1 == 0) {
+    var_out = 0;
+  } else {
+    if (var1 == (Word16) 0xffff) {
+      var_out = 15;
+    } else {
+      if (var1 < 0) {
+        var1 = ~var1;
+      }
+      var_out = (Word16) (__builtin_clz ((unsigned int) var1) - (8 * (int) sizeof (unsigned int) - 15));
+    }
+  }
+
+  return (var_out);
+}
+#else
+static __inline Word16 norm_s (Word16 var1) {
+  Word16 var_out;
+
+  if (var1 == 0) {
+    var_out = 0;
+  } else {
+    if (var1 == (Word16) 0xffff) {
+      var_out = 15;
+    } else {
+      if (var1 < 0) {
+        var1 = ~var1;
+      }
+      for (var_out = 0; var1 < 0x4000; var_out++) {
+        var1 <<= 1;
+      }
+    }
+  }
+
+  return (var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word16 div_s (Word16 var1, Word16 var2) {
+  Word16 var_out = 0;
+  Word16 iteration;
+  Word32 L_num;
+  Word32 L_denom;
+
+  if ((var1 > var2) || (var1 < 0) || (var2 < 0)) {
+    printf ("Division Error var1=%d  var2=%d\n", var1, var2);
+    abort ();                   /* exit (0); */
+  }
+  if (var2 == 0) {
+    printf ("Division by 0, Fatal error \n");
+    abort ();                   /* exit (0); */
+  }
+  if (var1 == 0) {
+    var_out = 0;
+  } else {
+    if (var1 == var2) {
+      var_out = MAX_16;
+    } else {
+      L_num = L_deposit_l (var1);
+      L_denom = L_deposit_l (var2);
+
+      for (iteration = 0; iteration < 15; iteration++) {
+        var_out <<= 1;
+        L_num <<= 1;
+
+        if (L_num >= L_denom) {
+          L_num = L_sub (L_num, L_denom);
+          var_out = add (var_out, 1);
+        }
+      }
+    }
+  }
+
+  return (var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word16 norm_l (Word32 L_var1) {
+  Word16 var_out;
+
+  if (L_var1 == 0) {
+    var_out = 0;
+  } else {
+    if (L_var1 == (Word32) 0xffffffffL) {
+      var_out = 31;
+    } else {
+      if (L_var1 < 0) {
+        L_var1 = ~L_var1;
+      }
+      var_out = (Word16) (__builtin_clz ((unsigned int) L_var1) - (8 * (int) sizeof (unsigned int) - 31));
+    }
+  }
+
+  return (var_out);
+}
+#else
+static __inline Word16 norm_l (Word32 L_var1) {
+  Word16 var_out;
+
+  if (L_var1 == 0) {
+    var_out = 0;
+  } else {
+    if (L_var1 == (Word32) 0xffffffffL) {
+      var_out = 31;
+    } else {
+      if (L_var1 < 0) {
+        L_var1 = ~L_var1;
+      }
+      for (var_out = 0; L_var1 < (Word32) 0x40000000L; var_out++) {
+        L_var1 <<= 1;
+      }
+    }
+  }
+
+  return (var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word32 L_mls (Word32 Lv, Word16 v) {
+  Word32 Temp;
+
+  Temp = Lv & (Word32) 0x0000ffff;
+  Temp = Temp * (Word32) v;
+  Temp = L_shr (Temp, (Word16) 15);
+  Temp = L_mac (Temp, v, extract_h (Lv));
+
+  return Temp;
+}
+
+static __inline Word16 div_l (Word32 L_num, Word16 den) {
+  Word16 var_out = (Word16) 0;
+  Word32 L_den;
+  Word16 iteration;
+
+  if (den == (Word16) 0) {
+    printf ("Division by 0 in div_l, Fatal error \n");
+    exit (0);
+  }
+
+  if ((L_num < (Word32) 0) || (den < (Word16) 0)) {
+    printf ("Division Error in div_l, Fatal error \n");
+    exit (0);
+  }
+
+  L_den = L_deposit_h (den);
+
+  if (L_num >= L_den) {
+    return MAX_16;
+  } else {
+    L_num = L_shr (L_num, (Word16) 1);
+    L_den = L_shr (L_den, (Word16) 1);
+    for (iteration = (Word16) 0; iteration < (Word16) 15; iteration++) {
+      var_out = shl (var_out, (Word16) 1);
+      L_num = L_shl (L_num, (Word16) 1);
+      if (L_num >= L_den) {
+        L_num = L_sub (L_num, L_den);
+        var_out = add (var_out, (Word16) 1);
+      }
+    }
+
+    return var_out;
+  }
+}
+
+static __inline Word16 i_mult (Word16 a, Word16 b) {
+#ifdef ORIGINAL_G7231
+  return a * b;
+#else
+  Word32 register c = a * b;
+  return saturate (c);
+#endif
+}
+
+static __inline Word32 L_mult0 (Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) var1 *(Word32) var2;
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_mac0 (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+  Word32 L_product;
+
+  L_product = L_mult0 (var1, var2);
+  L_var_out = L_add (L_var3, L_product);
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_msu0 (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_var_out;
+  Word32 L_product;
+
+  L_product = L_mult0 (var1, var2);
+  L_var_out = L_sub (L_var3, L_product);
+
+  return (L_var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Operators of enh1632.c                                                  |
+ |___________________________________________________________________________|
+*/
+static __inline Word16 lshl (Word16 var1, Word16 var2) {
+  Word16 var_out = 0;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    var_out = lshr (var1, var2);
+
+  } else {
+    if (var2 == 0 || var1 == 0) {
+      var_out = var1;
+    } else if (var2 >= 16) {
+      var_out = 0;
+    } else {
+      var_out = var1 << var2;
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 lshr (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    var_out = lshl (var1, var2);
+
+  } else {
+    if (var2 == 0 || var1 == 0) {
+      var_out = var1;
+    } else if (var2 >= 16) {
+      var_out = 0;
+    } else {
+      var_out = var1 >> 1;
+      var_out = var_out & 0x7fff;
+      var_out = var_out >> (var2 - 1);
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word32 L_lshl (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out = 0;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L_var_out = L_lshr (L_var1, var2);
+
+  } else {
+    if (var2 == 0 || L_var1 == 0) {
+      L_var_out = L_var1;
+    } else if (var2 >= 32) {
+      L_var_out = 0;
+    } else {
+      L_var_out = L_var1 << var2;
+    }
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_lshr (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L_var_out = L_lshl (L_var1, var2);
+
+  } else {
+    if (var2 == 0 || L_var1 == 0) {
+      L_var_out = L_var1;
+    } else if (var2 >= 32) {
+      L_var_out = 0;
+    } else {
+      L_var_out = L_var1 >> 1;
+      L_var_out = L_var_out & 0x7fffffff;
+      L_var_out = L_var_out >> (var2 - 1);
+    }
+  }
+
+  return (L_var_out);
+}
+
+static __inline Word16 shl_r (Word16 var1, Word16 var2) {
+  Word16 var_out;
+
+  if (var2 >= 0) {
+    var_out = shl (var1, var2);
+
+  } else {
+    var2 = -var2;
+    var_out = shr_r (var1, var2);
+
+  }
+
+  return (var_out);
+}
+
+static __inline Word32 L_shl_r (Word32 L_var1, Word16 var2) {
+  Word32 var_out;
+
+  if (var2 >= 0) {
+    var_out = L_shl (L_var1, var2);
+
+  } else {
+    var2 = -var2;
+    var_out = L_shr_r (L_var1, var2);
+
+  }
+
+  return (var_out);
+}
+
+static __inline Word16 rotr (Word16 var1, Word16 var2, Word16 * var3) {
+  Word16 var_out;
+
+  *var3 = s_and (var1, 0x1);
+  var_out = s_or (lshr (var1, 1), lshl (var2, 15));
+
+  return (var_out);
+}
+
+static __inline Word16 rotl (Word16 var1, Word16 var2, Word16 * var3) {
+  Word16 var_out;
+
+  *var3 = lshr (var1, 15);
+
+  var_out = s_or (lshl (var1, 1), s_and (var2, 0x1));
+
+  return (var_out);
+}
+
+static __inline Word32 L_rotr (Word32 L_var1, Word16 var2, Word16 * var3) {
+  Word32 L_var_out;
+
+  *var3 = s_and (extract_l (L_var1), 0x1);
+
+  L_var_out = L_or (L_lshr (L_var1, 1), L_lshl (L_deposit_l (var2), 31));
+
+  return (L_var_out);
+}
+
+static __inline Word32 L_rotl (Word32 L_var1, Word16 var2, Word16 * var3) {
+  Word32 L_var_out;
+
+  *var3 = extract_l (L_lshr (L_var1, 31));
+
+  L_var_out = L_or (L_lshl (L_var1, 1), L_deposit_l (s_and (var2, 0x1)));
+
+  return (L_var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Operators of enh40.c                                                    |
+ |___________________________________________________________________________|
+*/
+static __inline Word40 L40_shl (Word40 L40_var1, Word16 var2) {
+
+  Word40 L40_var_out;
+  Word40 L40_constant = L40_set (0xc000000000);
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L40_var_out = L40_shr (L40_var1, var2);
+
+  }
+
+  else {
+    L40_var_out = L40_var1;
+
+    for (; var2 > 0; var2--) {
+      if (L40_var_out > 0x003fffffffff) {
+        L40_var_out = L40_OVERFLOW_OCCURED (L40_var_out);
+        break;
+      }
+
+      else if (L40_var_out < L40_constant) {
+        L40_var_out = L40_UNDERFLOW_OCCURED (L40_var_out);
+        break;
+      }
+
+      else {
+        L40_var_out = L40_var_out << 1;
+      }
+    }
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_shr (Word40 L40_var1, Word16 var2) {
+  Word40 L40_var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L40_var_out = L40_shl (L40_var1, var2);
+
+  } else {
+    L40_var_out = L40_var1 >> var2;
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_negate (Word40 L40_var1) {
+  Word40 L40_var_out;
+
+  L40_var_out = L40_add (~L40_var1, 0x01);
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_add (Word40 L40_var1, Word40 L40_var2) {
+  Word40 L40_var_out;
+
+  L40_var_out = L40_var1 + L40_var2;
+
+  if ((((L40_var1 & 0x8000000000) >> 39) != 0)
+      && (((L40_var2 & 0x8000000000) >> 39) != 0)
+      && (((L40_var_out & 0x8000000000) >> 39) == 0)) {
+    L40_var_out = L40_UNDERFLOW_OCCURED (L40_var_out);
+
+  } else if ((((L40_var1 & 0x8000000000) >> 39) == 0)
+             && (((L40_var2 & 0x8000000000) >> 39) == 0)
+             && (((L40_var_out & 0x8000000000) >> 39) != 0)) {
+    L40_var_out = L40_OVERFLOW_OCCURED (L40_var_out);
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_sub (Word40 L40_var1, Word40 L40_var2) {
+  Word40 L40_var_out;
+
+  L40_var_out = L40_var1 - L40_var2;
+
+  if ((((L40_var1 & 0x8000000000) >> 39) != 0)
+      && (((L40_var2 & 0x8000000000) >> 39) == 0)
+      && (((L40_var_out & 0x8000000000) >> 39) == 0)) {
+    L40_var_out = L40_UNDERFLOW_OCCURED (L40_var_out);
+
+  } else if ((((L40_var1 & 0x8000000000) >> 39) == 0)
+             && (((L40_var2 & 0x8000000000) >> 39) != 0)
+             && (((L40_var_out & 0x8000000000) >> 39) != 0)) {
+    L40_var_out = L40_OVERFLOW_OCCURED (L40_var_out);
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_abs (Word40 L40_var1) {
+  Word40 L40_var_out;
+
+  if (L40_var1 < 0) {
+    L40_var_out = L40_negate (L40_var1);
+
+  } else {
+    L40_var_out = L40_var1;
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_max (Word40 L40_var1, Word40 L40_var2) {
+  Word40 L40_var_out;
+
+  if (L40_var1 < L40_var2)
+    L40_var_out = L40_var2;
+  else
+    L40_var_out = L40_var1;
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_min (Word40 L40_var1, Word40 L40_var2) {
+  Word40 L40_var_out;
+
+  if (L40_var1 < L40_var2)
+    L40_var_out = L40_var1;
+  else
+    L40_var_out = L40_var2;
+
+  return (L40_var_out);
+}
+
+static __inline Word32 L_saturate40 (Word40 L40_var1) {
+  Word32 L_var_out;
+
+  Word40 UNDER_L40_var2 = (Word40) ~ ((((Word40) 1) << 31) - (Word40) 1);
+  Word40 OVER_L40_var2 = (Word40) ((((Word40) 1) << 31) - (Word40) 1);
+
+  if (L40_var1 < UNDER_L40_var2) {
+    L40_var1 = UNDER_L40_var2;
+    Overflow = 1;
+  }
+
+  if (L40_var1 > OVER_L40_var2) {
+    L40_var1 = OVER_L40_var2;
+    Overflow = 1;
+  }
+
+  L_var_out = L_Extract40 (L40_var1);
+
+  return (L_var_out);
+}
+
+static __inline void Mpy_32_16_ss (Word32 L_var1, Word16 var2, Word32 * L_varout_h, UWord16 * varout_l) {
+  Word16 var1_h;
+  UWord16 uvar1_l;
+  Word40 L40_var1;
+
+  if ((L_var1 == (Word32) 0x80000000)
+      && (var2 == (Word16) 0x8000)) {
+    *L_varout_h = 0x7fffffff;
+    *varout_l = (UWord16) 0xffff;
+
+  } else {
+    uvar1_l = extract_l (L_var1);
+    var1_h = extract_h (L_var1);
+
+    /* Below line can not overflow, so we can use << instead of L40_shl.  */
+    L40_var1 = ((Word40) ((Word32) var2 * (Word32) uvar1_l)) << 1;
+
+    *varout_l = Extract40_L (L40_var1);
+
+    L40_var1 = L40_shr (L40_var1, 16);
+    L40_var1 = L40_mac (L40_var1, var2, var1_h);
+
+    *L_varout_h = L_Extract40 (L40_var1);
+
+  }
+
+  return;
+}
+
+static __inline void Mpy_32_32_ss (Word32 L_var1, Word32 L_var2, Word32 * L_varout_h, UWord32 * L_varout_l) {
+  UWord16 uvar1_l, uvar2_l;
+  Word16 var1_h, var2_h;
+  Word40 L40_var1;
+
+  if ((L_var1 == (Word32) 0x80000000)
+      && (L_var2 == (Word32) 0x80000000)) {
+    *L_varout_h = 0x7fffffff;
+    *L_varout_l = (UWord32) 0xffffffff;
+
+  } else {
+
+    uvar1_l = extract_l (L_var1);
+    var1_h = extract_h (L_var1);
+    uvar2_l = extract_l (L_var2);
+    var2_h = extract_h (L_var2);
+
+    /* Below line can not overflow, so we can use << instead of L40_shl.  */
+    L40_var1 = ((Word40) ((UWord32) uvar2_l * (UWord32) uvar1_l)) << 1;
+
+    *L_varout_l = 0x0000ffff & L_Extract40 (L40_var1);
+
+    L40_var1 = L40_shr (L40_var1, 16);
+    L40_var1 = L40_add (L40_var1, ((Word40) ((Word32) var2_h * (Word32) uvar1_l)) << 1);
+    L40_var1 = L40_add (L40_var1, ((Word40) ((Word32) var1_h * (Word32) uvar2_l)) << 1);
+    *L_varout_l |= (L_Extract40 (L40_var1)) << 16;
+
+    L40_var1 = L40_shr (L40_var1, 16);
+    L40_var1 = L40_mac (L40_var1, var1_h, var2_h);
+
+    *L_varout_h = L_Extract40 (L40_var1);
+
+  }
+
+  return;
+}
+
+static __inline Word40 L40_lshl (Word40 L40_var1, Word16 var2) {
+  Word40 L40_var_out;
+
+  if (var2 <= 0) {
+    var2 = -var2;
+    L40_var_out = L40_lshr (L40_var1, var2);
+
+  } else {
+    if (var2 >= 40)
+      L40_var_out = 0x0000000000;
+    else
+      L40_var_out = L40_var1 << var2;
+
+    L40_var_out = L40_set (L40_var_out);
+
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_lshr (Word40 L40_var1, Word16 var2) {
+  Word40 L40_var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L40_var_out = L40_lshl (L40_var1, var2);
+
+  } else {
+    if (var2 >= 40)
+      L40_var_out = 0x0000000000;
+    else
+      L40_var_out = (L40_var1 & 0xffffffffff) >> var2;
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word16 norm_L40 (Word40 L40_var1) {
+  Word16 var_out;
+
+  var_out = 0;
+
+  if (L40_var1 != 0) {
+    while ((L40_var1 > (Word32) 0x80000000L)
+           && (L40_var1 < (Word32) 0x7fffffffL)) {
+
+      L40_var1 = L40_shl (L40_var1, 1);
+      var_out++;
+
+    }
+
+    while ((L40_var1 < (Word32) 0x80000000L)
+           || (L40_var1 > (Word32) 0x7fffffffL)) {
+
+      L40_var1 = L40_shl (L40_var1, -1);
+      var_out--;
+
+    }
+  }
+
+  return (var_out);
+}
+
+static __inline Word40 L40_shr_r (Word40 L40_var1, Word16 var2) {
+  Word40 L40_var_out;
+
+  if (var2 > 39) {
+    L40_var_out = 0;
+
+  } else {
+    L40_var_out = L40_shr (L40_var1, var2);
+
+    if (var2 > 0) {
+      if ((L40_var1 & ((Word40) 1 << (var2 - 1))) != 0) {
+        /* below line can not generate overflows on 40-bit */
+        L40_var_out++;
+      }
+    }
+  }
+
+  return (L40_var_out);
+}
+
+static __inline Word40 L40_shl_r (Word40 L40_var1, Word16 var2) {
+  Word40 L40_var_out;
+
+  if (var2 >= 0) {
+    L40_var_out = L40_shl (L40_var1, var2);
+
+  } else {
+    var2 = -var2;
+    L40_var_out = L40_shr_r (L40_var1, var2);
+
+  }
+
+  return (L40_var_out);
+}
+
+
+#ifdef ENH_64_BIT_OPERATOR
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Operators of enh64.c                                                    |
+ |___________________________________________________________________________|
+*/
+static __inline Word64 W_add_nosat (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  L64_var_out = L64_var1 + L64_var2;
+
+
+  return L64_var_out;
+}
+
+static __inline Word64 W_sub_nosat (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  L64_var_out = L64_var1 - L64_var2;
+
+
+  return L64_var_out;
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word64 W_shl (Word64 L64_var1, Word16 var2) {
+
+  Word64 L64_var_out = 0LL;
+
+  if (var2 <= 0) {
+    if (var2 < -64)
+      var2 = -64;
+    var2 = -var2;
+    L64_var_out = L64_var1 >> var2;
+  } else if (L64_var1 != 0) {
+    /* the bits shifted out must all equal the sign bit */
+    if (var2 <= W_norm (L64_var1)) {
+      L64_var_out = (Word64) ((UWord64) L64_var1 << var2);
+    } else {
+      Overflow = 1;
+      L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+    }
+  }
+
+  return (L64_var_out);
+}
+#else
+static __inline Word64 W_shl (Word64 L64_var1, Word16 var2) {
+
+  Word64 L64_var_out = 0LL;
+
+  if (var2 <= 0) {
+    if (var2 < -64)
+      var2 = -64;
+    var2 = -var2;
+    L64_var_out = L64_var1 >> var2;
+  }
+  else {
+    for (; var2 > 0; var2--) {
+      if (L64_var1 > (Word64) 0X3fffffffffffffffLL) {
+        Overflow = 1;
+        L64_var_out = (Word64) 0X7fffffffffffffffLL;
+        break;
+      }
+      else {
+        if (L64_var1 < (Word64) 0xc000000000000000LL) {
+          Overflow = 1;
+          L64_var_out = (Word64)0x8000000000000000LL;
+          break;
+        }
+      }
+      L64_var1 *= 2;
+      L64_var_out = L64_var1;
+    }
+  }
+
+//  BASOP_CHECK();
+
+  return (L64_var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word64 W_shr (Word64 L64_var1, Word16 var2) {
+  Word64 L64_var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L64_var_out  = W_shl (L64_var1, var2);
+
+
+  } else {
+    L64_var_out = L64_var1 >> var2;
+  }
+
+
+  return (L64_var_out);
+}
+
+static __inline Word64 W_shl_nosat (Word64 L64_var1, Word16 var2) {
+
+  Word64 L64_var_out = 0LL;
+
+  if (var2 <= 0) {
+    var2 = -var2;
+    L64_var_out = L64_var1 >> var2;
+  }
+  else {
+    L64_var_out = L64_var1 << var2;
+  }
+
+//  BASOP_CHECK ();
+
+  return (L64_var_out);
+}
+
+static __inline Word64 W_shr_nosat (Word64 L64_var1, Word16 var2) {
+  Word64 L64_var_out;
+
+  if (var2 < 0) {
+    var2 = -var2;
+    L64_var_out  =  L64_var1 << var2;
+
+  } else {
+    L64_var_out = L64_var1 >> var2;
+  }
+
+
+  return (L64_var_out);
+}
+
+static __inline Word64 W_mac_32_16 (Word64  L64_var1, Word32 L_var2, Word16 var3) {
+  Word64  L64_var_out = ((Word64) L_var2*var3) << 1;
+  L64_var_out += L64_var1;
+  return L64_var_out;
+}
+
+static __inline Word64 W_msu_32_16(Word64  L64_var1, Word32 L_var2, Word16 var3) {
+  Word64  L64_var_out = ((Word64 )L_var2*var3) << 1;
+  L64_var_out = L64_var1 - L64_var_out;
+  return L64_var_out;
+}
+
+static __inline Word64 W_mult_32_16(Word32 L_var1, Word16 var2) {
+  Word64  L64_var_out = ((Word64 )L_var1*var2) << 1;
+  return L64_var_out;
+}
+
+static __inline Word64 W_mult0_16_16(Word16 var1, Word16 var2) {
+  Word64  L64_var_out = (Word64 )var1*var2;
+  return L64_var_out;
+}
+
+static __inline Word64 W_mac0_16_16(Word64 L64_var1, Word16 var2, Word16 var3) {
+  Word64  L64_var_out = (Word64 )var2*var3;
+  L64_var_out += L64_var1;
+  return L64_var_out;
+}
+
+static __inline Word64 W_msu0_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
+  Word64  L64_var_out = (Word64) var2*var3;
+  L64_var_out = L64_var1 - L64_var_out;
+  return L64_var_out;
+}
+
+static __inline Word32 W_sat_l (Word64 L64_var) {
+  Word32 L_var_out;
+
+  if (L64_var > 0x7FFFFFFF) {
+    L_var_out = 0x7FFFFFFF;
+  }
+  else if (L64_var < (int)0x80000000) {
+    L_var_out = 0x80000000;
+  }
+  else {
+    L_var_out = (Word32)L64_var;
+  }
+
+
+  return L_var_out;
+}
+
+static __inline Word32 W_sat_m (Word64 L64_var) {
+  Word32 L_var_out;
+
+  L64_var = L64_var >> 16;
+  L_var_out = W_sat_l (L64_var);
+
+
+  return L_var_out;
+}
+
+static __inline Word64 W_deposit32_l (Word32 L_var1) {
+  Word64 L64_var_out;
+
+  L64_var_out = (Word64) L_var1;
+
+
+  return (L64_var_out);
+}
+
+static __inline Word64 W_deposit32_h (Word32 L_var1) {
+  Word64 L64_var_out;
+
+  L64_var_out = (Word64) L_var1 << 32;
+
+
+  return (L64_var_out);
+}
+
+static __inline Word32 W_extract_l (Word64 L64_var1) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) L64_var1;
+
+
+  return (L_var_out);
+}
+
+static __inline Word32 W_extract_h (Word64 L64_var1) {
+  Word32 L_var_out;
+
+  L_var_out = (Word32) (L64_var1 >> 32);
+
+
+  return (L_var_out);
+}
+
+static __inline Word64 W_mult_16_16 (Word16 var1, Word16 var2) {
+  Word64  L64_var_out = ((Word64) var1*var2) << 1;
+  return L64_var_out;
+}
+
+static __inline Word64 W_mac_16_16 (Word64 L64_acc, Word16 var1, Word16 var2) {
+  Word64  L64_var_out = ((Word64) var1*var2) << 1;
+  L64_acc = L64_acc + L64_var_out;
+
+  return L64_acc;
+}
+
+static __inline Word64 W_msu_16_16 (Word64 L64_var1, Word16 var2, Word16 var3) {
+  Word64  L64_var_out = ((Word64)var2*var3) << 1;
+  L64_var_out = L64_var1 - L64_var_out;
+  return L64_var_out;
+}
+
+static __inline Word32 W_shl_sat_l (Word64 L64_var, Word32 n) {
+  Word32 L_result;
+  Word64 d_var_64;
+
+  d_var_64 = W_shl (L64_var, n);
+  L_result = W_sat_l (d_var_64);
+
+
+  return L_result;
+}
+
+static __inline Word32 W_round48_L (Word64 L64_var1) {
+  Word64 L64_var_out;
+  Word32 L_result;
+
+  Word64 L64_var2 = 0x80000000;
+  Word64 L64_MIN  = 0x8000000000000000LL;
+  Word64 L64_MAX  = 0x7FFFFFFFFFFFFFFFLL;
+
+  L64_var1  = W_shl (L64_var1, 16);
+
+  L64_var_out = (Word64) ((UWord64) L64_var1 + (UWord64) L64_var2);
+
+  if ( ( (L64_var1 ^ L64_var2) & L64_MIN) == 0) {
+    if ( (L64_var_out ^ L64_var1) & L64_MIN) {
+      L64_var_out = (L64_var1 < 0) ? L64_MIN : L64_MAX;
+      Overflow = 1;
+    }
+  }
+  L_result = W_extract_h (L64_var_out);
+
+  return (L_result);
+}
+
+static __inline Word16 W_round32_s (Word64 L64_var1) {
+  Word64 L64_var_out;
+  Word32 L_var;
+  Word16 var_out;
+
+
+  Word64 L64_var2 = 0x800000000000LL;
+  Word64 L64_MIN  = 0x8000000000000000LL;
+  Word64 L64_MAX  = 0x7FFFFFFFFFFFFFFFLL;
+
+  L64_var1  = W_shl (L64_var1, 16);
+  L64_var_out = (Word64) ((UWord64) L64_var1 + (UWord64) L64_var2);
+
+  if (((L64_var1 ^ L64_var2) & L64_MIN) == 0) {
+    if ((L64_var_out ^ L64_var1) & L64_MIN) {
+      L64_var_out = (L64_var1 < 0) ? L64_MIN : L64_MAX;
+      Overflow = 1;
+    }
+  }
+  L_var = W_extract_h (L64_var_out);
+  var_out = extract_h (L_var);
+
+  return (var_out);
+}
+
+#ifdef BASOP_BUILTIN
+static __inline Word16 W_norm (Word64 L64_var1) {
+  Word16 var_out;
+  if (L64_var1 == 0) {
+    var_out = 0;
+  }
+  else {
+    if (L64_var1 == (Word64) 0xffffffffffffffffLL) {
+      var_out = 63;
+    }
+    else {
+      if (L64_var1 < 0) {
+        L64_var1 = ~L64_var1;
+      }
+      var_out = (Word16) (__builtin_clzll ((unsigned long long) L64_var1) - (8 * (int) sizeof (unsigned long long) - 63));
+    }
+  }
+  return (var_out);
+}
+#else
+static __inline Word16 W_norm (Word64 L64_var1) {
+  Word16 var_out;
+  if (L64_var1 == 0) {
+    var_out = 0;
+  }
+  else {
+    if (L64_var1 == (Word64) 0xffffffffffffffffLL) {
+      var_out = 63;
+    }
+    else {
+      if (L64_var1 < 0) {
+        L64_var1 = ~L64_var1;
+      }
+      for (var_out = 0; L64_var1 < (Word64) 0x4000000000000000LL; var_out++) {
+        L64_var1 <<= 1;
+      }
+    }
+  }
+  return (var_out);
+}
+#endif /* BASOP_BUILTIN */
+
+#ifdef BASOP_BUILTIN
+static __inline Word64 W_add (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  if (__builtin_add_overflow (L64_var1, L64_var2, &L64_var_out)) {
+    L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+    Overflow = 1;
+  }
+
+  return L64_var_out;
+}
+#else
+static __inline Word64 W_add (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  L64_var_out = (Word64) ((UWord64) L64_var1 + (UWord64) L64_var2);
+
+    if (((L64_var1 ^ L64_var2) & MIN_64) == 0) {
+        if ((L64_var_out ^ L64_var1) & MIN_64) {
+            L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+            Overflow = 1;
+        }
+    }
+
+  return L64_var_out;
+}
+#endif /* BASOP_BUILTIN */
+
+#ifdef BASOP_BUILTIN
+static __inline Word64 W_sub (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  if (__builtin_sub_overflow (L64_var1, L64_var2, &L64_var_out)) {
+    L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+    Overflow = 1;
+  }
+
+  return L64_var_out;
+}
+#else
+static __inline Word64 W_sub (Word64 L64_var1, Word64 L64_var2) {
+  Word64 L64_var_out;
+
+  L64_var_out = (Word64) ((UWord64) L64_var1 - (UWord64) L64_var2);
+
+    if (((L64_var1 ^ L64_var2) & MIN_64) != 0) {
+        if ((L64_var_out ^ L64_var1) & MIN_64) {
+            L64_var_out = (L64_var1 < 0) ? MIN_64 : MAX_64;
+            Overflow = 1;
+        }
+    }
+
+  return L64_var_out;
+}
+#endif /* BASOP_BUILTIN */
+
+static __inline Word64 W_neg (Word64 L64_var1) {
+    Word64 L64_var_out;
+
+  if (L64_var1 == MIN_64) {
+    L64_var_out = MAX_64;
+        Overflow = 1;
+  }
+  else {
+    L64_var_out = -L64_var1;
+  }
+
+
+    return (L64_var_out);
+
+}
+
+static __inline Word64 W_abs (Word64 L64_var1) {
+    Word64 L64_var_out;
+
+    if (L64_var1 == MIN_64) {
+        L64_var_out = MAX_64;
+    Overflow = 1;
+    }
+    else {
+        if (L64_var1 < 0) {
+            L64_var_out = -L64_var1;
+        }
+        else {
+            L64_var_out = L64_var1;
+        }
+    }
+
+
+    return (L64_var_out);
+}
+
+static __inline Word64 W_mult_32_32(Word32 L_var1, Word32 L_var2) {
+  Word64  L64_var_out;
+
+  if ((L_var1 == MIN_32) && (L_var2 == MIN_32)) {
+    L64_var_out = MAX_64;
+    Overflow = 1;
+  }
+  else {
+    L64_var_out = ((Word64 )L_var1*L_var2) << 1;
+  }
+
+  return L64_var_out;
+}
+
+static __inline Word64 W_mult0_32_32 (Word32 L_var1, Word32 L_var2) {
+  Word64  L64_var_out;
+
+  L64_var_out = (Word64) L_var1*L_var2;
+
+
+  return L64_var_out;
+}
+
+static __inline UWord64 W_lshl (UWord64 L64_var1, Word16 var2) {
+
+  UWord64 L64_var_out = 0LL;
+
+  if (var2 < 0) {
+    L64_var_out = L64_var1 >> (-var2);
+  }
+  else {
+    L64_var_out = L64_var1 << var2 ;
+  }
+
+  return (L64_var_out);
+}
+
+static __inline UWord64 W_lshr (UWord64 L64_var1, Word16 var2) {
+
+  UWord64 L64_var_out = 0LL;
+
+  if (var2 < 0) {
+    L64_var_out = L64_var1 << (-var2);
+  }
+  else {
+    L64_var_out = L64_var1 >> var2 ;
+  }
+
+  return (L64_var_out);
+}
+
+static __inline Word32 W_round64_L (Word64 L64_var1) {
+  Word64 L64_var_out;
+  Word32 L_result;
+
+
+  Word64 L64_tmp = 0x80000000;
+  L64_var_out = W_add (L64_var1, L64_tmp);
+  L_result = W_extract_h (L64_var_out);
+
+
+  return (L_result);
+}
+#endif /* ENH_64_BIT_OPERATOR */
+
+
+#ifdef ENH_32_BIT_OPERATOR
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Operators of enh32.c                                                    |
+ |___________________________________________________________________________|
+*/
+static __inline Word32 Mpy_32_16_1 (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out = W_sat_m (W_mult_32_16 (L_var1, var2) );
+    return L_var_out;
+}
+
+static __inline Word32 Mpy_32_16_r (Word32 L_var1, Word16 var2) {
+  Word32 L_var_out = W_round48_L (W_mult_32_16 (L_var1, var2 ) );
+  return L_var_out;
+}
+
+static __inline Word32 Mpy_32_32 (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word64 L64_var1;
+
+  L64_var1 = ((Word64)L_var1 * L_var2);
+  L64_var1 = W_shl (L64_var1, 1);
+  L_var_out = W_extract_h (L64_var1 );
+    return L_var_out;
+}
+
+static __inline Word32 Mpy_32_32_r (Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+  Word64 L64_var1;
+
+  L64_var1 = ((Word64) L_var1 * L_var2);
+  L64_var1 = W_shr (L64_var1, 15);
+  L_var_out = W_round48_L (L64_var1 );
+    return L_var_out;
+}
+
+static __inline Word32 Madd_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_16_1 (L_var1, var2);
+  L_var_out = L_add (L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Madd_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_16_r (L_var1, var2);
+  L_var_out = L_add (L_var3, L_var_out);
+
+    return L_var_out;
+}
+
+static __inline Word32 Msub_32_16 (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_16_1 (L_var1, var2);
+  L_var_out = L_sub(L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Msub_32_16_r (Word32 L_var3, Word32 L_var1, Word16 var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_16_r (L_var1, var2);
+  L_var_out = L_sub (L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Madd_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_32 (L_var1, L_var2);
+  L_var_out = L_add (L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Madd_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_32_r (L_var1, L_var2);
+  L_var_out = L_add (L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Msub_32_32 (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_32 (L_var1, L_var2);
+  L_var_out = L_sub (L_var3, L_var_out);
+
+  return L_var_out;
+}
+
+static __inline Word32 Msub_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
+  Word32 L_var_out;
+
+  L_var_out = Mpy_32_32_r (L_var1, L_var2);
+  L_var_out = L_sub (L_var3, L_var_out);
+
+  return L_var_out;
+}
+#endif /* ENH_32_BIT_OPERATOR */
+
+
+#endif /* _BASOP_INLINE_H */
+
+
+/* end of file */
@@ -20,9 +20,9 @@
 
 #if (WMOPS)
 
-extern BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
 
-extern int currCounter;
+extern BASOP_TLS int currCounter;
 
 #endif /* if WMOPS */
 
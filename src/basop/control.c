@@ -21,9 +21,9 @@
 #include "stl.h"
 
 #ifdef WMOPS
-int funcId_where_last_call_to_else_occurred;
-long funcid_total_wmops_at_last_call_to_else;
-int call_occurred = 1;
+BASOP_TLS int funcId_where_last_call_to_else_occurred;
+BASOP_TLS long funcid_total_wmops_at_last_call_to_else;
+BASOP_TLS int call_occurred = 1;
 #endif
 
 #ifdef CONTROL_CODE_OPS
@@ -29,8 +29,8 @@
  *
  *****************************************************************************/
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 
   /* Technical note :
    * The following 3 variables are only used for correct complexity
@@ -47,9 +47,9 @@ extern int currCounter;
    *     ...
    *   }
    */
-extern int funcId_where_last_call_to_else_occurred;
-extern long funcid_total_wmops_at_last_call_to_else;
-extern int call_occurred;
+extern BASOP_TLS int funcId_where_last_call_to_else_occurred;
+extern BASOP_TLS long funcid_total_wmops_at_last_call_to_else;
+extern BASOP_TLS int call_occurred;
 #endif /* ifdef WMOPS */
 
 
@@ -32,6 +32,11 @@
                         L_mls() weight of 5.
                         div_l() weight of 32.
                         i_mult() weight of 3.
+   17 Oct 26   v2.4     Vector operators (enhvec.c), weight 1 per element.
+   17 Oct 26   v2.4     Counters thread-local with BASOP_THREADS; WMOPS_merge()
+                        and WMOPS_output_merged() for the reports of several
+                        threads. The frame rate (setFrameRate()) is
+                        shared by all the threads.
   ============================================================================
 */
 
@@ -48,14 +53,22 @@
 #include <string.h>
 #include "stl.h"
 
+#if defined(WMOPS) && defined(BASOP_THREADS)
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
 #ifdef WMOPS
-static double frameRate = FRAME_RATE;   /* default value : 10 ms */
+static double frameRate = FRAME_RATE;   /* default value : 10 ms; shared by all the threads */
 #endif /* ifdef WMOPS */
 
 #ifdef WMOPS
 /* Global counter variable for calculation of complexity weight */
-BASIC_OP multiCounter[MAXCOUNTERS];
-int currCounter = 0;            /* Zero equals global counter */
+BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+BASOP_TLS int currCounter = 0;            /* Zero equals global counter */
 #endif /* ifdef WMOPS */
 
 #ifdef WMOPS
@@ -170,6 +183,14 @@ char *BasicOperationList[] = {
   , "UL_deposit_l"  
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR
+  , "L_dot_v"
+  , "L_mac_v"
+  , "norm_l_v"
+  , "scale_v"
+  , "L_conv_v"
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   , "LT_16"   
   , "GT_16"   
@@ -289,6 +310,15 @@ const BASIC_OP op_weight = {
   , 1
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR
+  /* per element (per product for L_conv_v) */
+  , 1
+  , 1
+  , 1
+  , 1
+  , 1
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   , 1   
   , 1   
@@ -321,19 +351,42 @@ Word32 DeltaWeightedOperation (void);
 /* Counters for separating counting for different objects */
 
 
-static int maxCounter = 0;
-static char *objectName[MAXCOUNTERS + 1];
+static BASOP_TLS int maxCounter = 0;
+static BASOP_TLS char *objectName[MAXCOUNTERS + 1];
 
-static Word16 fwc_corr[MAXCOUNTERS + 1];
-static long int nbTimeObjectIsCalled[MAXCOUNTERS + 1];
+static BASOP_TLS Word16 fwc_corr[MAXCOUNTERS + 1];
+static BASOP_TLS long int nbTimeObjectIsCalled[MAXCOUNTERS + 1];
 
 #define NbFuncMax  1024
 
-static Word16 funcid[MAXCOUNTERS], nbframe[MAXCOUNTERS];
-static Word32 glob_wc[MAXCOUNTERS], wc[MAXCOUNTERS][NbFuncMax];
-static float total_wmops[MAXCOUNTERS];
-
-static Word32 LastWOper[MAXCOUNTERS];
+static BASOP_TLS Word16 funcid[MAXCOUNTERS], nbframe[MAXCOUNTERS];
+static BASOP_TLS Word32 glob_wc[MAXCOUNTERS], wc[MAXCOUNTERS][NbFuncMax];
+static BASOP_TLS float total_wmops[MAXCOUNTERS];
+
+static BASOP_TLS Word32 LastWOper[MAXCOUNTERS];
+
+/* Report merged from the counters of the threads (WMOPS_merge()), in WMOPS */
+static int mergedMax = -1;
+static char *mergedName[MAXCOUNTERS];
+static long int mergedFrames[MAXCOUNTERS], mergedCalls[MAXCOUNTERS];
+static Word16 mergedFuncs[MAXCOUNTERS];
+static float mergedTotal[MAXCOUNTERS], mergedWorst[MAXCOUNTERS];
+static float mergedWc[MAXCOUNTERS][NbFuncMax];
+
+#ifdef BASOP_THREADS
+#ifdef _WIN32
+static SRWLOCK mergeLock = SRWLOCK_INIT;
+#define MERGE_LOCK()   AcquireSRWLockExclusive (&mergeLock)
+#define MERGE_UNLOCK() ReleaseSRWLockExclusive (&mergeLock)
+#else
+static pthread_mutex_t mergeLock = PTHREAD_MUTEX_INITIALIZER;
+#define MERGE_LOCK()   pthread_mutex_lock (&mergeLock)
+#define MERGE_UNLOCK() pthread_mutex_unlock (&mergeLock)
+#endif
+#else /* ifdef BASOP_THREADS */
+#define MERGE_LOCK()
+#define MERGE_UNLOCK()
+#endif /* ifdef BASOP_THREADS */
 #endif /* ifdef WMOPS */
 
 
@@ -370,6 +423,7 @@ int getCounterId (char *objectNameArg) {
   return maxCounter;
 
 #else /* ifdef WMOPS */
+  (void) objectNameArg;
   return 0;                     /* Dummy */
 
 #endif /* ifdef WMOPS */
@@ -398,6 +452,8 @@ void setCounter (int counterId) {
   }
   currCounter = counterId;
   call_occurred = 1;
+#else /* ifdef WMOPS */
+  (void) counterId;
 #endif /* ifdef WMOPS */
 }
 
@@ -410,6 +466,8 @@ void incrementNbTimeObjectIsCalled (int counterId) {
     return;
   }
   nbTimeObjectIsCalled[counterId]++;
+#else /* ifdef WMOPS */
+  (void) counterId;
 #endif /* ifdef WMOPS */
 }
 
@@ -587,6 +645,9 @@ void WMOPS_output (Word16 dtx_mode) {
   }
   fprintf (stdout, " (%d frames)\n", nbframe[currCounter]);
 
+#else /* ifdef WMOPS */
+  (void) dtx_mode;
+
 #endif /* ifdef WMOPS */
 }
 
@@ -618,6 +679,11 @@ void WMOPS_output_avg (Word16 dtx_mode, Word32 * tot_wm, Word16 * num_frames) {
   }
   fprintf (stdout, " (%d frames)\n", nbframe[currCounter]);
 
+#else /* ifdef WMOPS */
+  (void) dtx_mode;
+  (void) tot_wm;
+  (void) num_frames;
+
 #endif /* ifdef WMOPS */
 }
 
@@ -753,6 +819,105 @@ void generic_WMOPS_output (Word16 dtx_mode, char *test_file_name) {
 
   currCounter = saved_value;
 
+#else /* ifdef WMOPS */
+  (void) dtx_mode;
+  (void) test_file_name;
+
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_merge (void) {
+#if WMOPS
+  int saved_value, m;
+  Word16 i;
+  Word32 tot;
+  float worst;
+
+  saved_value = currCounter;
+  MERGE_LOCK ();
+
+  for (currCounter = 0; currCounter <= maxCounter; currCounter++) {
+    /* the global counter (0) goes to the global counter, the others to the counter of the same name */
+    m = 0;
+    if (currCounter != 0) {
+      for (m = 1; m <= mergedMax; m++) {
+        if (mergedName[m] != NULL && objectName[currCounter] != NULL
+            && strcmp (mergedName[m], objectName[currCounter]) == 0)
+          break;
+      }
+    }
+    if (m > mergedMax) {
+      if (m >= MAXCOUNTERS)
+        continue;
+      mergedName[m] = (currCounter == 0) ? NULL : my_strdup (objectName[currCounter]);
+      mergedFrames[m] = 0;
+      mergedCalls[m] = 0;
+      mergedFuncs[m] = 0;
+      mergedTotal[m] = 0.0;
+      mergedWorst[m] = 0.0;
+      for (i = 0; i < NbFuncMax; i++)
+        mergedWc[m][i] = 0.0;
+      mergedMax = m;
+    }
+
+    /* same figures as WMOPS_output() */
+    tot = WMOPS_frameStat ();
+    mergedTotal[m] += total_wmops[currCounter] + ((float) tot) * frameRate;
+    mergedFrames[m] += nbframe[currCounter];
+    mergedCalls[m] += nbTimeObjectIsCalled[currCounter];
+
+    worst = ((float) glob_wc[currCounter]) * frameRate;
+    if (worst > mergedWorst[m])
+      mergedWorst[m] = worst;
+
+    for (i = 0; i < funcid[currCounter]; i++) {
+      worst = ((float) wc[currCounter][i]) * frameRate;
+      if (worst > mergedWc[m][i])
+        mergedWc[m][i] = worst;
+    }
+    if (funcid[currCounter] > mergedFuncs[m])
+      mergedFuncs[m] = funcid[currCounter];
+  }
+
+  MERGE_UNLOCK ();
+  currCounter = saved_value;
+#endif /* ifdef WMOPS */
+}
+
+
+void WMOPS_output_merged (Word16 dtx_mode) {
+#if WMOPS
+  int m;
+  Word16 i;
+  float tot_wc;
+
+  MERGE_LOCK ();
+
+  for (m = 0; m <= mergedMax; m++) {
+    /* skip the groups that counted nothing, e.g. the global one of threads using named groups only */
+    if (mergedFrames[m] == 0 && mergedCalls[m] == 0 && mergedWorst[m] == 0.0)
+      continue;
+    fprintf (stdout, "%10s:", mergedName[m] ? mergedName[m] : "");
+
+    if (mergedFrames[m] != 0) {
+      fprintf (stdout, "Average=%.3f  ", mergedTotal[m] / (float) mergedFrames[m]);
+    }
+    fprintf (stdout, "WorstCase=%.3f", mergedWorst[m]);
+
+    /* Worst worst case printed only when not in DTX mode */
+    if (dtx_mode == 0) {
+      tot_wc = 0.0;
+      for (i = 0; i < mergedFuncs[m]; i++)
+        tot_wc += mergedWc[m][i];
+      fprintf (stdout, "  WorstWC=%.3f", tot_wc);
+    }
+    fprintf (stdout, " (%ld frames, %ld calls)\n", mergedFrames[m], mergedCalls[m]);
+  }
+
+  MERGE_UNLOCK ();
+#else /* ifdef WMOPS */
+  (void) dtx_mode;
 #endif /* ifdef WMOPS */
 }
 
@@ -27,6 +27,12 @@
                         L_mls() weight of 5.
                         div_l() weight of 32.
                         i_mult() weight of 3.
+   17 Oct 26   v2.4     WMOPS is not defined with BASOP_INLINE (inline
+                        operators without counting, see basop_inline.h).
+   17 Oct 26   v2.4     Counters of the vector operators (enhvec.c), which
+                        are incremented by the number of elements.
+   17 Oct 26   v2.4     Per-thread counters with BASOP_THREADS, WMOPS_merge()
+                        and WMOPS_output_merged().
   ============================================================================
 */
 
@@ -51,6 +57,12 @@
  *
  * Currently there is a limit of 255 different counter groups.
  *
+ * With BASOP_THREADS defined, the counters, the counter groups and the
+ * current group are thread-local (see BASOP_TLS in typedef.h): each thread
+ * has its own getCounterId() / setCounter() and its own report. At the end
+ * of its work, each thread calls WMOPS_merge(), and WMOPS_output_merged()
+ * then prints the report of all the threads.
+ *
  * In the end of this file, there is a piece of code illustrating how the
  * functions can be used.
  *
@@ -59,7 +71,9 @@
 
 #ifndef _COUNT_H
 #define _COUNT_H "$Id$"
+#ifndef BASOP_INLINE
 #define WMOPS 1                 /* enable WMOPS profiling features */
+#endif
 // #undef WMOPS /* disable WMOPS profiling features */
 
 #define MAXCOUNTERS (256)
@@ -152,6 +166,22 @@ void setFrameRate (int samplingFreq, int frameLength);
 /*
  * This function can overwrite the value of the frameRate variable that is
  * initialized by the FRAME_RATE constant.
+ * The frame rate is shared by all the threads (also with BASOP_THREADS):
+ * it should be set before the threads are started.
+ */
+
+void WMOPS_merge (void);
+/*
+ * Adds the counters of the calling thread to the merged report: the global
+ * counter to the global counter, the other counter groups to the group of
+ * the same name. Frames, calls and average WMOPS are summed; the worst
+ * cases are the maximum over the threads. To be called once per thread,
+ * after its last frame; the counters of the thread are not modified.
+ */
+
+void WMOPS_output_merged (Word16 dtx_mode);
+/*
+ * Prints the merged report, one line per counter group, as WMOPS_output().
  */
 
 
@@ -421,6 +451,14 @@ typedef struct {
   UWord32 UL_deposit_l;            /* Complexity Weight of 1 */
 #endif /* #ifdef ENH_U_32_BIT_OPERATOR */
 
+#ifdef ENH_VEC_OPERATOR
+  UWord32 L_dot_v;                 /* Complexity Weight of 1 per element */
+  UWord32 L_mac_v;                 /* Complexity Weight of 1 per element */
+  UWord32 norm_l_v;                /* Complexity Weight of 1 per element */
+  UWord32 scale_v;                 /* Complexity Weight of 1 per element */
+  UWord32 L_conv_v;                /* Complexity Weight of 1 per product */
+#endif /* #ifdef ENH_VEC_OPERATOR */
+
 #ifdef CONTROL_CODE_OPS
   UWord32 LT_16;                   /* Complexity Weight of 1 */
   UWord32 GT_16;                   /* Complexity Weight of 1 */
@@ -57,8 +57,8 @@
 #include "stl.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -75,6 +75,7 @@ extern int currCounter;
  *   Functions
  *
  *****************************************************************************/
+#ifndef BASOP_INLINE            /* else defined in basop_inline.h */
 
 
 /*****************************************************************************
@@ -629,6 +630,7 @@ Word32 L_rotl (Word32 L_var1, Word16 var2, Word16 * var3) {
 
   return (L_var_out);
 }
+#endif /* ifndef BASOP_INLINE */
 
 
 
@@ -17,6 +17,8 @@
                         Some counters incrementations were missing (s_and, 
                         s_or, s_xor).                        
    30 Nov 09   v2.3     saturate() removed
+   17 Oct 26   v2.4     Operators of enh1632.c are static inline when
+                        BASOP_INLINE is defined (see basop_inline.h).
 
   ============================================================================
 */
@@ -38,8 +40,8 @@
 
 #if (WMOPS)
 #include "count.h"
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -48,19 +50,19 @@ extern int currCounter;
  *  Prototypes for enhanced 16/32 bit arithmetic operators
  *
  *****************************************************************************/
-Word16 shl_r (Word16 var1, Word16 var2);
-Word32 L_shl_r (Word32 L_var1, Word16 var2);
+BASOP_STATIC Word16 shl_r (Word16 var1, Word16 var2);
+BASOP_STATIC Word32 L_shl_r (Word32 L_var1, Word16 var2);
 
 
-Word16 lshl (Word16 var1, Word16 var2);
-Word16 lshr (Word16 var1, Word16 var2);
-Word32 L_lshl (Word32 L_var1, Word16 var2);
-Word32 L_lshr (Word32 L_var1, Word16 var2);
+BASOP_STATIC Word16 lshl (Word16 var1, Word16 var2);
+BASOP_STATIC Word16 lshr (Word16 var1, Word16 var2);
+BASOP_STATIC Word32 L_lshl (Word32 L_var1, Word16 var2);
+BASOP_STATIC Word32 L_lshr (Word32 L_var1, Word16 var2);
 
-Word16 rotr (Word16 var1, Word16 var2, Word16 * var3);
-Word16 rotl (Word16 var1, Word16 var2, Word16 * var3);
-Word32 L_rotr (Word32 var1, Word16 var2, Word16 * var3);
-Word32 L_rotl (Word32 var1, Word16 var2, Word16 * var3);
+BASOP_STATIC Word16 rotr (Word16 var1, Word16 var2, Word16 * var3);
+BASOP_STATIC Word16 rotl (Word16 var1, Word16 var2, Word16 * var3);
+BASOP_STATIC Word32 L_rotr (Word32 var1, Word16 var2, Word16 * var3);
+BASOP_STATIC Word32 L_rotl (Word32 var1, Word16 var2, Word16 * var3);
 
 
 
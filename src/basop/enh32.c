@@ -21,11 +21,12 @@
  *****************************************************************************/
 #include <stdio.h>
 #include <stdlib.h>
+#include "stl.h"
 #include "enh32.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
 #ifdef ENH_32_BIT_OPERATOR
@@ -47,6 +48,7 @@ extern int currCounter;
  *  Functions
  *
  *****************************************************************************/
+#ifndef BASOP_INLINE            /* else defined in basop_inline.h */
 
 Word32 Mpy_32_16_1 (Word32 L_var1, Word16 var2) {
   Word32 L_var_out = W_sat_m (W_mult_32_16 (L_var1, var2) );
@@ -209,6 +211,7 @@ Word32 Msub_32_32_r (Word32 L_var3, Word32 L_var1, Word32 L_var2) {
 #endif /* if WMOPS */	 
   return L_var_out;
 }
+#endif /* ifndef BASOP_INLINE */
 
 #endif /* #ifdef ENH_32_BIT_OPERATOR */
  
@@ -65,8 +65,8 @@
 #include "stl.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -89,6 +89,7 @@ extern int currCounter;
  *  Functions
  *
  *****************************************************************************/
+#ifndef BASOP_INLINE            /* else defined in basop_inline.h */
 
 /*****************************************************************************
  *
@@ -1040,6 +1041,7 @@ Word40 L40_shl_r (Word40 L40_var1, Word16 var2) {
 
   return (L40_var_out);
 }
+#endif /* ifndef BASOP_INLINE */
 
 
 /* end of file */
@@ -14,6 +14,8 @@
                         TD 11 document and subsequent discussions on the
                         wp3audio@yahoogroups.com email reflector.
    March 06   v2.1      Changed to improve portability.
+   17 Oct 26   v2.4     Operators of enh40.c are static inline when
+                        BASOP_INLINE is defined (see basop_inline.h).
 
   ============================================================================
 */
@@ -27,8 +29,8 @@
 
 
 #ifdef WMOPS
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* ifdef WMOPS */
 
 
@@ -61,10 +63,10 @@ extern int currCounter;
  *  Prototypes for enhanced 40 bit arithmetic operators
  *
  *****************************************************************************/
-Word40 L40_shr (Word40 L40_var1, Word16 var2);
-Word40 L40_shr_r (Word40 L40_var1, Word16 var2);
-Word40 L40_shl (Word40 L40_var1, Word16 var2);
-Word40 L40_shl_r (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_shr (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_shr_r (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_shl (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_shl_r (Word40 L40_var1, Word16 var2);
 
 static __inline Word40 L40_mult (Word16 var1, Word16 var2);
 
@@ -75,12 +77,12 @@ static __inline Word40 L40_msu (Word40 L40_var1, Word16 var1, Word16 var2);
 static __inline Word16 msu_r40 (Word40 L40_var1, Word16 var1, Word16 var2);
 
 
-void Mpy_32_16_ss (Word32 L_var1, Word16 var2, Word32 * L_varout_h, UWord16 * varout_l);
-void Mpy_32_32_ss (Word32 L_var1, Word32 L_var2, Word32 * L_varout_h, UWord32 * L_varout_l);
+BASOP_STATIC void Mpy_32_16_ss (Word32 L_var1, Word16 var2, Word32 * L_varout_h, UWord16 * varout_l);
+BASOP_STATIC void Mpy_32_32_ss (Word32 L_var1, Word32 L_var2, Word32 * L_varout_h, UWord32 * L_varout_l);
 
 
-Word40 L40_lshl (Word40 L40_var1, Word16 var2);
-Word40 L40_lshr (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_lshl (Word40 L40_var1, Word16 var2);
+BASOP_STATIC Word40 L40_lshr (Word40 L40_var1, Word16 var2);
 
 static __inline Word40 L40_set (Word40 L40_var1);
 static __inline UWord16 Extract40_H (Word40 L40_var1);
@@ -95,14 +97,14 @@ static __inline Word40 L40_round (Word40 L40_var1);
 static __inline Word16 round40 (Word40 L40_var1);
 
 
-Word40 L40_add (Word40 L40_var1, Word40 L40_var2);
-Word40 L40_sub (Word40 L40_var1, Word40 L40_var2);
-Word40 L40_abs (Word40 L40_var1);
-Word40 L40_negate (Word40 L40_var1);
-Word40 L40_max (Word40 L40_var1, Word40 L40_var2);
-Word40 L40_min (Word40 L40_var1, Word40 L40_var2);
-Word32 L_saturate40 (Word40 L40_var1);
-Word16 norm_L40 (Word40 L40_var1);
+BASOP_STATIC Word40 L40_add (Word40 L40_var1, Word40 L40_var2);
+BASOP_STATIC Word40 L40_sub (Word40 L40_var1, Word40 L40_var2);
+BASOP_STATIC Word40 L40_abs (Word40 L40_var1);
+BASOP_STATIC Word40 L40_negate (Word40 L40_var1);
+BASOP_STATIC Word40 L40_max (Word40 L40_var1, Word40 L40_var2);
+BASOP_STATIC Word40 L40_min (Word40 L40_var1, Word40 L40_var2);
+BASOP_STATIC Word32 L_saturate40 (Word40 L40_var1);
+BASOP_STATIC Word16 norm_L40 (Word40 L40_var1);
 
 
 /*****************************************************************************
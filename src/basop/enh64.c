@@ -16,11 +16,12 @@
 *****************************************************************************/
 #include <stdio.h>
 #include <stdlib.h>
+#include "stl.h"
 #include "enh64.h"
 
 #if (WMOPS)
-extern BASIC_OP multiCounter[MAXCOUNTERS];
-extern int currCounter;
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
 #endif /* if WMOPS */
 
 
@@ -44,6 +45,7 @@ extern int currCounter;
 *****************************************************************************/
 
 #ifdef ENH_64_BIT_OPERATOR
+#ifndef BASOP_INLINE            /* else defined in basop_inline.h */
 
 
 /*___________________________________________________________________________
@@ -1659,6 +1661,7 @@ Word32 W_round64_L (Word64 L64_var1) {
  
   return (L_result);
 }
+#endif /* ifndef BASOP_INLINE */
 
 #endif /* #ifdef ENH_64_BIT_OPERATOR */
 
@@ -0,0 +1,498 @@
+/*
+  ============================================================================
+   File: ENHVEC.C                                        v.1.0 - 17.Oct.2026
+  ============================================================================
+
+            ENHANCED VECTOR (ARRAY) OPERATORS
+
+   History:
+   v.1.0 - 17.Oct.2026  First version
+
+  ============================================================================
+*/
+
+ /*****************************************************************************
+ *
+ *  Enhanced vector operators :
+ *
+ *    L_dot_v()
+ *    L_mac_v()
+ *    norm_l_v()
+ *    scale_v()
+ *    L_conv_v()
+ *
+ *  The operators are bit-exact with the loops of scalar operators they
+ *  replace, including the setting of Overflow. They are computed with SSE2
+ *  instructions where available (x86, x86-64), and in C otherwise.
+ *
+ *  L_dot_v() and L_conv_v() accumulate the products exactly, and use the
+ *  result when no partial sum of the loop of L_mac() can saturate; else
+ *  (rare with scaled signals) the loop is computed element by element.
+ *
+ *  The complexity is counted per element: one L_mac() per product, one
+ *  operation per element for norm_l_v() and scale_v().
+ *
+ *****************************************************************************/
+
+
+/*****************************************************************************
+ *
+ *  Include-Files
+ *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "stl.h"
+#include "enhvec.h"
+
+#if (WMOPS)
+extern BASOP_TLS BASIC_OP multiCounter[MAXCOUNTERS];
+extern BASOP_TLS int currCounter;
+#endif /* if WMOPS */
+
+#ifdef ENH_VEC_OPERATOR
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENHVEC_SSE2
+#include <emmintrin.h>
+#endif
+
+
+/*****************************************************************************
+ *
+ *  Local Functions
+ *
+ *****************************************************************************/
+
+/* L_mac() without complexity counting */
+static Word32 vec_L_mac (Word32 L_var3, Word16 var1, Word16 var2) {
+  Word32 L_product;
+  Word64 L64_sum;
+
+  L_product = (Word32) var1 *(Word32) var2;
+  if (L_product != (Word32) 0x40000000L) {
+    L_product *= 2;
+  } else {
+    Overflow = 1;
+    L_product = MAX_32;
+  }
+
+  L64_sum = (Word64) L_var3 + L_product;
+  if (L64_sum > MAX_32) {
+    Overflow = 1;
+    return (MAX_32);
+  }
+  if (L64_sum < MIN_32) {
+    Overflow = 1;
+    return (MIN_32);
+  }
+  return ((Word32) L64_sum);
+}
+
+/* shl() without complexity counting */
+static Word16 vec_shl (Word16 var1, Word16 var2) {
+  Word32 result;
+
+  if (var2 <= 0) {
+    var2 = (var2 < -15) ? 15 : -var2;
+    return ((Word16) (var1 >> var2));
+  }
+  if (var1 == 0) {
+    return (0);
+  }
+  if (var2 > 15) {
+    Overflow = 1;
+    return ((var1 > 0) ? MAX_16 : MIN_16);
+  }
+  result = (Word32) var1 *((Word32) 1 << var2);
+  if (result != (Word32) ((Word16) result)) {
+    Overflow = 1;
+    return ((var1 > 0) ? MAX_16 : MIN_16);
+  }
+  return ((Word16) result);
+}
+
+
+#ifdef ENHVEC_SSE2
+/*
+  Exact dot product of x[0..lg-1] and y[0..lg-1] (rev = 0) or
+  y[0], y[-1], ..., y[-(lg-1)] (rev = 1), as a loop of L_mac() starting
+  from *L_acc. Returns 0, without changing *L_acc, if the loop could
+  saturate.
+*/
+static int vec_dot_sse2 (Word32 * L_acc, const Word16 x[], const Word16 y[], Word16 lg, int rev) {
+  const __m128i min16 = _mm_set1_epi16 (MIN_16);
+  __m128i tot = _mm_setzero_si128 ();
+  __m128i pos = _mm_setzero_si128 ();
+  __m128i bad = _mm_setzero_si128 ();
+  __m128i a, b, neg, t, p;
+  Word64 L64_tot, L64_pos, L64_neg, sum[2];
+  Word32 L_prod;
+  Word16 i, yi;
+
+  for (i = 0; i + 8 <= lg; i += 8) {
+    a = _mm_loadu_si128 ((const __m128i *) (x + i));
+    if (rev) {
+      b = _mm_loadu_si128 ((const __m128i *) (y - i - 7));
+      b = _mm_shuffle_epi32 (b, _MM_SHUFFLE (0, 1, 2, 3));
+      b = _mm_shufflelo_epi16 (b, _MM_SHUFFLE (2, 3, 0, 1));
+      b = _mm_shufflehi_epi16 (b, _MM_SHUFFLE (2, 3, 0, 1));
+    } else {
+      b = _mm_loadu_si128 ((const __m128i *) (y + i));
+    }
+    /* -32768 * -32768 saturates in L_mult() and overflows in pmaddwd */
+    bad = _mm_or_si128 (bad, _mm_and_si128 (_mm_cmpeq_epi16 (a, min16), _mm_cmpeq_epi16 (b, min16)));
+
+    /* all products, and the positive ones: pairs of products fit in 32 bits */
+    neg = _mm_srai_epi16 (_mm_xor_si128 (a, b), 15);
+    t = _mm_madd_epi16 (a, b);
+    p = _mm_madd_epi16 (_mm_andnot_si128 (neg, a), b);
+
+    /* accumulate in 64 bits */
+    tot = _mm_add_epi64 (tot, _mm_unpacklo_epi32 (t, _mm_srai_epi32 (t, 31)));
+    tot = _mm_add_epi64 (tot, _mm_unpackhi_epi32 (t, _mm_srai_epi32 (t, 31)));
+    pos = _mm_add_epi64 (pos, _mm_unpacklo_epi32 (p, _mm_setzero_si128 ()));
+    pos = _mm_add_epi64 (pos, _mm_unpackhi_epi32 (p, _mm_setzero_si128 ()));
+  }
+  if (_mm_movemask_epi8 (bad) != 0)
+    return (0);
+
+  _mm_storeu_si128 ((__m128i *) sum, tot);
+  L64_tot = sum[0] + sum[1];
+  _mm_storeu_si128 ((__m128i *) sum, pos);
+  L64_pos = sum[0] + sum[1];
+
+  for (; i < lg; i++) {
+    yi = rev ? y[-i] : y[i];
+    if (x[i] == MIN_16 && yi == MIN_16)
+      return (0);
+    L_prod = (Word32) x[i] * yi;
+    L64_tot += L_prod;
+    if (L_prod > 0)
+      L64_pos += L_prod;
+  }
+
+  /* every partial sum lies between *L_acc + 2*neg and *L_acc + 2*pos */
+  L64_neg = L64_tot - L64_pos;
+  if (*L_acc + 2 * L64_pos > MAX_32 || *L_acc + 2 * L64_neg < MIN_32)
+    return (0);
+
+  *L_acc = (Word32) (*L_acc + 2 * L64_tot);
+  return (1);
+}
+#endif /* ENHVEC_SSE2 */
+
+
+/*****************************************************************************
+ *
+ *  Functions
+ *
+ *****************************************************************************/
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : L_dot_v                                                 |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Dot product of the vectors x[] and y[] of lg elements, accumulated on   |
+ |   L_acc with saturation, as:                                              |
+ |                                                                           |
+ |      for (i = 0; i < lg; i++)                                             |
+ |        L_acc = L_mac (L_acc, x[i], y[i]);                                 |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    L_acc   32 bit long signed integer (Word32), initial value.            |
+ |                                                                           |
+ |    x[], y[]                                                               |
+ |             16 bit short signed integers (Word16).                        |
+ |                                                                           |
+ |    lg      number of elements.                                            |
+ |                                                                           |
+ |   Return Value :                                                          |
+ |                                                                           |
+ |    L_acc   32 bit long signed integer (Word32) whose value falls in the   |
+ |             range : 0x8000 0000 <= L_acc <= 0x7fff ffff.                  |
+ |___________________________________________________________________________|
+*/
+Word32 L_dot_v (Word32 L_acc, const Word16 x[], const Word16 y[], Word16 lg) {
+  Word16 i = 0;
+
+#ifdef ENHVEC_SSE2
+  if (lg >= 8 && vec_dot_sse2 (&L_acc, x, y, lg, 0))
+    i = lg;
+#endif
+  for (; i < lg; i++) {
+    L_acc = vec_L_mac (L_acc, x[i], y[i]);
+  }
+
+#if (WMOPS)
+  if (lg > 0)
+    multiCounter[currCounter].L_dot_v += lg;
+#endif /* if WMOPS */
+  return (L_acc);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : L_mac_v                                                 |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Multiply-accumulate of the vector x[] by var1 on the vector L_y[], with |
+ |   saturation, as:                                                         |
+ |                                                                           |
+ |      for (i = 0; i < lg; i++)                                             |
+ |        L_y[i] = L_mac (L_y[i], x[i], var1);                               |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    L_y[]   32 bit long signed integers (Word32).                          |
+ |                                                                           |
+ |    x[]     16 bit short signed integers (Word16).                         |
+ |                                                                           |
+ |    var1    16 bit short signed integer (Word16).                          |
+ |                                                                           |
+ |    lg      number of elements.                                            |
+ |                                                                           |
+ |   Outputs :                                                               |
+ |                                                                           |
+ |    L_y[]   32 bit long signed integers (Word32).                          |
+ |___________________________________________________________________________|
+*/
+void L_mac_v (Word32 L_y[], const Word16 x[], Word16 var1, Word16 lg) {
+  Word16 i = 0;
+#ifdef ENHVEC_SSE2
+  const __m128i c = _mm_set1_epi16 (var1);
+  const __m128i max32 = _mm_set1_epi32 (MAX_32);
+  const __m128i half = _mm_set1_epi32 (0x40000000L);
+  __m128i ovf = _mm_setzero_si128 ();
+  __m128i v, p, sp, a, s, o;
+
+  for (; i + 4 <= lg; i += 4) {
+    /* exact 32-bit products x[i] * var1, then L_mult() */
+    v = _mm_loadl_epi64 ((const __m128i *) (x + i));
+    p = _mm_unpacklo_epi16 (_mm_mullo_epi16 (v, c), _mm_mulhi_epi16 (v, c));
+    sp = _mm_cmpeq_epi32 (p, half);
+    p = _mm_or_si128 (_mm_andnot_si128 (sp, _mm_slli_epi32 (p, 1)), _mm_and_si128 (sp, max32));
+
+    /* L_add() */
+    a = _mm_loadu_si128 ((const __m128i *) (L_y + i));
+    s = _mm_add_epi32 (a, p);
+    o = _mm_srai_epi32 (_mm_and_si128 (_mm_xor_si128 (a, s), _mm_xor_si128 (p, s)), 31);
+    s = _mm_or_si128 (_mm_andnot_si128 (o, s), _mm_and_si128 (o, _mm_xor_si128 (_mm_srai_epi32 (a, 31), max32)));
+    _mm_storeu_si128 ((__m128i *) (L_y + i), s);
+
+    ovf = _mm_or_si128 (ovf, _mm_or_si128 (sp, o));
+  }
+  if (_mm_movemask_epi8 (ovf) != 0)
+    Overflow = 1;
+#endif
+  for (; i < lg; i++) {
+    L_y[i] = vec_L_mac (L_y[i], x[i], var1);
+  }
+
+#if (WMOPS)
+  if (lg > 0)
+    multiCounter[currCounter].L_mac_v += lg;
+#endif /* if WMOPS */
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : norm_l_v                                                |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Block normalisation: produces the smallest norm_l() of the non-zero     |
+ |   elements of L_x[], i.e. the number of left shifts that normalises the   |
+ |   element of largest magnitude; 0 if all the elements are 0. The block is |
+ |   normalised without overflow by shifting all the elements left by this   |
+ |   number.                                                                 |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    L_x[]   32 bit long signed integers (Word32).                          |
+ |                                                                           |
+ |    lg      number of elements.                                            |
+ |                                                                           |
+ |   Return Value :                                                          |
+ |                                                                           |
+ |    var_out 16 bit short signed integer (Word16) whose value falls in the  |
+ |             range : 0x0000 0000 <= var_out <= 0x0000 001f.                |
+ |___________________________________________________________________________|
+*/
+Word16 norm_l_v (const Word32 L_x[], Word16 lg) {
+  UWord32 nz = 0, mag = 0;
+  Word16 i = 0, var_out;
+#ifdef ENHVEC_SSE2
+  __m128i vnz = _mm_setzero_si128 ();
+  __m128i vmag = _mm_setzero_si128 ();
+  __m128i v;
+  UWord32 tmp[4];
+
+  for (; i + 4 <= lg; i += 4) {
+    v = _mm_loadu_si128 ((const __m128i *) (L_x + i));
+    vnz = _mm_or_si128 (vnz, v);
+    vmag = _mm_or_si128 (vmag, _mm_xor_si128 (v, _mm_srai_epi32 (v, 31)));
+  }
+  _mm_storeu_si128 ((__m128i *) tmp, vnz);
+  nz = tmp[0] | tmp[1] | tmp[2] | tmp[3];
+  _mm_storeu_si128 ((__m128i *) tmp, vmag);
+  mag = tmp[0] | tmp[1] | tmp[2] | tmp[3];
+#endif
+  for (; i < lg; i++) {
+    nz |= (UWord32) L_x[i];
+    mag |= (UWord32) (L_x[i] < 0 ? ~L_x[i] : L_x[i]);
+  }
+
+  if (nz == 0) {
+    var_out = 0;
+  } else if (mag == 0) {
+    var_out = 31;               /* only -1 and 0 */
+  } else {
+    for (var_out = 0; mag < (UWord32) 0x40000000UL; var_out++) {
+      mag <<= 1;
+    }
+  }
+
+#if (WMOPS)
+  if (lg > 0)
+    multiCounter[currCounter].norm_l_v += lg;
+#endif /* if WMOPS */
+  return (var_out);
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : scale_v                                                 |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Scaling of the vector x[] by 2^exp with saturation, as:                 |
+ |                                                                           |
+ |      for (i = 0; i < lg; i++)                                             |
+ |        x[i] = shl (x[i], exp);                                            |
+ |                                                                           |
+ |   Complexity weight : 1 per element                                       |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    x[]     16 bit short signed integers (Word16).                         |
+ |                                                                           |
+ |    lg      number of elements.                                            |
+ |                                                                           |
+ |    exp     16 bit short signed integer (Word16): left shift if positive,  |
+ |             arithmetic right shift if negative.                           |
+ |                                                                           |
+ |   Outputs :                                                               |
+ |                                                                           |
+ |    x[]     16 bit short signed integers (Word16).                         |
+ |___________________________________________________________________________|
+*/
+void scale_v (Word16 x[], Word16 lg, Word16 exp) {
+  Word16 i = 0;
+#ifdef ENHVEC_SSE2
+  __m128i v, lo, hi, r, cnt, ovf = _mm_setzero_si128 ();
+
+  if (exp < 0) {
+    cnt = _mm_cvtsi32_si128 ((exp < -15) ? 15 : -exp);
+    for (; i + 8 <= lg; i += 8) {
+      v = _mm_loadu_si128 ((const __m128i *) (x + i));
+      _mm_storeu_si128 ((__m128i *) (x + i), _mm_sra_epi16 (v, cnt));
+    }
+  } else if (exp > 0) {
+    /* 16-bit values shifted by up to 16 fit in 32 bits; saturate on packing */
+    cnt = _mm_cvtsi32_si128 ((exp > 16) ? 16 : exp);
+    for (; i + 8 <= lg; i += 8) {
+      v = _mm_loadu_si128 ((const __m128i *) (x + i));
+      lo = _mm_sll_epi32 (_mm_srai_epi32 (_mm_unpacklo_epi16 (v, v), 16), cnt);
+      hi = _mm_sll_epi32 (_mm_srai_epi32 (_mm_unpackhi_epi16 (v, v), 16), cnt);
+      r = _mm_packs_epi32 (lo, hi);
+      _mm_storeu_si128 ((__m128i *) (x + i), r);
+      ovf = _mm_or_si128 (ovf, _mm_xor_si128 (lo, _mm_srai_epi32 (_mm_unpacklo_epi16 (r, r), 16)));
+      ovf = _mm_or_si128 (ovf, _mm_xor_si128 (hi, _mm_srai_epi32 (_mm_unpackhi_epi16 (r, r), 16)));
+    }
+    if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (ovf, _mm_setzero_si128 ())) != 0xffff)
+      Overflow = 1;
+  } else {
+    i = (lg > 0) ? lg : 0;
+  }
+#endif
+  for (; i < lg; i++) {
+    x[i] = vec_shl (x[i], exp);
+  }
+
+#if (WMOPS)
+  if (lg > 0)
+    multiCounter[currCounter].scale_v += lg;
+#endif /* if WMOPS */
+}
+
+
+/*___________________________________________________________________________
+ |                                                                           |
+ |   Function Name : L_conv_v                                                |
+ |                                                                           |
+ |   Purpose :                                                               |
+ |                                                                           |
+ |   Convolution of x[] with the impulse response h[], both of lg elements,  |
+ |   with 32 bit outputs, as:                                                |
+ |                                                                           |
+ |      for (n = 0; n < lg; n++) {                                           |
+ |        L_acc = 0;                                                         |
+ |        for (i = 0; i <= n; i++)                                           |
+ |          L_acc = L_mac (L_acc, x[i], h[n - i]);                           |
+ |        L_y[n] = L_acc;                                                    |
+ |      }                                                                    |
+ |                                                                           |
+ |   Complexity weight : 1 per product, lg*(lg+1)/2                          |
+ |                                                                           |
+ |   Inputs :                                                                |
+ |                                                                           |
+ |    x[], h[]                                                               |
+ |             16 bit short signed integers (Word16).                        |
+ |                                                                           |
+ |    lg      number of elements.                                            |
+ |                                                                           |
+ |   Outputs :                                                               |
+ |                                                                           |
+ |    L_y[]   32 bit long signed integers (Word32), lg elements.             |
+ |___________________________________________________________________________|
+*/
+void L_conv_v (const Word16 x[], const Word16 h[], Word32 L_y[], Word16 lg) {
+  Word32 L_acc;
+  Word16 i, n;
+
+  for (n = 0; n < lg; n++) {
+    L_acc = 0;
+    i = 0;
+#ifdef ENHVEC_SSE2
+    if (n >= 7 && vec_dot_sse2 (&L_acc, x, h + n, (Word16) (n + 1), 1))
+      i = n + 1;
+#endif
+    for (; i <= n; i++) {
+      L_acc = vec_L_mac (L_acc, x[i], h[n - i]);
+    }
+    L_y[n] = L_acc;
+  }
+
+#if (WMOPS)
+  if (lg > 0)
+    multiCounter[currCounter].L_conv_v += (UWord32) lg *(lg + 1) / 2;
+#endif /* if WMOPS */
+}
+
+#endif /* ENH_VEC_OPERATOR */
+
+/* end of file */
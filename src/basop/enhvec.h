@@ -0,0 +1,47 @@
+/*
+  ============================================================================
+   File: ENHVEC.H                                        v.1.0 - 17.Oct.2026
+  ============================================================================
+
+            ENHANCED VECTOR (ARRAY) OPERATORS
+
+   History:
+   v.1.0 - 17.Oct.2026  First version
+
+  ============================================================================
+*/
+
+#ifndef _ENHVEC_H
+#define _ENHVEC_H
+
+#include "stl.h"
+
+#ifndef Word64
+#define Word64 long long int
+#endif
+
+/*****************************************************************************
+ *
+ *  Prototypes for the vector operators
+ *
+ *  Each operator gives the same results (Overflow included) as the loop of
+ *  scalar operators given in the comment; the complexity is counted per
+ *  element.
+ *
+ *****************************************************************************/
+#ifdef ENH_VEC_OPERATOR
+Word32 L_dot_v (Word32 L_acc, const Word16 x[], const Word16 y[], Word16 lg);
+                                  /* L_acc = L_mac (L_acc, x[i], y[i])       */
+void L_mac_v (Word32 L_y[], const Word16 x[], Word16 var1, Word16 lg);
+                                  /* L_y[i] = L_mac (L_y[i], x[i], var1)     */
+Word16 norm_l_v (const Word32 L_x[], Word16 lg);
+                                  /* min. of norm_l (L_x[i]), L_x[i] != 0    */
+void scale_v (Word16 x[], Word16 lg, Word16 exp);
+                                  /* x[i] = shl (x[i], exp)                  */
+void L_conv_v (const Word16 x[], const Word16 h[], Word32 L_y[], Word16 lg);
+                                  /* L_y[n] = sum of L_mac (., x[i], h[n-i]) */
+#endif /* ENH_VEC_OPERATOR */
+
+#endif /*_ENHVEC_H*/
+
+/* end of file */
@@ -14,6 +14,9 @@
                         TD 11 document and subsequent discussions on the
                         wp3audio@yahoogroups.com email reflector.
    March 06   v2.1      Changed to improve portability.                        
+   17 Oct 26   v2.4     basop_inline.h included with BASOP_INLINE, after
+                        enh64.h and enh32.h.
+   17 Oct 26   v2.4     enhvec.h included with ENH_VEC_OPERATOR.
 
   ============================================================================
 */
@@ -39,6 +42,10 @@
 #include "enh32.h"
 #endif
 
+#ifdef BASOP_INLINE
+#include "basop_inline.h"
+#endif
+
 #ifdef COMPLEX_OPERATOR
 #include "complex_basop.h"
 #endif
@@ -47,6 +54,10 @@
 #include "enhUL32.h"
 #endif
 
+#ifdef ENH_VEC_OPERATOR
+#include "enhvec.h"
+#endif
+
 #endif /* ifndef _STL_H */
 
 
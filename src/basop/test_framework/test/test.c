@@ -6,6 +6,8 @@
 int test_precision();
 int create_default_tests_prec();
 int test_sanity();
+int test_vector();
+int test_threads();
 
 int  main( int argc, char* argv[] )
 {
@@ -40,9 +42,21 @@ else if(strcmp(argv[1],"Test_type=1") == 0) /* Test_type=1 */
 
     printf("Tests complete \n");
 }  /* regression test */
+else if(strcmp(argv[1],"Test_type=2") == 0)
+{
+    printf("Starting Vector Operator Tests...\n");
+    RetVal = test_vector();
+    printf("Vector operator tests Completed\n");
+}
+else if(strcmp(argv[1],"Test_type=3") == 0)
+{
+    printf("Starting Thread Tests...\n");
+    RetVal = test_threads();
+    printf("Thread tests Completed\n");
+}
 else
 	{
-   	printf("No proper runtime argument provided. Please specify Test_type=0 or Test_type=1\n");
+   	printf("No proper runtime argument provided. Please specify Test_type=0, Test_type=1, Test_type=2 or Test_type=3\n");
 	RetVal = -1;
 	}
     return RetVal;
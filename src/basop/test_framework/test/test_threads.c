@@ -0,0 +1,149 @@
+
+#include "input_config.h"
+#include <stdio.h>
+
+#if defined(HAVE_PTHREAD) && defined(BASOP_THREADS)
+#define THR_PARALLEL
+#include <pthread.h>
+#endif
+
+/*
+   Thread-local flags and counters (BASOP_THREADS): threads run frames of
+   L_mac(), which saturate in the even threads only. Each thread must see
+   its own Overflow, its own counter group ids and its own operation count,
+   while the others run. The reports are then merged by name (two groups).
+   Without BASOP_THREADS or pthreads, the threads are run one after the
+   other.
+*/
+
+#define THR_NUM     4
+#define THR_FRAMES  200
+#define THR_OPS     1000
+
+typedef struct
+{
+    int index;
+    int fail;
+} thr_arg;
+
+/* One frame: (index + 1) * THR_OPS L_mac() */
+static Word32 thr_frame(int index)
+{
+    Word32 L_acc = 0;
+    Word16 x = (index & 1) ? 1 : MAX_16;
+    int i;
+
+    for (i = 0; i < (index + 1) * THR_OPS; i++)
+    {
+        L_acc = L_mac(L_acc, x, x);
+    }
+    return L_acc;
+}
+
+static void *thr_run(void *p)
+{
+    thr_arg *arg = (thr_arg *)p;
+    int f;
+#ifdef WMOPS
+    char name[20];
+    int id;
+
+    sprintf(name, "group %d", arg->index & 1);
+    id = getCounterId(name);
+    setCounter(id);
+    Init_WMOPS_counter();
+#ifdef THR_PARALLEL
+    /* first group of this thread */
+    if (id != 1)
+    {
+        arg->fail++;
+    }
+#endif
+#endif
+
+    for (f = 0; f < THR_FRAMES; f++)
+    {
+#ifdef WMOPS
+        Reset_WMOPS_counter();
+#endif
+        Overflow = 0;
+        thr_frame(arg->index);
+        if (Overflow != ((arg->index & 1) == 0))
+        {
+            arg->fail++;
+        }
+#ifdef WMOPS
+        if (readCounterId() != id || TotalWeightedOperation() != (arg->index + 1) * THR_OPS)
+        {
+            arg->fail++;
+        }
+        fwc();
+#endif
+    }
+
+#ifdef WMOPS
+    WMOPS_merge();
+#endif
+    return NULL;
+}
+
+int test_threads(void)
+{
+    thr_arg arg[THR_NUM];
+    int SuccessCnt = 0, FailCnt = 0;
+    int k;
+#ifdef THR_PARALLEL
+    pthread_t tid[THR_NUM];
+#endif
+
+    for (k = 0; k < THR_NUM; k++)
+    {
+        arg[k].index = k;
+        arg[k].fail = 0;
+    }
+
+#ifdef THR_PARALLEL
+    for (k = 0; k < THR_NUM; k++)
+    {
+        if (pthread_create(&tid[k], NULL, thr_run, &arg[k]) != 0)
+        {
+            printf(" Error : thread %d not created !!\n", k);
+            return 1;
+        }
+    }
+    for (k = 0; k < THR_NUM; k++)
+    {
+        pthread_join(tid[k], NULL);
+    }
+#else
+    printf(" Threads not enabled (BASOP_THREADS, HAVE_PTHREAD), run one after the other\n");
+    for (k = 0; k < THR_NUM; k++)
+    {
+        thr_run(&arg[k]);
+    }
+#endif
+
+    for (k = 0; k < THR_NUM; k++)
+    {
+        if (arg[k].fail == 0)
+        {
+            SuccessCnt++;
+        }
+        else
+        {
+            FailCnt++;
+            printf(" Error : thread %d, %d frames with wrong Overflow or counters !!\n", k, arg[k].fail);
+        }
+    }
+
+#ifdef WMOPS
+    WMOPS_output_merged(0);
+#endif
+
+    printf("BASOP Thread test complete :  Total pass  = %d : Total fail = %d : Total test = %d !! \n", SuccessCnt, FailCnt, SuccessCnt + FailCnt);
+
+    /* Returns non-zero when check fails */
+    return FailCnt;
+}
+
+/* End of file */
@@ -0,0 +1,181 @@
+
+#include "input_config.h"
+#include <stdio.h>
+
+/*
+   Vector operators (enhvec.c) against the loops of scalar operators they
+   replace: outputs and Overflow must be identical, for lengths 0 to
+   VEC_MAX_LEN and signals of various levels, full scale included.
+*/
+
+#define VEC_MAX_LEN     300
+#define VEC_NUM_LEVELS  6
+
+static unsigned int vec_seed = RAND_SEED_1;
+
+static Word16 vec_rand16(Word16 level)
+{
+    vec_seed = vec_seed * 1103515245u + 12345u;
+    return (Word16)((Word16)(vec_seed >> 16) >> level);
+}
+
+/* Random vector; level 0 is full scale with some -32768 */
+static void vec_fill(Word16 *x, int lg, Word16 level)
+{
+    int i;
+
+    for (i = 0; i < lg; i++)
+    {
+        x[i] = vec_rand16(level);
+        if (level == 0 && (vec_seed & 0x70000) == 0)
+        {
+            x[i] = MIN_16;
+        }
+    }
+}
+
+#define VEC_CHECK(cond, name) { \
+    if (cond) \
+    {\
+        SuccessCnt++;\
+    }\
+    else\
+    {\
+        FailCnt++;\
+        if (FailCnt <= 10) printf(" Error : BASOP  %s o/p mismatch (lg = %d, level = %d) !!\n", name, lg, level);\
+    }\
+}
+
+int test_vector(void)
+{
+    static Word16 x[VEC_MAX_LEN], y[VEC_MAX_LEN], z[VEC_MAX_LEN];
+    static Word32 L_y1[VEC_MAX_LEN], L_y2[VEC_MAX_LEN];
+    static const Word16 levels[VEC_NUM_LEVELS] = { 0, 1, 3, 6, 9, 12 };
+    static const Word16 shifts[] = { -32768, -17, -16, -15, -9, -1, 0, 1, 2, 5, 15, 16, 17, 40 };
+    int SuccessCnt = 0, FailCnt = 0;
+    int lg, l, i, n, k, ok;
+    Word16 level, exp, var1;
+    Word32 L_acc1, L_acc2;
+    Flag Ovf1, Ovf2;
+
+    for (lg = 0; lg <= VEC_MAX_LEN; lg += (lg < 40) ? 1 : 37)
+    {
+        for (l = 0; l < VEC_NUM_LEVELS; l++)
+        {
+            level = levels[l];
+            vec_fill(x, lg, level);
+            vec_fill(y, lg, level);
+
+            /* L_dot_v() */
+            L_acc1 = (lg & 1) ? (Word32)vec_rand16(0) * 32768 : 0;
+            L_acc2 = L_acc1;
+            Overflow = 0;
+            for (i = 0; i < lg; i++)
+            {
+                L_acc1 = L_mac(L_acc1, x[i], y[i]);
+            }
+            Ovf1 = Overflow;
+            Overflow = 0;
+            L_acc2 = L_dot_v(L_acc2, x, y, (Word16)lg);
+            Ovf2 = Overflow;
+            VEC_CHECK(L_acc1 == L_acc2 && Ovf1 == Ovf2, "L_dot_v");
+
+            /* L_mac_v() */
+            var1 = vec_rand16(level);
+            if ((lg & 7) == 3)
+            {
+                var1 = MIN_16;
+            }
+            for (i = 0; i < lg; i++)
+            {
+                L_y1[i] = L_y2[i] = (Word32)vec_rand16(0) * (1 << (vec_rand16(0) & 15));
+            }
+            Overflow = 0;
+            for (i = 0; i < lg; i++)
+            {
+                L_y1[i] = L_mac(L_y1[i], x[i], var1);
+            }
+            Ovf1 = Overflow;
+            Overflow = 0;
+            L_mac_v(L_y2, x, var1, (Word16)lg);
+            Ovf2 = Overflow;
+            for (i = 0, ok = 1; i < lg; i++)
+            {
+                ok &= (L_y1[i] == L_y2[i]);
+            }
+            VEC_CHECK(ok && Ovf1 == Ovf2, "L_mac_v");
+
+            /* norm_l_v() */
+            for (i = 0; i < lg; i++)
+            {
+                L_y1[i] = L_deposit_h(x[i]) >> (vec_rand16(0) & 31);
+                if ((vec_seed & 0x300000) == 0)
+                {
+                    L_y1[i] = (vec_seed & 0x400000) ? -1 : 0;
+                }
+            }
+            for (i = 0, n = 0, k = 0; i < lg; i++)
+            {
+                if (L_y1[i] != 0 && (n == 0 || norm_l(L_y1[i]) < k))
+                {
+                    k = norm_l(L_y1[i]);
+                    n = 1;
+                }
+            }
+            VEC_CHECK(norm_l_v(L_y1, (Word16)lg) == (n ? k : 0), "norm_l_v");
+
+            /* scale_v() */
+            for (k = 0; k < (int)(sizeof(shifts) / sizeof(shifts[0])); k++)
+            {
+                exp = shifts[k];
+                Overflow = 0;
+                for (i = 0; i < lg; i++)
+                {
+                    z[i] = shl(x[i], exp);
+                }
+                Ovf1 = Overflow;
+                for (i = 0; i < lg; i++)
+                {
+                    y[i] = x[i];
+                }
+                Overflow = 0;
+                scale_v(y, (Word16)lg, exp);
+                Ovf2 = Overflow;
+                for (i = 0, ok = 1; i < lg; i++)
+                {
+                    ok &= (y[i] == z[i]);
+                }
+                VEC_CHECK(ok && Ovf1 == Ovf2, "scale_v");
+            }
+
+            /* L_conv_v() */
+            vec_fill(y, lg, level);
+            Overflow = 0;
+            for (n = 0; n < lg; n++)
+            {
+                L_acc1 = 0;
+                for (i = 0; i <= n; i++)
+                {
+                    L_acc1 = L_mac(L_acc1, x[i], y[n - i]);
+                }
+                L_y1[n] = L_acc1;
+            }
+            Ovf1 = Overflow;
+            Overflow = 0;
+            L_conv_v(x, y, L_y2, (Word16)lg);
+            Ovf2 = Overflow;
+            for (i = 0, ok = 1; i < lg; i++)
+            {
+                ok &= (L_y1[i] == L_y2[i]);
+            }
+            VEC_CHECK(ok && Ovf1 == Ovf2, "L_conv_v");
+        }
+    }
+
+    printf("BASOP Vector test complete :  Total pass  = %d : Total fail = %d : Total test = %d !! \n", SuccessCnt, FailCnt, SuccessCnt + FailCnt);
+
+    /* Returns non-zero when check fails */
+    return FailCnt;
+}
+
+/* End of file */
@@ -17,6 +17,8 @@
                         TD 11 document and subsequent discussions on the
                         wp3audio@yahoogroups.com email reflector.
    March 06   v2.1      Changed to improve portability.
+   17.Oct.26  v2.4      BASOP_TLS storage class of the operator flags and
+                        complexity counters.
 
   ============================================================================
 */
@@ -96,6 +98,31 @@ typedef int Flag;
 #endif /* ifdef ORIGINAL_TYPEDEF_H */
 
 
+/*_____________________
+ |                     |
+ | Thread-local state. |
+ |_____________________|
+*/
+
+/*
+ * With BASOP_THREADS defined, the flags Overflow and Carry and the
+ * complexity counters (count.c) are thread-local: each thread has its own
+ * copy, and several threads may run basic operators at the same time.
+ * BASOP_TLS must then appear in all the declarations of these variables.
+ */
+#ifdef BASOP_THREADS
+#if defined(_MSC_VER)
+#define BASOP_TLS __declspec(thread)
+#elif defined(__GNUC__)
+#define BASOP_TLS __thread
+#else
+#define BASOP_TLS _Thread_local
+#endif
+#else /* ifdef BASOP_THREADS */
+#define BASOP_TLS
+#endif /* ifdef BASOP_THREADS */
+
+
 #endif /* ifndef _TYPEDEF_H */
 
 
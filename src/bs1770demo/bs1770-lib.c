@@ -0,0 +1,956 @@
+/*
+    Incremental loudness meter according to Recommendation ITU-R BS.1770-4
+    and EBU Tech 3341/3342 (momentary, short-term, integrated loudness and
+    loudness range), and true-peak meter according to Annex 2 of BS.1770-4.
+
+    The input is K-weighted and squared sample by sample, and the energy of
+    each 100 ms sub-block is kept in two circular buffers, from which the
+    400 ms (momentary, gating) and 3 s (short-term) block energies are
+    obtained every 100 ms. Instead of storing the energies of all gating
+    blocks, these are accumulated in loudness histograms, so that the memory
+    and the processing per update do not depend on the length of the input.
+    In the same loop, the input is 4 times oversampled by a polyphase FIR
+    interpolator and the largest absolute value is kept as the true peak.
+
+    The channels are filtered in parallel, directly on the interleaved
+    input: groups of 4 (AVX, chosen at run time) or 2 (SSE2) channels are
+    processed in lockstep, one channel per lane, with the same arithmetic
+    as the scalar code, so that the results do not depend on the path. For
+    high channel counts the groups can also be split over several threads
+    (bs1770_set_threads()).
+
+    The K-weighting filters are obtained for any sample rate from their
+    analog prototypes by the bilinear transform; at 48 kHz the coefficients
+    of Tables 1 and 2 of BS.1770 are used.
+
+    See LICENSE.md for terms.
+
+    HISTORY:
+    17.Oct.2026  First version, factored out of bs1770demo.c
+    17.Oct.2026  Added the true-peak meter
+    17.Oct.2026  Channel-parallel (SIMD, threads) filtering, any sample rate
+    17.Oct.2026  Threads of ugst_pool_run() (ugst-pool.c)
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "bs1770-lib.h"
+#include "ugst-pool.h"
+
+/* SIMD instruction sets for the channel-parallel filtering */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BS1770_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(BS1770_HAVE_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BS1770_HAVE_AVX
+#include <immintrin.h>
+#endif
+
+#define MAX_ITERATIONS            10
+#define RELATIVE_DIFF             0.0001
+#define LRA_LOW_PERCENTILE        0.10
+#define LRA_HIGH_PERCENTILE       0.95
+#define MAX_THREADS               8          /* Upper limit of bs1770_set_threads()         */
+#define MIN_CH_PER_THREAD         4          /* Channels are split in groups of this size   */
+#define BS1770_PI                 3.14159265358979323846
+
+/* R - REC - BS.1770 - 2 - 201103.pdf, Table 1, Filter coefficients for stage 1 of the pre - filter to model a spherical head */
+static const double B1[3] = { 1.53512485958697, -2.69169618940638, 1.19839281085285 };
+static const double A1[3] = { 1.0,              -1.69065929318241, 0.73248077421585 };
+
+/* R - REC - BS.1770 - 2 - 201103.pdf, Table 2, Filter coefficients for the RLB weighting curve */
+static const double B2[3] = { 1.0,              -2.0,              1.0              };
+static const double A2[3] = { 1.0,              -1.99004745483398, 0.99007225036621 };
+
+/* Analog prototypes of both filters, from which the tables above are obtained at 48 kHz */
+#define PRE_F0                    1681.974450955533   /* Shelving filter: centre frequency (Hz) */
+#define PRE_GAIN                  3.999843853973347   /*                  high frequency gain (dB) */
+#define PRE_Q                     0.7071752369554196  /*                  quality factor */
+#define PRE_VB_EXP                0.4996667741545416  /*                  exponent of the band gain */
+#define RLB_F0                    38.13547087602444   /* High-pass filter: cut-off frequency (Hz) */
+#define RLB_Q                     0.5003270373238773  /*                   quality factor */
+
+/* R - REC - BS.1770 - 4 - 201510.pdf, Annex 2, Polyphase FIR interpolating filter for 4x oversampling */
+static const double H_TP[BS1770_TP_PHASES][BS1770_TP_TAPS] = {
+    {  0.0017089843750,  0.0109863281250, -0.0196533203125,  0.0332031250000, -0.0594482421875,  0.1373291015625,
+       0.9721679687500, -0.1022949218750,  0.0476074218750, -0.0266113281250,  0.0148925781250, -0.0083007812500 },
+    { -0.0291748046875,  0.0292968750000, -0.0517578125000,  0.0891113281250, -0.1665039062500,  0.4650878906250,
+       0.7797851562500, -0.2003173828125,  0.1015625000000, -0.0582275390625,  0.0330810546875, -0.0189208984375 },
+    { -0.0189208984375,  0.0330810546875, -0.0582275390625,  0.1015625000000, -0.2003173828125,  0.7797851562500,
+       0.4650878906250, -0.1665039062500,  0.0891113281250, -0.0517578125000,  0.0292968750000, -0.0291748046875 },
+    { -0.0083007812500,  0.0148925781250, -0.0266113281250,  0.0476074218750, -0.1022949218750,  0.9721679687500,
+       0.1373291015625, -0.0594482421875,  0.0332031250000, -0.0196533203125,  0.0109863281250,  0.0017089843750 }
+};
+
+/* Input filtered by the threads, in groups of per_thread channels */
+typedef struct
+{
+    BS1770_STATE *st;
+    const short *input;
+    long length;
+    long per_thread;
+} BS1770_JOB;
+
+
+/*-------------------------------------------------
+ * Histogram bin of a loudness value
+ *-------------------------------------------------*/
+static long hist_bin(             /* o: Bin index          */
+    const double loudness,        /* i: Loudness (LKFS)    */
+    const double lmin,            /* i: Lower edge of bin 0 */
+    const long nbins              /* i: Number of bins     */
+)
+{
+    double k;
+
+    k = floor( (loudness - lmin) / BS1770_HIST_STEP );
+    if( k < 0.0 )
+    {
+        return 0;
+    }
+    if( k >= (double) nbins )
+    {
+        return nbins - 1;
+    }
+    return (long) k;
+}
+
+/*-------------------------------------------------
+ * First histogram bin whose centre is above the
+ * threshold
+ *-------------------------------------------------*/
+static long hist_first_bin(       /* o: Bin index [0..nbins] */
+    const double threshold,       /* i: Threshold (LKFS)   */
+    const double lmin,            /* i: Lower edge of bin 0 */
+    const long nbins              /* i: Number of bins     */
+)
+{
+    double k;
+
+    k = floor( (threshold - lmin) / BS1770_HIST_STEP - 0.5 ) + 1.0;
+    if( k < 0.0 )
+    {
+        return 0;
+    }
+    if( k > (double) nbins )
+    {
+        return nbins;
+    }
+    return (long) k;
+}
+
+/*-------------------------------------------------
+ * K-weighting filter coefficients for sample rate
+ * fs, by the bilinear transform (prewarped at the
+ * characteristic frequency) of the analog
+ * prototypes
+ *-------------------------------------------------*/
+static void k_filter_coefs(
+    BS1770_STATE *st,             /* i/o: state (b1, a1, b2, a2)   */
+    const long fs                 /* i: Sample rate                */
+)
+{
+    double K, Vh, Vb, a0;
+
+    if( fs == 48000 )
+    {
+        memcpy( st->b1, B1, sizeof( B1 ) );
+        memcpy( st->a1, A1, sizeof( A1 ) );
+        memcpy( st->b2, B2, sizeof( B2 ) );
+        memcpy( st->a2, A2, sizeof( A2 ) );
+        return;
+    }
+
+    /* High shelving pre-filter */
+    K = tan( BS1770_PI * PRE_F0 / fs );
+    Vh = pow( 10.0, PRE_GAIN / 20.0 );
+    Vb = pow( Vh, PRE_VB_EXP );
+    a0 = 1.0 + K / PRE_Q + K * K;
+    st->b1[0] = (Vh + Vb * K / PRE_Q + K * K) / a0;
+    st->b1[1] = 2.0 * (K * K - Vh) / a0;
+    st->b1[2] = (Vh - Vb * K / PRE_Q + K * K) / a0;
+    st->a1[0] = 1.0;
+    st->a1[1] = 2.0 * (K * K - 1.0) / a0;
+    st->a1[2] = (1.0 - K / PRE_Q + K * K) / a0;
+
+    /* RLB high-pass filter */
+    K = tan( BS1770_PI * RLB_F0 / fs );
+    a0 = 1.0 + K / RLB_Q + K * K;
+    st->b2[0] = 1.0;
+    st->b2[1] = -2.0;
+    st->b2[2] = 1.0;
+    st->a2[0] = 1.0;
+    st->a2[1] = 2.0 * (K * K - 1.0) / a0;
+    st->a2[2] = (1.0 - K / RLB_Q + K * K) / a0;
+
+    return;
+}
+
+BS1770_STATE *bs1770_init(
+    const long nchan,             /* i: Number of channels [1..BS1770_MAX_CH_NUMBER] */
+    const double *G,              /* i: Channel weights                              */
+    const long fs                 /* i: Sample rate [BS1770_FS_MIN..BS1770_FS_MAX]   */
+)
+{
+    BS1770_STATE *st;
+    long i;
+
+    if( nchan < 1 || nchan > BS1770_MAX_CH_NUMBER || fs < BS1770_FS_MIN || fs > BS1770_FS_MAX )
+    {
+        return NULL;
+    }
+    if( (st = malloc( sizeof( BS1770_STATE ) )) == NULL )
+    {
+        return NULL;
+    }
+    st->nchan = nchan;
+    st->fs = fs;
+    st->step_size = (fs + 5) / 10;
+    for( i = 0; i < nchan; i++ )
+    {
+        st->G[i] = G[i];
+    }
+    k_filter_coefs( st, fs );
+
+    /* Oversampling to at least 192 kHz, by a subset of the 4 phases above 48 kHz */
+    st->tp_step = (fs >= 4 * 48000) ? 4 : (fs >= 2 * 48000) ? 2 : 1;
+    st->threads = 1;
+    bs1770_reset( st );
+
+    return st;
+}
+
+long bs1770_set_threads(          /* o: Number of threads that will be used */
+    BS1770_STATE *st,             /* i/o: state                             */
+    const long threads            /* i: Requested number of threads         */
+)
+{
+#ifdef HAVE_PTHREAD
+    st->threads = threads < 1 ? 1 : threads > MAX_THREADS ? MAX_THREADS : threads;
+#else
+    (void) threads;
+    st->threads = 1;
+#endif
+
+    return st->threads;
+}
+
+void bs1770_reset(
+    BS1770_STATE *st              /* i/o: state */
+)
+{
+    long k;
+
+    memset( st->x1, 0, sizeof( st->x1 ) );
+    memset( st->x2, 0, sizeof( st->x2 ) );
+    memset( st->y1, 0, sizeof( st->y1 ) );
+    memset( st->y2, 0, sizeof( st->y2 ) );
+    memset( st->z1, 0, sizeof( st->z1 ) );
+    memset( st->z2, 0, sizeof( st->z2 ) );
+    memset( st->acc, 0, sizeof( st->acc ) );
+    memset( st->tp_mem, 0, sizeof( st->tp_mem ) );
+    memset( st->tp_peak, 0, sizeof( st->tp_peak ) );
+    st->tp_pos = 0;
+    st->pos = 0;
+    st->n_sub = 0;
+    for( k = 0; k < BS1770_SUB_BLOCKS; k++ )
+    {
+        st->e_tmp[k] = 0.0;
+    }
+    for( k = 0; k < BS1770_ST_SUB_BLOCKS; k++ )
+    {
+        st->e_st[k] = 0.0;
+    }
+    st->momentary = -HUGE_VAL;
+    st->shortterm = -HUGE_VAL;
+    st->momentary_max = -HUGE_VAL;
+    st->shortterm_max = -HUGE_VAL;
+
+    for( k = 0; k < BS1770_HIST_BINS; k++ )
+    {
+        st->hist.count[k] = 0;
+        st->hist.energy[k] = 0.0;
+    }
+    st->hist.n_blocks = 0;
+    st->hist.n_zero = 0;
+    for( k = 0; k < BS1770_LRA_HIST_BINS; k++ )
+    {
+        st->lra_hist.count[k] = 0;
+        st->lra_hist.energy[k] = 0.0;
+    }
+    st->lra_hist.n_blocks = 0;
+
+    return;
+}
+
+void bs1770_free(
+    BS1770_STATE *st              /* i/o: state */
+)
+{
+    free( st );
+
+    return;
+}
+
+/*-------------------------------------------------
+ * End of a 100 ms sub-block: update the momentary
+ * and short-term loudness and the histograms
+ *-------------------------------------------------*/
+static void end_sub_block(
+    BS1770_STATE *st              /* i/o: state */
+)
+{
+    long i, k;
+    double e_sub, e;
+
+    /* Energy of the sub-block, weighted sum over channels */
+    e_sub = 0;
+    for( i = 0; i < st->nchan; i++ )
+    {
+        e_sub += st->G[i] * st->acc[i];
+        st->acc[i] = 0.0;
+    }
+    st->e_tmp[st->n_sub % BS1770_SUB_BLOCKS] = e_sub;
+    st->e_st[st->n_sub % BS1770_ST_SUB_BLOCKS] = e_sub;
+    st->n_sub++;
+    st->pos = 0;
+
+    /* Gating block (400 ms), excluding incomplete blocks */
+    if( st->n_sub >= BS1770_SUB_BLOCKS )
+    {
+        e = ( st->e_tmp[0] + st->e_tmp[1] + st->e_tmp[2] + st->e_tmp[3] ) / ((double)(BS1770_SUB_BLOCKS * st->step_size));
+        st->momentary = BS1770_LKFS_OFFSET + 10 * log10( e );
+        if( st->momentary > st->momentary_max )
+        {
+            st->momentary_max = st->momentary;
+        }
+        st->hist.n_blocks++;
+        if( e == 0.0 )
+        {
+            st->hist.n_zero++;
+        }
+        else
+        {
+            k = hist_bin( st->momentary, BS1770_HIST_MIN, BS1770_HIST_BINS );
+            st->hist.count[k]++;
+            st->hist.energy[k] += e;
+        }
+    }
+
+    /* Short-term block (3 s) */
+    if( st->n_sub >= BS1770_ST_SUB_BLOCKS )
+    {
+        e = 0;
+        for( k = 0; k < BS1770_ST_SUB_BLOCKS; k++ )
+        {
+            e += st->e_st[k];
+        }
+        e /= (double)(BS1770_ST_SUB_BLOCKS * st->step_size);
+        st->shortterm = BS1770_LKFS_OFFSET + 10 * log10( e );
+        if( st->shortterm > st->shortterm_max )
+        {
+            st->shortterm_max = st->shortterm;
+        }
+        if( st->shortterm > BS1770_ABSOLUTE_THRESHOLD )
+        {
+            k = hist_bin( st->shortterm, BS1770_LRA_HIST_MIN, BS1770_LRA_HIST_BINS );
+            st->lra_hist.count[k]++;
+            st->lra_hist.energy[k] += e;
+            st->lra_hist.n_blocks++;
+        }
+    }
+
+    return;
+}
+
+/*-------------------------------------------------
+ * K-weighting, energy accumulation and true-peak
+ * interpolation of one channel
+ *
+ * y(n) = b[0] * x(n) + b[1] * x(n-1) + b[2] * x(n-2)
+ *                    - a[1] * y(n-1) - a[2] * y(n-2)
+ * for the pre-filter, then for the RLB filter. The
+ * true-peak memory holds each sample twice, so that
+ * tp_mem[pos..pos+TAPS-1] is x(n), x(n-1), ...
+ *-------------------------------------------------*/
+static void kweight_channel(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length,            /* i: Number of samples per channel  */
+    const long c                  /* i: Channel                        */
+)
+{
+    long n, p, k, pos;
+    const short *p_input;
+    double x, x1, x2, y, y1, y2, z, z1, z2, acc, peak, t;
+
+    x1 = st->x1[c];
+    x2 = st->x2[c];
+    y1 = st->y1[c];
+    y2 = st->y2[c];
+    z1 = st->z1[c];
+    z2 = st->z2[c];
+    acc = st->acc[c];
+    peak = st->tp_peak[c];
+    pos = st->tp_pos;
+    p_input = input + c;
+    for( n = 0; n < length; n++ )
+    {
+        x = ((double)(p_input[n * st->nchan])) / 32768.0;
+        y = st->b1[0] * x + st->b1[1] * x1 + st->b1[2] * x2
+                          - st->a1[1] * y1 - st->a1[2] * y2;
+        z = st->b2[0] * y + st->b2[1] * y1 + st->b2[2] * y2
+                          - st->a2[1] * z1 - st->a2[2] * z2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        z2 = z1;
+        z1 = z;
+        acc = acc + z * z;
+
+        pos = (pos == 0) ? BS1770_TP_TAPS - 1 : pos - 1;
+        st->tp_mem[pos][c] = x;
+        st->tp_mem[pos + BS1770_TP_TAPS][c] = x;
+        for( p = 0; p < BS1770_TP_PHASES; p += st->tp_step )
+        {
+            t = 0.0;
+            for( k = 0; k < BS1770_TP_TAPS; k++ )
+            {
+                t += H_TP[p][k] * st->tp_mem[pos + k][c];
+            }
+            t = fabs( t );
+            if( t > peak )
+            {
+                peak = t;
+            }
+        }
+    }
+    st->x1[c] = x1;
+    st->x2[c] = x2;
+    st->y1[c] = y1;
+    st->y2[c] = y2;
+    st->z1[c] = z1;
+    st->z2[c] = z2;
+    st->acc[c] = acc;
+    st->tp_peak[c] = peak;
+
+    return;
+}
+
+#ifdef BS1770_HAVE_SSE2
+/*-------------------------------------------------
+ * As kweight_channel(), for channels c and c+1 in
+ * lockstep (SSE2)
+ *-------------------------------------------------*/
+static void kweight_channels_sse2(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length,            /* i: Number of samples per channel  */
+    const long c                  /* i: First channel                  */
+)
+{
+    long n, p, k, pos;
+    int pair;
+    __m128i v;
+    __m128d x, x1, x2, y, y1, y2, z, z1, z2, acc, peak, t;
+    const __m128d scale = _mm_set1_pd( 1.0 / 32768.0 );
+    const __m128d sign = _mm_set1_pd( -0.0 );
+
+    x1 = _mm_loadu_pd( st->x1 + c );
+    x2 = _mm_loadu_pd( st->x2 + c );
+    y1 = _mm_loadu_pd( st->y1 + c );
+    y2 = _mm_loadu_pd( st->y2 + c );
+    z1 = _mm_loadu_pd( st->z1 + c );
+    z2 = _mm_loadu_pd( st->z2 + c );
+    acc = _mm_loadu_pd( st->acc + c );
+    peak = _mm_loadu_pd( st->tp_peak + c );
+    pos = st->tp_pos;
+    for( n = 0; n < length; n++ )
+    {
+        /* x(n) of both channels; the scaling by a power of 2 is exact, as the division */
+        memcpy( &pair, input + n * st->nchan + c, sizeof( pair ) );
+        v = _mm_cvtsi32_si128( pair );
+        v = _mm_srai_epi32( _mm_unpacklo_epi16( v, v ), 16 );
+        x = _mm_mul_pd( _mm_cvtepi32_pd( v ), scale );
+
+        y = _mm_add_pd( _mm_mul_pd( _mm_set1_pd( st->b1[0] ), x ), _mm_mul_pd( _mm_set1_pd( st->b1[1] ), x1 ) );
+        y = _mm_add_pd( y, _mm_mul_pd( _mm_set1_pd( st->b1[2] ), x2 ) );
+        y = _mm_sub_pd( y, _mm_mul_pd( _mm_set1_pd( st->a1[1] ), y1 ) );
+        y = _mm_sub_pd( y, _mm_mul_pd( _mm_set1_pd( st->a1[2] ), y2 ) );
+        z = _mm_add_pd( _mm_mul_pd( _mm_set1_pd( st->b2[0] ), y ), _mm_mul_pd( _mm_set1_pd( st->b2[1] ), y1 ) );
+        z = _mm_add_pd( z, _mm_mul_pd( _mm_set1_pd( st->b2[2] ), y2 ) );
+        z = _mm_sub_pd( z, _mm_mul_pd( _mm_set1_pd( st->a2[1] ), z1 ) );
+        z = _mm_sub_pd( z, _mm_mul_pd( _mm_set1_pd( st->a2[2] ), z2 ) );
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        z2 = z1;
+        z1 = z;
+        acc = _mm_add_pd( acc, _mm_mul_pd( z, z ) );
+
+        pos = (pos == 0) ? BS1770_TP_TAPS - 1 : pos - 1;
+        _mm_storeu_pd( st->tp_mem[pos] + c, x );
+        _mm_storeu_pd( st->tp_mem[pos + BS1770_TP_TAPS] + c, x );
+        for( p = 0; p < BS1770_TP_PHASES; p += st->tp_step )
+        {
+            t = _mm_setzero_pd();
+            for( k = 0; k < BS1770_TP_TAPS; k++ )
+            {
+                t = _mm_add_pd( t, _mm_mul_pd( _mm_set1_pd( H_TP[p][k] ), _mm_loadu_pd( st->tp_mem[pos + k] + c ) ) );
+            }
+            peak = _mm_max_pd( _mm_andnot_pd( sign, t ), peak );
+        }
+    }
+    _mm_storeu_pd( st->x1 + c, x1 );
+    _mm_storeu_pd( st->x2 + c, x2 );
+    _mm_storeu_pd( st->y1 + c, y1 );
+    _mm_storeu_pd( st->y2 + c, y2 );
+    _mm_storeu_pd( st->z1 + c, z1 );
+    _mm_storeu_pd( st->z2 + c, z2 );
+    _mm_storeu_pd( st->acc + c, acc );
+    _mm_storeu_pd( st->tp_peak + c, peak );
+
+    return;
+}
+#endif
+
+#ifdef BS1770_HAVE_AVX
+/*-------------------------------------------------
+ * As kweight_channel(), for channels c..c+3 in
+ * lockstep (AVX)
+ *-------------------------------------------------*/
+__attribute__ ((target ("avx")))
+static void kweight_channels_avx(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length,            /* i: Number of samples per channel  */
+    const long c                  /* i: First channel                  */
+)
+{
+    long n, p, k, pos;
+    __m256d x, x1, x2, y, y1, y2, z, z1, z2, acc, peak, t;
+    const __m256d scale = _mm256_set1_pd( 1.0 / 32768.0 );
+    const __m256d sign = _mm256_set1_pd( -0.0 );
+
+    x1 = _mm256_loadu_pd( st->x1 + c );
+    x2 = _mm256_loadu_pd( st->x2 + c );
+    y1 = _mm256_loadu_pd( st->y1 + c );
+    y2 = _mm256_loadu_pd( st->y2 + c );
+    z1 = _mm256_loadu_pd( st->z1 + c );
+    z2 = _mm256_loadu_pd( st->z2 + c );
+    acc = _mm256_loadu_pd( st->acc + c );
+    peak = _mm256_loadu_pd( st->tp_peak + c );
+    pos = st->tp_pos;
+    for( n = 0; n < length; n++ )
+    {
+        /* x(n) of the 4 channels; the scaling by a power of 2 is exact, as the division */
+        x = _mm256_mul_pd( _mm256_cvtepi32_pd( _mm_cvtepi16_epi32( _mm_loadl_epi64( (const __m128i *)(input + n * st->nchan + c) ) ) ), scale );
+
+        y = _mm256_add_pd( _mm256_mul_pd( _mm256_set1_pd( st->b1[0] ), x ), _mm256_mul_pd( _mm256_set1_pd( st->b1[1] ), x1 ) );
+        y = _mm256_add_pd( y, _mm256_mul_pd( _mm256_set1_pd( st->b1[2] ), x2 ) );
+        y = _mm256_sub_pd( y, _mm256_mul_pd( _mm256_set1_pd( st->a1[1] ), y1 ) );
+        y = _mm256_sub_pd( y, _mm256_mul_pd( _mm256_set1_pd( st->a1[2] ), y2 ) );
+        z = _mm256_add_pd( _mm256_mul_pd( _mm256_set1_pd( st->b2[0] ), y ), _mm256_mul_pd( _mm256_set1_pd( st->b2[1] ), y1 ) );
+        z = _mm256_add_pd( z, _mm256_mul_pd( _mm256_set1_pd( st->b2[2] ), y2 ) );
+        z = _mm256_sub_pd( z, _mm256_mul_pd( _mm256_set1_pd( st->a2[1] ), z1 ) );
+        z = _mm256_sub_pd( z, _mm256_mul_pd( _mm256_set1_pd( st->a2[2] ), z2 ) );
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        z2 = z1;
+        z1 = z;
+        acc = _mm256_add_pd( acc, _mm256_mul_pd( z, z ) );
+
+        pos = (pos == 0) ? BS1770_TP_TAPS - 1 : pos - 1;
+        _mm256_storeu_pd( st->tp_mem[pos] + c, x );
+        _mm256_storeu_pd( st->tp_mem[pos + BS1770_TP_TAPS] + c, x );
+        for( p = 0; p < BS1770_TP_PHASES; p += st->tp_step )
+        {
+            t = _mm256_setzero_pd();
+            for( k = 0; k < BS1770_TP_TAPS; k++ )
+            {
+                t = _mm256_add_pd( t, _mm256_mul_pd( _mm256_set1_pd( H_TP[p][k] ), _mm256_loadu_pd( st->tp_mem[pos + k] + c ) ) );
+            }
+            peak = _mm256_max_pd( _mm256_andnot_pd( sign, t ), peak );
+        }
+    }
+    _mm256_storeu_pd( st->x1 + c, x1 );
+    _mm256_storeu_pd( st->x2 + c, x2 );
+    _mm256_storeu_pd( st->y1 + c, y1 );
+    _mm256_storeu_pd( st->y2 + c, y2 );
+    _mm256_storeu_pd( st->z1 + c, z1 );
+    _mm256_storeu_pd( st->z2 + c, z2 );
+    _mm256_storeu_pd( st->acc + c, acc );
+    _mm256_storeu_pd( st->tp_peak + c, peak );
+
+    return;
+}
+#endif
+
+/*-------------------------------------------------
+ * K-weighting of channels c0..c1-1, by groups of
+ * lanes of the widest available instruction set
+ *-------------------------------------------------*/
+static void kweight_channels(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length,            /* i: Number of samples per channel  */
+    const long c0,                /* i: First channel                  */
+    const long c1                 /* i: Last channel + 1               */
+)
+{
+    long c;
+
+    c = c0;
+#ifdef BS1770_HAVE_AVX
+    if( __builtin_cpu_supports( "avx" ) )
+    {
+        for( ; c + 4 <= c1; c += 4 )
+        {
+            kweight_channels_avx( st, input, length, c );
+        }
+    }
+#endif
+#ifdef BS1770_HAVE_SSE2
+    for( ; c + 2 <= c1; c += 2 )
+    {
+        kweight_channels_sse2( st, input, length, c );
+    }
+#endif
+    for( ; c < c1; c++ )
+    {
+        kweight_channel( st, input, length, c );
+    }
+
+    return;
+}
+
+/*-------------------------------------------------
+ * Job k of the thread pool: channel group k
+ *-------------------------------------------------*/
+static void kweight_job(
+    void *ctx,                    /* i: BS1770_JOB                     */
+    long k                        /* i: Channel group                  */
+)
+{
+    BS1770_JOB *job = (BS1770_JOB *) ctx;
+    long c0, c1;
+
+    c0 = k * job->per_thread < job->st->nchan ? k * job->per_thread : job->st->nchan;
+    c1 = (k + 1) * job->per_thread < job->st->nchan ? (k + 1) * job->per_thread : job->st->nchan;
+    kweight_channels( job->st, job->input, job->length, c0, c1 );
+
+    return;
+}
+
+/*-------------------------------------------------
+ * K-weighting of all channels, split in channel
+ * groups over st->threads threads (the calling
+ * thread included, see ugst_pool_run()).
+ *-------------------------------------------------*/
+static void kweight(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length             /* i: Number of samples per channel  */
+)
+{
+    BS1770_JOB job;
+    long nthreads, ngroups;
+
+    ngroups = (st->nchan + MIN_CH_PER_THREAD - 1) / MIN_CH_PER_THREAD;
+    nthreads = st->threads < ngroups ? st->threads : ngroups;
+    if( nthreads > 1 )
+    {
+        job.st = st;
+        job.input = input;
+        job.length = length;
+        job.per_thread = (ngroups + nthreads - 1) / nthreads * MIN_CH_PER_THREAD;
+        ugst_pool_run( kweight_job, &job, nthreads, (int) nthreads );
+        return;
+    }
+    kweight_channels( st, input, length, 0, st->nchan );
+
+    return;
+}
+
+long bs1770_process(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length             /* i: Number of samples per channel  */
+)
+{
+    long len, done, n_sub;
+
+    n_sub = st->n_sub;
+    for( done = 0; done < length; done += len )
+    {
+        /* Process up to the end of the current sub-block */
+        len = st->step_size - st->pos;
+        if( len > length - done )
+        {
+            len = length - done;
+        }
+
+        kweight( st, input + done * st->nchan, len );
+        st->tp_pos = (st->tp_pos + BS1770_TP_TAPS - len % BS1770_TP_TAPS) % BS1770_TP_TAPS;
+
+        st->pos += len;
+        if( st->pos == st->step_size )
+        {
+            end_sub_block( st );
+        }
+    }
+
+    return st->n_sub - n_sub;
+}
+
+/*-------------------------------------------------
+ * True-peak interpolation only, for input that is
+ * not part of the loudness measurement
+ *-------------------------------------------------*/
+void bs1770_process_peak(
+    BS1770_STATE *st,             /* i/o: state                        */
+    const short *input,           /* i: Interleaved 16 bit input       */
+    const long length             /* i: Number of samples per channel  */
+)
+{
+    long c, n, p, k, pos;
+    double x, t;
+
+    pos = st->tp_pos;
+    for( n = 0; n < length; n++ )
+    {
+        pos = (pos == 0) ? BS1770_TP_TAPS - 1 : pos - 1;
+        for( c = 0; c < st->nchan; c++ )
+        {
+            x = ((double)(input[n * st->nchan + c])) / 32768.0;
+            st->tp_mem[pos][c] = x;
+            st->tp_mem[pos + BS1770_TP_TAPS][c] = x;
+            for( p = 0; p < BS1770_TP_PHASES; p += st->tp_step )
+            {
+                t = 0.0;
+                for( k = 0; k < BS1770_TP_TAPS; k++ )
+                {
+                    t += H_TP[p][k] * st->tp_mem[pos + k][c];
+                }
+                t = fabs( t );
+                if( t > st->tp_peak[c] )
+                {
+                    st->tp_peak[c] = t;
+                }
+            }
+        }
+    }
+    st->tp_pos = pos;
+
+    return;
+}
+
+double bs1770_true_peak(
+    const BS1770_STATE *st,       /* i: state                          */
+    const long c                  /* i: Channel, or -1 for all channels */
+)
+{
+    long i;
+    double peak;
+
+    if( c >= 0 )
+    {
+        return 20 * log10( st->tp_peak[c] );
+    }
+    peak = 0.0;
+    for( i = 0; i < st->nchan; i++ )
+    {
+        if( st->tp_peak[i] > peak )
+        {
+            peak = st->tp_peak[i];
+        }
+    }
+    return 20 * log10( peak );
+}
+
+double bs1770_momentary(
+    const BS1770_STATE *st        /* i: state */
+)
+{
+    return st->momentary;
+}
+
+double bs1770_shortterm(
+    const BS1770_STATE *st        /* i: state */
+)
+{
+    return st->shortterm;
+}
+
+double bs1770_momentary_max(
+    const BS1770_STATE *st        /* i: state */
+)
+{
+    return st->momentary_max;
+}
+
+double bs1770_shortterm_max(
+    const BS1770_STATE *st        /* i: state */
+)
+{
+    return st->shortterm_max;
+}
+
+/*-------------------------------------------------
+ * Gated loudness from the histogram. A scaling by
+ * fac shifts all block loudness values by
+ * 20*log10(fac), i.e. the threshold by the opposite
+ * amount. Blocks are compared with the threshold by
+ * the centre of their bin.
+ *-------------------------------------------------*/
+double bs1770_gated_loudness(
+    const BS1770_STATE *st,       /* i: state                          */
+    const double fac,             /* i: Scaling factor                 */
+    const double threshold,       /* i: LKFS threshold                 */
+    const short rms_flag          /* i: Flag for RMS (no gating)       */
+)
+{
+    long k;
+    long count;
+    double energy = 0.0;
+
+    count = 0;
+    if( rms_flag )
+    {
+        k = 0;
+        count = st->hist.n_zero;
+    }
+    else
+    {
+        k = hist_first_bin( threshold - 20 * log10( fac ), BS1770_HIST_MIN, BS1770_HIST_BINS );
+    }
+    for( ; k < BS1770_HIST_BINS; k++ )
+    {
+        energy += st->hist.energy[k];
+        count += st->hist.count[k];
+    }
+
+    if ( count == 0 )
+    {
+        return BS1770_ZERO_BLOCKS; /* Send invalid value to indicate that zero blocks were above threshold */
+    }
+    else
+    {
+        return BS1770_LKFS_OFFSET + 10 * log10( energy * fac * fac / count );
+    }
+}
+
+double bs1770_integrated(
+    const BS1770_STATE *st,       /* i: state                          */
+    const double fac,             /* i: Scaling factor                 */
+    const short rms_flag          /* i: Flag for RMS (no gating)       */
+)
+{
+    double relative_threshold;
+
+    relative_threshold = bs1770_gated_loudness( st, fac, BS1770_ABSOLUTE_THRESHOLD, rms_flag ) + BS1770_RELATIVE_THRESHOLD_OFFSET;
+    if( BS1770_ABSOLUTE_THRESHOLD > relative_threshold )
+    {
+        relative_threshold = BS1770_ABSOLUTE_THRESHOLD;
+    }
+    return bs1770_gated_loudness( st, fac, relative_threshold, rms_flag );
+}
+
+double bs1770_find_scaling_factor(
+    const BS1770_STATE *st,       /* i: state                          */
+    const double lev,             /* i: Target level                   */
+    const short rms_flag,         /* i: Flag for RMS (no gating)       */
+    double *lev_input,            /* o: Input level                    */
+    double *lev_obtained          /* o: Obtained level                 */
+)
+{
+    long itr;
+    double last_fac;
+    double fac;
+    double gated_loudness_final;
+
+    last_fac = 100.0; /* Dummy init to trigger first iteration */
+    fac = 1.0;
+    itr = 0;
+    gated_loudness_final = BS1770_ZERO_BLOCKS;
+    /* Since a rescaling affects the relative gating threshold the factor is found iteratively */
+    while( (fabs( 1.0 - fac / last_fac ) > RELATIVE_DIFF) && (itr < MAX_ITERATIONS) )
+    {
+        gated_loudness_final = bs1770_integrated( st, fac, rms_flag );
+        last_fac = fac;
+        fac *= pow( 10.0, (lev - gated_loudness_final) / 20.0 );
+        if( itr == 0 )
+        {
+            *lev_input = gated_loudness_final;
+        }
+        itr++;
+    }
+
+    *lev_obtained = gated_loudness_final;
+    return fac;
+}
+
+/*-------------------------------------------------
+ * Loudness range (EBU Tech 3342): difference of the
+ * 95th and 10th percentiles of the short-term
+ * loudness distribution, after an absolute gate at
+ * -70 LKFS and a relative gate 20 LU below the
+ * energy mean of the remaining blocks
+ *-------------------------------------------------*/
+double bs1770_loudness_range(
+    const BS1770_STATE *st        /* i: state */
+)
+{
+    long k, k0, count, n, n_low, n_high;
+    double energy, low, high;
+
+    if( st->lra_hist.n_blocks == 0 )
+    {
+        return 0.0;
+    }
+
+    /* Relative gate */
+    energy = 0.0;
+    for( k = 0; k < BS1770_LRA_HIST_BINS; k++ )
+    {
+        energy += st->lra_hist.energy[k];
+    }
+    k0 = hist_first_bin( BS1770_LKFS_OFFSET + 10 * log10( energy / st->lra_hist.n_blocks ) + BS1770_LRA_RELATIVE_THRESHOLD_OFFSET,
+                         BS1770_LRA_HIST_MIN, BS1770_LRA_HIST_BINS );
+    count = 0;
+    for( k = k0; k < BS1770_LRA_HIST_BINS; k++ )
+    {
+        count += st->lra_hist.count[k];
+    }
+    if( count == 0 )
+    {
+        return 0.0;
+    }
+
+    /* Percentiles, at the centre of the bins */
+    n_low = (long)( (count - 1) * LRA_LOW_PERCENTILE + 0.5 );
+    n_high = (long)( (count - 1) * LRA_HIGH_PERCENTILE + 0.5 );
+    low = high = 0.0;
+    n = 0;
+    for( k = k0; k < BS1770_LRA_HIST_BINS; k++ )
+    {
+        if( n <= n_low && n_low < n + st->lra_hist.count[k] )
+        {
+            low = BS1770_LRA_HIST_MIN + (k + 0.5) * BS1770_HIST_STEP;
+        }
+        if( n <= n_high && n_high < n + st->lra_hist.count[k] )
+        {
+            high = BS1770_LRA_HIST_MIN + (k + 0.5) * BS1770_HIST_STEP;
+            break;
+        }
+        n += st->lra_hist.count[k];
+    }
+
+    return high - low;
+}
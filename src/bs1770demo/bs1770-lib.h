@@ -0,0 +1,170 @@
+/*
+    Incremental loudness meter according to Recommendation ITU-R BS.1770-4
+    and EBU Tech 3341/3342 (momentary, short-term, integrated loudness and
+    loudness range), and true-peak meter according to Annex 2 of BS.1770-4.
+
+    See LICENSE.md for terms.
+
+    HISTORY:
+    17.Oct.2026  First version, factored out of bs1770demo.c
+    17.Oct.2026  Added the true-peak meter
+    17.Oct.2026  Channel-parallel (SIMD, threads) filtering, any sample rate
+*/
+
+#ifndef BS1770_LIB_H
+#define BS1770_LIB_H
+
+#define BS1770_FS                 48000      /* Default sample rate                                        */
+#define BS1770_FS_MIN             8000       /* Range of supported sample rates                            */
+#define BS1770_FS_MAX             384000
+#define BS1770_MAX_CH_NUMBER      24
+#define BS1770_SUB_BLOCKS         4          /* 400 ms gating/momentary block = 4 sub-blocks of 100 ms     */
+#define BS1770_ST_SUB_BLOCKS      30         /* 3 s short-term block = 30 sub-blocks of 100 ms             */
+#define BS1770_LKFS_OFFSET        (-0.691)
+#define BS1770_ABSOLUTE_THRESHOLD (-70.0)
+#define BS1770_RELATIVE_THRESHOLD_OFFSET (-10.0)
+#define BS1770_LRA_RELATIVE_THRESHOLD_OFFSET (-20.0)
+#define BS1770_ZERO_BLOCKS        (1000.0f)  /* Returned when zero blocks passed the gating threshold      */
+#define BS1770_TP_PHASES          4          /* Oversampling factor of the true-peak meter                 */
+#define BS1770_TP_TAPS            12         /* Coefficients per phase of the interpolation filter         */
+
+/*
+    Loudness histograms: bins of BS1770_HIST_STEP dB, so the stored
+    block energies do not depend on the length of the input. Blocks
+    below the lowest bin (or above the highest one) are accumulated in
+    the first (last) bin. The range of the gating histogram is wide
+    enough for the absolute threshold to be met after a scaling of the
+    quietest non-zero 16-bit input to any usual target level.
+*/
+#define BS1770_HIST_STEP          0.01
+#define BS1770_HIST_MIN           (-200.0)
+#define BS1770_HIST_BINS          24000      /* [-200, +40) LKFS                                           */
+#define BS1770_LRA_HIST_MIN       BS1770_ABSOLUTE_THRESHOLD
+#define BS1770_LRA_HIST_BINS      11000      /* [-70, +40) LKFS                                            */
+
+typedef struct
+{
+    long   count[BS1770_HIST_BINS];          /* Number of gating blocks per loudness bin                   */
+    double energy[BS1770_HIST_BINS];         /* Sum of their energies                                      */
+    long   n_blocks;                         /* Number of complete gating blocks                           */
+    long   n_zero;                           /* ... of which with zero energy                              */
+} BS1770_HIST;
+
+typedef struct
+{
+    long   count[BS1770_LRA_HIST_BINS];      /* Number of short-term blocks per loudness bin               */
+    double energy[BS1770_LRA_HIST_BINS];     /* Sum of their energies                                      */
+    long   n_blocks;                         /* Number of short-term blocks above the absolute threshold   */
+} BS1770_LRA_HIST;
+
+typedef struct
+{
+    long   nchan;                            /* Number of channels                                         */
+    long   fs;                               /* Sample rate                                                */
+    long   step_size;                        /* Sub-block length (100 ms) in samples                       */
+    long   tp_step;                          /* Step between the interpolation phases used (1, 2 or 4)     */
+    long   threads;                          /* Number of threads for the filtering                        */
+    double G[BS1770_MAX_CH_NUMBER];          /* Channel weights                                            */
+    double b1[3], a1[3];                     /* Pre-filter coefficients                                    */
+    double b2[3], a2[3];                     /* RLB filter coefficients                                    */
+    /* Per-channel memories, one array per variable so that channels can be processed in parallel */
+    double x1[BS1770_MAX_CH_NUMBER];         /* x(n-1)                                                     */
+    double x2[BS1770_MAX_CH_NUMBER];         /* x(n-2)                                                     */
+    double y1[BS1770_MAX_CH_NUMBER];         /* Pre-filter output y(n-1)                                   */
+    double y2[BS1770_MAX_CH_NUMBER];         /* y(n-2)                                                     */
+    double z1[BS1770_MAX_CH_NUMBER];         /* RLB filter output z(n-1)                                   */
+    double z2[BS1770_MAX_CH_NUMBER];         /* z(n-2)                                                     */
+    double acc[BS1770_MAX_CH_NUMBER];        /* Sum of squares of the current sub-block per channel        */
+    double tp_mem[2 * BS1770_TP_TAPS][BS1770_MAX_CH_NUMBER]; /* True-peak filter memories (stored twice)    */
+    double tp_peak[BS1770_MAX_CH_NUMBER];    /* Maximum absolute value of the oversampled input            */
+    long   tp_pos;                           /* Position of the last input sample in tp_mem                */
+    long   pos;                              /* Number of samples in the current sub-block                 */
+    long   n_sub;                            /* Number of complete sub-blocks                              */
+    double e_tmp[BS1770_SUB_BLOCKS];         /* Circular buffer of sub-block energies for 400 ms blocks    */
+    double e_st[BS1770_ST_SUB_BLOCKS];       /* Circular buffer of sub-block energies for 3 s blocks       */
+    double momentary;                        /* Last momentary loudness (-Inf until the first block)       */
+    double shortterm;                        /* Last short-term loudness (-Inf until the first block)      */
+    double momentary_max;                    /* Maximum momentary loudness                                 */
+    double shortterm_max;                    /* Maximum short-term loudness                                */
+    BS1770_HIST     hist;                    /* Gating block histogram for the integrated loudness         */
+    BS1770_LRA_HIST lra_hist;                /* Short-term histogram for the loudness range                */
+} BS1770_STATE;
+
+BS1770_STATE *bs1770_init(                   /* o: state, NULL if invalid parameters or out of memory      */
+    const long nchan,                        /* i: Number of channels [1..BS1770_MAX_CH_NUMBER]            */
+    const double *G,                         /* i: Channel weights                                         */
+    const long fs                            /* i: Sample rate [BS1770_FS_MIN..BS1770_FS_MAX]              */
+);
+
+long bs1770_set_threads(                     /* o: Number of threads that will be used                     */
+    BS1770_STATE *st,                        /* i/o: state                                                 */
+    const long threads                       /* i: Requested number of threads                             */
+);
+
+void bs1770_reset(
+    BS1770_STATE *st                         /* i/o: state                                                 */
+);
+
+void bs1770_free(
+    BS1770_STATE *st                         /* i/o: state                                                 */
+);
+
+long bs1770_process(                         /* o: Number of sub-blocks (100 ms) completed by this call     */
+    BS1770_STATE *st,                        /* i/o: state                                                 */
+    const short *input,                      /* i: Interleaved 16 bit input                                */
+    const long length                        /* i: Number of samples per channel                           */
+);
+
+void bs1770_process_peak(                    /* Update of the true peak only                               */
+    BS1770_STATE *st,                        /* i/o: state                                                 */
+    const short *input,                      /* i: Interleaved 16 bit input                                */
+    const long length                        /* i: Number of samples per channel                           */
+);
+
+double bs1770_true_peak(                     /* o: True-peak level (dBTP)                                  */
+    const BS1770_STATE *st,                  /* i: state                                                   */
+    const long c                             /* i: Channel, or -1 for the maximum over all channels        */
+);
+
+double bs1770_momentary(                     /* o: Momentary loudness of the last 400 ms                   */
+    const BS1770_STATE *st                   /* i: state                                                   */
+);
+
+double bs1770_shortterm(                     /* o: Short-term loudness of the last 3 s                     */
+    const BS1770_STATE *st                   /* i: state                                                   */
+);
+
+double bs1770_momentary_max(                 /* o: Maximum momentary loudness                              */
+    const BS1770_STATE *st                   /* i: state                                                   */
+);
+
+double bs1770_shortterm_max(                 /* o: Maximum short-term loudness                             */
+    const BS1770_STATE *st                   /* i: state                                                   */
+);
+
+double bs1770_gated_loudness(                /* o: Loudness of the blocks above threshold, or ZERO_BLOCKS  */
+    const BS1770_STATE *st,                  /* i: state                                                   */
+    const double fac,                        /* i: Scaling factor                                          */
+    const double threshold,                  /* i: LKFS threshold                                          */
+    const short rms_flag                     /* i: Flag for RMS (no gating)                                */
+);
+
+double bs1770_integrated(                    /* o: Gated loudness with adaptive threshold, or ZERO_BLOCKS  */
+    const BS1770_STATE *st,                  /* i: state                                                   */
+    const double fac,                        /* i: Scaling factor                                          */
+    const short rms_flag                     /* i: Flag for RMS (no gating)                                */
+);
+
+double bs1770_find_scaling_factor(           /* o: Scaling factor                                          */
+    const BS1770_STATE *st,                  /* i: state                                                   */
+    const double lev,                        /* i: Target level                                            */
+    const short rms_flag,                    /* i: Flag for RMS (no gating)                                */
+    double *lev_input,                       /* o: Input level                                             */
+    double *lev_obtained                     /* o: Obtained level                                          */
+);
+
+double bs1770_loudness_range(                /* o: Loudness range (LU)                                     */
+    const BS1770_STATE *st                   /* i: state                                                   */
+);
+
+#endif /* BS1770_LIB_H */
@@ -11,15 +11,11 @@
 #include <math.h>
 #include <string.h>
 
-#define BLOCK_SIZE                19200      /* 400 ms in 48000 Hz sample rate */
-#define STEP_SIZE                 4800       /* 100 ms in 48000 Hz sample rate (75% overlap of 400 ms gating blocks) */   
-#define LKFS_OFFSET               (-0.691)
-#define ABSOLUTE_THRESHOLD        (-70.0)
-#define RELATIVE_THRESHOLD_OFFSET (-10.0)
-#define MAX_ITERATIONS            10
-#define RELATIVE_DIFF             0.0001
-#define MAX_CH_NUMBER             24
-#define ZERO_BLOCKS               (1000.0f) /* Constant to signal that zero blocks passed the gating threshold. 
+#include "bs1770-lib.h"
+
+#define MAX_CH_NUMBER             BS1770_MAX_CH_NUMBER
+#define ABSOLUTE_THRESHOLD        BS1770_ABSOLUTE_THRESHOLD
+#define ZERO_BLOCKS               BS1770_ZERO_BLOCKS /* Constant to signal that zero blocks passed the gating threshold.
                                               (Only results within [-Inf,LKFS_OFFSET] are valid) */
 
 /*
@@ -84,25 +80,26 @@ static const char default_conf_24[25] = "000L11000L11000000000000";
 static const char default_conf_18[19] = "000L1100011000000";
 
 
-/* R - REC - BS.1770 - 2 - 201103.pdf, Table 1, Filter coefficients for stage 1 of the pre - filter to model a spherical head */
-static const double B1[3] = { 1.53512485958697, -2.69169618940638, 1.19839281085285 };
-static const double A1[3] = { 1.0,              -1.69065929318241, 0.73248077421585 };
-
-/* R - REC - BS.1770 - 2 - 201103.pdf, Table 2, Filter coefficients for the RLB weighting curve */
-static const double B2[3] = { 1.0,              -2.0,              1.0              };
-static const double A2[3] = { 1.0,              -1.99004745483398, 0.99007225036621 };
-
 void usage()
 {
     fprintf( stdout, "bs1770demo.exe [options] <input file> [<output file>]\n" );
     fprintf( stdout, "\n" );
-    fprintf( stdout, "<input file>      Input file,  16 bit PCM, 48 kHz\n" );
-    fprintf( stdout, "[<output file>]   Output file, 16 bit PCM, 48 kHz (Optional)\n" );
+    fprintf( stdout, "<input file>      Input file,  16 bit PCM\n" );
+    fprintf( stdout, "[<output file>]   Output file, 16 bit PCM (Optional)\n" );
     fprintf( stdout, "\n" );
     fprintf( stdout, "Options:\n" );
     fprintf( stdout, "-nchan N          Number of channels [1..24] (Default: 1)\n" );
+    fprintf( stdout, "-fs F             Sample rate in Hz [%d..%d] (Default: %d)\n", BS1770_FS_MIN, BS1770_FS_MAX, BS1770_FS );
     fprintf( stdout, "-lev L            Target level LKFS (Default: -26)\n" );
     fprintf( stdout, "-rms              Disable gating (for background noise level measurement)\n" );
+    fprintf( stdout, "-tp T             Maximum true-peak level of the output, dBTP (Default: no limit)\n" );
+    fprintf( stdout, "-meter            Print momentary and short-term loudness every 100 ms\n" );
+    fprintf( stdout, "-threads T        Split the filtering of the channels over T threads (Default: 1)\n" );
+    fprintf( stdout, "-check-lev L D    Exit with an error if the input level is not L +/- D LKFS\n" );
+    fprintf( stdout, "-check-mom M D    Exit with an error if the max momentary loudness is not M +/- D LKFS\n" );
+    fprintf( stdout, "-check-st S D     Exit with an error if the max short-term loudness is not S +/- D LKFS\n" );
+    fprintf( stdout, "-check-lra R D    Exit with an error if the loudness range is not R +/- D LU\n" );
+    fprintf( stdout, "-check-tp T       Exit with an error if the input true peak exceeds T dBTP\n" );
     fprintf( stdout, "-conf xxxx        Configuration string:\n") ;
     fprintf( stdout, "                      '1' ldspk pos within |elev| < 30 deg, 60 deg <= |azim| <= 120 deg\n" );
     fprintf( stdout, "                      'L' LFE channel (weight zero)\n" );
@@ -114,248 +111,52 @@ void usage()
 }
 
 
-void scale(
-    const double *input,  /* i: Input signal       */
-    const double fac,     /* i: Scaling factor     */
-          double *output, /* i: Output signal      */
-    const long length     /* i: Length of signal   */
-)
-{
-    long i;
-    for( i = 0; i < length; i++ )
-    {
-        output[i] = input[i] * fac;
-    }
-
-    return;
-}
-
-/*-------------------------------------------------
- * Sum of squares of input signal
- *-------------------------------------------------*/
-double sumsq(             /* o: Sum of squared signal */
-    const double *input,  /* i: Input signal          */
-    const long length     /* i: Length of signal      */
+long scale_short(         /* o: Number of clipped samples                  */
+    short *data,          /* i/o: Interleaved signal, scaled in place      */
+    const double fac,     /* i: Scaling factor                             */
+    const long length     /* i: Length of signal                           */
 )
 {
     long i;
-    double result;
-    result = 0;
-    for( i = 0; i < length; i++ )
-    {
-        result = result + input[i] * input[i];
-    }
-
-    return result;
-}
-
-/*------------------------------------------------- 
- * 2nd order iir filter
- * y(n) = b[0] * x(n) + b[1] * x(n-1) + b[2] * x(n-2)
-                      - a[1] * y(n-1) - a[2] * y(n-2)
-    
-   a[0] assumed to be 1.0
-
- *-------------------------------------------------*/
-void iir2(
-    const double *input,  /* i  : Input signal         */
-          double *output, /* o  : Output signal        */
-    const long length,    /* i  : Length of signal     */
-    const double *B,      /* i  : B coefficients       */
-    const double *A,      /* i  : A coefficients       */
-          double *Bmem,   /* i/o: B memory (3 samples) */
-          double *Amem    /* i/o: A memory (3 samples) */
-    )
-{
-    long i;
-
-    for (i = 0; i < length; i++ )
-    {
-        Bmem[2] = Bmem[1];
-        Bmem[1] = Bmem[0];
-        Bmem[0] = input[i];
-
-        Amem[2] = Amem[1];
-        Amem[1] = Amem[0];
-        Amem[0] = B[0] * Bmem[0] + B[1] * Bmem[1] + B[2] * Bmem[2]
-                                 - A[1] * Amem[1] - A[2] * Amem[2];
-        output[i] = Amem[0];
-    }
-
-    return;
-}
-
-void deinterleave_short2double(
-    short *input_short,  /* i: Input short signal     */
-    double *input,       /* i: Input signal in double */
-    const long length,   /* i: Length of signal       */
-    const long nchan     /* i: Number of channels     */
-)
-{
-    long i,j,k;
-    long block_length;
-
-    block_length = length / nchan;
-    j = 0;
-    k = 0;
-
-    for ( i = 0; i < length; i++ )
-    {
-        input[block_length*j + k] = ((double)(input_short[i])) / 32768.0;
-        j++;
-        if (j == nchan )
-        {
-            j = 0;
-            k++;
-        }
-    }
-
-    return;
-}
-
-long interleave_double2short( /* returns number of clipped samples */
-    double *input,            /* i: Input signal in double         */
-    short *input_short,       /* i: Input signal in short          */
-    const long length,        /* i: Length of signal               */
-    const long nchan          /* i: Number of channels             */
-)
-{
-    long i, j, k, indx;
-    long block_length;
     long clip;
+    double input;
     double input_16;
 
-    block_length = length / nchan;
     clip = 0;
-    indx = 0;
-    j = 0;
-    k = 0;
     for( i = 0; i < length; i++ )
     {
-        input_16 = input[indx] * 32768.0;
+        input = ((double)(data[i])) / 32768.0;
+        input_16 = input * fac * 32768.0;
 
         if( input_16 > 32767.0 )
         {
             clip++;
-            input_short[i] = 32767;
+            data[i] = 32767;
         }
         else
         {
             if( input_16 < -32768.0 )
             {
                 clip++;
-                input_short[i] = -32768;
+                data[i] = -32768;
             }
             else
             {
                 if ( input_16 > 0.0 )
                 {
-                    input_short[i] = (short)(input_16 + 0.5);
+                    data[i] = (short)(input_16 + 0.5);
                 }
                 else 
                 {
-                    input_short[i] = (short)(input_16 - 0.5);
+                    data[i] = (short)(input_16 - 0.5);
                 }
             }
         }
-        j++;
-        if( j == nchan )
-        {
-            j = 0;
-            k++;
-        }
-        indx = block_length * j + k;
     }
 
     return clip;
 }
 
-double gated_loudness(                  /* o: gated loudness                 */
-    const double *gating_block_energy,  /* i: gating_block_energy            */
-    const double fac,                   /* i: Scaling factor                 */
-    const long n_gating_blocks,         /* i: Number of gating blocks        */
-    const double threshold,             /* i: LKFS threshold                 */
-    const short rms_flag                /* i: Flag for RMS (no gating)       */    
-)
-{
-    long i;
-    long count;
-    double energy = 0.0;
-    count = 0;
-    for( i = 0; i < n_gating_blocks; i++ )
-    {
-        if( ( (LKFS_OFFSET + 10 * log10( gating_block_energy[i] * fac * fac )) > threshold ) || rms_flag )
-        {
-            energy += gating_block_energy[i] * fac * fac;
-            count++;
-        }
-    }
-
-    if ( count == 0 )
-    {
-        return ZERO_BLOCKS; /* Send invalid value to indicate that zero blocks were above threshold */
-    }
-    else 
-    {
-        return LKFS_OFFSET + 10 * log10(energy / count);
-    }
-}
-
-double gated_loudness_adaptive(         /* o: gated loudness, using adaptive threshold  */
-    const double *gating_block_energy,  /* i: gating_block_energy                       */
-    const double fac,                   /* i: Scaling factor                            */
-    const long n_gating_blocks,         /* i: Number of gating blocks                   */
-    const short rms_flag                /* i: Flag for RMS (no gating)                  */
-)
-{
-    double relative_threshold;
-    double gated_loudness_final;
-
-    /* Find scaling factor */
-    relative_threshold = gated_loudness( gating_block_energy, fac, n_gating_blocks, ABSOLUTE_THRESHOLD, rms_flag ) + RELATIVE_THRESHOLD_OFFSET;
-    if( ABSOLUTE_THRESHOLD > relative_threshold )
-    {
-        relative_threshold = ABSOLUTE_THRESHOLD;
-    }
-    gated_loudness_final = gated_loudness( gating_block_energy, fac, n_gating_blocks, relative_threshold, rms_flag );
-    return gated_loudness_final;
-}
-
-
-double find_scaling_factor(            /* o: scaling factor                 */
-    const double *gating_block_energy, /* i: gating_block_energy            */
-    const long n_gating_blocks,        /* i: Number of gating blocks        */
-    const double lev,                  /* i: Target level                   */
-    const short rms_flag,              /* i: Flag for RMS (no gating)       */
-          double *lev_input,           /* o: Input level                    */
-          double *lev_obtained         /* o: Obtained level                 */
-)
-{
-    long itr;
-    double last_fac;
-    double fac;
-    double gated_loudness_final;
-
-    last_fac = 100.0; /* Dummy init to trigger first iteration */
-    fac = 1.0;
-    itr = 0;
-    while( (fabs( 1.0 - fac / last_fac ) > RELATIVE_DIFF) && (itr < MAX_ITERATIONS) )
-    {
-        /* Find scaling factor */
-        gated_loudness_final = gated_loudness_adaptive( gating_block_energy, fac, n_gating_blocks, rms_flag );
-        last_fac = fac;
-        fac *= pow( 10.0, (lev - gated_loudness_final) / 20.0 );
-        if (itr == 0 )
-        {
-            *lev_input = gated_loudness_final;
-        }
-        itr++;
-    }
-
-    *lev_obtained = gated_loudness_final;
-    return fac;
-}
-
 long parse_conf(      /*  o: 0:success, -1:fail   */
     const char *str,  /*  i: Configuration string */
     const long nchan, /*  i: Number of channels   */ 
@@ -391,34 +192,53 @@ int main(int argc, char **argv )
     FILE* f_output;
     char *input_filename;
     char *output_filename;
-    double *input;
-    double *p_input;
     short *input_short;
-    double *Bmem1, *Amem1, *Bmem2, *Amem2;
-    double *gating_block_energy; /* Buffer for energy values of gating block j */
-    double *e_tmp;   /* Circular buffer for computing energy of each 100 ms sub-block */
+    short *input_next;
+    short *p_swap;
+    BS1770_STATE *st;  /* Loudness meter state */
     long nchan; 
+    long fs;
+    long threads;
+    long step_size;
     long length_total;
     long length;
-    long n_gating_blocks;
     long clip;
-    long n,i,j;
+    long i;
     const char *conf;
     double lev_input;
     double lev_target;
     double lev_obtained;
+    double tp_input;
+    double tp_max;
     double fac;
     double G[MAX_CH_NUMBER];
     short zero_input_flag;
     short zero_blocks_flag;
     short rms_flag; 
+    short meter_flag;
+    short tp_flag;
+    double check_lev[2];  /* Expected input level and tolerance           */
+    double check_mom[2];  /* Expected max momentary loudness and tolerance */
+    double check_st[2];   /* Expected max short-term loudness and tolerance */
+    double check_lra[2];  /* Expected loudness range and tolerance         */
+    double check_tp;      /* Maximum input true peak                       */
+    short check_flag;     /* Checks requested: 1 level, 2 momentary, 4 peak,
+                             8 short-term, 16 loudness range */
+    short check_fail;
 
     lev_target = -26;  /* Default target level       */
     i = 1;
     conf = NULL;
     nchan = -1;
-    zero_input_flag = 1;
+    fs = BS1770_FS;
+    threads = 1;
     rms_flag = 0; 
+    meter_flag = 0;
+    tp_flag = 0;
+    tp_max = 0;
+    check_flag = 0;
+    check_fail = 0;
+    lev_input = -HUGE_VAL;
 
     /* Command line parsing */
     if( argc == 1 )
@@ -443,6 +263,24 @@ int main(int argc, char **argv )
             }
             i += 2;
         }
+        else if( strcmp( argv[i], "-fs" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%ld", &fs ) != 1 || fs < BS1770_FS_MIN || fs > BS1770_FS_MAX )
+            {
+                fprintf( stderr, "*** Invalid sample rate %s, exiting..\n", argv[i + 1] );
+                usage();
+            }
+            i += 2;
+        }
+        else if( strcmp( argv[i], "-threads" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%ld", &threads ) != 1 || threads < 1 )
+            {
+                fprintf( stderr, "*** Invalid number of threads %s, exiting..\n", argv[i + 1] );
+                usage();
+            }
+            i += 2;
+        }
         else if( strcmp( argv[i], "-lev" ) == 0 )
         {
             if( sscanf( argv[i + 1], "%lf", &lev_target ) != 1 )
@@ -457,6 +295,71 @@ int main(int argc, char **argv )
             rms_flag = 1;
             i += 1;
         }
+        else if( strcmp( argv[i], "-tp" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &tp_max ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid true-peak level %s, exiting..\n", argv[i + 1] );
+                usage();
+            }
+            tp_flag = 1;
+            i += 2;
+        }
+        else if( strcmp( argv[i], "-check-lev" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &check_lev[0] ) != 1 || sscanf( argv[i + 2], "%lf", &check_lev[1] ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid expected level %s %s, exiting..\n", argv[i + 1], argv[i + 2] );
+                usage();
+            }
+            check_flag |= 1;
+            i += 3;
+        }
+        else if( strcmp( argv[i], "-check-mom" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &check_mom[0] ) != 1 || sscanf( argv[i + 2], "%lf", &check_mom[1] ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid expected momentary loudness %s %s, exiting..\n", argv[i + 1], argv[i + 2] );
+                usage();
+            }
+            check_flag |= 2;
+            i += 3;
+        }
+        else if( strcmp( argv[i], "-check-st" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &check_st[0] ) != 1 || sscanf( argv[i + 2], "%lf", &check_st[1] ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid expected short-term loudness %s %s, exiting..\n", argv[i + 1], argv[i + 2] );
+                usage();
+            }
+            check_flag |= 8;
+            i += 3;
+        }
+        else if( strcmp( argv[i], "-check-lra" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &check_lra[0] ) != 1 || sscanf( argv[i + 2], "%lf", &check_lra[1] ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid expected loudness range %s %s, exiting..\n", argv[i + 1], argv[i + 2] );
+                usage();
+            }
+            check_flag |= 16;
+            i += 3;
+        }
+        else if( strcmp( argv[i], "-check-tp" ) == 0 )
+        {
+            if( sscanf( argv[i + 1], "%lf", &check_tp ) != 1 )
+            {
+                fprintf( stderr, "*** Invalid true-peak level %s, exiting..\n", argv[i + 1] );
+                usage();
+            }
+            check_flag |= 4;
+            i += 2;
+        }
+        else if( strcmp( argv[i], "-meter" ) == 0 )
+        {
+            meter_flag = 1;
+            i += 1;
+        }
         else if( strcmp( argv[i], "-conf" ) == 0 )
         {
             conf = argv[i + 1];
@@ -539,64 +442,68 @@ int main(int argc, char **argv )
         fprintf( stdout, "Output file:      %s\n", output_filename );
     }
     fprintf( stdout, "nchan:            %ld\n", nchan );
-
-    /* Find length of input file */
-    fseek( f_input, 0L, SEEK_END );
-    length_total = ftell( f_input ) / (2*nchan); /* 2 bytes per sample (16 bits), nchan channels */
-    if( (ftell( f_input ) % (2 * nchan)) != 0 )
+    if( fs != BS1770_FS )
     {
-        fprintf( stderr, "*** Number of samples not divisible into number of channels, exiting..\n" );
-        exit( -1 );
+        fprintf( stdout, "fs:               %ld\n", fs );
     }
-    if( length_total < BLOCK_SIZE )
+
+    /* Setup loudness meter */
+    if( (st = bs1770_init( nchan, G, fs )) == NULL )
     {
-        fprintf( stderr, "*** Input file must be longer than 400 ms to use bs1770demo, exiting..\n" );
+        fprintf( stderr, "*** Could not initialize loudness meter, exiting..\n" );
         exit( -1 );
     }
-    rewind( f_input );
-    n_gating_blocks = 4 * (length_total - BLOCK_SIZE) / (BLOCK_SIZE);
+    bs1770_set_threads( st, threads );
+    step_size = st->step_size;
 
     /* Allocate input buffers */
-    input = malloc( sizeof( double ) * STEP_SIZE * nchan );
-    input_short = malloc( sizeof( short ) * STEP_SIZE * nchan ); 
-    /* Allocate filter buffers */
-    Bmem1 = calloc( sizeof( double ), 3 * nchan );
-    Amem1 = calloc( sizeof( double ), 3 * nchan );
-    Bmem2 = calloc( sizeof( double ), 3 * nchan );
-    Amem2 = calloc( sizeof( double ), 3 * nchan );
-    /* Allocate energy array to allow two passes */
-    gating_block_energy = malloc( sizeof( double ) * n_gating_blocks);
-    e_tmp = malloc( sizeof( double ) * 4 );
-
-    /* Obtain filtering and compute energy of gating blocks */
-    for( n = 0, j = -3; j < n_gating_blocks; n++, j++ )
-    {
-        /* Read next sub-block */
-        fread( input_short, sizeof( short ), STEP_SIZE * nchan, f_input );
-
-        deinterleave_short2double( input_short, input, STEP_SIZE * nchan, nchan );
+    input_short = malloc( sizeof( short ) * step_size * nchan ); 
+    input_next = malloc( sizeof( short ) * step_size * nchan ); 
 
-        /* Filter sub-block and store energy in circular buffer e_tmp */
-        p_input = input;
-        e_tmp[(n % 4)] = 0;
-        for(i = 0; i < nchan; i++ )
+    /* Filter input and accumulate loudness of gating blocks, one sub-block at a time.
+       A sub-block is only processed once the following one is complete, so that the
+       last complete sub-block of the file is not used, as in the previous versions */
+    if( meter_flag )
+    {
+        fprintf( stdout, "%10s %12s %12s\n", "Time [s]", "Momentary", "Short-term" );
+    }
+    length_total = 0;
+    while( (length = (long)fread( input_next, sizeof( short ), step_size * nchan, f_input ) ) )
+    {
+        if( (length % nchan) != 0 )
         {
-            iir2( p_input, p_input, STEP_SIZE, B1, A1, Bmem1 + 3 * i, Amem1 + 3 * i );
-            iir2( p_input, p_input, STEP_SIZE, B2, A2, Bmem2 + 3 * i, Amem2 + 3 * i );
-            e_tmp[(n % 4)] += G[i] * sumsq( p_input, STEP_SIZE );
-            p_input += STEP_SIZE;
+            fprintf( stderr, "*** Number of samples not divisible into number of channels, exiting..\n" );
+            exit( -1 );
         }
-
-        /* Compute energies of block j from 4 current sub-blocks in circular buffer, excluding incomplete blocks */
-        if( j >= 0 )
+        if( length_total > 0 && length == step_size * nchan )
         {
-            gating_block_energy[j] = ( e_tmp[0] + e_tmp[1] + e_tmp[2] + e_tmp[3] ) / ((double)BLOCK_SIZE);
-            zero_input_flag &= (gating_block_energy[j] == 0.0); /* Keep track of all-zero input */
+            bs1770_process( st, input_short, step_size );
+            if( meter_flag )
+            {
+                fprintf( stdout, "%10.1f %12.6f %12.6f\n", (double) length_total / fs,
+                         bs1770_momentary( st ), bs1770_shortterm( st ) );
+            }
         }
+        length_total += length / nchan;
+        p_swap = input_short;
+        input_short = input_next;
+        input_next = p_swap;
+    }
+    if( length_total > 0 )
+    {
+        /* The last sub-block is still included in the true peak */
+        bs1770_process_peak( st, input_short, (length_total - 1) % step_size + 1 );
+    }
+    tp_input = bs1770_true_peak( st, -1 );
+    if( st->hist.n_blocks == 0 )
+    {
+        fprintf( stderr, "*** Input file must be longer than 400 ms to use bs1770demo, exiting..\n" );
+        exit( -1 );
     }
 
-    /* Check if all blocks are below ABSOLUTE_THRESHOLD  */
-    zero_blocks_flag = (ZERO_BLOCKS == gated_loudness(gating_block_energy, 1.0, n_gating_blocks, ABSOLUTE_THRESHOLD, rms_flag) );
+    /* Check if all blocks are zero, or below ABSOLUTE_THRESHOLD  */
+    zero_input_flag = (st->hist.n_zero == st->hist.n_blocks);
+    zero_blocks_flag = (ZERO_BLOCKS == bs1770_gated_loudness( st, 1.0, ABSOLUTE_THRESHOLD, rms_flag ) );
 
     if ( !zero_input_flag && !zero_blocks_flag )
     { 
@@ -607,17 +514,23 @@ int main(int argc, char **argv )
 
             /* Find scaling factor */
             /* Since a rescaling affects the relative gating threshold the factor is found through an iterative function */
-            fac = find_scaling_factor( gating_block_energy, n_gating_blocks, lev_target, rms_flag, &lev_input, &lev_obtained );
+            fac = bs1770_find_scaling_factor( st, lev_target, rms_flag, &lev_input, &lev_obtained );
+
+            /* Limit the scaling so that the true peak of the output does not exceed tp_max */
+            if( tp_flag && tp_input + 20 * log10( fac ) > tp_max )
+            {
+                fac = pow( 10.0, (tp_max - tp_input) / 20.0 );
+                lev_obtained = bs1770_integrated( st, fac, rms_flag );
+                fprintf( stderr, "*** Warning: Target level not reached, scaling limited by true-peak level %.2f dBTP\n", tp_max );
+            }
 
             /* Apply scaling */
             rewind( f_input ); 
             length_total = 0;
             clip = 0;
-            while( (length = (long)fread( input_short, sizeof( short ), STEP_SIZE * nchan, f_input ) ) )
+            while( (length = (long)fread( input_short, sizeof( short ), step_size * nchan, f_input ) ) )
             {
-                deinterleave_short2double( input_short, input, STEP_SIZE * nchan, nchan );
-                scale(input, fac, input, STEP_SIZE * nchan );
-                clip += interleave_double2short( input, input_short, STEP_SIZE * nchan, nchan );
+                clip += scale_short( input_short, fac, length );
                 length_total += length / nchan;
                 fwrite( input_short, sizeof( short ), length, f_output );
             }
@@ -627,6 +540,11 @@ int main(int argc, char **argv )
             fprintf( stdout, "Obtained level:   %.6f\n", lev_obtained );
             fprintf( stdout, "Scaling factor:   %.6f\n", fac );
             fprintf( stdout, "Scaling [dB]:     %.6f\n", 20 * log10( fac ) );
+            fprintf( stdout, "True peak:        %.6f\n", tp_input );
+            fprintf( stdout, "Obtained peak:    %.6f\n", tp_input + 20 * log10( fac ) );
+            fprintf( stdout, "Max momentary:    %.6f\n", bs1770_momentary_max( st ) );
+            fprintf( stdout, "Max short-term:   %.6f\n", bs1770_shortterm_max( st ) );
+            fprintf( stdout, "Loudness range:   %.6f\n", bs1770_loudness_range( st ) );
             fprintf( stdout, "\n--> Done processing %ld samples\n", length_total );
             if( clip > 0 )
             {
@@ -638,8 +556,12 @@ int main(int argc, char **argv )
         else
         {
             /* No output file is specified -- find the input level */
-            lev_input = gated_loudness_adaptive( gating_block_energy, 1.0, n_gating_blocks, rms_flag );
+            lev_input = bs1770_integrated( st, 1.0, rms_flag );
             fprintf( stdout, "Input level:      %.6f\n", lev_input );
+            fprintf( stdout, "True peak:        %.6f\n", tp_input );
+            fprintf( stdout, "Max momentary:    %.6f\n", bs1770_momentary_max( st ) );
+            fprintf( stdout, "Max short-term:   %.6f\n", bs1770_shortterm_max( st ) );
+            fprintf( stdout, "Loudness range:   %.6f\n", bs1770_loudness_range( st ) );
             fprintf( stdout, "\n--> Done processing %ld samples\n", length_total );
         }
     }
@@ -665,18 +587,41 @@ int main(int argc, char **argv )
         }
     }
 
+    /* Check the measured values against the expected ones */
+    if( (check_flag & 1) && !(fabs( lev_input - check_lev[0] ) <= check_lev[1]) )
+    {
+        fprintf( stderr, "*** Input level %.6f is not %.6f +/- %.6f LKFS\n", lev_input, check_lev[0], check_lev[1] );
+        check_fail = 1;
+    }
+    if( (check_flag & 2) && !(fabs( bs1770_momentary_max( st ) - check_mom[0] ) <= check_mom[1]) )
+    {
+        fprintf( stderr, "*** Max momentary loudness %.6f is not %.6f +/- %.6f LKFS\n", bs1770_momentary_max( st ), check_mom[0], check_mom[1] );
+        check_fail = 1;
+    }
+    if( (check_flag & 4) && tp_input > check_tp )
+    {
+        fprintf( stderr, "*** True peak %.6f exceeds %.6f dBTP\n", tp_input, check_tp );
+        check_fail = 1;
+    }
+    if( (check_flag & 8) && !(fabs( bs1770_shortterm_max( st ) - check_st[0] ) <= check_st[1]) )
+    {
+        fprintf( stderr, "*** Max short-term loudness %.6f is not %.6f +/- %.6f LKFS\n", bs1770_shortterm_max( st ), check_st[0], check_st[1] );
+        check_fail = 1;
+    }
+    if( (check_flag & 16) && !(fabs( bs1770_loudness_range( st ) - check_lra[0] ) <= check_lra[1]) )
+    {
+        fprintf( stderr, "*** Loudness range %.6f is not %.6f +/- %.6f LU\n", bs1770_loudness_range( st ), check_lra[0], check_lra[1] );
+        check_fail = 1;
+    }
+
     /* Close files */
     fclose( f_input );
 
     /* Deallocate memory */
-    free( input );
     free( input_short );
-    free( Bmem1 );
-    free( Amem1 );
-    free( Bmem2 );
-    free( Amem2 );
-    free( gating_block_energy );
-    free( e_tmp );
+    free( input_next );
+    bs1770_free( st );
 
+    return check_fail ? -1 : 0;
 }
 
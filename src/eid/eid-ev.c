@@ -1,4 +1,4 @@
-/*                                                       02.Feb.2010 v1.1
+/*                                                       17.Oct.2026 v1.2
 =========================================================================
 
 eid-ev.c
@@ -69,16 +69,22 @@ Byte mode:  file will contain either 0x21 (no disturbance) or
 Usage:
 ~~~~~
 eid-ev [Options] in_bs e0 [e1 e2 ... eN] out_bs
+eid-ev [Options] -eplist list in_bs
 Where:
 in_bs ...... input encoded speech bitstream file
 eX    ...... layer error pattern files
 out_bs ..... disturbed encoded speech bitstream file
+list ....... text file with one set of files per line: the layer error
+             pattern files e0 .. eN and the output bitstream out_bs
 
 Options:
 -bs mode ... Mode for bitstreams (g192, byte)
 -ep mode ... Mode for error pattern (g192, byte)
 -layers .....Layer boundaries in absolute bits (comma separated list) (default layer setup is -layers 160,240,320,480,640 )
 -ind ....... Treat layers individually, do not truncate intermediate layers, set erased layer softbits to zero
+-eplist f .. Batch mode: apply each set of layer error patterns listed in f,
+             in a single pass over the input bitstream (mapped in memory,
+             with a frame index checked once against the layer setup)
 -q ......... Quiet operation, skip statistics
 -h ......... Displays this message
 -help ...... Displays a complete help message
@@ -93,6 +99,11 @@ History:
 6 May 2006, v.1.0  eid-ev C-code (converted from eid-xor v.1.1) <Nicklas S./Jonas Sv. L.M. Ericsson>
 2 Feb 2010, v.1.1  modified maximum string length for filenames to
                    avoid buffer overruns (y.hiwasaki)
+17 Oct 2026, v.1.2 Batch mode (-eplist): many sets of layer error patterns
+                   applied in one pass over the mapped input bitstream and
+                   its frame index (g192bs.c); frame processing moved to
+                   apply_layer_errors(). The wrap counts printed are those
+                   of each error pattern file (was always the first one).
 
 ========================================================================= */
 
@@ -136,6 +147,7 @@ static void noprintf (char *dummy, ...) {
 
 /* ..... Module definition files ..... */
 #include "softbit.h"            /* Soft bit definitions and prototypes */
+#include "g192bs.h"             /* Mapped bitstreams, frame index */
 
 /* ..... Definitions used by the program ..... */
 
@@ -145,10 +157,47 @@ static void noprintf (char *dummy, ...) {
 #define IND 0                   /* indidvidual layer error application, only high layers are truncated */
 #define MAX_STR MAX_STRLEN
 
+/* Layer setup */
+typedef struct {
+  long n_layers;                /* number of active layers */
+  long layer_b[MAX_FILES];      /* layering boundaries information */
+  long layer_b_low[MAX_FILES];  /* layering boundaries information */
+  long ev_app_type;             /* LAY or IND */
+} EV_LAYERS;
+
+/* Statistics of an output bitstream */
+typedef struct {
+  double disturbed;             /* # of distorted frames (error applied) */
+  double dist_layer[MAX_FILES]; /* # of distorted layers incoming and outgoing */
+  double dist_layer_new[MAX_FILES];     /* # of distorted layers during this eid proces */
+  double sum_in_bits;           /* input stream rate accumulator */
+  double sum_out_bits;          /* output stream rate accumulator */
+  double sum_in_fer;            /* input stream fer accumulator */
+  double sum_out_fer;           /* output stream fer accumulator */
+  double sum_in_nodata;         /* input stream no_data accumulator */
+  double sum_out_nodata;        /* output stream no_data accumulator */
+  double processed;             /* # of processed bits/frames */
+  long max_fr_len_out;          /* Maximum frame length found in outp file */
+} EV_STATS;
+
+/* Error patterns and output bitstream of one line of the -eplist list */
+typedef struct {
+  G192_BS *ep[MAX_FILES];       /* Error pattern of each layer (mapped) */
+  long nflags[MAX_FILES];       /* Number of erasure flags in each pattern */
+  char *file;                   /* Output bitstream file */
+  FILE *F;                      /* Output file pointer */
+  EV_STATS st;                  /* Statistics of the output */
+} EV_SET;
+
 /* Local function prototypes */
 void display_usage ARGS ((int level));
 long parse_layers (char *inp_str, long *bound);
 long all_zeros (short *vector, long low, long high);
+void apply_layer_errors ARGS ((EV_LAYERS * lay, short *bs, short *layer_error, short *outp_frame, EV_STATS * st));
+void print_layer_stats ARGS ((EV_LAYERS * lay, EV_STATS * st, long *wraps, long max_fr_len));
+char **read_ep_list ARGS ((char *list, long m, long *n));
+short ep_flag ARGS ((G192_BS * ep, long j));
+long run_ep_list ARGS ((EV_LAYERS * lay, char *ibs_file, char *list, char quiet));
 
 
 
@@ -219,12 +268,413 @@ long all_zeros (short *vector, long low, long high) {
 /* ....................... End of all_zeros() ....................... */
 
 
+/*-------------------------------------------------------------------------
+ void apply_layer_errors();  build the output frame from the input frame
+ bs[] (with sync header) and the erasure flags of its layers, updating
+ the statistics st
+-------------------------------------------------------------------------*/
+void apply_layer_errors (EV_LAYERS * lay, short *bs, short *layer_error, short *outp_frame, EV_STATS * st) {
+  long fr_len = bs[1];
+  long first_trunc_layer;       /* lowest removed layer */
+  long i, k;
+
+  /* collect statistics */
+  st->sum_in_bits += fr_len;
+  if (bs[0] == G192_FER) {
+    st->sum_in_fer++;
+  }
+  if ((fr_len == 0) && (bs[0] == G192_SYNC)) {
+    st->sum_in_nodata++;
+    TRACE ("NODATA input\n");
+  }
+
+  /* output frame: the frame samples are set to zero (total uncertainty) */
+  memset (outp_frame, 0, (fr_len + 2) * sizeof (short));
+  outp_frame[0] = bs[0];        /* incoming frame type indication, may change */
+  outp_frame[1] = fr_len;       /* The incoming fr_len ; may change */
+
+  if ((bs[0] != G192_SYNC) && (bs[0] != G192_FER)) {
+    TRACE ("Illegal input sync_header, setting frame to Erasure\n");
+    outp_frame[0] = G192_FER;
+    outp_frame[1] = 0;
+  }
+
+  for (i = 0; i < lay->n_layers; i++) {  /* copy good bits to output frame as appropriate */
+    if (layer_error[i] == G192_FER) {
+      /* that some layers have FER */
+      if (fr_len >= lay->layer_b[i]) {
+        outp_frame[0] = G192_FER;
+        TRACE ("FER in layer[%ld]\n", i);
+        st->dist_layer_new[i]++;        /* it is actually an applied layer error in this EID session */
+      } else {
+        TRACE ("FER in layer[%ld], no input for that layer \n", i);
+      }
+    } else {                /* good layer, copy input layer bits, if available */
+      if (fr_len >= lay->layer_b[i]) {
+        for (k = lay->layer_b_low[i]; k < lay->layer_b[i]; k++) {
+          outp_frame[k + 2] = bs[k + 2];
+        }
+        TRACE ("Good layer[%ld, copying input]\n", i);
+      } else {
+        TRACE ("Good layer[%ld], no input for that layer \n", i);
+      }
+    }
+  }
+
+  first_trunc_layer = -1;
+  if (lay->ev_app_type == LAY) {
+    TRACE ("ev_app_type=LAY\n");
+    /* truncate rest of frame if in layered mode */
+    for (i = (lay->n_layers - 1); i >= 0; i--) {
+      if (outp_frame[1] >= lay->layer_b[i]) {
+        if (layer_error[i] == G192_FER) {
+          outp_frame[1] = lay->layer_b_low[i];   /* actual truncation */
+          TRACE ("layer_error[%ld] outp_frame[1]=>%d\n", i, outp_frame[1]);
+          first_trunc_layer = i;
+        }
+      }
+    }                       /* a totally truncated frame should be set to a G192_FER frame */
+
+    /* update statistics based on layered truncation */
+    if (first_trunc_layer >= 0) {
+      for (i = (first_trunc_layer + 1); i < lay->n_layers; i++) {
+        if ((layer_error[i] != G192_FER) && (fr_len >= lay->layer_b[i])) {
+          TRACE ("Added FER stat in layer[%ld] due to layered error application \n", i);
+          st->dist_layer_new[i]++;      /* it is actually an additional applied layer error in this EID session */
+        }
+      }
+    }
+
+  } else {                  /* ev_ app_type=IND, truncate only the top layers from frame length */
+    TRACE ("ev_app_type=IND\n");
+    i = lay->n_layers - 1;
+    while ((i > 0) && (layer_error[i] == G192_FER)) {
+      TRACE ("layer_error[%ld]\n", i);
+      if (outp_frame[1] >= lay->layer_b[i]) {
+        outp_frame[1] = lay->layer_b_low[i];
+        first_trunc_layer = i;
+      }
+      i--;
+    }
+  }
+  TRACE ("first_trunc layer=[%ld]\n", first_trunc_layer);
+  TRACE ("outp_frame size=[%d]\n", outp_frame[1]);
+
+  /* if no remaining erased bits remain after truncation, re-declare frame as good truncated frame with synch */
+  if (outp_frame[1] != 0) {
+    i = 0;
+    while (i < outp_frame[1]) {
+      if (outp_frame[i + 2] == 0) {
+        outp_frame[0] = G192_FER;   /* erased bit exists, declare as FER frame */
+        TRACE ("Frame has some remaining zeroes, set to G192_FER\n");
+        break;
+      } else {
+        outp_frame[0] = G192_SYNC;  /* declare as good frame with synch */
+      }
+      i++;
+    }
+    if (fr_len > outp_frame[1]) {
+      TRACE ("Layer errors truncated, frame is set to %s\n", outp_frame[0] == G192_FER ? "G192_FER" : "G192_SYNC");
+    }
+  } else {
+    /* zero frame size */
+    TRACE ("Zero length frame is  %s\n", outp_frame[0] == G192_FER ? "G192_FER" : "G192_SYNC");
+  }
+
+  /* count affected frames in this application process */
+  i = 0;
+  while (i < lay->n_layers) {
+    if (layer_error[i] == G192_FER) {
+      st->disturbed++;
+      break;
+    }
+    i++;
+  }
+
+  /* analyze output file */
+  /* Count total errors for each layer, assuming input is originally all available layers */
+  /* Note: incoming NoData frames (synch, zero length) are not treated as errored frames */
+  /* truncated frames and layers with zeros are counted as errored layers */
+  TRACE ("Counting Total FER \n");
+  if (!((outp_frame[0] == G192_SYNC) && (outp_frame[1] == 0))) {
+    if (outp_frame[0] == G192_FER) {
+      /* account for truncated layers */
+      i = lay->n_layers - 1;
+      while ((i >= 0) && (outp_frame[1] < lay->layer_b[i])) {
+        TRACE ("FER frame:: Total FER counted in layer[%ld]\n", i);
+        st->dist_layer[i]++;    /* a layer error in this output file */
+        i--;
+      }
+      /* check remaining non-truncated bitstream for erased individual layers */
+      for (k = i; k >= 0; k--) {
+        /* check if individual layer contains all zero bits */
+        if (all_zeros (&outp_frame[2], lay->layer_b_low[k], lay->layer_b[k])) {
+          TRACE ("FER frame:: Total FER counted in layer[%ld] All zeros\n", k);
+          st->dist_layer[k]++;  /* a layer error present in this output file */
+        }
+      }
+    } else {                /* G192_SYNC */
+      i = lay->n_layers - 1;
+      while ((i >= 0) && (outp_frame[1] < lay->layer_b[i])) {
+        TRACE ("Sync frame:: Total FER counted in layer[%ld]\n", i);
+        st->dist_layer[i]++;    /* a layer error in this output file */
+        i--;
+      }
+    }
+  } else {
+    TRACE ("NoData frame not counted\n");
+  }
+
+  /* Update frame counter */
+  st->sum_out_bits += outp_frame[1];
+  st->processed++;
+
+  if (outp_frame[0] == G192_FER) {
+    st->sum_out_fer++;
+  }
+  if ((outp_frame[1] == 0) && (outp_frame[0] == G192_SYNC)) {
+    st->sum_out_nodata++;
+    TRACE ("NODATA out\n");
+  }
+  if (st->max_fr_len_out < outp_frame[1]) {
+    st->max_fr_len_out = outp_frame[1];
+  }
+}
+
+/* ....................... End of apply_layer_errors() ....................... */
+
+
+/*-------------------------------------------------------------------------
+ void print_layer_stats();  print the statistics of an output bitstream
+-------------------------------------------------------------------------*/
+void print_layer_stats (EV_LAYERS * lay, EV_STATS * st, long *wraps, long max_fr_len) {
+  long i;
+
+  fprintf (stderr, "# Processed %s.................... : %.0f \n", "frames ", st->processed);
+  fprintf (stderr, "# Distorted %s........... : %.0f \n", "frames (applied)", st->disturbed);
+  fprintf (stderr, "# %s.............: %f %%\n", "EP frame disturbance rate", 100.0 * st->disturbed / st->processed);
+
+  fprintf (stderr, "# Average rate/frame (input).............: %5.4f\n", st->sum_in_bits / st->processed);
+  fprintf (stderr, "# Average rate/frame (output)............: %5.4f\n", st->sum_out_bits / st->processed);
+
+  fprintf (stderr, "# Erasure rate (input)...................: %f %%\n", 100.0 * st->sum_in_fer / st->processed);
+  fprintf (stderr, "# Erasure rate (output)..................: %f %%\n", 100.0 * st->sum_out_fer / st->processed);
+
+  fprintf (stderr, "# NoData rate (input)....................: %f %%\n", 100.0 * st->sum_in_nodata / st->processed);
+  fprintf (stderr, "# NoData rate (output)...................: %f %%\n", 100.0 * st->sum_out_nodata / st->processed);
+  fprintf (stderr, "# Max_Frame size (input).................: %ld\n", max_fr_len);
+  fprintf (stderr, "# Max_Frame size (output)................: %ld\n", st->max_fr_len_out);
+
+  for (i = 0; i < lay->n_layers; i++) {
+    fprintf (stderr, "#################\n");
+    fprintf (stderr, "# Error pattern file[%ld] wrapped ...........: %ld times\n", i, wraps[i]);
+    fprintf (stderr, "# Layer[%ld] erasing rate....................: %f %%\n", i, 100.0 * st->dist_layer_new[i] / st->processed);
+    fprintf (stderr, "# Layer[%ld] total erasure rate..............: %f %%\n", i, 100.0 * st->dist_layer[i] / st->processed);
+  }
+}
+
+/* ....................... End of print_layer_stats() ....................... */
+
+
+/*-------------------------------------------------------------------------
+ char **read_ep_list();  read the list of the batch mode: m file names
+ per line (separated by blanks; empty lines and lines starting with '#'
+ are skipped). Returns the m*n names, or aborts if the list can't be read.
+-------------------------------------------------------------------------*/
+char **read_ep_list (char *list, long m, long *n) {
+  FILE *F;
+  char line[(MAX_FILES + 1) * (MAX_STR + 1) + 2];
+  char *pch, **names = NULL;
+  long k, size = 0;
+
+  if ((F = fopen (list, "r")) == NULL)
+    KILL (list, 1);
+
+  for (*n = 0; fgets (line, sizeof (line), F) != NULL;) {
+    if (line[0] == '#' || (pch = strtok (line, " \t\r\n")) == NULL)
+      continue;
+
+    /* Grow the list as needed */
+    if (m * (*n + 1) > size) {
+      size = size ? 2 * size : 32 * m;
+      if ((names = (char **) realloc (names, size * sizeof (char *))) == NULL)
+        error_terminate ("Can't allocate memory for file list. Aborted.\n", 6);
+    }
+    for (k = 0; k < m && pch != NULL; k++, pch = strtok (NULL, " \t\r\n")) {
+      if ((names[m * *n + k] = (char *) malloc (strlen (pch) + 1)) == NULL)
+        error_terminate ("Can't allocate memory for file list. Aborted.\n", 6);
+      strcpy (names[m * *n + k], pch);
+    }
+    if (k < m || pch != NULL) {
+      fprintf (stderr, "Invalid line in file list %s (%ld EP files and the output bitstream expected)\n", list, m - 1);
+      exit (5);
+    }
+    (*n)++;
+  }
+  fclose (F);
+
+  if (*n == 0) {
+    fprintf (stderr, "No files in list %s\n", list);
+    exit (5);
+  }
+  return (names);
+}
+
+/* ....................... End of read_ep_list() ....................... */
+
+
+/*-------------------------------------------------------------------------
+ short ep_flag();  erasure flag j of a mapped error pattern, as read by
+ read_g192() or read_byte()
+-------------------------------------------------------------------------*/
+short ep_flag (G192_BS * ep, long j) {
+  unsigned char tmp;
+
+  if (ep->format == g192)
+    return (((short *) ep->data)[j]);
+  tmp = ep->data[j];
+  return ((tmp == 0x20 || tmp == 0x21) ? (short) (0x6B00 | tmp) : (short) tmp);
+}
+
+/* ....................... End of ep_flag() ....................... */
+
+
+/*-------------------------------------------------------------------------
+ long run_ep_list();  batch mode: apply each set of layer error patterns
+ listed in the file "list" to the input bitstream, in a single pass over
+ the bitstream.
+
+ The input bitstream and the error patterns are mapped in memory
+ (g192bs.c). The frame index of the bitstream (offset and length of each
+ frame) is built and checked against the layer setup once; each frame
+ is then read in place from the mapped file (16-bit G.192) and the
+ output frames of all the sets are built from it. The outputs are the
+ same as those of one run per set. Returns the number of sets.
+-------------------------------------------------------------------------*/
+long run_ep_list (EV_LAYERS * lay, char *ibs_file, char *list, char quiet) {
+  G192_BS *ibs;                 /* Input bitstream (mapped) and its index */
+  EV_SET *set;                  /* Error patterns and output of each line */
+  char **names;
+  short *frame = NULL;          /* Input frame (byte-oriented input only) */
+  short *bs;                    /* Input frame, with sync header */
+  short *outp_frame;            /* Output frame */
+  short layer_error[MAX_FILES]; /* Erasure flags of the layers */
+  long nsets, f, i, k, s, fr_len;
+  long wraps[MAX_FILES];
+
+  /* Input bitstream and its frame index */
+  if ((ibs = open_g192_bs (ibs_file)) == NULL)
+    error_terminate ("Could not open input bitstream file\n", 1);
+  if (index_g192_frames (ibs) <= 0)
+    error_terminate ("Error::Input bitstream format MUST have sync_headers for layered error application\n\n", 1);
+  if (ibs->tail > 0) {
+    fprintf (stderr, "%s\n%s\n", "*** Bits read do not correspond to fram elength Check that the correct  ***", "*** frame size was used and that the bitstream is not corrupted.***");
+    exit (9);
+  }
+  if (ibs->format == byte && lay->layer_b[lay->n_layers - 1] > 255)
+    error_terminate ("Error::Missmatching layer information, g192 byte input is used, layers can not be larger than 255 bits\n\n", 1);
+  if (ibs->max_len > lay->layer_b[lay->n_layers - 1])
+    error_terminate ("Error:: maximum frame size in input bitstream, larger than highest layer boundary !!\n\n", 1);
+
+  /* check that all frame lengths hit a valid layer boundary */
+  for (f = 0; f < ibs->nframes; f++) {
+    fr_len = ibs->frame_len[f];
+    for (k = (fr_len == 0), i = 0; !k && i < lay->n_layers; i++)
+      k = (fr_len == lay->layer_b[i]);
+    if (!k) {
+      fprintf (stderr, "Frame %ld: ", f + 1);
+      error_terminate ("Illegal frame length in input bitstream\n", 1);
+    }
+  }
+
+  /* Error patterns and outputs */
+  names = read_ep_list (list, lay->n_layers + 1, &nsets);
+  if ((set = (EV_SET *) calloc (nsets, sizeof (EV_SET))) == NULL)
+    error_terminate ("Can't allocate memory for the error patterns. Aborted.\n", 6);
+  for (s = 0; s < nsets; s++) {
+    for (i = 0; i < lay->n_layers; i++) {
+      if ((set[s].ep[i] = open_g192_bs (names[s * (lay->n_layers + 1) + i])) == NULL)
+        KILL (names[s * (lay->n_layers + 1) + i], 1);
+      if (set[s].ep[i]->format == compact)
+        error_terminate ("Error::EP format can not be binary compact format. g.192 format or g.192 byte format is required.\n\n", 1);
+      if (set[s].ep[i]->type != FER)
+        error_terminate ("BAD(unknown) error application type. Aborted.\n", 6);
+      set[s].nflags[i] = G192_BS_SAMPLES (set[s].ep[i]);
+      if (set[s].nflags[i] <= 0)
+        KILL (names[s * (lay->n_layers + 1) + i], 7);
+    }
+    set[s].file = names[s * (lay->n_layers + 1) + lay->n_layers];
+    if ((set[s].F = fopen (set[s].file, WB)) == NULL)
+      KILL (set[s].file, 1);
+    set[s].st.max_fr_len_out = -1;
+  }
+
+  /* Frame buffers */
+  if ((outp_frame = (short *) calloc (ibs->max_len + 2, sizeof (short))) == NULL)
+    error_terminate ("Can't allocate memory for erased frame. Aborted.\n", 6);
+  if (ibs->format == byte && (frame = (short *) calloc (ibs->max_len + 2, sizeof (short))) == NULL)
+    error_terminate ("Can't allocate memory for bitstream. Aborted.\n", 6);
+
+  /* *** Single pass over the input bitstream *** */
+  for (f = 0; f < ibs->nframes; f++) {
+    fr_len = ibs->frame_len[f];
+    if (ibs->format == g192)
+      bs = (short *) ibs->data + ibs->frame_pos[f];
+    else {
+      /* Byte-oriented input: as read_byte() */
+      for (k = 0; k < fr_len + 2; k++)
+        frame[k] = ep_flag (ibs, ibs->frame_pos[f] + k);
+      frame[1] = (short) fr_len;
+      bs = frame;
+    }
+
+    for (s = 0; s < nsets; s++) {
+      for (i = 0; i < lay->n_layers; i++)
+        layer_error[i] = ep_flag (set[s].ep[i], f % set[s].nflags[i]);
+      apply_layer_errors (lay, bs, layer_error, outp_frame, &set[s].st);
+      if (save_g192 (outp_frame, outp_frame[1] + 2, set[s].F) < outp_frame[1] + 2)
+        KILL (set[s].file, 7);
+    }
+  }
+
+  /* Close and print the statistics */
+  for (s = 0; s < nsets; s++) {
+    if (!quiet) {
+      for (i = 0; i < lay->n_layers; i++)
+        wraps[i] = (ibs->nframes - 1) / set[s].nflags[i];
+      fprintf (stderr, "#################\n");
+      fprintf (stderr, "# Output bitstream ......................: %s\n", set[s].file);
+      print_layer_stats (lay, &set[s].st, wraps, ibs->max_len);
+    }
+    fclose (set[s].F);
+    for (i = 0; i < lay->n_layers; i++)
+      close_g192_bs (set[s].ep[i]);
+  }
+  if (!quiet) {
+    fprintf (stderr, "# Bitstream format (G.192 header) ..... : %s\n", format_str ((int) ibs->format));
+    fprintf (stderr, "# EP Application type method .......... : %s\n", lay->ev_app_type == LAY ? "Layered " : "Individual");
+  }
+
+  for (s = 0; s < nsets * (lay->n_layers + 1); s++)
+    free (names[s]);
+  free (names);
+  free (set);
+  free (outp_frame);
+  if (frame)
+    free (frame);
+  close_g192_bs (ibs);
+  return (nsets);
+}
+
+/* ....................... End of run_ep_list() ....................... */
+
+
 
 /*-------------------------------------------------------------------------
 display_usage(int level);  Shows program usage.
 -------------------------------------------------------------------------*/
 void display_usage (int level) {
-  printf ("eid-ev.c - Version 1.1 of 02.Feb.2010 \n\n");
+  printf ("eid-ev.c - Version 1.2 of 17.Oct.2026 \n\n");
 
   if (level) {
     printf ("Program Description:\n");
@@ -276,16 +726,20 @@ void display_usage (int level) {
 
   printf ("Usage:\n");
   printf ("eid-ev [Options] in_bs e0 [e1, ..eN] out_bs\n");
+  printf ("eid-ev [Options] -eplist list in_bs\n");
   printf ("Where:\n");
   printf (" in_bs ...... input encoded speech bitstream file\n");
   printf (" eX    ...... error pattern bitstream file (one for each layer)\n");
   printf (" out_bs ..... disturbed encoded speech bitstream file    \n");
+  printf (" list ....... text file with one set of files per line: e0 [e1, ..eN] out_bs\n");
   printf ("\n");
   printf ("Options:\n");
   printf (" -bs mode ... Mode for bitstream (g192 or byte)\n");
   printf (" -ep mode ... Mode for error pattern file (g192 or byte)\n");
   printf (" -ind ....... Individual layer error application, (individual intermediate layers may be erased) \n");
   printf (" -layers .... Set layering setup in absolute bits, default is \"-layers 160,240,320,480,640\" \n");
+  printf (" -eplist f .. Apply each set of error patterns listed in f, in a single\n");
+  printf ("              pass over the input bitstream\n");
   printf (" -q ......... Quiet operation, skip statistics\n");
   printf (" -h ......... Displays this message\n");
   printf (" -help ...... Displays a complete instructive help message\n");
@@ -313,19 +767,15 @@ int main (int argc, char *argv[]) {
   char ep_file[MAX_FILES][MAX_STR];     /* Error pattern file names */
   long fr_len = 0;              /* Frame length in bits */
   long max_fr_len = -1;         /* Maximum frame length found in inp file */
-  long max_fr_len_out = -1;     /* Maximum frame length found in outp file */
 
   long bs_len, ep_len;          /* BS and EP lengths, with headers */
   long ep_true_len;             /* number of words read in EP file */
   long start_frame = 1;         /* Start inserting error from 1st one */
   char sync_header = 1;         /* Flag for input BS */
   long wraps[MAX_FILES];        /* Count how many times wraps the EP file */
-  long n_layers;                /* number of active layers */
-  long layer_b[MAX_FILES];      /* layering boundaries information */
-  long layer_b_low[MAX_FILES];  /* layering boundaries information */
+  EV_LAYERS lay;                /* layer setup */
   char layer_str[MAX_STR];      /* layering string for parsing */
-  long first_trunc_layer = -1;  /* lowest removed layer */
-  long ev_app_type = LAY;       /* LAY or IND */
+  char ep_list[MAX_STR] = "";   /* List of error patterns (batch mode) */
 
   /* File I/O parameter */
   FILE *Fibs;                   /* Pointer to input encoded bitstream file */
@@ -346,17 +796,7 @@ int main (int argc, char *argv[]) {
   short *outp_frame;            /* A totally erased frame */
 
   /* Aux. variables */
-  double disturbed = 0;         /* # of distorted frames (error applied) */
-  double dist_layer[MAX_FILES]; /* # of distorted layers incoming and outgoing */
-  double dist_layer_new[MAX_FILES];     /* # of distorted layers during this eid proces */
-  double sum_in_bits = 0;       /* input stream rate accumulator */
-  double sum_out_bits = 0;      /* output stream rate accumulator */
-  double sum_in_fer = 0;        /* input stream fer accumulator */
-  double sum_out_fer = 0;       /* output stream fer accumulator */
-  double sum_in_nodata = 0;     /* input stream no_data accumulator */
-  double sum_out_nodata = 0;    /* output stream no_data accumulator */
-
-  double processed = 0;         /* # of processed bits/frames */
+  EV_STATS st;                  /* statistics of the output bitstream */
   char vbr = 1;                 /* Flag for variable bit rate mode, always 1 !! */
   long ibs_sample_len;          /* Size (bytes) of samples in the BS */
   char tmp_type;
@@ -375,19 +815,20 @@ int main (int argc, char *argv[]) {
 
 
   /* init params */
+  memset (&st, 0, sizeof (st));
+  st.max_fr_len_out = -1;
+  lay.ev_app_type = LAY;
   for (i = 0; i < MAX_FILES; i++) {
     wraps[i] = 0;
-    layer_b[i] = -1;
-    dist_layer[i] = 0.0;        /* applied earlier or thi stime */
-    dist_layer_new[i] = 0.0;    /* applied by this process */
+    lay.layer_b[i] = -1;
   }
   /* default is layer setup for Q.9.EV-VBR */
-  layer_b[0] = 160;             /* 8kbps for 20 ms frame */
-  layer_b[1] = 240;
-  layer_b[2] = 320;
-  layer_b[3] = 480;
-  layer_b[4] = 640;             /* 32 kbps for 20 ms frame */
-  n_layers = 5;
+  lay.layer_b[0] = 160;             /* 8kbps for 20 ms frame */
+  lay.layer_b[1] = 240;
+  lay.layer_b[2] = 320;
+  lay.layer_b[3] = 480;
+  lay.layer_b[4] = 640;             /* 32 kbps for 20 ms frame */
+  lay.n_layers = 5;
 
   /* ......... GET PARAMETERS ......... */
 
@@ -427,7 +868,7 @@ int main (int argc, char *argv[]) {
         argv += 2;
       } else if (strcmp (argv[1], "-ind") == 0 || strcmp (argv[1], "-IND") == 0) {
         /* EV application type: Layered or individual */
-        ev_app_type = IND;
+        lay.ev_app_type = IND;
 
         /* Move arg{c,v} over the option to the next argument */
         argc--;
@@ -437,12 +878,19 @@ int main (int argc, char *argv[]) {
         strncpy (layer_str, argv[2], MAX_STR);
         fprintf (stderr, "Layer string:\"%s\"", layer_str);
 
-        n_layers = parse_layers (layer_str, &(layer_b[0]));
+        lay.n_layers = parse_layers (layer_str, &(lay.layer_b[0]));
 
-        if (n_layers <= 0) {
+        if (lay.n_layers <= 0) {
           error_terminate ("Illegal layer string ", 5);
           exit (-1);
         }
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-eplist") == 0) {
+        /* Batch mode: list of error patterns and output bitstreams */
+        strncpy (ep_list, argv[2], MAX_STR - 1);
+
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
@@ -462,6 +910,17 @@ int main (int argc, char *argv[]) {
       }
   }
 
+  /* Batch mode: only the input bitstream on the command line */
+  if (ep_list[0]) {
+    GET_PAR_S (1, "_Input bit stream file ..................: ", ibs_file);
+    lay.layer_b_low[0] = 0;
+    for (i = 1; i < lay.n_layers; i++) {
+      lay.layer_b_low[i] = lay.layer_b[i - 1];
+    }
+    run_ep_list (&lay, ibs_file, ep_list, quiet);
+    return 0;
+  }
+
   /* remove prog_name from count */
   local_argc = argc - 1;
 
@@ -477,7 +936,7 @@ int main (int argc, char *argv[]) {
     GET_PAR_S (i + 2, "_Error pattern file .....................: ", ep_file[i]);
   }
   /* check layering info vs number of EP-files */
-  if (n_layers != (local_argc - 1)) {
+  if (lay.n_layers != (local_argc - 1)) {
     error_terminate ("Missmatching number of layers  and EP-files\n\n", 5);
   }
 
@@ -491,7 +950,7 @@ int main (int argc, char *argv[]) {
   if ((Fibs = fopen (ibs_file, RB)) == NULL) {
     error_terminate ("Could not open input bitstream file\n", 1);
   }
-  for (i = 0; i < n_layers; i++) {
+  for (i = 0; i < lay.n_layers; i++) {
     if ((Fep[i] = fopen (ep_file[i], RB)) == NULL) {
       error_terminate ("Could not open error pattern file\n", 1);
     }
@@ -505,13 +964,13 @@ int main (int argc, char *argv[]) {
 
 
   /* Initialization: set up lower boundaries for all layers */
-  layer_b_low[0] = 0;
-  for (i = 1; i < n_layers; i++) {
-    layer_b_low[i] = layer_b[i - 1];
+  lay.layer_b_low[0] = 0;
+  for (i = 1; i < lay.n_layers; i++) {
+    lay.layer_b_low[i] = lay.layer_b[i - 1];
   }
 
   /* set format/type tags for all EP layers */
-  for (k = 0; k < n_layers; k++) {
+  for (k = 0; k < lay.n_layers; k++) {
     ep_format_2[k] = ep_format;
     ep_type_2[k] = ep_type;
   }
@@ -575,7 +1034,7 @@ int main (int argc, char *argv[]) {
         sync_header = 0;
       }
       /* check maximum frame size for byte input vs current layering information */
-      if (layer_b[n_layers - 1] > 255) {
+      if (lay.layer_b[lay.n_layers - 1] > 255) {
         error_terminate ("Error::Missmatching layer information, g192 byte input is used, layers can not be larger than 255 bits\n\n", 1);
       }
     } else {
@@ -614,7 +1073,7 @@ int main (int argc, char *argv[]) {
   }
 
   /* check that all EP files have the same types and format */
-  for (k = 1; k < n_layers; k++) {
+  for (k = 1; k < lay.n_layers; k++) {
     i = check_eid_format (Fep[k], ep_file[k], &tmp_type);
     if (i != ep_format_2[k]) {
       fprintf (stderr, "*** Switching error pattern[%ld] format from %s to %s ***\n", k, format_str ((int) ep_format_2[k]), format_str (i));
@@ -681,7 +1140,7 @@ int main (int argc, char *argv[]) {
     TRACE ("Input, found max_fr_len=%ld\n", max_fr_len);
 
 
-    if (max_fr_len > layer_b[n_layers - 1]) {
+    if (max_fr_len > lay.layer_b[lay.n_layers - 1]) {
       error_terminate ("Error:: maximum frame size in input bitstream, larger than highest layer boundary !!\n\n", 1);
     }
   }
@@ -715,7 +1174,7 @@ int main (int argc, char *argv[]) {
   /* *** START ACTUAL EP application *** */
   switch (ep_type) {
   case FER:                    /* only layered FER is used and allowed for now */
-    memset (read_ok, 0, n_layers * sizeof (short));
+    memset (read_ok, 0, lay.n_layers * sizeof (short));
     while (1) {
       /* Read one frame from input BS */
       /* Get sync header to see how many samples are in this frame */
@@ -754,8 +1213,8 @@ int main (int argc, char *argv[]) {
 
       /* (check that incoming fr_len hits a valid layer boundary) */
       k = (fr_len == 0);
-      for (i = 0; i < n_layers; i++) {
-        k = (k || (fr_len == layer_b[i]));
+      for (i = 0; i < lay.n_layers; i++) {
+        k = (k || (fr_len == lay.layer_b[i]));
       }
       if (!k) {
         TRACE ("Bad input frame length, k=%ld, fr_len=%ld\n", k, fr_len);
@@ -764,26 +1223,13 @@ int main (int argc, char *argv[]) {
         TRACE ("Good inp length, k=%ld, fr_len=%ld\n", k, fr_len);
       }
 
-      TRACE ("Proc=%6.0f, InpHeader=0x%x,fr_len=%ld, bs_len=%ld, read %ld items\n", processed, bs[0], fr_len, bs_len, items);
-
-      /* collect statistics */
-      sum_in_bits += fr_len;
-      if (bs[0] == G192_FER) {
-        sum_in_fer++;
-      }
-      if ((fr_len == 0) && (bs[0] == G192_SYNC)) {
-        sum_in_nodata++;
-        TRACE ("NODATA input\n");
-      }
+      TRACE ("Proc=%6.0f, InpHeader=0x%x,fr_len=%ld, bs_len=%ld, read %ld items\n", st.processed, bs[0], fr_len, bs_len, items);
 
       /* fill up error vector from the EP files */
       memset (layer_error, 0, MAX_FILES * sizeof (short));
-      memset (read_ok, 0, n_layers * sizeof (short));
-      memset (outp_frame, 0, bs_len * sizeof (short));  /* ... set the frame samples to zero (total uncertainty) */
-      outp_frame[0] = bs[0];    /* incoming frame type indication, may change */
-      outp_frame[1] = fr_len;   /* The incoming fr_len ; may change */
+      memset (read_ok, 0, lay.n_layers * sizeof (short));
 
-      for (i = 0; i < n_layers; i++) {
+      for (i = 0; i < lay.n_layers; i++) {
         while (read_ok[i] == 0) {
           ep_true_len = read_ok[i] = read_patt (&layer_error[i], 1, Fep[i]);
           if (read_ok[i] <= 0) {
@@ -797,138 +1243,8 @@ int main (int argc, char *argv[]) {
         }
       }
 
-
-      if ((bs[0] != G192_SYNC) && (bs[0] != G192_FER)) {
-        TRACE ("Illegal input sync_header, setting frame to Erasure\n");
-        outp_frame[0] = G192_FER;
-        outp_frame[1] = 0;
-      }
-
-      for (i = 0; i < n_layers; i++) {  /* copy good bits to output frame as appropriate */
-        if (layer_error[i] == G192_FER) {
-          /* that some layers have FER */
-          if (fr_len >= layer_b[i]) {
-            outp_frame[0] = G192_FER;
-            TRACE ("FER in layer[%ld]\n", i);
-            dist_layer_new[i]++;        /* it is actually an applied layer error in this EID session */
-          } else {
-            TRACE ("FER in layer[%ld], no input for that layer \n", i);
-          }
-        } else {                /* good layer, copy input layer bits, if available */
-          if (fr_len >= layer_b[i]) {
-            for (k = layer_b_low[i]; k < layer_b[i]; k++) {
-              outp_frame[k + 2] = bs[k + 2];
-            }
-            TRACE ("Good layer[%ld, copying input]\n", i);
-          } else {
-            TRACE ("Good layer[%ld], no input for that layer \n", i);
-          }
-        }
-      }
-
-      first_trunc_layer = -1;
-      if (ev_app_type == LAY) {
-        TRACE ("ev_app_type=LAY\n");
-        /* truncate rest of frame if in layered mode */
-        for (i = (n_layers - 1); i >= 0; i--) {
-          if (outp_frame[1] >= layer_b[i]) {
-            if (layer_error[i] == G192_FER) {
-              outp_frame[1] = layer_b_low[i];   /* actual truncation */
-              TRACE ("layer_error[%ld] outp_frame[1]=>%d\n", i, outp_frame[1]);
-              first_trunc_layer = i;
-            }
-          }
-        }                       /* a totally truncated frame should be set to a G192_FER frame */
-
-        /* update statistics based on layered truncation */
-        if (first_trunc_layer >= 0) {
-          for (i = (first_trunc_layer + 1); i < n_layers; i++) {
-            if ((layer_error[i] != G192_FER) && (fr_len >= layer_b[i])) {
-              TRACE ("Added FER stat in layer[%ld] due to layered error application \n", i);
-              dist_layer_new[i]++;      /* it is actually an additional applied layer error in this EID session */
-            }
-          }
-        }
-
-      } else {                  /* ev_ app_type=IND, truncate only the top layers from frame length */
-        TRACE ("ev_app_type=IND\n");
-        i = n_layers - 1;
-        while ((i > 0) && (layer_error[i] == G192_FER)) {
-          TRACE ("layer_error[%ld]\n", i);
-          if (outp_frame[1] >= layer_b[i]) {
-            outp_frame[1] = layer_b_low[i];
-            first_trunc_layer = i;
-          }
-          i--;
-        }
-      }
-      TRACE ("first_trunc layer=[%ld]\n", first_trunc_layer);
-      TRACE ("outp_frame size=[%d]\n", outp_frame[1]);
-
-      /* if no remaining erased bits remain after truncation, re-declare frame as good truncated frame with synch */
-      if (outp_frame[1] != 0) {
-        i = 0;
-        while (i < outp_frame[1]) {
-          if (outp_frame[i + 2] == 0) {
-            outp_frame[0] = G192_FER;   /* erased bit exists, declare as FER frame */
-            TRACE ("Frame has some remaining zeroes, set to G192_FER\n");
-            break;
-          } else {
-            outp_frame[0] = G192_SYNC;  /* declare as good frame with synch */
-          }
-          i++;
-        }
-        if (fr_len > outp_frame[1]) {
-          TRACE ("Layer errors truncated, frame is set to %s\n", outp_frame[0] == G192_FER ? "G192_FER" : "G192_SYNC");
-        }
-      } else {
-        /* zero frame size */
-        TRACE ("Zero length frame is  %s\n", outp_frame[0] == G192_FER ? "G192_FER" : "G192_SYNC");
-      }
-
-      /* count affected frames in this application process */
-      i = 0;
-      while (i < n_layers) {
-        if (layer_error[i] == G192_FER) {
-          disturbed++;
-          break;
-        }
-        i++;
-      }
-
-      /* analyze output file */
-      /* Count total errors for each layer, assuming input is originally all available layers */
-      /* Note: incoming NoData frames (synch, zero length) are not treated as errored frames */
-      /* truncated frames and layers with zeros are counted as errored layers */
-      TRACE ("Counting Total FER \n");
-      if (!((outp_frame[0] == G192_SYNC) && (outp_frame[1] == 0))) {
-        if (outp_frame[0] == G192_FER) {
-          /* account for truncated layers */
-          i = n_layers - 1;
-          while ((i >= 0) && (outp_frame[1] < layer_b[i])) {
-            TRACE ("FER frame:: Total FER counted in layer[%ld]\n", i);
-            dist_layer[i]++;    /* a layer error in this output file */
-            i--;
-          }
-          /* check remaining non-truncated bitstream for erased individual layers */
-          for (k = i; k >= 0; k--) {
-            /* check if individual layer contains all zero bits */
-            if (all_zeros (&outp_frame[2], layer_b_low[k], layer_b[k])) {
-              TRACE ("FER frame:: Total FER counted in layer[%ld] All zeros\n", k);
-              dist_layer[k]++;  /* a layer error present in this output file */
-            }
-          }
-        } else {                /* G192_SYNC */
-          i = n_layers - 1;
-          while ((i >= 0) && (outp_frame[1] < layer_b[i])) {
-            TRACE ("Sync frame:: Total FER counted in layer[%ld]\n", i);
-            dist_layer[i]++;    /* a layer error in this output file */
-            i--;
-          }
-        }
-      } else {
-        TRACE ("NoData frame not counted\n");
-      }
+      /* Build the output frame */
+      apply_layer_errors (&lay, bs, layer_error, outp_frame, &st);
 
       /* Write output frame */
       items = save_data (outp_frame, (outp_frame[1] + 2), Fobs);
@@ -939,21 +1255,7 @@ int main (int argc, char *argv[]) {
         TRACE ("BAD write of output, bs_len=%d, items=%ld\n", outp_frame[1] + 2, items);
         KILL (obs_file, 7);
       }
-      TRACE ("Proc=%6.0f, OutHeader=0x%x,fr_len=%d, bs_len=%d, wrote %ld items\n", processed, outp_frame[0], outp_frame[1], outp_frame[1] + 2, items);
-      /* Update frame counter */
-      sum_out_bits += outp_frame[1];
-      processed++;
-
-      if (outp_frame[0] == G192_FER) {
-        sum_out_fer++;
-      }
-      if ((outp_frame[1] == 0) && (outp_frame[0] == G192_SYNC)) {
-        sum_out_nodata++;
-        TRACE ("NODATA out\n");
-      }
-      if (max_fr_len_out < outp_frame[1]) {
-        max_fr_len_out = outp_frame[1];
-      }
+      TRACE ("Proc=%6.0f, OutHeader=0x%x,fr_len=%d, bs_len=%d, wrote %ld items\n", st.processed, outp_frame[0], outp_frame[1], outp_frame[1] + 2, items);
     }
     break;
   default:
@@ -969,34 +1271,11 @@ int main (int argc, char *argv[]) {
       fprintf (stderr, "# Out bitstream format %s. : %s\n", sync_header ? "(G.192 header) " : "(headerless) ..", format_str ((int) obs_format));
 
     fprintf (stderr, "# EP Pattern format %s.. : %s\n", ep_type == FER ? "(frame erasures) " : "(bit error) ...", format_str ((int) ep_format));
-    fprintf (stderr, "# EP Application type method .......... : %s\n", ev_app_type == LAY ? "Layered " : "Individual");
-
-
-
-    fprintf (stderr, "# Processed %s.................... : %.0f \n", "frames ", processed);
-    fprintf (stderr, "# Distorted %s........... : %.0f \n", "frames (applied)", disturbed);
-    fprintf (stderr, "# %s.............: %f %%\n", "EP frame disturbance rate", 100.0 * disturbed / processed);
+    fprintf (stderr, "# EP Application type method .......... : %s\n", lay.ev_app_type == LAY ? "Layered " : "Individual");
 
-    fprintf (stderr, "# Average rate/frame (input).............: %5.4f\n", sum_in_bits / processed);
-    fprintf (stderr, "# Average rate/frame (output)............: %5.4f\n", sum_out_bits / processed);
 
-    fprintf (stderr, "# Erasure rate (input)...................: %f %%\n", 100.0 * sum_in_fer / processed);
-    fprintf (stderr, "# Erasure rate (output)..................: %f %%\n", 100.0 * sum_out_fer / processed);
 
-    fprintf (stderr, "# NoData rate (input)....................: %f %%\n", 100.0 * sum_in_nodata / processed);
-    fprintf (stderr, "# NoData rate (output)...................: %f %%\n", 100.0 * sum_out_nodata / processed);
-    fprintf (stderr, "# Max_Frame size (input).................: %ld\n", max_fr_len);
-    fprintf (stderr, "# Max_Frame size (output)................: %ld\n", max_fr_len_out);
-
-
-
-
-    for (i = 0; i < n_layers; i++) {
-      fprintf (stderr, "#################\n");
-      fprintf (stderr, "# Error pattern file[%ld] wrapped ...........: %ld times\n", i, wraps[0]);
-      fprintf (stderr, "# Layer[%ld] erasing rate....................: %f %%\n", i, 100.0 * dist_layer_new[i] / processed);
-      fprintf (stderr, "# Layer[%ld] total erasure rate..............: %f %%\n", i, 100.0 * dist_layer[i] / processed);
-    }
+    print_layer_stats (&lay, &st, wraps, max_fr_len);
   }
   /* *** FINALIZATIONS *** */
 
@@ -1007,7 +1286,7 @@ int main (int argc, char *argv[]) {
 
   /* Close the output file and quit *** */
   fclose (Fibs);
-  for (i = 0; i > n_layers; i++) {
+  for (i = 0; i > lay.n_layers; i++) {
     fclose (Fep[i]);
   }
   fclose (Fobs);
@@ -1,4 +1,4 @@
-/*                                                          02.Feb.2010 v1.2
+/*                                                          17.Oct.2026 v1.5
    =========================================================================
 
    eid-xor.c
@@ -75,10 +75,15 @@
    Usage:
    ~~~~~
    eid-xor [Options] in_bs err_pat_bs out_bs
+   eid-xor [Options] -eplist list in_bs
+   eid-xor [Options] -bslist list err_pat_bs
    Where:
    in_bs ...... input encoded speech bitstream file
    err_pat .... error pattern bitstream file
    out_bs ..... disturbed encoded speech bitstream file
+   list ....... text file with one pair of files per line: error
+                pattern and output bitstream (-eplist), or input and
+                output bitstreams (-bslist)
 
    Options:
    -frame # ... Set the frame size to #. Necessary for headerless G.192
@@ -88,6 +93,14 @@
    -ber ....... Error pattern is a bit error pattern (needed for bit format)
    -fer ....... Error pattern is a frame erasure pattern (for bit format)
    -vbr ....... Enables variable bit rate operation
+   -eplist f .. Batch mode: apply each error pattern listed in f to the
+                bitstream, in a single pass over the bitstream
+   -bslist f .. Batch mode: apply the error pattern to each bitstream
+                listed in f (same format and frame size), in a single
+                pass over the error pattern
+   -packed .... Insert the bit errors one 64-bit word at a time, on
+                packed hard bits (same output); frames with softbits
+                other than '0' and '1' are processed softbit by softbit
    -q ......... Quiet operation
    -? ......... Displays this message
    -help ...... Displays a complete help message
@@ -105,6 +118,14 @@
    09.Jun.05 v.1.1 Bug correction during EP file reading. <Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com>
    02.Feb.10 v.1.2 Modified maximum string length for filenames to avoid
                    buffer overruns (y.hiwasaki)
+   17.Oct.26 v.1.3 VBR frame lengths taken from the frame index of the
+                   mapped bitstream (g192bs.c).
+   17.Oct.26 v.1.4 Bit errors inserted and counted on whole frames
+                   (g192_xor(), SIMD where available); batch mode with
+                   many error patterns for one bitstream (-eplist) or one
+                   error pattern for many bitstreams (-bslist).
+   17.Oct.26 v.1.5 Option -packed: bit errors inserted and counted on
+                   packed hard bits, one 64-bit word at a time.
 
    ========================================================================= */
 
@@ -133,6 +154,7 @@
 
 /* ..... Module definition files ..... */
 #include "softbit.h"            /* Soft bit definitions and prototypes */
+#include "g192bs.h"             /* Mapped bitstreams, frame index */
 
 /* ..... Definitions used by the program ..... */
 
@@ -140,44 +162,232 @@
 #define EID_BUFFER_LENGTH 256
 #define OUT_RECORD_LENGTH 512
 
+/* Input bitstream: file, frame buffer and current frame length */
+typedef struct {
+  char *file;                   /* File name */
+  FILE *F;                      /* File pointer */
+  short *bs;                    /* Frame, with sync header if any */
+  short *payload;               /* Point to payload in frame */
+  long fr_len, bs_len;          /* Frame length, with and without header */
+  char eof;                     /* End of bitstream reached */
+} XOR_BS;
+
+/* Error pattern: file, buffer and state of the pattern reading */
+typedef struct {
+  char *file;                   /* File name */
+  FILE *F;                      /* File pointer */
+  short *ep;                    /* Error pattern buffer */
+  long k;                       /* Number of erasure flags left in buffer */
+  long true_len;                /* Number of words read in EP file */
+  long wraps;                   /* Count how many times wraps the EP file */
+  short flag;                   /* Current frame erasure flag */
+  char format;                  /* Error pattern format */
+  long (*read_patt) ();         /* To read error pattern */
+} XOR_EP;
+
+/* Output bitstream and its counters */
+typedef struct {
+  char *file;                   /* File name */
+  FILE *F;                      /* File pointer */
+  double disturbed;             /* # of distorted bits/frames */
+  double processed;             /* # of processed bits/frames */
+} XOR_OUT;
+
 
 /* Local function prototypes */
-short eid_xor ARGS ((int a, int b));
 long insert_errors ARGS ((short *a, short *b, short *c, long n));
+long read_frame ARGS ((XOR_BS * b, char vbr, char sync_header, char ep_type));
+long read_ep_frame ARGS ((XOR_EP * e, long ep_len));
+short next_erasure_flag ARGS ((XOR_EP * e, long ep_len));
+char **read_file_list ARGS ((char *list, long *n));
 void display_usage ARGS ((int level));
 
+/* Pointers to the bitstream I/O functions */
+static long (*read_data) () = read_g192;        /* To read input bitstream */
+static long (*save_data) () = save_g192;        /* To save output bitstream */
+
+/* Packed hard bits of a frame and of its error pattern (option -packed) */
+static BS_WORD *packed_bs = NULL, *packed_ep = NULL;
+
 
 /* ************************* AUXILIARY FUNCTIONS ************************* */
 
 /*
-  Perform XOR operation on two samples
+  Insert errors by XOR-ing the input data arrays and saving the
+  disturbed data in a third array. The XOR and the count of the
+  disturbed bits are done on whole frames: on packed hard bits, one
+  word at a time, with option -packed (packed_xor()), or softbit by
+  softbit (g192_xor(), SIMD where available), also for the frames
+  with soft decision values, which have no packed representation.
 */
-short eid_xor (int a, int b) {
-  return (a ^ b ? G192_ONE : G192_ZERO);
+long insert_errors (short *a, short *b, short *c, long n) {
+  long disturbed;
+
+  if (packed_bs != NULL && g192_to_packed (a, n, packed_bs) == 0 && g192_to_packed (b, n, packed_ep) == 0) {
+    disturbed = packed_xor (packed_bs, packed_ep, n);
+    packed_to_g192 (packed_bs, n, c);
+    return (disturbed);
+  }
+  return (g192_xor (a, b, c, n));
 }
 
-/* ......................... End of eid_xor() ......................... */
+/* ....................... End of insert_errors() ....................... */
 
 
 /*
-  Insert errors by XOR-ing the input data arrays and saving the
-  disturbed data in a third array.
+  Read one frame from a bitstream: two steps for VBR mode, one
+  otherwise. Returns the number of samples read, 0 at the end of the
+  bitstream. The frame length is updated for VBR bitstreams, and for
+  the last frame of headerless bitstreams.
 */
-long insert_errors (short *a, short *b, short *c, long n) {
-  long i;
-  long register disturbed;
-  short bit;
-
-  for (disturbed = i = 0; i < n; i++) {
-    bit = eid_xor (a[i], b[i]);
-    if (bit != a[i])
-      disturbed++;
-    c[i] = bit;
+long read_frame (XOR_BS * b, char vbr, char sync_header, char ep_type) {
+  long items;
+
+  if (vbr) {
+    /* Get sync header to see how many samples are in this frame */
+    if ((items = read_data (b->bs, 2l, b->F)) != 2)
+      return (0);
+    b->fr_len = b->bs[1];
+    b->bs_len = sync_header ? b->fr_len + 2 : b->fr_len;
+
+    /* ... and read payload, if not an empty frame */
+    if (b->fr_len != 0)
+      items += read_data (b->payload, b->fr_len, b->F);
+  } else
+    /* Read one whole frame from bitstream */
+    items = read_data (b->bs, b->bs_len, b->F);
+
+  /* Stop when reaches end-of-file */
+  if (items == 0)
+    return (0);
+
+  /* Aborts on error */
+  if (items < 0)
+    KILL (b->file, 7);
+
+  /* Check if read all expected samples; if not, take a special action */
+  if (items < b->bs_len) {
+    if (sync_header) {
+      /* If the bitstream has sync header, this situation should not occur, since the length of the input bitstream file should be a multiple of the frame size! The file is either invalid otr corrupt. Execution is aborted at this point */
+      fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this bitstream file is not multiple  ***", "*** of the given frame length. Check that the correct  ***", "*** frame size was used (is this a variable-frame size ***", "*** file?) and that the bitstream is not corrupted.***");
+      exit (9);
+    } else if (feof (b->F)) {
+      /* EOF reached. Since the input bitstream is headerless, this maybe a corrupt file, or the user simply specified the wrong frame size. Warn the user (not important for BER, so the msg is not printed) and continue */
+#ifndef DEBUG
+      if (ep_type == FER)
+#endif
+        fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this HEADERLESS bitstream is not ***", "*** multiple of the given frame length. Check that ***", "*** the correct frame size was selected & that the ***", "*** bitstream file is not corrupted.***");
+      b->bs_len = b->fr_len = items;
+    } else                      /* An unknown error happened! */
+      KILL (b->file, 7);
   }
-  return (disturbed);
+  return (items);
 }
 
-/* ....................... End of insert_errors() ....................... */
+/* ......................... End of read_frame() ......................... */
+
+
+/*
+  Read one bit error pattern frame; when the EP finishes, go back to
+  its beginning and fill up the EP buffer.
+*/
+long read_ep_frame (XOR_EP * e, long ep_len) {
+  long items, k;
+
+  /* Read one error pattern frame from file */
+  items = e->read_patt (e->ep, ep_len, e->F);
+
+  /* Treat case when EP finishes before BS: */
+  /* Go back to beginning of EP & fill up EP buffer */
+  if (items < ep_len) {
+    if (items < 0)
+      KILL (e->file, 7);
+    k = ep_len - items;         /* Number of missing EP samples */
+    fseek (e->F, 0l, SEEK_SET); /* Rewind */
+    items = e->read_patt (&e->ep[items], k, e->F); /* Fill-up EP buffer */
+
+    /* Count how many times wrapped the EP file */
+    e->wraps++;
+  }
+  return (items);
+}
+
+/* ....................... End of read_ep_frame() ....................... */
+
+
+/*
+  Get the next frame erasure flag, reading a number of them from the
+  EP file when the buffer is empty (wrapping the EP file at its end).
+*/
+short next_erasure_flag (XOR_EP * e, long ep_len) {
+  /* Read a number of erasure flags from file */
+  while (e->k == 0) {
+    /* No EP flags in buffer; read a number of them */
+    e->true_len = e->k = e->read_patt (e->ep, ep_len, e->F);
+
+    /* No flags read - either error or EOF */
+    /* Go back to beginning of EP & fill up EP buffer */
+    if (e->k <= 0) {
+      if (e->k < 0)
+        KILL (e->file, 7);      /* Error: abort */
+      fseek (e->F, 0l, SEEK_SET);       /* EOF: Rewind */
+      e->wraps++;               /* Count how many times wrapped EP */
+    }
+  }
+
+  /* Decrement counter of number of flags in EP buffer */
+  return (e->ep[e->true_len - e->k--]);
+}
+
+/* ..................... End of next_erasure_flag() ..................... */
+
+
+/*
+  Read a list of file name pairs (two names per line, separated by
+  blanks; empty lines and lines starting with '#' are skipped).
+  Returns the 2*n names, or aborts if the list can't be read.
+*/
+char **read_file_list (char *list, long *n) {
+  FILE *F;
+  char line[2 * MAX_STRLEN + 2], name1[MAX_STRLEN], name2[MAX_STRLEN];
+  char fmt[32];
+  char **names = NULL;
+  long size = 0;
+
+  if ((F = fopen (list, "r")) == NULL)
+    KILL (list, 1);
+  sprintf (fmt, "%%%ds %%%ds", MAX_STRLEN - 1, MAX_STRLEN - 1);
+
+  for (*n = 0; fgets (line, sizeof (line), F) != NULL;) {
+    if (line[0] == '#' || sscanf (line, "%1s", name1) != 1)
+      continue;
+    if (sscanf (line, fmt, name1, name2) != 2) {
+      fprintf (stderr, "Invalid line in file list %s: %s", list, line);
+      exit (5);
+    }
+
+    /* Grow the list as needed */
+    if (2 * (*n + 1) > size) {
+      size = size ? 2 * size : 32;
+      if ((names = (char **) realloc (names, size * sizeof (char *))) == NULL)
+        error_terminate ("Can't allocate memory for file list. Aborted.\n", 6);
+    }
+    if ((names[2 * *n] = (char *) malloc (strlen (name1) + 1)) == NULL || (names[2 * *n + 1] = (char *) malloc (strlen (name2) + 1)) == NULL)
+      error_terminate ("Can't allocate memory for file list. Aborted.\n", 6);
+    strcpy (names[2 * *n], name1);
+    strcpy (names[2 * *n + 1], name2);
+    (*n)++;
+  }
+  fclose (F);
+
+  if (*n == 0) {
+    fprintf (stderr, "No files in list %s\n", list);
+    exit (5);
+  }
+  return (names);
+}
+
+/* ...................... End of read_file_list() ...................... */
 
 
 /*
@@ -192,7 +402,7 @@ long insert_errors (short *a, short *b, short *c, long n) {
    --------------------------------------------------------------------------
  */
 void display_usage (int level) {
-  printf ("eid-xor.c - Version 1.2 of 02/Feb/2010 \n\n");
+  printf ("eid-xor.c - Version 1.5 of 17/Oct/2026 \n\n");
 
   if (level) {
     printf ("Program Description:\n");
@@ -271,10 +481,15 @@ void display_usage (int level) {
 
   printf ("Usage:\n");
   printf ("eid-xor [Options] in_bs err_pat_bs out_bs\n");
+  printf ("eid-xor [Options] -eplist list in_bs\n");
+  printf ("eid-xor [Options] -bslist list err_pat_bs\n");
   printf ("Where:\n");
   printf (" in_bs ...... input encoded speech bitstream file\n");
   printf (" err_pat .... error pattern bitstream file\n");
   printf (" out_bs ..... disturbed encoded speech bitstream file    \n");
+  printf (" list ....... text file with one pair of files per line: error\n");
+  printf ("              pattern and output bitstream (-eplist), or input\n");
+  printf ("              and output bitstreams (-bslist)\n");
   printf ("\n");
   printf ("Options:\n");
   printf (" -frame # ... Set the frame size to # (for headerless G.192\n");
@@ -284,6 +499,10 @@ void display_usage (int level) {
   printf (" -ber ....... Error pattern is a bit error pattern (needed for bit format)\n");
   printf (" -fer ....... Error pattern is a frame erasure pattern (for bit format)\n");
   printf (" -vbr ....... Enables variable bit rate operation (different frame sizes)\n");
+  printf (" -eplist f .. Apply each error pattern listed in f to the bitstream\n");
+  printf (" -bslist f .. Apply the error pattern to each bitstream listed in f\n");
+  printf (" -packed .... Insert the bit errors on packed hard bits, one word at\n");
+  printf ("              a time (same output)\n");
   printf (" -q ......... Quiet operation\n");
   printf (" -? ......... Displays this message\n");
   printf (" -help ...... Displays a complete help message\n");
@@ -307,46 +526,41 @@ int main (int argc, char *argv[]) {
   char ibs_file[MAX_STRLEN];    /* Input bitstream file */
   char obs_file[MAX_STRLEN];    /* Output bitstream file */
   char ep_file[MAX_STRLEN];     /* Error pattern file */
+  char *list_file = NULL;       /* List of EP/input BS and output BS files */
+  char list_type = 0;           /* Files in list: 'e' (EPs) or 'b' (BSs) */
   long fr_len = 0;              /* Frame length in bits */
   long bs_len, ep_len;          /* BS and EP lengths, with headers */
-  long ep_true_len;             /* number of words read in EP file */
-  long ori_bs_len, ori_fr_len;  /* Frame/BS legth memory */
   long blk = EID_BUFFER_LENGTH; /* Standard frame length */
   long start_frame = 1;         /* Start inserting error from 1st one */
   char sync_header = 1;         /* Flag for input BS */
-  long wraps = 0;               /* Count how many times wraps the EP file */
 
-  /* File I/O parameter */
-  FILE *Fibs;                   /* Pointer to input encoded bitstream file */
-  FILE *Fobs;                   /* Pointer to input encoded bitstream file */
-  FILE *Fep;                    /* Pointer to error pattern file */
+  /* Bitstreams and error patterns (more than one in batch mode) */
+  XOR_BS *ibs;                  /* Input encoded bitstream(s) */
+  XOR_EP *eps;                  /* Error pattern(s) */
+  XOR_OUT *obs;                 /* Output bitstream(s) */
+  long nibs = 1, neps = 1, nobs = 1;    /* Number of each */
+  char **names;                 /* File names from the list */
+  XOR_BS *b;
+  XOR_EP *e;
 #ifdef DEBUG
   FILE *F;
 #endif
 
   /* Data arrays */
-  short *bs;                    /* Encoded speech bitstream */
-  short *payload;               /* Point to payload in bitstream */
-  short *ep;                    /* Error pattern buffer */
+  short *out;                   /* Disturbed frame */
   short *erased_frame;          /* A totally erased frame */
 
   /* Aux. variables */
-  double disturbed = 0;         /* # of distorted bits/frames */
-  double processed = 0;         /* # of processed bits/frames */
   char vbr = 0;                 /* Flag for variable bit rate mode */
   long ibs_sample_len;          /* Size (bytes) of samples in the BS */
-  char tmp_type;
-  long i, k;
+  char tmp_type, bs_type;
+  long i, j, active;
   long items;                   /* Number of output elements */
 #if defined(VMS)
   char mrs[15] = "mrs=512";
 #endif
   char quiet = 0;
-
-  /* Pointer to a function */
-  long (*read_data) () = read_g192;     /* To read input bitstream */
-  long (*read_patt) () = read_g192;     /* To read error pattern */
-  long (*save_data) () = save_g192;     /* To save output bitstream */
+  char packed = 0;              /* Errors inserted on packed hard bits */
 
   /* ......... GET PARAMETERS ......... */
 
@@ -394,6 +608,14 @@ int main (int argc, char *argv[]) {
         } else
           ep_format = i;
 
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-eplist") == 0 || strcmp (argv[1], "-bslist") == 0) {
+        /* Batch mode: many error patterns for one bitstream, or one error pattern for many bitstreams */
+        list_file = argv[2];
+        list_type = argv[1][1];
+
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
@@ -415,6 +637,13 @@ int main (int argc, char *argv[]) {
         /* Enables variable bit rate operation */
         vbr = 1;
 
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-packed") == 0) {
+        /* Insert bit errors on packed hard bits */
+        packed = 1;
+
         /* Move arg{c,v} over the option to the next argument */
         argc--;
         argv++;
@@ -435,23 +664,57 @@ int main (int argc, char *argv[]) {
       }
   }
 
-  /* Get command line parameters */
-  GET_PAR_S (1, "_Input bit stream file ..................: ", ibs_file);
-  GET_PAR_S (2, "_Error pattern file .....................: ", ep_file);
-  GET_PAR_S (3, "_Output bit stream file .................: ", obs_file);
+  /* Get command line parameters; in batch mode, the files that change are in the list */
+  names = NULL;
+  if (list_type == 'e') {
+    GET_PAR_S (1, "_Input bit stream file ..................: ", ibs_file);
+    names = read_file_list (list_file, &neps);
+    nobs = neps;
+  } else if (list_type == 'b') {
+    GET_PAR_S (1, "_Error pattern file .....................: ", ep_file);
+    names = read_file_list (list_file, &nibs);
+    nobs = nibs;
+  } else {
+    GET_PAR_S (1, "_Input bit stream file ..................: ", ibs_file);
+    GET_PAR_S (2, "_Error pattern file .....................: ", ep_file);
+    GET_PAR_S (3, "_Output bit stream file .................: ", obs_file);
+  }
 
+  /* Allocate the bitstream, error pattern and output descriptors */
+  ibs = (XOR_BS *) calloc (nibs, sizeof (XOR_BS));
+  eps = (XOR_EP *) calloc (neps, sizeof (XOR_EP));
+  obs = (XOR_OUT *) calloc (nobs, sizeof (XOR_OUT));
+  if (ibs == NULL || eps == NULL || obs == NULL)
+    error_terminate ("Can't allocate memory for file descriptors. Aborted.\n", 6);
+  for (j = 0; j < nobs; j++) {
+    if (list_type == 'e') {
+      eps[j].file = names[2 * j];
+      obs[j].file = names[2 * j + 1];
+    } else if (list_type == 'b') {
+      ibs[j].file = names[2 * j];
+      obs[j].file = names[2 * j + 1];
+    } else
+      obs[j].file = obs_file;
+  }
+  if (list_type != 'b')
+    ibs[0].file = ibs_file;
+  if (list_type != 'e')
+    eps[0].file = ep_file;
 
 
   /* Starting frame is from 0 to number_of_frames-1 */
   start_frame--;
 
   /* Open files */
-  if ((Fibs = fopen (ibs_file, RB)) == NULL)
-    error_terminate ("Could not open input bitstream file\n", 1);
-  if ((Fep = fopen (ep_file, RB)) == NULL)
-    error_terminate ("Could not open error pattern file\n", 1);
-  if ((Fobs = fopen (obs_file, WB)) == NULL)
-    error_terminate ("Could not create output file\n", 1);
+  for (j = 0; j < nibs; j++)
+    if ((ibs[j].F = fopen (ibs[j].file, RB)) == NULL)
+      error_terminate ("Could not open input bitstream file\n", 1);
+  for (j = 0; j < neps; j++)
+    if ((eps[j].F = fopen (eps[j].file, RB)) == NULL)
+      error_terminate ("Could not open error pattern file\n", 1);
+  for (j = 0; j < nobs; j++)
+    if ((obs[j].F = fopen (obs[j].file, WB)) == NULL)
+      error_terminate ("Could not create output file\n", 1);
 #ifdef DEBUG
   F = fopen ("ep.g192", WB);    /* File to save the EP in G.192 format */
 #endif
@@ -460,7 +723,7 @@ int main (int argc, char *argv[]) {
   /* *** CHECK CONSISTENCY *** */
 
   /* Do preliminary inspection in the INPUT BITSTREAM FILE to check its format (byte, bit, g192) */
-  i = check_eid_format (Fibs, ibs_file, &tmp_type);
+  i = check_eid_format (ibs[0].F, ibs[0].file, &tmp_type);
 
   /* Check whether the specified BS format matches with the one in the file */
   if (i != bs_format) {
@@ -469,6 +732,9 @@ int main (int argc, char *argv[]) {
     bs_format = i;
   }
 
+  /* Type of the bitstream (with or without sync headers), the same for all bitstreams in batch mode */
+  bs_type = tmp_type;
+
   /* Check whether the BS has a sync header */
   if (tmp_type == FER) {
     /* The input BS may have a G.192 synchronism header - verify */
@@ -476,13 +742,13 @@ int main (int argc, char *argv[]) {
       short tmp[2];
 
       /* Get presumed first G.192 sync header */
-      fread (tmp, sizeof (short), 2, Fibs);
+      fread (tmp, sizeof (short), 2, ibs[0].F);
       /* tmp[1] should have the frame length */
       i = tmp[1];
       /* advance file to the (presumed) next G.192 sync header */
-      fseek (Fibs, (long) (tmp[1]) * sizeof (short), SEEK_CUR);
+      fseek (ibs[0].F, (long) (tmp[1]) * sizeof (short), SEEK_CUR);
       /* get (presumed) next G.192 sync header */
-      fread (tmp, sizeof (short), 2, Fibs);
+      fread (tmp, sizeof (short), 2, ibs[0].F);
       /* Verify */
       /* if (((tmp[0] & 0xFFF0) == 0x6B20) && (i == tmp[1])) */
       if ((tmp[0] & 0xFFF0) == 0x6B20) {
@@ -496,13 +762,13 @@ int main (int argc, char *argv[]) {
       char tmp[2];
 
       /* Get presumed first byte-wise G.192 sync header */
-      fread (tmp, sizeof (char), 2, Fibs);
+      fread (tmp, sizeof (char), 2, ibs[0].F);
       /* tmp[1] should have the frame length */
       i = tmp[1];
       /* advance file to the (presumed) next byte-wise G.192 sync header */
-      fseek (Fibs, (long) tmp[1], SEEK_CUR);
+      fseek (ibs[0].F, (long) tmp[1], SEEK_CUR);
       /* get (presumed) next G.192 sync header */
-      fread (tmp, sizeof (char), 2, Fibs);
+      fread (tmp, sizeof (char), 2, ibs[0].F);
       /* Verify */
       /* if (((tmp[0] & 0xF0) == 0x20) && (i == tmp[1])) */
       if ((tmp[0] & 0xF0) == 0x20) {
@@ -516,16 +782,25 @@ int main (int argc, char *argv[]) {
       sync_header = 0;
 
     /* Rewind file */
-    fseek (Fibs, 0l, SEEK_SET);
+    fseek (ibs[0].F, 0l, SEEK_SET);
   }
 
   /* If input BS is headerless, any frame size will do; using default */
   if (fr_len == 0)
     fr_len = blk;
 
+  /* In batch mode, all the bitstreams must have the same format as the first one */
+  for (j = 1; j < nibs; j++) {
+    if (check_eid_format (ibs[j].F, ibs[j].file, &tmp_type) != bs_format || tmp_type != bs_type) {
+      fprintf (stderr, "*** Bitstream %s has not the format of %s. Aborted ***\n", ibs[j].file, ibs[0].file);
+      exit (5);
+    }
+    fseek (ibs[j].F, 0l, SEEK_SET);
+  }
+
 
   /* Do preliminary inspection in the ERROR PATTERN FILE to check its format (byte, bit, g192) */
-  i = check_eid_format (Fep, ep_file, &tmp_type);
+  i = check_eid_format (eps[0].F, eps[0].file, &tmp_type);
 
   /* Check whether the specified EP format matches with the one in the file */
   if (i != ep_format) {
@@ -546,6 +821,16 @@ int main (int argc, char *argv[]) {
     }
   }
 
+  /* In batch mode, all the error patterns must have the type of the first one */
+  eps[0].format = ep_format;
+  for (j = 1; j < neps; j++) {
+    eps[j].format = check_eid_format (eps[j].F, eps[j].file, &tmp_type);
+    if (eps[j].format != compact && tmp_type != ep_type) {
+      fprintf (stderr, "*** Error pattern %s is not of type %s. Aborted ***\n", eps[j].file, type_str ((int) ep_type));
+      exit (5);
+    }
+  }
+
   /* VBR operation is not possible with compact or headerless bitstreams */
   if (vbr && (bs_format == compact || !sync_header)) {
     vbr = 0;
@@ -555,6 +840,10 @@ int main (int argc, char *argv[]) {
       fprintf (stderr, "VBR operation disabled for headerless bitstreams!\n");
   }
 
+  /* ... nor with a list of bitstreams, which share the frame length */
+  if (vbr && nibs > 1)
+    error_terminate ("VBR operation not possible with a list of bitstreams. Aborted\n", 5);
+
   /* One final check: the FER operation is not possible when the output bitstream format is compact, since it is not possible to convey the information that a frame was erased without a header *and* without softbits. The STL conveys frame erasure information based on either of these two mechanisms. If this anomalous situation is found, the output bitstream is redefined as having the g192 format */
   if (bs_format == compact && ep_type == FER)
     obs_format = g192;
@@ -571,7 +860,8 @@ int main (int argc, char *argv[]) {
 
   /* Use the proper data I/O functions */
   read_data = bs_format == byte ? read_byte : (bs_format == g192 ? read_g192 : read_bit_ber);
-  read_patt = ep_format == byte ? read_byte : (ep_format == g192 ? read_g192 : (ep_type == BER ? read_bit_ber : read_bit_fer));
+  for (e = eps; e < eps + neps; e++)
+    e->read_patt = e->format == byte ? read_byte : (e->format == g192 ? read_g192 : (ep_type == BER ? read_bit_ber : read_bit_fer));
   save_data = obs_format == byte ? save_byte : (obs_format == g192 ? save_g192 : save_bit);
 
   /* Define BS sample size, in bytes */
@@ -579,29 +869,38 @@ int main (int argc, char *argv[]) {
 
   /* Inspect the bitstream file for variable frame sizes (i.e. variable bit rate operation of the codec), if the option vbr is set (NOT the default). NOTE: VBR operation is not possible for compact bitstreams! */
   if (vbr) {
-    /* Two local variables */
+    /* Three local variables */
     short offset = 0;           /* Where is next frame leng.val. in the BS */
     long max_fr_len = fr_len;   /* Maximum frame length found in file */
+    G192_BS *mbs;               /* Mapped bitstream */
 
-    /* Scan file for largest frame size */
-    while (!feof (Fibs)) {
-      /* Move to position where next frame length value is expected */
-      fseek (Fibs, (long) (ibs_sample_len + offset), SEEK_CUR);
+    /* Largest frame size from the frame index, or ... */
+    if ((mbs = open_g192_bs (ibs[0].file)) != NULL && index_g192_frames (mbs) > 0) {
+      if (mbs->max_len > max_fr_len)
+        max_fr_len = mbs->max_len;
+    } else {
+      /* ... scan file for largest frame size */
+      while (!feof (ibs[0].F)) {
+        /* Move to position where next frame length value is expected */
+        fseek (ibs[0].F, (long) (ibs_sample_len + offset), SEEK_CUR);
 
-      /* get (presumed) next G.192 sync header */
-      if ((items = read_data (&offset, 1l, Fibs)) != 1)
-        break;
+        /* get (presumed) next G.192 sync header */
+        if ((items = read_data (&offset, 1l, ibs[0].F)) != 1)
+          break;
 
-      /* We have a different frame length here! */
-      if (offset > max_fr_len)
-        max_fr_len = offset;
+        /* We have a different frame length here! */
+        if (offset > max_fr_len)
+          max_fr_len = offset;
 
-      /* Convert offset number read to no.of bytes */
-      offset *= ibs_sample_len;
+        /* Convert offset number read to no.of bytes */
+        offset *= ibs_sample_len;
+      }
     }
 
+    close_g192_bs (mbs);
+
     /* Rewind file */
-    fseek (Fibs, 0l, SEEK_SET);
+    fseek (ibs[0].F, 0l, SEEK_SET);
 
     /* Set the frame length to the maximum possible value */
     fr_len = max_fr_len;
@@ -612,18 +911,23 @@ int main (int argc, char *argv[]) {
   bs_len = sync_header ? fr_len + 2 : fr_len;
   ep_len = fr_len;
 
-  /* Save frame lengths in memory */
-  ori_bs_len = bs_len;
-  ori_fr_len = fr_len;
-
   /* Allocate memory for data buffers */
-  if ((bs = (short *) calloc (bs_len, sizeof (short))) == NULL)
+  for (b = ibs; b < ibs + nibs; b++) {
+    if ((b->bs = (short *) calloc (bs_len, sizeof (short))) == NULL)
+      error_terminate ("Can't allocate memory for bitstream. Aborted.\n", 6);
+
+    /* Initializes to the start of the payload in input bitstream */
+    b->payload = sync_header ? b->bs + 2 : b->bs;
+    b->fr_len = fr_len;
+    b->bs_len = bs_len;
+  }
+  for (e = eps; e < eps + neps; e++)
+    if ((e->ep = (short *) calloc (ep_len, sizeof (short))) == NULL)
+      error_terminate ("Can't allocate memory for error pattern. Aborted.\n", 6);
+  if ((out = (short *) calloc (bs_len, sizeof (short))) == NULL)
     error_terminate ("Can't allocate memory for bitstream. Aborted.\n", 6);
-  if ((ep = (short *) calloc (ep_len, sizeof (short))) == NULL)
-    error_terminate ("Can't allocate memory for error pattern. Aborted.\n", 6);
-
-  /* Initializes to the start of the payload in input bitstream */
-  payload = sync_header ? bs + 2 : bs;
+  if (packed && ((packed_bs = (BS_WORD *) calloc (BS_WORDS (fr_len), sizeof (BS_WORD))) == NULL || (packed_ep = (BS_WORD *) calloc (BS_WORDS (fr_len), sizeof (BS_WORD))) == NULL))
+    error_terminate ("Can't allocate memory for packed bits. Aborted.\n", 6);
 
   /* Prepare a totally-erased frame */
   /* ... allocate memory */
@@ -642,195 +946,126 @@ int main (int argc, char *argv[]) {
 
   /* *** START ACTUAL WORK *** */
 
-  switch (ep_type) {
-  case FER:
-    k = 0;
-    while (1) {
-      /* Read one frame from BS: two steps for VBR mode, one otherwise */
-      if (vbr) {
-        /* Get sync header to see how many samples are in this frame */
-        if ((items = read_data (bs, 2l, Fibs)) != 2)
-          break;
-        fr_len = bs[1];
-        bs_len = sync_header ? fr_len + 2 : fr_len;
-
-        /* ... and read payload, if not an empty frame */
-        if (fr_len != 0)
-          items += read_data (payload, fr_len, Fibs);
-      } else
-        /* Read one whole frame from bitstream */
-        items = read_data (bs, bs_len, Fibs);
-
-      /* Stop when reaches end-of-file */
-      if (items == 0)
-        break;
-
-      /* Aborts on error */
-      if (items < 0)
-        KILL (ibs_file, 7);
-
-      /* Check if read all expected samples; if not, take a special action */
-      if (items < bs_len) {
-        if (sync_header) {
-          /* If the bitstream has sync header, this situation should not occur, since the length of the input bitstream file should be a multiple of the frame size! The file is either invalid otr corrupt. Execution is aborted at this point */
-          fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this bitstream file is not multiple  ***", "*** of the given frame length. Check that the correct  ***", "*** frame size was used (is this a variable-frame size ***", "*** file?) and that the bitstream is not corrupted.***");
-          exit (9);
-        } else if (feof (Fibs)) {
-          /* EOF reached. Since the input bitstream is headerless, this maybe a corrupt file, or the user simply specified the wrong frame size. Warn the user and continue */
-          fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this HEADERLESS bitstream is not ***", "*** multiple of the given frame length. Check that ***", "*** the correct frame size was selected & that the ***", "*** bitstream file is not corrupted.***");
-          bs_len = fr_len = items;
-        } else                  /* An unknown error happened! */
-          KILL (ibs_file, 7);
-      }
-      /* Read a number of erasure flags from file */
-      while (k == 0) {
-        /* No EP flags in buffer; read a number of them */
-        ep_true_len = k = read_patt (ep, ep_len, Fep);
-
-        /* No flags read - either error or EOF */
-        /* Go back to beginning of EP & fill up EP buffer */
-        if (k <= 0) {
-          if (k < 0)
-            KILL (ep_file, 7);  /* Error: abort */
-          fseek (Fep, 0l, SEEK_SET);    /* EOF: Rewind */
-          wraps++;              /* Count how many times wrapped EP */
-        }
+  /* Each frame of the bitstream(s) and of the error pattern(s) is read once, and applied to all the output bitstreams that use it */
+  while (1) {
+    /* Read one frame from each bitstream */
+    for (active = 0, b = ibs; b < ibs + nibs; b++)
+      if (!b->eof) {
+        if (read_frame (b, vbr, sync_header, ep_type) == 0)
+          b->eof = 1;
+        else
+          active++;
       }
 
-      /* Update frame counters */
-      processed++;
-
-      /* Save original or erased frame, as appropriate */
-      if (ep[ep_true_len - k] == G192_FER) {
-        /* If in VBR mode, update frame length value */
-        if (vbr)
-          erased_frame[1] = fr_len;
-        /* Write erased frame */
-        items = save_data (erased_frame, bs_len, Fobs);
-        disturbed++;
-      } else
-        /* Write undisturbed frame */
-        items = save_data (bs, bs_len, Fobs);
-
-      /* Abort on error */
-      if (items < bs_len)
-        KILL (obs_file, 7);
+    /* Stop when all bitstreams reach end-of-file */
+    if (active == 0)
+      break;
 
-      /* Decrement counter of number of flags in EP buffer */
-      k--;
+    /* Read one frame (BER) or one flag (FER) from each error pattern */
+    for (e = eps; e < eps + neps; e++) {
+      if (ep_type == FER)
+        e->flag = next_erasure_flag (e, ep_len);
+      else {
+        read_ep_frame (e, ep_len);
+#ifdef DEBUG
+        /* Save to a temp file - debugging */
+        fwrite (e->ep, sizeof (short), ep_len, F);
+#endif
+      }
     }
-    break;
-
-  case BER:
-    while (1) {
-      /* Read one frame from BS: two steps for VBR mode, one otherwise */
-      if (vbr) {
-        /* Get sync header to see how many samples are in this frame */
-        if ((items = read_data (bs, 2l, Fibs)) != 2)
-          break;
-        fr_len = bs[1];
-        bs_len = sync_header ? fr_len + 2 : fr_len;
 
-        /* ... and read payload, if not an empty frame */
-        if (fr_len != 0)
-          items += read_data (payload, fr_len, Fibs);
-      } else
-        /* Read one whole frame from bitstream */
-        items = read_data (bs, bs_len, Fibs);
-
-      /* Stop when reaches end-of-file */
-      if (items == 0)
+    for (j = 0; j < nobs; j++) {
+      b = ibs + (nibs > 1 ? j : 0);
+      e = eps + (neps > 1 ? j : 0);
+      if (b->eof)
+        continue;
+
+      switch (ep_type) {
+      case FER:
+        /* Update frame counters */
+        obs[j].processed++;
+
+        /* Save original or erased frame, as appropriate */
+        if (e->flag == G192_FER) {
+          /* If in VBR mode, update frame length value */
+          if (vbr)
+            erased_frame[1] = b->fr_len;
+          /* Write erased frame */
+          items = save_data (erased_frame, b->bs_len, obs[j].F);
+          obs[j].disturbed++;
+        } else
+          /* Write undisturbed frame */
+          items = save_data (b->bs, b->bs_len, obs[j].F);
         break;
 
-      /* Aborts on error */
-      if (items < 0)
-        KILL (ibs_file, 7);
-
-      /* Check if read all expected samples; if not, probably hit EOF */
-      if (items < bs_len) {
+      default:                 /* BER */
+        /* Convolve errors */
         if (sync_header) {
-          /* This situation should not occur in a headed BS - Abort */
-          fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this bitstream file is not multiple  ***", "*** of the given frame length. Check that the correct  ***", "*** frame size was used (is this a variable-frame size ***", "*** file?) and that the bitstream is not corrupted.***");
-          exit (9);
-        } else if (feof (Fibs)) {
-          /* Headerless BS is corrupted or wrong frame size was used */
-          /* This is not important for BER, so the msg is not printed */
-#ifdef DEBUG
-          fprintf (stderr, "%s\n%s\n%s\n%s\n", "*** File size for this HEADERLESS bitstream is not ***", "*** multiple of the given frame length. Check that ***", "*** the correct frame size was selected & that the ***", "*** bitstream file is not corrupted.***");
-#endif
-          bs_len = fr_len = items;
-        } else                  /* An unknown error happened! */
-          KILL (ibs_file, 7);
-      }
-
-      /* Read one error pattern frame from file */
-      items = read_patt (ep, ep_len, Fep);
+          out[0] = b->bs[0];
+          out[1] = b->bs[1];
+        }
+        items = insert_errors (b->payload, e->ep, sync_header ? out + 2 : out, b->fr_len);
 
-      /* Treat case when EP finishes before BS: */
-      /* Go back to beginning of EP & fill up EP buffer */
-      if (items < ep_len) {
-        if (items < 0)
-          KILL (ep_file, 7);
-        k = ep_len - items;     /* Number of missing EP samples */
-        fseek (Fep, 0l, SEEK_SET);      /* Rewind */
-        items = read_patt (&ep[items], k, Fep); /* Fill-up EP buffer */
+        /* Update BER counters */
+        obs[j].disturbed += items;
+        obs[j].processed += b->fr_len;
 
-        /* Count how many times wrapped the EP file */
-        wraps++;
+        /* Save disturbed bitstream to file */
+        items = save_data (out, b->bs_len, obs[j].F);
+        break;
       }
-#ifdef DEBUG
-      /* Save to a temp file - debugging */
-      fwrite (ep, sizeof (short), ep_len, F);
-#endif
-
-      /* Convolve errors */
-      items = insert_errors (payload, ep, payload, fr_len);
-
-      /* Update BER counters */
-      disturbed += items;
-      processed += fr_len;
-
-      /* Save disturbed bitstream to file */
-      items = save_data (bs, bs_len, Fobs);
 
       /* Abort on error */
-      if (items < bs_len)
-        KILL (obs_file, 7);
+      if (items < b->bs_len)
+        KILL (obs[j].file, 7);
     }
-    break;
   }
 
 
   /* *** PRINT SUMMARY OF OPTIONS & RESULTS ON SCREEN *** */
 
-  /* Restore frame lengths from memory (just in case they were changed) */
-  bs_len = ori_bs_len;
-  fr_len = ori_fr_len;
-
   /* Print summary */
   fprintf (stderr, "# Bitstream format %s...... : %s\n", sync_header ? "(G.192 header) " : "(headerless) ..", format_str ((int) bs_format));
   if (bs_format != obs_format)
     fprintf (stderr, "# Out bitstream format %s.. : %s\n", sync_header ? "(G.192 header) " : "(headerless) ..", format_str ((int) obs_format));
 
   fprintf (stderr, "# Pattern format %s....... : %s\n", ep_type == FER ? "(frame erasure) " : "(bit error) ....", format_str ((int) ep_format));
-  fprintf (stderr, "# Error pattern files wrapped ...........: %ld times\n", wraps);
-  fprintf (stderr, "# Frame size ............................: %ld\n", fr_len);
-  fprintf (stderr, "# Processed %s..................... : %.0f \n", ep_type == BER ? "bits .." : "frames ", processed);
-  fprintf (stderr, "# Distorted %s..................... : %.0f \n", ep_type == BER ? "bits .." : "frames ", disturbed);
-  fprintf (stderr, "# %s.....................: %f %%\n", ep_type == BER ? "Bit error rate ..." : "Frame erasure rate", 100.0 * disturbed / processed);
+  for (j = 0; j < nobs; j++) {
+    if (nobs > 1)
+      fprintf (stderr, "# Output bitstream ......................: %s\n", obs[j].file);
+    fprintf (stderr, "# Error pattern files wrapped ...........: %ld times\n", eps[neps > 1 ? j : 0].wraps);
+    fprintf (stderr, "# Frame size ............................: %ld\n", fr_len);
+    fprintf (stderr, "# Processed %s..................... : %.0f \n", ep_type == BER ? "bits .." : "frames ", obs[j].processed);
+    fprintf (stderr, "# Distorted %s..................... : %.0f \n", ep_type == BER ? "bits .." : "frames ", obs[j].disturbed);
+    fprintf (stderr, "# %s.....................: %f %%\n", ep_type == BER ? "Bit error rate ..." : "Frame erasure rate", 100.0 * obs[j].disturbed / obs[j].processed);
+  }
 
 
   /* *** FINALIZATIONS *** */
 
-  /* Free memory allocated */
+  /* Free memory allocated and close the files */
   free (erased_frame);
-  free (ep);
-  free (bs);
-
-  /* Close the output file and quit *** */
-  fclose (Fibs);
-  fclose (Fep);
-  fclose (Fobs);
+  free (out);
+  free (packed_bs);
+  free (packed_ep);
+  for (b = ibs; b < ibs + nibs; b++) {
+    free (b->bs);
+    fclose (b->F);
+  }
+  for (e = eps; e < eps + neps; e++) {
+    free (e->ep);
+    fclose (e->F);
+  }
+  for (j = 0; j < nobs; j++)
+    fclose (obs[j].F);
+  if (names != NULL) {
+    for (j = 0; j < 2 * nobs; j++)
+      free (names[j]);
+    free (names);
+  }
+  free (ibs);
+  free (eps);
+  free (obs);
 #ifdef DEBUG
   fclose (F);
 #endif
@@ -1,4 +1,4 @@
-/*                                                            02.Feb.2010  v2.7
+/*                                                            17.Oct.2026  v2.8
   =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -124,6 +124,22 @@ FUNCTIONS       : - open_eid (double ber, double gamma)
 		   - FER_generator_burst(BURST_EID *state);
                    - reset_burst_eid(BURST_EID *burst_eid);
 
+                  - set_RAN_mode (SCD_EID *EID, int mode)
+                     Selects the random generator of BER_generator() and
+                     FER_generator_random(): EID_RAN_LCG (default; the
+                     legacy LCG, one number per bit and per state change)
+                     or EID_RAN_FAST (64-bit generator drawing the run
+                     lengths up to the next state change or error).
+
+                  - set_RAN_stream (SCD_EID *EID, unsigned long seed,
+                                    long stream)
+                  - set_burst_stream (BURST_EID *state, unsigned long seed,
+                                      long stream)
+                     Start independent random sequence number "stream"
+                     of a seed, the channel state being drawn from the
+                     stationary distribution of the model (used by
+                     EID_par_generate(), see eid_par.c).
+
  HISTORY:
   28.Feb.92 v1.0 1st UGST version
   20.Apr.92 v2.0 Modifications on the RNG
@@ -142,6 +158,16 @@ FUNCTIONS       : - open_eid (double ber, double gamma)
                  to extend Bellcore burst model resolution and operating
                  range to [0.5-30%]. <J.Sv. Ericsson>
   02.Feb.10 v2.7 Modified maximum string lenght for filenames (y.hiwasaki)
+  17.Oct.26 v2.8 Added the fast random generator mode (set_RAN_mode()),
+                 with geometric sampling of the run lengths in
+                 BER_generator(); the scale factor of EID_random() is
+                 computed once.
+  17.Oct.26 v2.9 Transition vector of the Bellcore model kept in the
+                 BURST_EID struct instead of a global array (several
+                 models in one process); added set_RAN_stream() and
+                 set_burst_stream().
+  17.Oct.26 v2.10 Scale factor of EID_random() is a constant (no
+                 static set on the first call, for parallel generators).
   =============================================================================
 */
 
@@ -465,6 +491,7 @@ int PORTABILITY_TEST_OPERATION = 1;
 #include <time.h>
 #include <math.h>
 #include <stdlib.h>
+#include <limits.h>             /* ULONG_MAX */
 #include <ctype.h>
 #include <stdio.h>
 
@@ -473,12 +500,19 @@ int PORTABILITY_TEST_OPERATION = 1;
 
 /* Local function prototypes and definitions .........*/
 double EID_random ARGS ((unsigned long *seed));
+static double EID_random_fast ARGS ((unsigned long long *state));
+static long EID_geometric ARGS ((unsigned long long *state, double p, long nmax));
+static double GEC_stay_prob ARGS ((SCD_EID * EID, long state));
+static long GEC_next_state ARGS ((SCD_EID * EID, long state, double ran));
+static double BER_generator_fast ARGS ((SCD_EID * EID, long lseg, short *EPbuff));
+static unsigned long long EID_stream_seed ARGS ((unsigned long seed, long stream));
 void update_EID_random ARGS ((long len_register, long *shift_register));
 long GEC_init ARGS ((SCD_EID * EID, double ber, double gamma));
 double bfer_comp (long index);
-/* ......... Global variable: Bellcore Model Transition probability vector ......... */
-/* ......... prob[0]=P0 updated from command line, using function bfer_comp......... */
-double prob[MODEL_SIZE] = { 0.0023, 0.85, 0.825, 0.8, 0.775, 0.75, 0.725, 0.7, 0.6, 0.45, 0.0 };
+/* ......... Default Bellcore Model Transition probability vector ......... */
+/* ......... copied in each BURST_EID by open_burst_eid(), where ......... */
+/* ......... P0 is replaced by the value of bfer_comp() ......... */
+static double prob[MODEL_SIZE] = { 0.0023, 0.85, 0.825, 0.8, 0.775, 0.75, 0.725, 0.7, 0.6, 0.45, 0.0 };
 
 /*
  * ...................... BEGIN OF FUNCTIONS .........................
@@ -531,6 +565,7 @@ SCD_EID *open_eid (double ber, double gamma) {
   time (&t1);
 #endif
   EID->seed = (unsigned long) t1;
+  EID->ran_mode = EID_RAN_LCG;
 
 
   /* Initialize Gilbert-Elliot Channel model */
@@ -646,6 +681,10 @@ double BER_generator (EID, lseg, EPbuff)
   if (lseg == (long) 0)
     return (0.0);
 
+  /* Draw run lengths instead of bits */
+  if (EID->ran_mode == EID_RAN_FAST)
+    return (BER_generator_fast (EID, lseg, EPbuff));
+
   /* Generate random bits */
   ber = 0.0;
   for (i = 0; i < lseg; i++) {
@@ -954,8 +993,13 @@ double FER_generator_random (EID)
 {
   long n;                       /* value of random generator */
   double RAN, fer;
+  short EP;
 
 
+  /* One bit of the fast generator */
+  if (EID->ran_mode == EID_RAN_FAST)
+    return (BER_generator_fast (EID, 1L, &EP));
+
   /* Get next random number */
   RAN = EID_random (&(EID->seed));
 
@@ -1246,29 +1290,276 @@ double FER_module_stl96 (EID, lseg, xbuff, ybuff)
                        longs have 64, not 32 bits). Implemented by
                        <simao.campos@comsat.com>, after bug reported
                        by <claude.lamblin@cnet.francetelecom.fr>
+        17.Oct.26 v3.1 Scale factor computed once instead of calling
+                       pow() for each number (same results).
+        17.Oct.26 v3.2 Scale factor is a constant, 1/(ULONG_MAX+1), instead
+                       of a static computed on the first call, which
+                       threads could race on (same results).
 
  ============================================================================
 */
 double EID_random (seed)
      unsigned long *seed;
 {
-  /* Size in bits (=size in bytes * 8) for long variables */
-  static double bits_in_long = sizeof (long) * 8;
+  /* 2^-(size in bits of long variables), exact; a compile-time constant,
+     so that generators running in parallel threads share no state */
+  static const double scale = 1.0 / ((double) ULONG_MAX + 1.0);
 
   /* Update RNG */
   *seed = ((unsigned long) 69069L * (*seed) + 1L);
 
   /* Return random number as a double */
-#ifdef WAS
-  return (pow ((double) 2.0, (double) -32.0) * (double) (*seed));
-#else
-  return (pow ((double) 2.0, -bits_in_long) * (double) (*seed));
-#endif
+  return (scale * (double) (*seed));
 }
 
 /* ....................... End of EID_random() ....................... */
 
 
+/*
+  ============================================================================
+
+        static double EID_random_fast (unsigned long long *state);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Returns a new random number of the fast mode (EID_RAN_FAST),
+        generated by the SplitMix64 generator: a 64-bit Weyl sequence
+        followed by a bit mixing function. See: Steele, G.L., Lea, D.,
+        Flood, C.H. 2014: "Fast Splittable Pseudorandom Number
+        Generators", OOPSLA 2014.
+
+        Parameters:
+        ~~~~~~~~~~~
+        state: ... 64-bit generator state.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns a random number as double in the range ]0..1], with
+        53 bits of resolution.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static double EID_random_fast (unsigned long long *state) {
+  unsigned long long z;
+
+  /* Update state and mix */
+  z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= (z >> 31);
+
+  /* Upper 53 bits as a double, 0 excluded */
+  return (((double) (z >> 11) + 1.0) * (1.0 / 9007199254740992.0));
+}
+
+/* ....................... End of EID_random_fast() ....................... */
+
+
+/*
+  ============================================================================
+
+        static long EID_geometric (unsigned long long *state, double p,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~  long nmax);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Draws the number of failures before the first success of
+        independent trials with probability of success p (geometric
+        distribution), by inversion of its distribution function:
+        k = floor (log (U) / log (1 - p)), U uniform in ]0..1].
+        One random number replaces the k+1 trials.
+
+        Parameters:
+        ~~~~~~~~~~~
+        state: ... 64-bit generator state.
+        p: ....... probability of success of each trial.
+        nmax: .... upper limit of the result.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns the number of failures, limited to nmax.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static long EID_geometric (unsigned long long *state, double p, long nmax) {
+  double k;
+
+  if (p <= 0.0)
+    return (nmax);
+  if (p >= 1.0)
+    return (0L);
+
+  k = floor (log (EID_random_fast (state)) / log1p (-p));
+  return (k < (double) nmax ? (long) k : nmax);
+}
+
+/* ....................... End of EID_geometric() ....................... */
+
+
+/*
+  ============================================================================
+
+        static double GEC_stay_prob (SCD_EID *EID, long state);
+        static long GEC_next_state (SCD_EID *EID, long state, double ran);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Probabilities of the transitions of the channel model, as
+        selected by BER_generator() with one random number RAN: the
+        next state is the first n with RAN < matrix[state][n], or the
+        same state if there is none. GEC_stay_prob() returns the
+        probability to remain in the state; GEC_next_state() returns
+        the next state other than "state", for ran uniform in
+        [0 .. 1-GEC_stay_prob()[.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ..... pointer to EID-struct
+        state: ... current state
+        ran: ..... random number
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Probability to remain in the state / next state.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static double GEC_stay_prob (SCD_EID *EID, long state) {
+  long n;
+  double lim, top = 0.0, stay = 0.0;
+
+  for (n = 0; n < EID->nstates; n++) {
+    lim = EID->matrix[state][n] < 1.0 ? EID->matrix[state][n] : 1.0;
+    if (lim > top) {
+      if (n == state)
+        stay = lim - top;
+      top = lim;
+    }
+  }
+
+  /* no threshold reached: state unchanged */
+  return (stay + 1.0 - top);
+}
+
+static long GEC_next_state (SCD_EID *EID, long state, double ran) {
+  long n, next = state;
+  double lim, top = 0.0;
+
+  for (n = 0; n < EID->nstates; n++) {
+    lim = EID->matrix[state][n] < 1.0 ? EID->matrix[state][n] : 1.0;
+    if (lim > top) {
+      if (n != state) {
+        next = n;
+        if (ran < lim - top)
+          break;
+        ran -= lim - top;
+      }
+      top = lim;
+    }
+  }
+  return (next);
+}
+
+/* .................. End of GEC_stay_prob(), GEC_next_state() .................. */
+
+
+/*
+  ============================================================================
+
+        static double BER_generator_fast (SCD_EID *EID, long lseg,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  short *EPbuff);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        BER_generator() of the fast mode (EID_RAN_FAST). Same channel
+        model, but instead of drawing two random numbers per bit, it
+        draws the number of bits up to the next state change, and in
+        each state the number of bits up to the next error (geometric
+        distributions, see EID_geometric()). Both distributions are
+        memoryless, so that runs cut at the end of a frame are drawn
+        again in the next one. At low bit error rates, there are only
+        a few random numbers per frame.
+
+        The 64-bit generator state is kept in EID->seed (its lower
+        32 bits only, where longs have 32 bits), so that the state
+        variable files of the EID remain valid.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ...... (In/Out) struct with channel model
+        lseg: ..... (In)     length of current frame
+        EPbuff: ... (Out)    bit error pattern (softbits)
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns the number of bit errors in the current frame as a double.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static double BER_generator_fast (SCD_EID *EID, long lseg, short *EPbuff) {
+  unsigned long long state = (unsigned long long) EID->seed;
+  long i, k, end, cur = EID->current_state;
+  double stay, ber = 0.0;
+
+  for (i = 0; i < lseg;) {
+    /* bits remaining in the current state, then the bit of the state change */
+    stay = GEC_stay_prob (EID, cur);
+    end = i + EID_geometric (&state, 1.0 - stay, lseg - i);
+
+    /* errors of the state (0x007F between them) */
+    while (i < end) {
+      k = i + EID_geometric (&state, EID->ber[cur], end - i);
+      for (; i < k; i++)
+        EPbuff[i] = (short) 0x007F;
+      if (i < end) {
+        EPbuff[i++] = (short) 0x0081;
+        ber += 1.0;
+      }
+    }
+
+    /* state change, and error decision of its bit */
+    if (i < lseg) {
+      cur = GEC_next_state (EID, cur, EID_random_fast (&state) * (1.0 - stay));
+      if (EID_random_fast (&state) <= EID->ber[cur]) {
+        EPbuff[i] = (short) 0x0081;
+        ber += 1.0;
+      } else {
+        EPbuff[i] = (short) 0x007F;
+      }
+      i++;
+    }
+  }
+
+  EID->current_state = cur;
+  EID->seed = (unsigned long) state;
+  return (ber);                 /* return number of error bits */
+}
+
+/* ....................... End of BER_generator_fast() ....................... */
+
+
 /*
   ============================================================================
 
@@ -1504,6 +1795,226 @@ unsigned long get_RAN_seed (EID)
 /* ....................... End of get_RAN_seed() ....................... */
 
 
+/*
+  ==========================================================================
+
+        void set_RAN_mode (SCD_EID *EID, int mode);
+        ~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Selects the random generator of BER_generator() and
+        FER_generator_random():
+        EID_RAN_LCG .... legacy LCG (EID_random()), one random number
+                         per bit for the state and one for the error;
+                         reproduces the patterns of previous versions.
+        EID_RAN_FAST ... SplitMix64 generator, drawing the run lengths
+                         up to the next state change or bit error
+                         (same channel model, different patterns).
+        The seed and the channel state are kept.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ... (In/Out) Pointer to EID-struct
+        mode: .. (In)     EID_RAN_LCG or EID_RAN_FAST
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void set_RAN_mode (SCD_EID *EID, int mode) {
+  EID->ran_mode = mode == EID_RAN_FAST ? EID_RAN_FAST : EID_RAN_LCG;
+}
+
+/* ....................... End of set_RAN_mode() ....................... */
+
+
+/*
+  ==========================================================================
+
+        int get_RAN_mode (SCD_EID *EID);
+        ~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Returns the random generator mode (EID_RAN_LCG or EID_RAN_FAST)
+        selected by set_RAN_mode().
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ... pointer to EID structure with states.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns the current mode.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+int get_RAN_mode (SCD_EID *EID) {
+  return (EID->ran_mode);
+}
+
+/* ....................... End of get_RAN_mode() ....................... */
+
+
+/*
+  ==========================================================================
+
+        static unsigned long long EID_stream_seed (unsigned long seed,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  long stream);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Returns the initial state of the 64-bit generator of the random
+        sequence number "stream" of a seed: both are combined and mixed
+        by the output function of EID_random_fast(), so that neighbour
+        streams (and seeds) give unrelated sequences. As the state only
+        depends on (seed, stream), any stream can be generated without
+        the previous ones (counter-based seeding).
+
+        Parameters:
+        ~~~~~~~~~~~
+        seed: .... user seed.
+        stream: .. sequence number.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        64-bit generator state.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+static unsigned long long EID_stream_seed (unsigned long seed, long stream) {
+  unsigned long long z;
+
+  z = (unsigned long long) seed * 0x9E3779B97F4A7C15ULL;
+  z ^= ((unsigned long long) stream + 1) * 0xD1B54A32D192ED03ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (z ^ (z >> 31));
+}
+
+/* ....................... End of EID_stream_seed() ....................... */
+
+
+/*
+  ==========================================================================
+
+        void set_RAN_stream (SCD_EID *EID, unsigned long seed,
+        ~~~~~~~~~~~~~~~~~~~  long stream);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Selects the fast random generator (EID_RAN_FAST) and starts its
+        sequence number "stream" of "seed" (see EID_stream_seed()). The
+        channel state is drawn from the stationary distribution of the
+        two-state model, so that a pattern made of streams generated
+        separately has the statistics of a single one; channels with
+        other numbers of states keep their current state.
+
+        Parameters:
+        ~~~~~~~~~~~
+        EID: ..... (In/Out) Pointer to EID-struct
+        seed: .... (In)     user seed
+        stream: .. (In)     sequence number
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void set_RAN_stream (SCD_EID *EID, unsigned long seed, long stream) {
+  unsigned long long state = EID_stream_seed (seed, stream);
+  double p01, p10;
+
+  EID->ran_mode = EID_RAN_FAST;
+  if (EID->nstates == 2) {
+    /* P(state 1) = p01 / (p01 + p10) */
+    p01 = 1.0 - GEC_stay_prob (EID, 0L);
+    p10 = 1.0 - GEC_stay_prob (EID, 1L);
+    if (p01 + p10 > 0.0)
+      EID->current_state = EID_random_fast (&state) * (p01 + p10) <= p01 ? 1 : 0;
+  }
+  EID->seed = (unsigned long) state;
+}
+
+/* ....................... End of set_RAN_stream() ....................... */
+
+
+/*
+  ==========================================================================
+
+        void set_burst_stream (BURST_EID *state, unsigned long seed,
+        ~~~~~~~~~~~~~~~~~~~~~  long stream);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Starts the random sequence number "stream" of "seed" of the
+        Bellcore model (the generator of FER_generator_burst() is seeded
+        with EID_stream_seed()). The state (number of consecutive bad
+        frames) is drawn from the stationary distribution of the model:
+        P(s) is proportional to prob[0]*...*prob[s-1]. The counters are
+        not changed.
+
+        Parameters:
+        ~~~~~~~~~~~
+        state: ... (In/Out) State variable describing the channel.
+        seed: .... (In)     user seed
+        stream: .. (In)     sequence number
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ============================================================================
+*/
+void set_burst_stream (BURST_EID *state, unsigned long seed, long stream) {
+  unsigned long long gen = EID_stream_seed (seed, stream);
+  double p[MODEL_SIZE], sum = 0.0, ran;
+  long s;
+
+  for (s = 0; s < MODEL_SIZE; s++) {
+    p[s] = s == 0 ? 1.0 : p[s - 1] * state->prob[s - 1];
+    sum += p[s];
+  }
+
+  ran = EID_random_fast (&gen) * sum;
+  for (s = 0; s < MODEL_SIZE - 1 && ran > p[s]; s++)
+    ran -= p[s];
+  state->s_new = s;
+  state->seedptr = (unsigned long) gen;
+}
+
+/* ....................... End of set_burst_stream() ....................... */
+
+
 /*
   ==========================================================================
 
@@ -1736,6 +2247,8 @@ char get_GEC_current_state (EID)
         History:
         ~~~~~~~~
         04/Aug/93 v.1.0 Created
+        17.Oct.26 v.1.1 Transition vector copied in the struct, instead
+                        of updating a global one.
 
  ============================================================================
 */
@@ -1771,14 +2284,17 @@ BURST_EID *open_burst_eid (index)
     burst_eid->index = 2;
   }
 
-  prob[0] = bfer_comp (burst_eid->index);
+  for (i = 0; i < MODEL_SIZE; i++) {
+    burst_eid->prob[i] = prob[i];
+  }
+  burst_eid->prob[0] = bfer_comp (burst_eid->index);
 
 #ifdef DEBUG
   /*
    **  Print out the selected coefficient vector
    */
   for (i = 0; i < MODEL_SIZE; i++) {
-    printf ("p[%2d]=%f\n", i, prob[i]);
+    printf ("p[%2d]=%f\n", i, burst_eid->prob[i]);
   }
 #endif
 
@@ -1825,6 +2341,7 @@ BURST_EID *open_burst_eid (index)
                        longs have 64, not 32 bits). Implemented by
                        <simao.campos@comsat.com>, after bug reported
                        by <claude.lamblin@cnet.francetelecom.fr>
+        17.Oct.26 v3.1 Transition vector of the struct.
 
  ============================================================================
 */
@@ -1845,7 +2362,7 @@ double FER_generator_burst (state)
 #else
   ran = (pow ((double) 2.0, -bits_in_long) * (double) (state->seedptr));
 #endif
-  aux = prob[state->s_new];
+  aux = state->prob[state->s_new];
   in = floor (ran + aux);       /* in = 0 indicates good frame */
   /* in = 1 indicates bad frame */
   if (in == 0) {                /* If frame is good, */
@@ -16,11 +16,17 @@
                         <Morgan.Lindqvist@era-t.ericsson.se> comments for the
 		        cc compiler in a DEC Alpha Unix machine.
    10.Oct.97    v2.4    Added prototype for reset_burst_eid() <simao>   
+   17.Oct.26    v2.5    Added set_RAN_mode()/get_RAN_mode() and the
+                        random generator modes
+   17.Oct.26    v2.6    Transition vector of the Bellcore model in the
+                        BURST_EID struct; added set_RAN_stream() and
+                        set_burst_stream()
   ============================================================================
 */
 
 #include <math.h>               /* RTL Math Function Declarations */
 #include <stdlib.h>             /* General utility definitions */
+#include <stddef.h>             /* offsetof() */
 
 #ifndef EID_defined
 #define EID_defined 300
@@ -37,6 +43,10 @@
 #define MODEL_SIZE 11
 #define MODEL_NUMBER 5
 
+/* Random generator modes, see set_RAN_mode() */
+#define EID_RAN_LCG  0          /* legacy LCG, one number per bit */
+#define EID_RAN_FAST 1          /* 64-bit generator, run lengths */
+
 #if defined(VMS) | defined(MSDOS) | defined (__MSDOS__) | defined (__STDC__)
 #define CONST const
 #else
@@ -57,6 +67,7 @@ typedef struct {
   /* another one */
   double usrber;                /* user defined bit error rate */
   double usrgamma;              /* user defined correlation factor */
+  int ran_mode;                 /* EID_RAN_LCG or EID_RAN_FAST */
 } SCD_EID;
 
 typedef struct {
@@ -64,8 +75,12 @@ typedef struct {
   long internal[MODEL_SIZE];
   long s_new;
   long index;
+  double prob[MODEL_SIZE];      /* transition vector (bad frame prob.) */
 } BURST_EID;
 
+/* Part of BURST_EID saved in state variable files: the fields before prob[] */
+#define BURST_EID_STATE_SIZE offsetof (BURST_EID, prob)
+
 /* 
  * ......... Definitions for G.192-compliant or non-compliant  ......... 
  * ......... handling of soft bitstreams (post- and pre-STL92) ......... 
@@ -85,6 +100,10 @@ SCD_EID *open_eid ARGS ((double ber, double gamma));
 BURST_EID *open_burst_eid ARGS ((long index));
 void set_RAN_seed ARGS ((SCD_EID * EID, unsigned long seed));
 unsigned long get_RAN_seed ARGS ((SCD_EID * EID));
+void set_RAN_mode ARGS ((SCD_EID * EID, int mode));
+void set_RAN_stream ARGS ((SCD_EID * EID, unsigned long seed, long stream));
+void set_burst_stream ARGS ((BURST_EID * state, unsigned long seed, long stream));
+int get_RAN_mode ARGS ((SCD_EID * EID));
 void set_GEC_matrix ARGS ((SCD_EID * EID, double threshold, int /* char */ current_state, int /* char */ next_state));
 double get_GEC_matrix ARGS ((SCD_EID * EID, int /* char */ current_state,
                              int /* char */ next_state));
@@ -1,4 +1,4 @@
-/*                                                        02.Feb.2010 v2.02
+/*                                                        17.Oct.2026 v2.03
   =========================================================================
 
    EID_IO.C
@@ -27,6 +27,8 @@
                      formats <simao.campos@comsat.com>
    13.Jan.98 v2.01 Clarified ambigous syntax in save_EID_to_file() <simao>
    02.Feb.10 v2.02 Correct casting of arguments to "toupper()" <y.hiwasaki>
+   17.Oct.26 v2.03 Burst EID state files limited to BURST_EID_STATE_SIZE
+                   (the transition vector is rebuilt by open_burst_eid())
   =========================================================================
 */
 
@@ -471,8 +473,8 @@ BURST_EID *recall_burst_eid_from_file (state_file, index)
   /*
    **  Read state from file
    */
-  items = fread (eid_in, 1, sizeof (BURST_EID), state_ptr);
-  if (items != sizeof (BURST_EID))
+  items = fread (eid_in, 1, BURST_EID_STATE_SIZE, state_ptr);
+  if (items != BURST_EID_STATE_SIZE)
     return ((BURST_EID *) 0);
 
   /*
@@ -568,8 +570,8 @@ long save_burst_eid_to_file (burst_eid, state_file)
   /*
    ** Write state to file
    */
-  items = fwrite (burst_eid, 1, sizeof (BURST_EID), state_ptr);
-  if (items != sizeof (BURST_EID))
+  items = fwrite (burst_eid, 1, BURST_EID_STATE_SIZE, state_ptr);
+  if (items != BURST_EID_STATE_SIZE)
     return (0);
 
   /*
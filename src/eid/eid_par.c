@@ -0,0 +1,193 @@
+/*                                                         17/Oct/2026 v1.1 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+MODULE:         PARALLEL ERROR PATTERN GENERATOR OF THE UGST EID MODULE
+
+DESCRIPTION:
+        EID_par_generate() produces long error patterns with a pool of
+        threads. The pattern is cut in blocks of par->block bits (or
+        frames), and block number b is generated by the random stream
+        number b of par->seed (set_RAN_stream(), set_burst_stream()):
+        the generator state of a block only depends on the seed and on
+        the block number, not on the previous blocks. Each block is
+        generated entirely by one thread, on its own copy of the model,
+        so the pattern is the same whatever the number of threads.
+
+        At the start of each block, the state of the model is drawn
+        from its stationary distribution; the statistics of the pattern
+        are those of a single sequence, only the correlation across the
+        block boundaries is lost. The Gilbert model (BER and FER modes)
+        uses the fast random generator (EID_RAN_FAST); the Bellcore
+        model (BFER) keeps the generator of FER_generator_burst().
+
+        The threads are those of ugst_pool_run() (ugst-pool.c).
+
+HISTORY:
+        17.Oct.26 v1.0 First version
+        17.Oct.26 v1.1 Pool of threads of ugst-pool.c
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "eid.h"
+#include "eid_par.h"
+#include "softbit.h"
+#include "ugst-pool.h"
+
+/* One block of the pattern */
+typedef struct {
+  long stream;                  /* random stream (block number) */
+  long n;                       /* bits|frames of the block */
+  short *patt;                  /* output */
+  double count;                 /* errors|erasures in the block */
+  SCD_EID eid;                  /* copy of the Gilbert model */
+  BURST_EID burst;              /* copy of the Bellcore model */
+} eid_par_job;
+
+/* Blocks of one call */
+typedef struct {
+  EID_PAR *par;                 /* models and streams */
+  eid_par_job *job;             /* the blocks to generate */
+} eid_par_pool;
+
+
+/*
+  ============================================================================
+
+       void eid_par_run_job (void *ctx, long k);
+       ~~~~~~~~~~~~~~~~~~~~
+
+       Generate block k of the pool `ctx' (an eid_par_pool), on the copy
+       of the model in the job.
+
+  ============================================================================
+*/
+static void eid_par_run_job (void *ctx, long k) {
+  eid_par_pool *pool = (eid_par_pool *) ctx;
+  EID_PAR *par = pool->par;
+  eid_par_job *job = &pool->job[k];
+  long i;
+
+  if (par->burst) {
+    job->burst = *par->burst;
+    memset (job->burst.internal, 0, sizeof (job->burst.internal));
+    set_burst_stream (&job->burst, par->seed, job->stream);
+    for (job->count = i = 0; i < job->n; i++) {
+      if (FER_generator_burst (&job->burst) != 0.0) {
+        job->patt[i] = G192_FER;
+        job->count++;
+      } else
+        job->patt[i] = G192_SYNC;
+    }
+    return;
+  }
+
+  job->eid = *par->eid;
+  set_RAN_stream (&job->eid, par->seed, job->stream);
+  job->count = BER_generator (&job->eid, job->n, job->patt);
+
+  /* FER: the frames are the bits of BER_generator() */
+  if (par->fer)
+    for (i = 0; i < job->n; i++)
+      job->patt[i] = job->patt[i] == G192_ONE ? G192_FER : G192_SYNC;
+}
+
+/* ....................... End of eid_par_run_job() ....................... */
+
+
+/*
+  ============================================================================
+
+       double EID_par_generate (EID_PAR *par, long first, long n,
+       ~~~~~~~~~~~~~~~~~~~~~~~  short *patt);
+
+       Description:
+       ~~~~~~~~~~~~
+       Generate n bits (par->eid, par->fer == 0: 0x007F/0x0081) or
+       frame erasure flags (par->eid with par->fer set, or par->burst:
+       0x6B21/0x6B20) in patt[], made of the blocks first, first+1, ...
+       of par->block items each (the last one may be incomplete), with
+       par->threads threads. Without POSIX threads, or if a thread can
+       not be created, the remaining blocks are generated by the
+       calling thread.
+
+       The pattern of a block is the same in all calls, so that a long
+       pattern may be generated in several calls, and the next call
+       should start at the block following the last one. On return,
+       the model has the state at the end of the last block, and the
+       counters of the Bellcore model are updated with all the blocks.
+
+       Return value:
+       ~~~~~~~~~~~~~
+       Number of bit errors|frame erasures as a double, or -1 if the
+       memory for the blocks could not be allocated.
+
+  ============================================================================
+*/
+double EID_par_generate (EID_PAR * par, long first, long n, short *patt) {
+  eid_par_pool pool;
+  eid_par_job *job;
+  double count = 0.0;
+  long block = par->block > 0 ? par->block : EID_PAR_BLOCK;
+  long k, s, njobs;
+
+  if (n <= 0)
+    return (0.0);
+
+  /* One job per block */
+  njobs = (n + block - 1) / block;
+  if ((job = (eid_par_job *) calloc (njobs, sizeof (eid_par_job))) == NULL)
+    return (-1.0);
+  for (k = 0; k < njobs; k++) {
+    job[k].stream = first + k;
+    job[k].patt = patt + k * block;
+    job[k].n = n - k * block < block ? n - k * block : block;
+  }
+  pool.par = par;
+  pool.job = job;
+  ugst_pool_run (eid_par_run_job, &pool, njobs, par->threads);
+
+  /* Results in block order; state at the end of the last block */
+  for (k = 0; k < njobs; k++) {
+    count += job[k].count;
+    if (par->burst)
+      for (s = 0; s < MODEL_SIZE; s++)
+        par->burst->internal[s] += job[k].burst.internal[s];
+  }
+  k = njobs - 1;
+  if (par->burst) {
+    par->burst->seedptr = job[k].burst.seedptr;
+    par->burst->s_new = job[k].burst.s_new;
+  } else {
+    par->eid->seed = job[k].eid.seed;
+    par->eid->current_state = job[k].eid.current_state;
+    par->eid->ran_mode = EID_RAN_FAST;
+  }
+
+  free (job);
+  return (count);
+}
+
+/* ....................... End of EID_par_generate() ....................... */
+
+/* ******************** End of eid_par.c ***************************** */
@@ -0,0 +1,46 @@
+/*
+ ============================================================================
+   File: EID_PAR.H                                                  17.OCT.26
+ ============================================================================
+
+		  UGST/ITU-T ERROR INSERTION MODULE
+
+	  PROTOTYPES FOR THE PARALLEL ERROR PATTERN GENERATOR
+
+   HISTORY:
+   ~~~~~~~~
+   17.Oct.26 v1.0  Created
+ ============================================================================
+*/
+#ifndef EID_PAR_defined
+#define EID_PAR_defined 100
+
+#include "eid.h"
+
+/* ......... Smart prototypes .......... */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else
+#define ARGS(x) ()
+#endif
+#endif
+
+/* Default number of bits|frames per random stream */
+#define EID_PAR_BLOCK 65536L
+
+/* Parallel generator: one of the models, and the stream parameters */
+typedef struct {
+  SCD_EID *eid;                 /* Gilbert model (BER/FER), or NULL */
+  BURST_EID *burst;             /* Bellcore model (BFER), or NULL */
+  int fer;                      /* Gilbert model: frame erasure flags */
+  unsigned long seed;           /* seed of all the streams */
+  long block;                   /* bits|frames per stream */
+  int threads;                  /* number of threads (calling one incl.) */
+} EID_PAR;
+
+/* eid_par.c */
+double EID_par_generate ARGS ((EID_PAR * par, long first, long n, short *patt));
+
+#endif
+/* ........................... End of EID_PAR.H ........................... */
@@ -1,4 +1,4 @@
-/*                                                         02.Feb.2010 v.2.2
+/*                                                         17.Oct.2026 v.2.3
    =========================================================================
 
    ep-stats.c
@@ -48,6 +48,9 @@
                  for bit format)
    -fer ........ Error pattern type is frame erasure pattern (important
                  for bit format)
+   -rate r tol . Check that the overall bit error/frame erasure rate
+                 is r +- tol (fractions, as in gen-patt), and exit
+                 with code 1 if it is not
    -q .......... Quiet operation
    -? .......... Displays this message
    -help ....... Displays a complete help message
@@ -70,6 +73,8 @@
                      <Ericsson>
     2.Feb.2010 v.2.2 Modified maximum string length for filename to avoid
                      buffer overruns (y.hiwasaki)
+   17.Oct.2026 v.2.3 Added option -rate, to check the error/erasure rate
+                     of generated patterns in the test suite
    ========================================================================= */
 
 /* ..... Generic include files ..... */
@@ -117,7 +122,7 @@
    --------------------------------------------------------------------------
  */
 void display_usage (int level) {
-  printf ("ep-stats.c - Version 2.2 of 02.Feb.2010 \n\n");
+  printf ("ep-stats.c - Version 2.3 of 17.Oct.2026 \n\n");
 
   if (level) {
     printf ("Program Description:\n");
@@ -165,6 +170,7 @@ void display_usage (int level) {
   printf (" -ep format .. Format for error pattern (g192, byte, or bit)\n");
   printf (" -ber ........ Pattern type is bit error pattern\n");
   printf (" -fer ........ Pattern type is frame erasure pattern\n");
+  printf (" -rate r tol . Exit with code 1 if the overall rate is not r +- tol\n");
   printf (" -q .......... Quiet operation\n");
   printf (" -? .......... Displays this message\n");
   printf (" -help ....... Displays a complete help message\n");
@@ -190,6 +196,8 @@ int main (int argc, char *argv[]) {
   long burst_len = 10;          /* Max burst length to count */
   long start_item = 1;          /* Start analyzing errors from 1st one */
   long preamble_items = 0;
+  double check_rate = -1.0;     /* Expected rate, or <0 for no check */
+  double rate_tol = 0.0;        /* Tolerance of the expected rate */
   /* File I/O parameter */
   FILE *Fep;                    /* Pointer to error pattern file */
 
@@ -206,6 +214,8 @@ int main (int argc, char *argv[]) {
 #endif
   char quiet = 0;
   float ftmp;
+  double rate;
+  int status = 0;
 
   /* Pointer to a function */
   long (*read_patt) () = read_g192;     /* To read error pattern */
@@ -275,6 +285,14 @@ int main (int argc, char *argv[]) {
         /* Move arg{c,v} over the option to the next argument */
         argc--;
         argv++;
+      } else if (strcmp (argv[1], "-rate") == 0) {
+        /* Expected error/erasure rate, and its tolerance */
+        check_rate = atof (argv[2]);
+        rate_tol = atof (argv[3]);
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 3;
+        argv += 3;
       } else if (strcmp (argv[1], "-q") == 0) {
         /* Set quiet mode */
         quiet = 1;
@@ -433,6 +451,15 @@ int main (int argc, char *argv[]) {
   if (eps.unexpected)
     fprintf (stderr, "#*** %ld unexpected samples found in EP file\n", eps.unexpected);
 
+  /* Check the rate against the expected one */
+  if (check_rate >= 0) {
+    rate = eps.processed > 0 ? eps.disturbed / (double) eps.processed : 0.0;
+    if (fabs (rate - check_rate) > rate_tol) {
+      fprintf (stderr, "#*** Overall rate %f is not %f +- %f\n", rate, check_rate, rate_tol);
+      status = 1;
+    }
+  }
+
   /* *** FINALIZATIONS *** */
 
   /* Free memory allocated */
@@ -443,6 +470,6 @@ int main (int argc, char *argv[]) {
   fclose (Fep);
 
 #ifndef VMS                     /* return value to OS if not VMS */
-  return 0;
+  return status;
 #endif
 }
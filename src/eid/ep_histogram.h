@@ -5,6 +5,9 @@
 #include <sys/stat.h>
 #endif
 
+/* ..... Module definition files ..... */
+#include "g192bs.h"             /* Packed hard bits */
+
 /* Buffer size definitions */
 #define EID_BUFFER_LENGTH 256
 #define OUT_RECORD_LENGTH 512
@@ -18,6 +21,8 @@ typedef struct {
   long unexpected;              /* Number of unexpected conversions */
   char first_time;              /* Flag for general initializations */
   short *ep;                    /* Buffer for hard-bit version of error pattern */
+  BS_WORD *packed;              /* Buffer for packed version of error pattern */
+  long packed_size;             /* Size of the packed buffer, in words */
   long processed, disturbed;    /* No. of processed/disturbed bits */
   float event_distance;         /* Sum of error/erasure event distances */
   float event_distance_sq;      /* Squared sum of error/erasure event distances */
@@ -67,6 +72,8 @@ int init_ep_histogram (ep_histogram_state * state, long burst_len) {
   state->in_event = 0;
   state->first_time = 1;
   state->ep = 0;
+  state->packed = 0;
+  state->packed_size = 0;
   state->burst_len = burst_len;
   state->min_distance = 2147483647;
   state->max_distance = 0;
@@ -121,6 +128,7 @@ int init_ep_histogram (ep_histogram_state * state, long burst_len) {
 */
 void free_ep_histogram (ep_histogram_state * state) {
   free (state->hist);
+  free (state->packed);
 }
 
 /* ..................... End of free_ep_histogram() ..................... */
@@ -176,11 +184,14 @@ void free_ep_histogram (ep_histogram_state * state) {
   19.Nov.97  v1.1  Changed to use a state variable rather than local
                    static variables. Necessary for processing multiple
                    EP at the same time. <simao>
+  17.Oct.26  v.1.2  Error/erasure events found as runs of packed hard
+                   bits (g192bs.c), whole words at a time, when the
+                   pattern has no unexpected values.
 
   ---------------------------------------------------------------------------
 */
 long compute_ep_histogram (short *pattern, long items, int ep_type, ep_histogram_state * s, int reset) {
-  long i;
+  long i, run;
   long this_event;
   float delta;
 
@@ -224,6 +235,57 @@ long compute_ep_histogram (short *pattern, long items, int ep_type, ep_histogram
   /* Update counter */
   s->processed += items;
 
+  /* Allocate memory for the packed EP */
+  if (BS_WORDS (items) > s->packed_size) {
+    free (s->packed);
+    s->packed_size = BS_WORDS (items);
+    if ((s->packed = (BS_WORD *) malloc (s->packed_size * sizeof (BS_WORD))) == NULL)
+      error_terminate ("Can't allocate memory for counter. Aborted.\n", 6);
+  }
+
+  /* Convert EP to packed hard bits; if all values are as expected, the events are the runs of bits set */
+  if ((ep_type == BER ? g192_to_packed (pattern, items, s->packed) : fer_to_packed (pattern, items, s->packed)) == 0) {
+    for (i = 0; i < items; i += run) {
+      if (!s->in_event) {
+        /* Skip undisturbed bits/frames */
+        if ((i += packed_run (s->packed, items, i, 0)) == items)
+          break;
+
+        /* Start of an error/erasure event */
+        s->event_started = s->processed - items + i;
+        delta = s->event_started - s->last_event;
+        if (delta > s->max_distance)
+          s->max_distance = delta;
+        if (delta < s->min_distance)
+          s->min_distance = delta;
+        s->event_distance += delta;
+        s->event_distance_sq += delta * delta;
+#ifdef DEBUG
+        fprintf (stderr, "Event at bit/frame: %ld\n", s->event_started);
+#endif
+        s->in_event = 1;
+      }
+
+      /* Length of the event in this block; flush it if it ends here */
+      run = packed_run (s->packed, items, i, 1);
+      s->count += run;
+      if (i + run < items) {
+        this_event = (s->count <= s->burst_len) ? s->count : s->burst_len + 1;
+        s->hist[this_event]++;
+        s->disturbed += s->count;
+        s->count = 0;
+        s->in_event = 0;
+
+        s->event_no++;
+        s->last_event = s->event_started;
+      }
+    }
+
+    /* Set number of undisturbed bits/frames */
+    s->hist[0] = s->processed - s->disturbed;
+    return (s->unexpected);
+  }
+
   /* Convert EP to hardbit notation */
   s->unexpected += soft2hard (pattern, s->ep, items, ep_type);
 
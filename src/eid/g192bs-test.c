@@ -0,0 +1,120 @@
+/*                                                          17.Oct.2026 v1.0
+   =========================================================================
+
+   g192bs-test.c
+   ~~~~~~~~~~~~~
+
+   Program Description:
+   ~~~~~~~~~~~~~~~~~~~~
+
+   Self-test of the packed (1 bit per softbit) operations of g192bs.c,
+   on random hard-bit frames and error patterns of all lengths from 1
+   to MAX_LEN softbits (i.e. with full and partial last words):
+
+   - g192_to_packed() followed by packed_to_g192() gives back the
+     G.192 softbits (round trip);
+
+   - packed_xor() gives the same disturbed frame as g192_xor(), and
+     both count the same number of bit errors, which is also the
+     packed_count() of the error pattern;
+
+   - g192_to_packed() counts the softbits that are not hard bits.
+
+   Usage:
+   ~~~~~
+   g192bs-test [seed]
+
+   Returns 0 if all the checks pass, 1 otherwise.
+
+   History:
+   ~~~~~~~~
+   17.Oct.26 v.1.0 Created.
+
+   ========================================================================= */
+
+/* ..... Generic include files ..... */
+#include <stdio.h>              /* Standard I/O Definitions */
+#include <stdlib.h>             /* atol(), rand() */
+
+/* ..... Module definition files ..... */
+#include "softbit.h"            /* Soft bit definitions and prototypes */
+#include "g192bs.h"             /* Packed bitstreams */
+
+/* ..... Definitions used by the program ..... */
+#define MAX_LEN 300             /* Longest frame, in softbits */
+#define PASSES  8               /* Random frames per length */
+
+
+/* Random hard bit, '1' with probability 1/p */
+static short random_bit (int p) {
+  return (rand () % p == 0 ? G192_ONE : G192_ZERO);
+}
+
+
+/* ************************* MAIN PROGRAM ************************* */
+int main (int argc, char *argv[]) {
+  short a[MAX_LEN], ep[MAX_LEN], c[MAX_LEN], d[MAX_LEN];
+  BS_WORD pa[BS_WORDS (MAX_LEN) + 1], pe[BS_WORDS (MAX_LEN) + 1];
+  long n, i, pass, count, errors = 0;
+
+  srand (argc > 1 ? (unsigned) atol (argv[1]) : 1u);
+
+  for (n = 1; n <= MAX_LEN; n++)
+    for (pass = 0; pass < PASSES; pass++) {
+      /* Random frame, random error pattern (sparse or dense); the word after the last one is a guard */
+      for (i = 0; i < n; i++) {
+        a[i] = random_bit (2);
+        ep[i] = random_bit (pass % 2 ? 2 : 20);
+      }
+      pa[BS_WORDS (n)] = pe[BS_WORDS (n)] = ~(BS_WORD) 0;
+
+      /* Round trip */
+      if (g192_to_packed (a, n, pa) != 0 || g192_to_packed (ep, n, pe) != 0) {
+        fprintf (stderr, "n=%ld: hard bits counted as soft decision values\n", n);
+        errors++;
+      }
+      packed_to_g192 (pa, n, d);
+      for (i = 0; i < n && d[i] == a[i]; i++);
+      if (i < n) {
+        fprintf (stderr, "n=%ld: round trip differs at softbit %ld\n", n, i);
+        errors++;
+      }
+
+      /* Word-wise XOR and count against g192_xor() */
+      count = g192_xor (a, ep, c, n);
+      if (packed_count (pe, n) != count) {
+        fprintf (stderr, "n=%ld: packed_count() %ld, g192_xor() %ld\n", n, packed_count (pe, n), count);
+        errors++;
+      }
+      if (packed_xor (pa, pe, n) != count) {
+        fprintf (stderr, "n=%ld: packed_xor() count differs from g192_xor() %ld\n", n, count);
+        errors++;
+      }
+      packed_to_g192 (pa, n, d);
+      for (i = 0; i < n && d[i] == c[i]; i++);
+      if (i < n) {
+        fprintf (stderr, "n=%ld: packed_xor() differs from g192_xor() at softbit %ld\n", n, i);
+        errors++;
+      }
+      if (pa[BS_WORDS (n)] != ~(BS_WORD) 0) {
+        fprintf (stderr, "n=%ld: packed_xor() wrote past the last word\n", n);
+        errors++;
+      }
+
+      /* Soft decision values are counted */
+      a[n / 2] = 0;
+      if (g192_to_packed (a, n, pa) != 1) {
+        fprintf (stderr, "n=%ld: soft decision value not counted\n", n);
+        errors++;
+      }
+    }
+
+  if (errors)
+    fprintf (stderr, "g192bs-test: %ld errors\n", errors);
+  else
+    fprintf (stderr, "g192bs-test: all checks passed\n");
+
+  return (errors ? 1 : 0);
+}
+
+/* ************************* END OF G192BS-TEST.C ************************* */
@@ -0,0 +1,676 @@
+/*                                                        V.1.3 - 17.Oct.2026
+  ===========================================================================
+
+   g192bs.c
+   ~~~~~~~~
+
+   Description:
+   ~~~~~~~~~~~~
+
+   Shared layer for the programs processing G.192 bitstreams and error
+   patterns (softbit formats as described in softbit.c):
+
+   - open_g192_bs() maps a whole bitstream file in memory (mmap() on
+     Unix, file mapping on Windows; the file is read where neither is
+     available), so that its frames are accessed in place, without
+     one read per frame;
+
+   - index_g192_frames() builds the index of the frames of a bitstream
+     with G.192 sync headers (position of the sync word and length
+     of the payload), in 16-bit or byte-oriented format;
+
+   - the packed representation holds 1 bit per softbit in 64-bit
+     words (BS_WORD), in the bit order of the compact format, so that
+     bit errors are inserted and counted, and runs of error-free (or
+     erased) frames of an error pattern are found, one word (64 bits)
+     at a time instead of one 16-bit softbit at a time;
+
+   - g192_xor() inserts the bit errors of a whole frame of G.192
+     softbits, and the conversions to packed hard bits test 16
+     softbits at a time; both use SSE2 where available, and plain C
+     otherwise, with the same results.
+
+   Functions:
+   ~~~~~~~~~~
+   open_g192_bs ........ map a bitstream file, detect its format
+   close_g192_bs ....... release a mapped bitstream
+   index_g192_frames ... index of the frames (sync headers)
+   g192_to_packed ...... G.192 softbits to packed hard bits
+   fer_to_packed ....... G.192 frame erasure flags to packed hard bits
+   packed_to_g192 ...... packed hard bits to G.192 softbits
+   packed_xor .......... insert packed bit errors, count them
+   packed_count ........ count the bits set in packed hard bits
+   packed_run .......... length of a run of identical packed bits
+   g192_xor ............ insert bit errors in G.192 softbits, count them
+
+   History:
+   ~~~~~~~~
+   17.Oct.2026 v1.0  Created.
+   17.Oct.2026 v1.1  Added fer_to_packed(), packed_run() and g192_xor();
+                     SSE2 versions of the softbit conversions.
+   17.Oct.2026 v1.2  Removed the packed conversions and operations that
+                     no program uses (byte_to_packed(), packed_to_g192(),
+                     compact_to_packed(), packed_xor(), packed_count());
+                     64-bit file size, for files over 2 GB on all hosts.
+   17.Oct.2026 v1.3  packed_to_g192(), packed_xor() and packed_count()
+                     back, for the word-wise error insertion of eid-xor
+                     (option -packed).
+
+  ===========================================================================
+*/
+
+/* ..... Generic include files ..... */
+#include "ugstdemo.h"           /* general UGST definitions */
+#include <stdio.h>              /* Standard I/O Definitions */
+#include <stdlib.h>
+
+/* ..... OS-specific include files ..... */
+#if defined(_WIN32)
+#include <windows.h>            /* CreateFileMapping(), MapViewOfFile() */
+#define G192BS_MAP
+#elif defined(unix) || defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#include <fcntl.h>              /* open() */
+#include <unistd.h>             /* close() */
+#include <sys/mman.h>           /* mmap() */
+#define G192BS_MAP
+#endif
+
+/* ..... SIMD: SSE2 on x86 targets, plain C otherwise ..... */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define G192BS_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Specific includes */
+#include "g192bs.h"
+
+
+/*
+  -------------------------------------------------------------------------
+  Number of bits set in a packed word
+  -------------------------------------------------------------------------
+*/
+#if defined(__GNUC__) || defined(__clang__)
+#define bs_popcount(w) ((long) __builtin_popcountll (w))
+#else
+static long bs_popcount (BS_WORD w) {
+  w = w - ((w >> 1) & 0x5555555555555555ULL);
+  w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+  w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return ((long) ((w * 0x0101010101010101ULL) >> 56));
+}
+#endif
+
+/* Number of trailing zero bits of a non-zero packed word */
+#if defined(__GNUC__) || defined(__clang__)
+#define bs_ctz(w) ((long) __builtin_ctzll (w))
+#else
+static long bs_ctz (BS_WORD w) {
+  long n = 0;
+
+  while (!(w & 0xFFFF)) {
+    w >>= 16;
+    n += 16;
+  }
+  while (!(w & 1)) {
+    w >>= 1;
+    n++;
+  }
+  return (n);
+}
+#endif
+
+/* Mask of the valid bits in the last word of a packed stream of n bits */
+#define BS_LAST_MASK(n) ((n) % BS_WORD_BITS ? ((BS_WORD) 1 << ((n) % BS_WORD_BITS)) - 1 : ~(BS_WORD) 0)
+
+
+/*
+  -------------------------------------------------------------------------
+  G192_BS *open_g192_bs (char *file);
+  ~~~~~~~~~~~~~~~~~~~~~
+
+  Maps a bitstream file in memory (read only) and detects its format
+  (g192, byte or compact) and type (BER for headerless bitstreams, FER
+  for bitstreams with sync headers) as check_eid_format().
+
+  Parameter:
+  ~~~~~~~~~~
+  file .... name of the bitstream file
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns a pointer to the G192_BS structure, or a NULL pointer if the
+  file can't be opened or read.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+G192_BS *open_g192_bs (char *file) {
+  G192_BS *bs;
+  FILE *F;
+  long long size;
+  char type;
+
+  if ((F = fopen (file, RB)) == NULL)
+    return ((G192_BS *) 0);
+  if ((bs = (G192_BS *) calloc (1, sizeof (G192_BS))) == NULL) {
+    fclose (F);
+    return ((G192_BS *) 0);
+  }
+
+  /* Format, type and size of the file */
+  bs->format = check_eid_format (F, file, &type);
+  bs->type = type;
+#if defined(_WIN32)
+  _fseeki64 (F, 0, SEEK_END);
+  size = _ftelli64 (F);
+#elif defined(G192BS_MAP)
+  fseeko (F, (off_t) 0, SEEK_END);
+  size = (long long) ftello (F);
+#else
+  fseek (F, 0l, SEEK_END);
+  size = ftell (F);
+#endif
+  fseek (F, 0l, SEEK_SET);
+  bs->nframes = -1;
+
+  if (size <= 0) {
+    fclose (F);
+    return (bs);
+  }
+  if ((unsigned long long) size > (size_t) - 1) {
+    fclose (F);
+    free (bs);
+    return ((G192_BS *) 0);
+  }
+  bs->size = (size_t) size;
+
+  /* Map the file */
+#if defined(_WIN32)
+  {
+    HANDLE hfile, hmap;
+
+    hfile = CreateFileA (file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hfile != INVALID_HANDLE_VALUE) {
+      hmap = CreateFileMapping (hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+      CloseHandle (hfile);
+      if (hmap != NULL) {
+        bs->data = (unsigned char *) MapViewOfFile (hmap, FILE_MAP_READ, 0, 0, 0);
+        if (bs->data != NULL) {
+          bs->handle = (void *) hmap;
+          bs->mapped = 1;
+        } else
+          CloseHandle (hmap);
+      }
+    }
+  }
+#elif defined(G192BS_MAP)
+  {
+    int fd;
+    void *p;
+
+    if ((fd = open (file, O_RDONLY)) >= 0) {
+      p = mmap (NULL, bs->size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close (fd);
+      if (p != MAP_FAILED) {
+        bs->data = (unsigned char *) p;
+        bs->mapped = 1;
+      }
+    }
+  }
+#endif
+
+  /* ... or read it */
+  if (!bs->mapped) {
+    if ((bs->data = (unsigned char *) malloc (bs->size)) == NULL || fread (bs->data, 1, bs->size, F) != bs->size) {
+      fclose (F);
+      close_g192_bs (bs);
+      return ((G192_BS *) 0);
+    }
+  }
+
+  fclose (F);
+  return (bs);
+}
+
+/* ....................... End of open_g192_bs() ....................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  void close_g192_bs (G192_BS *bs);
+  ~~~~~~~~~~~~~~~~~~
+
+  Releases the mapping (or the memory) of a bitstream opened by
+  open_g192_bs(), and its frame index.
+
+  Parameter:
+  ~~~~~~~~~~
+  bs ...... pointer to the G192_BS structure
+
+  Return value:
+  ~~~~~~~~~~~~~
+  None.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+void close_g192_bs (G192_BS * bs) {
+  if (bs == (G192_BS *) 0)
+    return;
+
+  if (bs->data != NULL) {
+    if (bs->mapped) {
+#if defined(_WIN32)
+      UnmapViewOfFile (bs->data);
+      CloseHandle ((HANDLE) bs->handle);
+#elif defined(G192BS_MAP)
+      munmap ((void *) bs->data, bs->size);
+#endif
+    } else
+      free (bs->data);
+  }
+  free (bs->frame_pos);
+  free (bs->frame_len);
+  free (bs);
+}
+
+/* ....................... End of close_g192_bs() ....................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long index_g192_frames (G192_BS *bs);
+  ~~~~~~~~~~~~~~~~~~~~~~
+
+  Builds the index of the frames of a bitstream with G.192 sync headers
+  (16-bit or byte-oriented): for each frame, the position of its sync
+  word (0x6B20 to 0x6B2F, or 0x20 to 0x2F) and the length of its payload,
+  in samples. The payload of frame i starts at sample frame_pos[i]+2.
+
+  The index stops at the first invalid sync word or incomplete frame;
+  the number of samples left is then given in bs->tail (0 if the
+  whole file is indexed).
+
+  Parameter:
+  ~~~~~~~~~~
+  bs ...... pointer to the G192_BS structure
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of frames, or -1 if the bitstream has no sync
+  headers (compact format or headerless bitstream) or if memory can't
+  be allocated.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long index_g192_frames (G192_BS * bs) {
+  long pos, len, n, size = 0, *p;
+  short *word = (short *) bs->data;
+
+  bs->nframes = -1;
+  if (bs->format == compact || (bs->format != g192 && bs->format != byte))
+    return (-1);
+
+  /* Number of samples */
+  n = G192_BS_SAMPLES (bs);
+
+  for (bs->nframes = pos = 0; pos < n; bs->nframes++, pos += len + 2) {
+    /* Sync word and frame length */
+    if (pos + 2 > n)
+      break;
+    if (bs->format == g192) {
+      if ((word[pos] & 0xFFF0) != 0x6B20)
+        break;
+      len = (unsigned short) word[pos + 1];
+    } else {
+      if ((bs->data[pos] & 0xF0) != 0x20)
+        break;
+      len = bs->data[pos + 1];
+    }
+    if (pos + 2 + len > n)
+      break;
+
+    /* Grow the index */
+    if (bs->nframes == size) {
+      size = size ? 2 * size : 1024;
+      if ((p = (long *) realloc (bs->frame_pos, size * sizeof (long))) == NULL)
+        return (bs->nframes = -1);
+      bs->frame_pos = p;
+      if ((p = (long *) realloc (bs->frame_len, size * sizeof (long))) == NULL)
+        return (bs->nframes = -1);
+      bs->frame_len = p;
+    }
+
+    bs->frame_pos[bs->nframes] = pos;
+    bs->frame_len[bs->nframes] = len;
+    if (len > bs->max_len)
+      bs->max_len = len;
+  }
+
+  bs->tail = n - pos;
+  if (bs->nframes == 0 && bs->tail > 0)
+    bs->nframes = -1;
+  return (bs->nframes);
+}
+
+/* ....................... End of index_g192_frames() ....................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long g192_to_packed (short *soft, long n, BS_WORD *packed);
+  ~~~~~~~~~~~~~~~~~~~
+
+  Converts G.192 softbits to packed hard bits: '1' (0x0081) gives a
+  bit set, any other value a bit cleared.
+
+  Parameter:
+  ~~~~~~~~~~
+  soft .... softbits
+  n ....... number of softbits
+  packed .. packed hard bits (BS_WORDS(n) words)
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of softbits that are neither '0' nor '1' (hard
+  bits), i.e. for which the conversion loses information.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long g192_to_packed (short *soft, long n, BS_WORD * packed) {
+  long i, j, k, other = 0;
+  BS_WORD w;
+#ifdef G192BS_SSE2
+  __m128i one = _mm_set1_epi16 (G192_ONE), zero = _mm_set1_epi16 (G192_ZERO);
+  __m128i x0, x1;
+  unsigned set, valid;
+#endif
+
+  for (i = 0; i < n; i += BS_WORD_BITS) {
+    k = n - i < BS_WORD_BITS ? n - i : BS_WORD_BITS;
+    w = 0;
+    j = 0;
+#ifdef G192BS_SSE2
+    /* 16 softbits at a time: one bit per softbit from the byte mask */
+    for (; j + 16 <= k; j += 16) {
+      x0 = _mm_loadu_si128 ((__m128i *) (soft + j));
+      x1 = _mm_loadu_si128 ((__m128i *) (soft + j + 8));
+      set = _mm_movemask_epi8 (_mm_packs_epi16 (_mm_cmpeq_epi16 (x0, one), _mm_cmpeq_epi16 (x1, one)));
+      valid = set | _mm_movemask_epi8 (_mm_packs_epi16 (_mm_cmpeq_epi16 (x0, zero), _mm_cmpeq_epi16 (x1, zero)));
+      w |= (BS_WORD) set << j;
+      other += 16 - bs_popcount ((BS_WORD) valid);
+    }
+#endif
+    for (; j < k; j++) {
+      w |= (BS_WORD) (soft[j] == G192_ONE) << j;
+      other += soft[j] != G192_ONE && soft[j] != G192_ZERO;
+    }
+    *packed++ = w;
+    soft += k;
+  }
+  return (other);
+}
+
+/* ....................... End of g192_to_packed() ....................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long fer_to_packed (short *soft, long n, BS_WORD *packed);
+  ~~~~~~~~~~~~~~~~~~
+
+  Converts G.192 frame erasure flags to packed hard bits: an erased
+  frame (0x6B20) gives a bit set, any other value a bit cleared.
+
+  Parameter:
+  ~~~~~~~~~~
+  soft .... frame erasure flags (G.192 sync words)
+  n ....... number of flags
+  packed .. packed hard bits (BS_WORDS(n) words)
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of flags that are not G.192 sync words (0x6B2?),
+  as soft2hard().
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long fer_to_packed (short *soft, long n, BS_WORD * packed) {
+  long i, j, k, other = 0;
+  BS_WORD w;
+#ifdef G192BS_SSE2
+  __m128i fer = _mm_set1_epi16 (G192_FER), sync = _mm_set1_epi16 (G192_FER & 0xFFF0);
+  __m128i mask = _mm_set1_epi16 ((short) 0xFFF0);
+  __m128i x0, x1;
+  unsigned set, valid;
+#endif
+
+  for (i = 0; i < n; i += BS_WORD_BITS) {
+    k = n - i < BS_WORD_BITS ? n - i : BS_WORD_BITS;
+    w = 0;
+    j = 0;
+#ifdef G192BS_SSE2
+    for (; j + 16 <= k; j += 16) {
+      x0 = _mm_loadu_si128 ((__m128i *) (soft + j));
+      x1 = _mm_loadu_si128 ((__m128i *) (soft + j + 8));
+      set = _mm_movemask_epi8 (_mm_packs_epi16 (_mm_cmpeq_epi16 (x0, fer), _mm_cmpeq_epi16 (x1, fer)));
+      valid = _mm_movemask_epi8 (_mm_packs_epi16 (_mm_cmpeq_epi16 (_mm_and_si128 (x0, mask), sync), _mm_cmpeq_epi16 (_mm_and_si128 (x1, mask), sync)));
+      w |= (BS_WORD) set << j;
+      other += 16 - bs_popcount ((BS_WORD) valid);
+    }
+#endif
+    for (; j < k; j++) {
+      w |= (BS_WORD) (soft[j] == G192_FER) << j;
+      other += (soft[j] >> 4) != 0x06B2;
+    }
+    *packed++ = w;
+    soft += k;
+  }
+  return (other);
+}
+
+/* ........................ End of fer_to_packed() ........................ */
+
+
+/*
+  -------------------------------------------------------------------------
+  void packed_to_g192 (BS_WORD *packed, long n, short *soft);
+  ~~~~~~~~~~~~~~~~~~~
+
+  Converts packed hard bits to G.192 softbits ('0' = 0x007F, '1' = 0x0081).
+
+  Parameter:
+  ~~~~~~~~~~
+  packed .. packed hard bits
+  n ....... number of bits
+  soft .... G.192 softbits
+
+  Return value:
+  ~~~~~~~~~~~~~
+  None.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+void packed_to_g192 (BS_WORD * packed, long n, short *soft) {
+  long i, j, k;
+  BS_WORD w;
+
+  for (i = 0; i < n; i += BS_WORD_BITS) {
+    k = n - i < BS_WORD_BITS ? n - i : BS_WORD_BITS;
+    w = *packed++;
+    for (j = 0; j < k; j++, w >>= 1)
+      *soft++ = (w & 1) ? G192_ONE : G192_ZERO;
+  }
+}
+
+/* ....................... End of packed_to_g192() ....................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long packed_xor (BS_WORD *x, BS_WORD *ep, long n);
+  long packed_count (BS_WORD *packed, long n);
+  ~~~~~~~~~~~~~~~~
+
+  packed_xor() inserts the bit errors of an error pattern in packed hard
+  bits (x = x XOR ep, one word at a time) and returns the number of bit
+  errors; packed_count() returns the number of bits set. For hard bits,
+  these are the output and the count of g192_xor().
+
+  Parameter:
+  ~~~~~~~~~~
+  x ....... packed hard bits (In/Out)
+  ep ...... packed error pattern (bit set: bit error)
+  packed .. packed hard bits
+  n ....... number of bits
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of bits set in ep / packed.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long packed_xor (BS_WORD * x, BS_WORD * ep, long n) {
+  long i, nw = BS_WORDS (n), count = 0;
+  BS_WORD w;
+
+  for (i = 0; i < nw; i++) {
+    w = i == nw - 1 ? ep[i] & BS_LAST_MASK (n) : ep[i];
+    x[i] ^= w;
+    count += bs_popcount (w);
+  }
+  return (count);
+}
+
+long packed_count (BS_WORD * packed, long n) {
+  long i, nw = BS_WORDS (n), count = 0;
+
+  for (i = 0; i < nw; i++)
+    count += bs_popcount (i == nw - 1 ? packed[i] & BS_LAST_MASK (n) : packed[i]);
+  return (count);
+}
+
+/* ................... End of packed_xor(), packed_count() ................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long packed_run (BS_WORD *packed, long n, long pos, int bit);
+  ~~~~~~~~~~~~~~~
+
+  Returns the length of the run of bits equal to "bit" (0 or 1) that
+  starts at bit "pos" of packed hard bits, stopping at bit n. Runs are
+  found one word at a time, so that long error-free (or erased)
+  stretches of an error pattern are skipped 64 bits at a time.
+
+  Parameter:
+  ~~~~~~~~~~
+  packed .. packed hard bits
+  n ....... number of bits
+  pos ..... first bit of the run
+  bit ..... value of the bits of the run
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of bits of the run (0 if bit pos differs, or if
+  pos >= n).
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long packed_run (BS_WORD * packed, long n, long pos, int bit) {
+  long start = pos;
+  BS_WORD w;
+
+  while (pos < n) {
+    w = packed[pos / BS_WORD_BITS];
+    if (bit)
+      w = ~w;
+    w >>= pos % BS_WORD_BITS;   /* bits that end the run */
+    if (w) {
+      pos += bs_ctz (w);
+      break;
+    }
+    pos += BS_WORD_BITS - pos % BS_WORD_BITS;
+  }
+  return ((pos < n ? pos : n) - start);
+}
+
+/* ......................... End of packed_run() ......................... */
+
+
+/*
+  -------------------------------------------------------------------------
+  long g192_xor (short *a, short *ep, short *c, long n);
+  ~~~~~~~~~~~~~
+
+  Inserts the bit errors of an error pattern in G.192 softbits, as the
+  softbit-by-softbit XOR of eid-xor: c[i] is '1' (0x0081) where a[i]
+  and ep[i] differ, '0' (0x007F) where they are equal. The softbits
+  are processed 8 at a time with SSE2 where available.
+
+  Parameter:
+  ~~~~~~~~~~
+  a ....... input softbits
+  ep ...... error pattern softbits ('1': bit error)
+  c ....... output softbits (may be the same array as a)
+  n ....... number of softbits
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of softbits of c that differ from those of a.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26  v.1.0  Created.
+  -------------------------------------------------------------------------
+ */
+long g192_xor (short *a, short *ep, short *c, long n) {
+  long i = 0, disturbed = 0;
+  short bit;
+#ifdef G192BS_SSE2
+  __m128i one = _mm_set1_epi16 (G192_ONE), zero = _mm_set1_epi16 (G192_ZERO);
+  __m128i x, eq, y;
+
+  for (; i + 8 <= n; i += 8) {
+    x = _mm_loadu_si128 ((__m128i *) (a + i));
+    eq = _mm_cmpeq_epi16 (x, _mm_loadu_si128 ((__m128i *) (ep + i)));
+    y = _mm_or_si128 (_mm_and_si128 (eq, zero), _mm_andnot_si128 (eq, one));
+    disturbed += 8 - bs_popcount ((BS_WORD) _mm_movemask_epi8 (_mm_cmpeq_epi16 (x, y))) / 2;
+    _mm_storeu_si128 ((__m128i *) (c + i), y);
+  }
+#endif
+  for (; i < n; i++) {
+    bit = a[i] ^ ep[i] ? G192_ONE : G192_ZERO;
+    if (bit != a[i])
+      disturbed++;
+    c[i] = bit;
+  }
+  return (disturbed);
+}
+
+/* .......................... End of g192_xor() .......................... */
+
+/* ************************* END OF G192BS.C ************************* */
@@ -0,0 +1,83 @@
+/*
+  ============================================================================
+   File: G192BS.H                                                   17.OCT.26
+  ============================================================================
+
+			  UGST/ITU-T UTILITY MODULE
+
+	  PROTOTYPES FOR MAPPED G.192 BITSTREAMS, FRAME INDEX AND
+	  PACKED (1 BIT PER SOFTBIT) OPERATIONS
+
+   History:
+   17.Oct.26     1.00   Created
+   17.Oct.26     1.10   Added fer_to_packed(), packed_run(), g192_xor()
+   17.Oct.26     1.20   Removed the unused packed operations; size_t
+                        file size, G192_BS_SAMPLES()
+   17.Oct.26     1.30   packed_to_g192(), packed_xor(), packed_count()
+                        back
+  ============================================================================
+*/
+#ifndef G192BS_DEFINED
+#define G192BS_DEFINED 130
+
+#include <stddef.h>             /* size_t */
+#include <limits.h>             /* LONG_MAX */
+
+#include "softbit.h"
+
+/* ......... Smart prototypes .......... */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else
+#define ARGS(x) ()
+#endif
+#endif
+
+
+/* ..... Definitions for packed bitstreams ..... */
+
+/* Word of a packed bitstream: bit i of a stream is bit (i % BS_WORD_BITS)
+   of word i / BS_WORD_BITS, i.e. the LSBs come first in time, as in the
+   compact (bit) format */
+typedef unsigned long long BS_WORD;
+#define BS_WORD_BITS    64
+#define BS_WORDS(n)     (((n) + BS_WORD_BITS - 1) / BS_WORD_BITS)
+
+/* Bitstream file in memory (mapped, or read where mapping is not
+   available), with the index of its frames */
+typedef struct {
+  unsigned char *data;          /* file contents */
+  size_t size;                  /* file size, in bytes */
+  char format;                  /* g192, byte or compact */
+  char type;                    /* BER (headerless) or FER (sync headers) */
+  char mapped;                  /* data mapped (1) or allocated (0) */
+  long nframes;                 /* number of frames in the index */
+  long *frame_pos;              /* position of each sync word, in samples */
+  long *frame_len;              /* payload length of each frame, in samples */
+  long max_len;                 /* largest payload length */
+  long tail;                    /* samples after the last complete frame */
+  void *handle;                 /* mapping handle (Windows) */
+} G192_BS;
+
+/* Number of samples (16-bit words or bytes) of a bitstream in memory;
+   the frame index counts samples in longs, hence at most LONG_MAX */
+#define G192_BS_SAMPLE_SIZE(bs) ((bs)->format == g192 ? sizeof (short) : (size_t) 1)
+#define G192_BS_SAMPLES(bs) \
+  ((bs)->size / G192_BS_SAMPLE_SIZE (bs) > (size_t) LONG_MAX ? LONG_MAX : (long) ((bs)->size / G192_BS_SAMPLE_SIZE (bs)))
+
+/* g192bs.c */
+G192_BS *open_g192_bs ARGS ((char *file));
+void close_g192_bs ARGS ((G192_BS * bs));
+long index_g192_frames ARGS ((G192_BS * bs));
+long g192_to_packed ARGS ((short *soft, long n, BS_WORD * packed));
+long fer_to_packed ARGS ((short *soft, long n, BS_WORD * packed));
+void packed_to_g192 ARGS ((BS_WORD * packed, long n, short *soft));
+long packed_xor ARGS ((BS_WORD * x, BS_WORD * ep, long n));
+long packed_count ARGS ((BS_WORD * packed, long n));
+long packed_run ARGS ((BS_WORD * packed, long n, long pos, int bit));
+long g192_xor ARGS ((short *a, short *ep, short *c, long n));
+
+#endif /* G192BS_DEFINED */
+
+/* ************************* END OF G192BS.H ************************* */
@@ -1,4 +1,4 @@
-/*                                                          02.Feb.2010 v1.7
+/*                                                          17.Oct.2026 v1.9
    =========================================================================
 
    gen-patt.c
@@ -109,6 +109,15 @@
    -reset ... Reset EID state in between iteractions
    -max # ... Maximum number of iteractions
    -tol # ... Max deviation of specified BER/FER/BFER
+   -fast .... Fast random generator for the BER|FER modes, drawing the
+              run lengths up to the next error (patterns differ from
+              those of the default legacy generator)
+   -threads # Parallel generation with # threads: the pattern is made
+              of blocks of 65536 bits|frames, each generated by its own
+              random stream (fast generator for BER|FER), and is the
+              same for any number of threads
+   -seed # .. Seed of the random streams of -threads (default: the seed
+              of the EID state)
    -q ....... Quiet operation mode
 
    Original Author:
@@ -152,6 +161,10 @@
                        (preamble part may now be excluded for teh iteration target) <Ericsson>
    02.Feb.2010,v1.7  Modified maximum string length for filenames to avoid
                      buffer overruns (y.hiwasaki)
+   17.Oct.2026,v1.8  Added option -fast (fast random generator of the EID
+                     module, see set_RAN_mode())
+   17.Oct.2026,v1.9  Added options -threads and -seed (parallel generation,
+                     see EID_par_generate())
 
   ========================================================================= */
 
@@ -166,6 +179,7 @@
 /* ..... Module definition files ..... */
 #include "eid.h"                /* EID functions */
 #include "eid_io.h"             /* EID state variable I/O functions */
+#include "eid_par.h"            /* Parallel pattern generator */
 #include "softbit.h"            /* Soft bit definitions */
 
 
@@ -175,6 +189,7 @@
 /* Buffer size definitions */
 #define EID_BUFFER_LENGTH 256
 #define OUT_RECORD_LENGTH 512
+#define PAR_CHUNK_BLOCKS 4      /* blocks per thread and per write (-threads) */
 
 /* Local function prototypes */
 char *mode_str ARGS ((int mode));
@@ -251,11 +266,20 @@ char check_bellcore (long index) {
    History:
    ~~~~~~~~
    15.Aug.97  v.1.0  Created.
+   17.Oct.26  v.1.1  Fast random generator mode.
    -------------------------------------------------------------------------
  */
 long run_FER_generator_random (short *patt, SCD_EID * state, long n) {
   long fer, i, count;
 
+  /* Fast mode: the frames are the bits of BER_generator() */
+  if (get_RAN_mode (state) == EID_RAN_FAST) {
+    count = (long) BER_generator (state, n, patt);
+    for (i = 0; i < n; i++)
+      patt[i] = patt[i] == G192_ONE ? G192_FER : G192_SYNC;
+    return (count);
+  }
+
   for (count = i = 0; i < n; i++) {
     fer = (long) FER_generator_random (state);
     if (fer)
@@ -322,7 +346,7 @@ long run_FER_generator_burst (short *patt, BURST_EID * state, long n) {
    --------------------------------------------------------------------------
  */
 void display_usage () {
-  printf ("gen-patt.c Version 1.7 of 02.Feb.2010\n");
+  printf ("gen-patt.c Version 1.9 of 17.Oct.2026\n");
 
   printf ("  This example program produces bit error pattern files for error\n");
   printf ("  insertion in G.192-compliant serial bitstreams encoded files. Error\n");
@@ -363,6 +387,12 @@ void display_usage () {
   printf ("   -reset ... Reset EID state in between iteractions\n");
   printf ("   -max # ... Maximum number of iteractions\n");
   printf ("   -tol # ... Max deviation of specified BER/FER/BFER\n");
+  printf ("   -fast .... Fast random generator for BER|FER (run lengths;\n");
+  printf ("              patterns differ from the default generator)\n");
+  printf ("   -threads # Parallel generation with # threads, in blocks of\n");
+  printf ("              independent random streams (same pattern for any\n");
+  printf ("              number of threads; fast generator for BER|FER)\n");
+  printf ("   -seed # .. Seed of the streams of -threads [default: EID seed]\n");
   printf ("   -q ....... Quiet operation mode\n");
 
   /* Quit program */
@@ -420,9 +450,17 @@ int main (int argc, char *argv[]) {
   char mrs[15] = "mrs=512";
 #endif
   long max_iteraction = 100;
-  char quiet = 0, reset = 0, save_format = byte, tailstat = 0;
+  char quiet = 0, reset = 0, save_format = byte, tailstat = 0, fast = 0;
   long (*save_data) () = save_byte;     /* Pointer to a function */
 
+  /* Parallel generation */
+  EID_PAR par;                  /* models and streams */
+  short *par_pat = (short *) 0; /* pattern buffer */
+  long par_chunk = 0;           /* items per write */
+  long par_next = 0;            /* next block (stream) of the pattern */
+  int threads = 0;              /* 0: sequential generation */
+  char seed_set = 0;
+
 #ifdef PORT_TEST
   extern int PORTABILITY_TEST_OPERATION;
   if (PORTABILITY_TEST_OPERATION)
@@ -530,6 +568,30 @@ int main (int argc, char *argv[]) {
         /* Move arg{c,v} over the option to the next argument */
         argc--;
         argv++;
+      } else if (strcmp (argv[1], "-fast") == 0) {
+        /* Fast random generator of the EID (BER/FER modes) */
+        fast = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-threads") == 0) {
+        /* Parallel generation */
+        threads = atoi (argv[2]);
+        if (threads < 1)
+          threads = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-seed") == 0) {
+        /* Seed of the random streams of the parallel generation */
+        par.seed = strtoul (argv[2], NULL, 0);
+        seed_set = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
       } else if (strcmp (argv[1], "-q") == 0) {
         /* Set quiet mode */
         quiet = 1;
@@ -650,6 +712,8 @@ int main (int argc, char *argv[]) {
     } else
       fprintf (stderr, "%s %s: BER=%.2f%% Gamma=%.2f%%\n", "Using BER/Gamma from EID-state file", state_file, BER * 100, BER_gamma * 100);
 
+    if (fast)
+      set_RAN_mode (BEReid, EID_RAN_FAST);
     ber_rate = BER;
     break;
 
@@ -667,10 +731,16 @@ int main (int argc, char *argv[]) {
     } else
       fprintf (stderr, "%s %s: FER=%.2f%% Gamma=%.2f%%\n", "Using FER/Gamma from EID-state file", state_file, FER * 100, FER_gamma * 100);
 
+    if (fast)
+      set_RAN_mode (FEReid, EID_RAN_FAST);
     ber_rate = FER;
     break;
 
   case 'B':
+    if (fast)
+      fprintf (stderr, "Warning !! Option -fast ignored by the Bellcore model.\n");
+    fast = 0;
+
     /* Try to open burst eid state file */
     burst_eid = recall_burst_eid_from_file (state_file, index);
     if (burst_eid == (BURST_EID *) 0) {
@@ -688,6 +758,26 @@ int main (int argc, char *argv[]) {
     break;
   }
 
+  /*
+   **  Setup the parallel generator
+   */
+  if (threads > 0) {
+    par.eid = mode == 'R' ? BEReid : (mode == 'F' ? FEReid : (SCD_EID *) 0);
+    par.burst = mode == 'B' ? burst_eid : (BURST_EID *) 0;
+    par.fer = mode == 'F';
+    par.block = EID_PAR_BLOCK;
+    par.threads = threads;
+    if (!seed_set)
+      par.seed = mode == 'B' ? burst_eid->seedptr : par.eid->seed;
+    if (!quiet)
+      fprintf (stderr, " Parallel generation: %d thread(s), seed %lu\n", threads, par.seed);
+
+    par_chunk = PAR_CHUNK_BLOCKS * threads * par.block;
+    if ((par_pat = (short *) malloc (par_chunk * sizeof (short))) == (short *) 0)
+      error_terminate ("Could not allocate memory for error pattern buffer\n", 1);
+  } else if (seed_set)
+    fprintf (stderr, "Warning !! Option -seed ignored without -threads.\n");
+
   /*
    **  Allocate memory for G.192 data buffer
    */
@@ -755,7 +845,24 @@ int main (int argc, char *argv[]) {
         }
 
         /* Generate bits subject to disturbance */
-        for (i = start_frame; i < number_of_frames; i += EID_BUFFER_LENGTH) {
+        for (i = start_frame; threads > 0 && i < number_of_frames; i += k) {
+          /* Blocks of random streams, continued in the next iteraction */
+          k = number_of_frames - i < par_chunk ? number_of_frames - i : par_chunk;
+          if ((ber1 = EID_par_generate (&par, par_next, k, par_pat)) < 0)
+            error_terminate ("Could not allocate memory for the parallel generator\n", 1);
+          par_next += (k + par.block - 1) / par.block;
+
+          /* Save data to file according to the defined format */
+          items = save_data (par_pat, k, out_file_ptr);
+          if (items < 0)
+            error_terminate ("Error saving data to file\n", 8);
+
+          /* Update counters */
+          disturbed += ber1;
+          processed += items;
+          generated += items;
+        }
+        for (i = start_frame; threads == 0 && i < number_of_frames; i += EID_BUFFER_LENGTH) {
           /* Checks how many frame erasures are necessary here. If this is not the last round of collections, then get EID_BUFFER_LENGTH frame erasure indications. If this is the last iteraction in the loop, get only the remainder of samples not all EID_BUFFER_LENGTH samples */
           k = i + EID_BUFFER_LENGTH > number_of_frames ? number_of_frames - (long) generated : EID_BUFFER_LENGTH;
 
@@ -794,7 +901,24 @@ int main (int argc, char *argv[]) {
         }
 
         /* Generate frame subject to disturbance */
-        for (i = start_frame; i < number_of_frames; i += EID_BUFFER_LENGTH) {
+        for (i = start_frame; threads > 0 && i < number_of_frames; i += k) {
+          /* Blocks of random streams, continued in the next iteraction */
+          k = number_of_frames - i < par_chunk ? number_of_frames - i : par_chunk;
+          if ((ber1 = EID_par_generate (&par, par_next, k, par_pat)) < 0)
+            error_terminate ("Could not allocate memory for the parallel generator\n", 1);
+          par_next += (k + par.block - 1) / par.block;
+
+          /* Save intermediate data in buffer */
+          items = save_data (par_pat, k, out_file_ptr);
+          if (items < 0)
+            error_terminate ("Error saving data to file\n", 8);
+
+          /* Update counters */
+          disturbed += ber1;
+          processed += items;   /* does not include preamble frames */
+          generated += items;   /* includes preamble frames */
+        }
+        for (i = start_frame; threads == 0 && i < number_of_frames; i += EID_BUFFER_LENGTH) {
           /* Checks how many frame erasures are necessary here. If this is not the last round of collections, then get EID_BUFFER_LENGTH frame erasure indications. If this is the last iteraction in the loop, get only the remainder of samples not all EID_BUFFER_LENGTH samples */
           k = i + EID_BUFFER_LENGTH > number_of_frames ? number_of_frames - (long) generated : EID_BUFFER_LENGTH;
           /*
@@ -926,6 +1050,8 @@ int main (int argc, char *argv[]) {
    **  Close the output file and quit
    */
   fclose (out_file_ptr);
+  if (par_pat)
+    free (par_pat);
 
 #ifndef VMS                     /* return value to OS if not VMS */
   return 0;
@@ -1,4 +1,4 @@
-/*                                                           02.Feb.2010 v3.5
+/*                                                           17.Oct.2026 v3.6
   ===========================================================================
 
   FILTER.C
@@ -41,6 +41,25 @@
                   samples are inserted in the begining of the file,
                   d<0 causes samples to be dropped. Default is d=0.
   -q ............ quiet processing (no progress flag)
+  -kernel k ..... implementation of the FIR kernels: "ref" (original
+                  scalar kernels), "poly" (polyphase kernels, bit-exact
+                  with "ref") or "simd" (polyphase kernels with
+                  SSE/AVX2/NEON inner products, within +-1 of "ref").
+                  Default is "poly".
+  -ratio L/M .... resampling factor for filter type RAT: the output rate
+                  is L/M times the input rate. L and M may also be the
+                  sampling rates, e.g. 16000/44100. Default is 1/1.
+
+  Filter pipelines:
+  Several filters can be applied in one pass by giving a comma-separated
+  list of filter types, e.g. LP20,HQ3:down,IRS16,P341. Each block of
+  BlockSize input samples is run through all the stages before the next
+  block is read, using two work buffers alternately, so no intermediate
+  files are needed; the block size hence sets the chunk size that has to
+  fit in the cache. A stage type can be followed by options separated by
+  colons: "up" or "down" (overriding -up/-down), "mod" (as -mod), or L/M
+  for a RAT stage (overriding -ratio). The processing time of each stage
+  is reported at the end. ASYNC operation is not available for pipelines.
 
   Valid filter specifications:
   Flt_type Description
@@ -58,6 +77,7 @@
    PCM      Standard IIR PCM quality factor 1:2 (up) or 2:1 (down)
    PCM1     Standard PCM quality with factor 1:1 at 16 kHz
    GSM1     GSM Mobile station input response w/ factor 1:1 at 16 kHz
+   RAT      Polyphase low-pass resampler with rational factor L/M (-ratio)
    P341     Send-part weighting of ITU-T Rec.P.341 (Wideband telephones)
    DC       Direct-form DC-removal IIR filter (factor 1:1)
    IFLAT    Flat IIR low-pass with factor 1:3 (up) or 3:1 (down) using a
@@ -152,6 +172,14 @@
 
    02.Feb.2010 v3.5 - Modified maximum string length for filenames to avoid
                       buffer overruns (y.hiwasaki)
+
+   17.Oct.2026 v3.6 - Added option -kernel to select the reference,
+                      polyphase or SIMD FIR kernels.
+                    - Added filter type RAT and option -ratio for
+                      resampling by an arbitrary rational factor L/M.
+                    - Added filter pipelines: a comma-separated list of
+                      filter types is processed block-wise in one pass,
+                      with the processing time reported per stage.
   ===========================================================================
 */
 
@@ -159,6 +187,7 @@
 #include <stdlib.h>
 #include <string.h>             /* strncmp() */
 #include <math.h>
+#include <time.h>               /* clock() */
 
 #if defined(VMS)
 #include <stat.h>
@@ -200,6 +229,7 @@ int valid_filter (char *F_type, char modified_IRS) {
       || strncmp (F_type, "msin", 4) == 0 || strncmp (F_type, "MSIN", 4) == 0
       || strncmp (F_type, "pcm", 3) == 0 || strncmp (F_type, "PCM", 3) == 0
       || strncmp (F_type, "p341", 4) == 0 || strncmp (F_type, "P341", 4) == 0
+      || strncmp (F_type, "rat", 3) == 0 || strncmp (F_type, "RAT", 3) == 0
       || strncmp (F_type, "dc", 2) == 0 || strncmp (F_type, "DC", 2) == 0 || strncmp (F_type, "iflat", 5) == 0 || strncmp (F_type, "IFLAT", 5) == 0 || strncmp (F_type, "5kbp", 4) == 0 || strncmp (F_type, "5KBP", 4) == 0 || strncmp (F_type, "5kBP", 4) == 0 || strncmp (F_type, "5Kbp", 4) == 0 || strncmp (F_type, "100_5kbp", 8) == 0 || strncmp (F_type, "100_5KBP", 8) == 0 || strncmp (F_type, "14kbp", 5) == 0 || strncmp (F_type, "14KBP", 5) == 0 || strncmp (F_type, "14kBP", 5) == 0 || strncmp (F_type, "14Kbp", 5) == 0 || strncmp (F_type, "20kbp", 5) == 0 || strncmp (F_type, "20KBP", 5) == 0 || strncmp (F_type, "20kBP", 5) == 0 || strncmp (F_type, "20Kbp", 5) == 0 || strncmp (F_type, "LP1P5", 5) == 0 || strncmp (F_type, "lp1p5", 5) == 0 || strncmp (F_type, "LP1p5", 5) == 0 || strncmp (F_type, "LP35", 4) == 0 || strncmp (F_type, "lp35", 4) == 0 || strncmp (F_type, "LP7", 3) == 0 || strncmp (F_type, "lp7", 3) == 0 || strncmp (F_type, "LP10", 4) == 0 || strncmp (F_type, "lp10", 4) == 0
 // FILTER_12k48k_HW
       || strncmp (F_type, "LP12", 4) == 0 || strncmp (F_type, "lp12", 4) == 0
@@ -221,7 +251,7 @@ int valid_filter (char *F_type, char modified_IRS) {
  * Last update: 15.May.2007 <>
  */
 void display_usage () {
-  printf ("FILTER.C - Version 3.5 of 02.Feb.2010 \n\n");
+  printf ("FILTER.C - Version 3.6 of 17.Oct.2026 \n\n");
 
   printf (" Test program to process a given file by one of the possible filter\n");
   printf (" characteristics of the STL. Multiple filterings (as available\n");
@@ -255,6 +285,15 @@ void display_usage () {
   printf ("               samples are inserted in the begining of the file,\n");
   printf ("               d<0 causes samples to be dropped. Default is d=0.\n");
   printf ("  -q ......... quiet processing (no progress flag)\n");
+  printf ("  -kernel k .. FIR kernel: ref, poly [default] or simd\n");
+  printf ("  -ratio L/M . resampling factor for filter type RAT (output rate is\n");
+  printf ("               L/M times the input rate) [default: 1/1]\n");
+  printf ("\n");
+  printf (" Filter pipelines: Flt_type may be a comma-separated list of filter\n");
+  printf (" types, applied in this order in a single pass, e.g.\n");
+  printf ("   LP20,HQ3:down,IRS16,P341\n");
+  printf (" Options for one stage follow its type, separated by colons:\n");
+  printf (" up, down, mod, or L/M for RAT (e.g. RAT:147/160).\n");
   printf ("\n");
   printf (" Valid filter specifications:\n");
   printf ("  Flt_type Description\n");
@@ -274,6 +313,7 @@ void display_usage () {
   printf ("   PCM     Standard IIR PCM quality factor 1:2 (up) or 2:1 (down)\n");
   printf ("   PCM1    Standard PCM quality with factor 1:1 at 16 kHz\n");
   printf ("   GSM1    GSM Mobile station input FIR w/ factor 1:1 at 16 kHz\n");
+  printf ("   RAT     Polyphase low-pass resampler with factor L/M (see -ratio)\n");
   printf ("   MSIN    Same as GSM1\n");
   printf ("   P341    P.341 send-mask FIR with factor 1:1 at 16 kHz\n");
   printf ("   DC      Direct-form DC-removal IIR filter (factor 1:1)\n");
@@ -301,170 +341,76 @@ char *filter_type_str[] = { "FIR", "Parallel-form IIR",
   "Cascade-form IIR", "Direct-form IIR"
 };
 
-/*============================== */
-int main (int argc, char *argv[]) {
-  /* DECLARATIONS */
+#define MAX_STAGES 16            /* max. number of stages in a pipeline */
 
-  /* Algorithm variables */
+/* One stage of the filter pipeline */
+typedef struct {
+  char name[MAX_STRLEN];        /* filter type */
+  char upsample;                /* up-sampling (1) or down-sampling (0) */
+  char modified_IRS;            /* use modified IRS */
+  long ratio_L, ratio_M;        /* factor L/M for RAT */
+  char kernel_type;             /* FIR, IIR_PARALLEL, IIR_CASCADE or IIR_DIRECT */
   SCD_FIR *fir_state;
   SCD_IIR *parallel_iir_state;
   CASCADE_IIR *cascade_iir_state;
   DIRECT_IIR *direct_iir_state;
+  char hswitch;                 /* 'U', 'D' or 'R' (rational) */
+  long factor;                  /* rate change factor */
+  long out_size;                /* max. number of output samples per block */
+  clock_t cpu;                  /* processing time */
+} FILTER_STAGE;
 
-  float *InpBuff, *OutBuff;
-  short *TmpBuff;
-  char F_type[MAX_STRLEN], async = 0, upsample = 0;
-  long cur_blk, satur = 0, total = 0, k, N, N1, N2;
-  char modified_IRS = 0, quiet = 0;
-  long inp_size, out_size, factor, smpno;
-  double fs = 8000;
-  char kernel_type = 0;
-  static char funny[9] = "|/-\\|/-\\";
-
-  /* For asynchronous tandem simulation */
-  long delay = 0, skip = 0;
-  short *zero;
-
-  /* File variables */
-  char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
-  FILE *Fi, *Fo;
-  long start_byte;
-#ifdef VMS
-  char mrs[15];
-#endif
-
-
-  /* ......... GET PARAMETERS ......... */
-
-  /* Check options */
-  if (argc < 2)
-    display_usage ();
-  else {
-    while (argc > 1 && argv[1][0] == '-')
-      if (strcmp (argv[1], "-mod") == 0) {
-        /* Set modified IRS flag */
-        modified_IRS = 1;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc--;
-        argv++;
-      } else if (strcmp (argv[1], "-fs") == 0) {
-        /* Change sampling frequency */
-        fs = atof (argv[2]);
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc -= 2;
-        argv += 2;
-      } else if (strcmp (argv[1], "-q") == 0) {
-        /* Change sampling frequency */
-        quiet = 1;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc--;
-        argv++;
-      } else if (strcmp (argv[1], "-down") == 0) {
-        /* Filtering is for downsampling */
-        upsample = async = 0;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc--;
-        argv++;
-      } else if (strcmp (argv[1], "-up") == 0) {
-        /* Filtering is for upsampling */
-        upsample = 1;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc--;
-        argv++;
-      } else if (strcmp (argv[1], "-async") == 0) {
-        /* Filtering is an asyncronization process */
-        async = upsample = 1;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc--;
-        argv++;
-      } else if (strcmp (argv[1], "-delay") == 0) {
-        /* Filtering is an asyncronization process */
-        delay = atoi (argv[2]);
-        if (delay < 0)
-          skip = -delay;
-
-        /* Move arg{c,v} over the option to the next argument */
-        argc -= 2;
-        argv += 2;
-      } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
-        /* Display help message */
-        display_usage ();
-      } else {
-        fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
-        display_usage ();
-      }
-  }
-
-  /* Read parameters for processing */
-  GET_PAR_S (1, "_Filter type: ................. ", F_type);
-  GET_PAR_S (2, "_Input File: .................. ", FileIn);
-  GET_PAR_S (3, "_Output File: ................. ", FileOut);
-  FIND_PAR_L (4, "_Block Size: .................. ", N, 256);
-  FIND_PAR_L (5, "_Starting Block: .............. ", N1, 1);
-  FIND_PAR_L (6, "_No. of Blocks: ............... ", N2, 0);
-
-
-  /* ......... CHECK CONSISTENCY ......... */
 
-  /* Verify that a valid filter was selected */
-  if (!valid_filter (F_type, modified_IRS)) {
-    if (modified_IRS && (strcmp (F_type, "irs8") == 0 || strcmp (F_type, "IRS8") == 0))
-      fprintf (stderr, "\nModified IRS is NOT available at 8 kHz! Aborted.\n");
-    else
-      fprintf (stderr, "\nInvalid filter chosen! Aborted.\n");
-    exit (2);
-  }
-
-  /* The delay option is only available with asynchronous filtering */
-  if (delay != 0 && !async)
-    error_terminate ("\nDelay option only available for ASYNC filtering! Aborted.\n", 5);
-
-
-  /* ......... STARTING ......... */
-
-  /* Find starting byte in file */
-  start_byte = sizeof (short) * (long) (--N1) * (long) N;
-
-#ifdef SKIP_APPROACH_1
-  /* If samples are to be skipped in output file, does it here */
-  if (skip)
-    start_byte += skip * sizeof (short);
-#endif
-
-  /* Check if is to process the whole file */
-  if (N2 == 0) {
-    struct stat st;
-
-    /* ... find the input file size ... */
-    stat (FileIn, &st);
-    N2 = ceil ((st.st_size - start_byte) / (double) (N * sizeof (short)));
+/*
+ * Parse a stage specification TYPE[:option[:option...]], where option is
+ * "up", "down", "mod" or L/M (for RAT). The defaults are taken from the
+ * command line options.
+ * Return: 1 -> OK
+ *         0 -> invalid option
+ */
+int stage_parse (FILTER_STAGE * st, char *spec, char upsample, char modified_IRS, long ratio_L, long ratio_M) {
+  char *opt;
+
+  memset (st, 0, sizeof (FILTER_STAGE));
+  st->upsample = upsample;
+  st->modified_IRS = modified_IRS;
+  st->ratio_L = ratio_L;
+  st->ratio_M = ratio_M;
+
+  strncpy (st->name, spec, MAX_STRLEN - 1);
+  if ((opt = strchr (st->name, ':')) == NULL)
+    return 1;
+  *opt++ = '\0';
+
+  for (opt = strtok (opt, ":"); opt != NULL; opt = strtok (NULL, ":")) {
+    if (strcmp (opt, "up") == 0)
+      st->upsample = 1;
+    else if (strcmp (opt, "down") == 0)
+      st->upsample = 0;
+    else if (strcmp (opt, "mod") == 0)
+      st->modified_IRS = 1;
+    else if (sscanf (opt, "%ld/%ld", &st->ratio_L, &st->ratio_M) != 2 || st->ratio_L <= 0 || st->ratio_M <= 0)
+      return 0;
   }
-  inp_size = N;                 /* samples */
+  return 1;
+}
 
 
-  /* Allocate memory for delay buffer & initialize it */
-  if (delay > 0) {
-    if ((zero = (short *) calloc (delay, sizeof (short))) == NULL) {
-      error_terminate ("Error allocating memory for delay buffer\n", 5);
-    } else
-      memset (zero, 0, delay * sizeof (short));
-  }
+/*
+ * Initialize the filter of one stage
+ */
+void stage_init (FILTER_STAGE * st) {
+  long k;
 
   /* Set flag to filter type: IIR or FIR; default is FIR */
-  if (strncmp (F_type, "dc", 2) == 0 || strncmp (F_type, "DC", 2) == 0)
-    kernel_type = IIR_DIRECT;
-  else if (strncmp (F_type, "iflat", 5) == 0 || strncmp (F_type, "IFLAT", 5) == 0)
-    kernel_type = IIR_CASCADE;
-  else if (strncmp (F_type, "pcm", 3) == 0 || strncmp (F_type, "PCM", 3) == 0)
-    kernel_type = IIR_PARALLEL;
+  if (strncmp (st->name, "dc", 2) == 0 || strncmp (st->name, "DC", 2) == 0)
+    st->kernel_type = IIR_DIRECT;
+  else if (strncmp (st->name, "iflat", 5) == 0 || strncmp (st->name, "IFLAT", 5) == 0)
+    st->kernel_type = IIR_CASCADE;
+  else if (strncmp (st->name, "pcm", 3) == 0 || strncmp (st->name, "PCM", 3) == 0)
+    st->kernel_type = IIR_PARALLEL;
   else
-    kernel_type = FIR;
+    st->kernel_type = FIR;
 
 
   /* ... CHOOSE CORRECT FILTER INITIALIZATION ... */
@@ -480,237 +426,515 @@ int main (int argc, char *argv[]) {
   *                     . RXIRS8  -> factor: 1:1 (modified) NOT IMPLEMENTED
   *                     . RXIRS16 -> factor: 1:1 (modified) NOT IMPLEMENTED
   */
-  if (strncmp (F_type, "irs", 3) == 0 || strncmp (F_type, "IRS", 3) == 0) {
-    k = atoi (&F_type[3]);
+  if (strncmp (st->name, "irs", 3) == 0 || strncmp (st->name, "IRS", 3) == 0) {
+    k = atoi (&st->name[3]);
     switch (k) {
     case 8:
-      fir_state = irs_8khz_init ();
+      st->fir_state = irs_8khz_init ();
       break;
     case 16:
-      fir_state = modified_IRS ? mod_irs_16khz_init ()
+      st->fir_state = st->modified_IRS ? mod_irs_16khz_init ()
         : irs_16khz_init ();
       break;
     case 48:
-      fir_state = mod_irs_48khz_init ();
+      st->fir_state = mod_irs_48khz_init ();
       break;
     default:
       error_terminate ("Unimplemented: IRS rate not 8, 16 or 48 kHz\n", 15);
     }
   }
-  if (strncmp (F_type, "rxirs", 5) == 0 || strncmp (F_type, "RXIRS", 5) == 0) {
-    k = atoi (&F_type[5]);
+  if (strncmp (st->name, "rxirs", 5) == 0 || strncmp (st->name, "RXIRS", 5) == 0) {
+    k = atoi (&st->name[5]);
     switch (k) {
     case 8:
-      modified_IRS = 1;         /* Only modified IRS rcx filter available */
-      fir_state = rx_mod_irs_8khz_init ();
+      st->modified_IRS = 1;         /* Only modified IRS rcx filter available */
+      st->fir_state = rx_mod_irs_8khz_init ();
       break;
     case 16:
-      modified_IRS = 1;         /* Only modified IRS rcx filter available */
-      fir_state = rx_mod_irs_16khz_init ();
+      st->modified_IRS = 1;         /* Only modified IRS rcx filter available */
+      st->fir_state = rx_mod_irs_16khz_init ();
       break;
     default:
       error_terminate ("Unimplemented: Receive Mod-IRS rate not 8 or 16 kHz\n", 15);
     }
-  } else if (strncmp (F_type, "hirs16", 6) == 0 || strncmp (F_type, "HIRS16", 6) == 0) {
-    fir_state = ht_irs_16khz_init ();
+  } else if (strncmp (st->name, "hirs16", 6) == 0 || strncmp (st->name, "HIRS16", 6) == 0) {
+    st->fir_state = ht_irs_16khz_init ();
   }
 
-  else if (strncmp (F_type, "tirs", 4) == 0 || strncmp (F_type, "TIRS", 4) == 0) {
-    fir_state = tia_irs_8khz_init ();
+  else if (strncmp (st->name, "tirs", 4) == 0 || strncmp (st->name, "TIRS", 4) == 0) {
+    st->fir_state = tia_irs_8khz_init ();
   }
 
 /*
   * Filter type: DSM - Delta-SM: factor 1:1
   */
-  else if (strncmp (F_type, "dsm", 3) == 0 || strncmp (F_type, "DSM", 3) == 0) {
-    fir_state = delta_sm_16khz_init ();
+  else if (strncmp (st->name, "dsm", 3) == 0 || strncmp (st->name, "DSM", 3) == 0) {
+    st->fir_state = delta_sm_16khz_init ();
   }
 
 /*
   * Filter type: PSO - Psophometric wheighting filter: factor 1:1
   */
-  else if (strncmp (F_type, "pso", 3) == 0 || strncmp (F_type, "PSO", 3) == 0) {
-    fir_state = psophometric_8khz_init ();
+  else if (strncmp (st->name, "pso", 3) == 0 || strncmp (st->name, "PSO", 3) == 0) {
+    st->fir_state = psophometric_8khz_init ();
   }
 
 /*
   * Filter type: GSM Mobile Station Input - Linear-phase, high-band
   * 1:1 factor added by Simao Campos after Kyrill Fisher [27/Feb/98]
   */
-  else if (strncmp (F_type, "gsm1", 4) == 0 || strncmp (F_type, "GSM1", 4) == 0 || strncmp (F_type, "msin", 4) == 0 || strncmp (F_type, "MSIN", 4) == 0) {
-    fir_state = msin_16khz_init ();
+  else if (strncmp (st->name, "gsm1", 4) == 0 || strncmp (st->name, "GSM1", 4) == 0 || strncmp (st->name, "msin", 4) == 0 || strncmp (st->name, "MSIN", 4) == 0) {
+    st->fir_state = msin_16khz_init ();
   }
 
 /*
   * Filter type: FLAT - Linear-phase, pass-band 1:1, 2:1 or 1:2 factor:
-  *                    . fs ==  8000 -> upsample: 1:2
+  *                    . fs ==  8000 -> st->upsample: 1:2
   *                    . fs == 16000 -> downsample: 2:1, or
   *                                     keep rate: 1:1 (treated first)
   */
-  else if (strncmp (F_type, "flat", 4) == 0 || strncmp (F_type, "FLAT", 4) == 0) {
-    fir_state = F_type[4] == '1' ? linear_phase_pb_1_to_1_init ()
-      : (upsample ? linear_phase_pb_1_to_2_init ()
+  else if (strncmp (st->name, "flat", 4) == 0 || strncmp (st->name, "FLAT", 4) == 0) {
+    st->fir_state = st->name[4] == '1' ? linear_phase_pb_1_to_1_init ()
+      : (st->upsample ? linear_phase_pb_1_to_2_init ()
          : linear_phase_pb_2_to_1_init ());
   }
 
 /*
   * Filter type: HQ2 - High quality 2:1 or 1:2 factor:
-  *                    . fs ==  8000 -> upsample: 1:2
+  *                    . fs ==  8000 -> st->upsample: 1:2
   *                    . fs == 16000 -> downsample: 2:1
   *              HQ3 - High quality 3:1 or 3:1 factor
-  *                    . fs ==  8000 -> upsample: 1:3
+  *                    . fs ==  8000 -> st->upsample: 1:3
   *                    . fs == 16000 -> downsample: 3:1
   */
-  else if (strncmp (F_type, "hq", 2) == 0 || strncmp (F_type, "HQ", 2) == 0) {
-    if (upsample)               /* It is up-sampling! */
-      fir_state = F_type[2] == '2' ? hq_up_1_to_2_init ()
+  else if (strncmp (st->name, "hq", 2) == 0 || strncmp (st->name, "HQ", 2) == 0) {
+    if (st->upsample)               /* It is up-sampling! */
+      st->fir_state = st->name[2] == '2' ? hq_up_1_to_2_init ()
         : hq_up_1_to_3_init ();
     else                        /* It is down-sampling! */
-      fir_state = F_type[2] == '2' ? hq_down_2_to_1_init ()
+      st->fir_state = st->name[2] == '2' ? hq_down_2_to_1_init ()
         : hq_down_3_to_1_init ();
   }
 
+/*
+  * Filter type: RAT - polyphase resampler with rational factor L/M
+  */
+  else if (strncmp (st->name, "rat", 3) == 0 || strncmp (st->name, "RAT", 3) == 0) {
+    if ((st->fir_state = rat_resampling_init (st->ratio_L, st->ratio_M)) == NULL)
+      error_terminate ("Error allocating memory for the L/M resampler\n", 5);
+  }
+
 /*
   * Filter type: P.341 send mask: factor 1:1
   */
-  else if (strncmp (F_type, "p341", 4) == 0 || strncmp (F_type, "P341", 4) == 0) {
-    fir_state = p341_16khz_init ();
+  else if (strncmp (st->name, "p341", 4) == 0 || strncmp (st->name, "P341", 4) == 0) {
+    st->fir_state = p341_16khz_init ();
   }
 
 /*
   * Filter type: 50-5000 Hz bandpass filter: factor 1:1
   */
-  else if (strncmp (F_type, "5kbp", 4) == 0 || strncmp (F_type, "5KBP", 4) == 0 || strncmp (F_type, "5Kbp", 4) == 0 || strncmp (F_type, "5kBP", 4) == 0) {
-    fir_state = bp5k_16khz_init ();
+  else if (strncmp (st->name, "5kbp", 4) == 0 || strncmp (st->name, "5KBP", 4) == 0 || strncmp (st->name, "5Kbp", 4) == 0 || strncmp (st->name, "5kBP", 4) == 0) {
+    st->fir_state = bp5k_16khz_init ();
   }
 
 /*
   * Filter type: 100-5000 Hz bandpass filter: factor 1:1
   */
-  else if (strncmp (F_type, "100_5kbp", 8) == 0 || strncmp (F_type, "100_5KBP", 8) == 0) {
-    fir_state = bp100_5k_16khz_init ();
+  else if (strncmp (st->name, "100_5kbp", 8) == 0 || strncmp (st->name, "100_5KBP", 8) == 0) {
+    st->fir_state = bp100_5k_16khz_init ();
   }
 
 /*
   * Filter type: 50-14000 Hz bandpass filter (fs=32kHz): factor 1:1
   */
-  else if (strncmp (F_type, "14kbp", 5) == 0 || strncmp (F_type, "14KBP", 5) == 0 || strncmp (F_type, "14Kbp", 5) == 0 || strncmp (F_type, "14kBP", 5) == 0) {
-    fir_state = bp14k_32khz_init ();
+  else if (strncmp (st->name, "14kbp", 5) == 0 || strncmp (st->name, "14KBP", 5) == 0 || strncmp (st->name, "14Kbp", 5) == 0 || strncmp (st->name, "14kBP", 5) == 0) {
+    st->fir_state = bp14k_32khz_init ();
   }
 
   /*
    * Filter type: 20-20000 Hz bandpass filter (fs=48kHz): factor 1:1
    */
-  else if (strncmp (F_type, "20kbp", 5) == 0 || strncmp (F_type, "20KBP", 5) == 0 || strncmp (F_type, "20Kbp", 5) == 0 || strncmp (F_type, "20kBP", 5) == 0) {
-    fir_state = bp20k_48khz_init ();
+  else if (strncmp (st->name, "20kbp", 5) == 0 || strncmp (st->name, "20KBP", 5) == 0 || strncmp (st->name, "20Kbp", 5) == 0 || strncmp (st->name, "20kBP", 5) == 0) {
+    st->fir_state = bp20k_48khz_init ();
   }
 
 /*
   * Filter type: 1.5kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP1p5", 5) == 0 || strncmp (F_type, "lp1p5", 5) == 0 || strncmp (F_type, "LP1p5", 5) == 0) {
-    fir_state = LP1p5_48kHz_init ();
+  else if (strncmp (st->name, "LP1p5", 5) == 0 || strncmp (st->name, "lp1p5", 5) == 0 || strncmp (st->name, "LP1p5", 5) == 0) {
+    st->fir_state = LP1p5_48kHz_init ();
   }
 
 /*
   * Filter type: 3.5kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP35", 4) == 0 || strncmp (F_type, "lp35", 4) == 0) {
-    fir_state = LP35_48kHz_init ();
+  else if (strncmp (st->name, "LP35", 4) == 0 || strncmp (st->name, "lp35", 4) == 0) {
+    st->fir_state = LP35_48kHz_init ();
   }
 /*
   * Filter type: 7kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP7", 3) == 0 || strncmp (F_type, "lp7", 3) == 0) {
-    fir_state = LP7_48kHz_init ();
+  else if (strncmp (st->name, "LP7", 3) == 0 || strncmp (st->name, "lp7", 3) == 0) {
+    st->fir_state = LP7_48kHz_init ();
   }
 /*
   * Filter type: 10kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP10", 5) == 0 || strncmp (F_type, "lp10", 5) == 0) {
-    fir_state = LP10_48kHz_init ();
+  else if (strncmp (st->name, "LP10", 5) == 0 || strncmp (st->name, "lp10", 5) == 0) {
+    st->fir_state = LP10_48kHz_init ();
   }
 // FILTER_12k48k_HW
   /*
    * Filter type: 12kHz lowpass filter (fs=48kHz): factor 1:1
    */
-  else if (strncmp (F_type, "LP12", 4) == 0 || strncmp (F_type, "lp12", 4) == 0) {
-    fir_state = LP12_48kHz_init ();
+  else if (strncmp (st->name, "LP12", 4) == 0 || strncmp (st->name, "lp12", 4) == 0) {
+    st->fir_state = LP12_48kHz_init ();
   }
 // FILTER_12k48k_HW
 /*
   * Filter type: 14kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP14", 4) == 0 || strncmp (F_type, "lp14", 4) == 0) {
-    fir_state = LP14_48kHz_init ();
+  else if (strncmp (st->name, "LP14", 4) == 0 || strncmp (st->name, "lp14", 4) == 0) {
+    st->fir_state = LP14_48kHz_init ();
   }
 
 /*
   * Filter type: 20kHz lowpass filter (fs=48kHz): factor 1:1
   */
-  else if (strncmp (F_type, "LP20", 4) == 0 || strncmp (F_type, "lp20", 4) == 0) {
-    fir_state = LP20_48kHz_init ();
+  else if (strncmp (st->name, "LP20", 4) == 0 || strncmp (st->name, "lp20", 4) == 0) {
+    st->fir_state = LP20_48kHz_init ();
   }
 
 /*
   * Filter type: PCM  - Standard PCM quality 2:1 or 1:2 factor:
-  *                    . fs ==  8000 -> upsample: 1:2
+  *                    . fs ==  8000 -> st->upsample: 1:2
   *                    . fs == 16000 -> downsample: 2:1
   *              PCM1 - Standard PCM quality with 1:1 factor
   *                    . fs ==  8000 -> unimplemented
   *                    . fs == 16000 -> OK, 1:1 at 16 kHz
   */
-  else if (strncmp (F_type, "pcm", 3) == 0 || strncmp (F_type, "PCM", 3) == 0) {
-    if (strncmp (F_type, "pcm1", 4) == 0 || strncmp (F_type, "PCM1", 4) == 0) {
-      parallel_iir_state = stdpcm_16khz_init ();
+  else if (strncmp (st->name, "pcm", 3) == 0 || strncmp (st->name, "PCM", 3) == 0) {
+    if (strncmp (st->name, "pcm1", 4) == 0 || strncmp (st->name, "PCM1", 4) == 0) {
+      st->parallel_iir_state = stdpcm_16khz_init ();
     } else
-      parallel_iir_state = upsample ? stdpcm_1_to_2_init ()     /* It is up-sampling! */
+      st->parallel_iir_state = st->upsample ? stdpcm_1_to_2_init ()     /* It is up-sampling! */
         : stdpcm_2_to_1_init ();        /* It is down-sampling! */
   }
 
 /*
   * Filter type: IFLAT - cascade-form IIR flat low-pass with 1:3
-  *                    . fs == 16000 -> upsample: 1:3
+  *                    . fs == 16000 -> st->upsample: 1:3
   *                    . fs == 48000 -> downsample: 3:1
   */
-  else if (strncmp (F_type, "iflat", 5) == 0 || strncmp (F_type, "IFLAT", 5) == 0) {
-    cascade_iir_state = upsample ? iir_casc_lp_1_to_3_init ()   /* It is up-sampling! */
+  else if (strncmp (st->name, "iflat", 5) == 0 || strncmp (st->name, "IFLAT", 5) == 0) {
+    st->cascade_iir_state = st->upsample ? iir_casc_lp_1_to_3_init ()   /* It is up-sampling! */
       : iir_casc_lp_3_to_1_init ();     /* It is down-sampling! */
   }
 
 /*
   * Filter type: DC - IIR DC removal filter (a la RPE-LTP)
   */
-  else if (strncmp (F_type, "dc", 2) == 0 || strncmp (F_type, "DC", 2) == 0) {
-    direct_iir_state = iir_dir_dc_removal_init ();
+  else if (strncmp (st->name, "dc", 2) == 0 || strncmp (st->name, "DC", 2) == 0) {
+    st->direct_iir_state = iir_dir_dc_removal_init ();
   }
+}
 
 
+/*
+ * Find the rate change factor of one stage and the max. number of output
+ * samples for inp_size input samples
+ */
+void stage_size (FILTER_STAGE * st, long inp_size) {
+  switch (st->kernel_type) {
+  case FIR:
+    st->factor = st->fir_state->dwn_up;
+    st->hswitch = st->fir_state->hswitch;
+    break;
+  case IIR_PARALLEL:
+    st->factor = st->parallel_iir_state->idown;
+    st->hswitch = st->parallel_iir_state->hswitch;
+    break;
+  case IIR_CASCADE:
+    st->factor = st->cascade_iir_state->idown;
+    st->hswitch = st->cascade_iir_state->hswitch;
+    break;
+  case IIR_DIRECT:
+    st->factor = st->direct_iir_state->idown;
+    st->hswitch = st->direct_iir_state->hswitch;
+  }
+  if (st->hswitch == 'R')
+    st->out_size = ceil (inp_size * (double) st->factor / st->fir_state->down);
+  else
+    st->out_size = (st->hswitch == 'U')
+      ? inp_size * st->factor : ceil (inp_size / (double) st->factor);
+}
+
+
+/*
+ * Filter one block through one stage
+ * Return: number of output samples
+ */
+long stage_kernel (FILTER_STAGE * st, long smpno, float *InpBuff, float *OutBuff) {
+  switch (st->kernel_type) {
+  case FIR:
+    smpno = hq_kernel (smpno, InpBuff, st->fir_state, OutBuff);
+    break;
+  case IIR_PARALLEL:
+    smpno = stdpcm_kernel (smpno, InpBuff, st->parallel_iir_state, OutBuff);
+    break;
+  case IIR_CASCADE:
+    smpno = cascade_iir_kernel (smpno, InpBuff, st->cascade_iir_state, OutBuff);
+    break;
+  case IIR_DIRECT:
+    smpno = direct_iir_kernel (smpno, InpBuff, st->direct_iir_state, OutBuff);
+    break;
+  }
+  return smpno;
+}
 
-  /* MEMORY ALLOCATION */
 
-  /* Calculate Output buffer size and rate change factor */
-  switch (kernel_type) {
+/*
+ * Release the filter of one stage
+ */
+void stage_free (FILTER_STAGE * st) {
+  switch (st->kernel_type) {
   case FIR:
-    factor = fir_state->dwn_up;
-    out_size = (fir_state->hswitch == 'U')
-      ? inp_size * factor : ceil (inp_size / (double) factor);
+    hq_free (st->fir_state);
     break;
   case IIR_PARALLEL:
-    factor = parallel_iir_state->idown;
-    out_size = (parallel_iir_state->hswitch == 'U')
-      ? inp_size * factor : ceil (inp_size / (double) factor);
+    stdpcm_free (st->parallel_iir_state);
     break;
   case IIR_CASCADE:
-    factor = cascade_iir_state->idown;
-    out_size = (cascade_iir_state->hswitch == 'U')
-      ? inp_size * factor : ceil (inp_size / (double) factor);
+    cascade_iir_free (st->cascade_iir_state);
     break;
   case IIR_DIRECT:
-    factor = direct_iir_state->idown;
-    out_size = (direct_iir_state->hswitch == 'U')
-      ? inp_size * factor : ceil (inp_size / (double) factor);
+    direct_iir_free (st->direct_iir_state);
+    break;
   }
+}
+
+
+/*============================== */
+int main (int argc, char *argv[]) {
+  /* DECLARATIONS */
+
+  /* Algorithm variables */
+  FILTER_STAGE stage[MAX_STAGES];
+  int nstages, i;
+  char *spec, *next;
+  clock_t t1;
+
+  float *InpBuff, *OutBuff, *Buff[2];
+  short *TmpBuff;
+  char F_type[MAX_STRLEN], async = 0, upsample = 0;
+  long cur_blk, satur = 0, total = 0, N, N1, N2;
+  char modified_IRS = 0, quiet = 0;
+  long inp_size, out_size, buf_size, factor, smpno;
+  double fs = 8000;
+  int fir_kernel = FIR_KERNEL_POLYPHASE;
+  long ratio_L = 1, ratio_M = 1;
+  static char funny[9] = "|/-\\|/-\\";
+
+  /* For asynchronous tandem simulation */
+  long delay = 0, skip = 0;
+  short *zero;
+
+  /* File variables */
+  char FileIn[MAX_STRLEN], FileOut[MAX_STRLEN];
+  FILE *Fi, *Fo;
+  long start_byte;
+#ifdef VMS
+  char mrs[15];
+#endif
+
+
+  /* ......... GET PARAMETERS ......... */
+
+  /* Check options */
+  if (argc < 2)
+    display_usage ();
+  else {
+    while (argc > 1 && argv[1][0] == '-')
+      if (strcmp (argv[1], "-mod") == 0) {
+        /* Set modified IRS flag */
+        modified_IRS = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-fs") == 0) {
+        /* Change sampling frequency */
+        fs = atof (argv[2]);
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-q") == 0) {
+        /* Change sampling frequency */
+        quiet = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-down") == 0) {
+        /* Filtering is for downsampling */
+        upsample = async = 0;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-up") == 0) {
+        /* Filtering is for upsampling */
+        upsample = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-async") == 0) {
+        /* Filtering is an asyncronization process */
+        async = upsample = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-delay") == 0) {
+        /* Filtering is an asyncronization process */
+        delay = atoi (argv[2]);
+        if (delay < 0)
+          skip = -delay;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-kernel") == 0) {
+        /* Select FIR kernel implementation */
+        if (strcmp (argv[2], "ref") == 0)
+          fir_kernel = FIR_KERNEL_REFERENCE;
+        else if (strcmp (argv[2], "poly") == 0)
+          fir_kernel = FIR_KERNEL_POLYPHASE;
+        else if (strcmp (argv[2], "simd") == 0)
+          fir_kernel = FIR_KERNEL_SIMD;
+        else {
+          fprintf (stderr, "ERROR! Invalid FIR kernel \"%s\"\n\n", argv[2]);
+          display_usage ();
+        }
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-ratio") == 0) {
+        /* Rational resampling factor L/M */
+        if (sscanf (argv[2], "%ld/%ld", &ratio_L, &ratio_M) != 2 || ratio_L <= 0 || ratio_M <= 0) {
+          fprintf (stderr, "ERROR! Invalid resampling factor \"%s\"\n\n", argv[2]);
+          display_usage ();
+        }
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+        /* Display help message */
+        display_usage ();
+      } else {
+        fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+        display_usage ();
+      }
+  }
+
+  /* Read parameters for processing */
+  GET_PAR_S (1, "_Filter type: ................. ", F_type);
+  GET_PAR_S (2, "_Input File: .................. ", FileIn);
+  GET_PAR_S (3, "_Output File: ................. ", FileOut);
+  FIND_PAR_L (4, "_Block Size: .................. ", N, 256);
+  FIND_PAR_L (5, "_Starting Block: .............. ", N1, 1);
+  FIND_PAR_L (6, "_No. of Blocks: ............... ", N2, 0);
+
+
+  /* ......... CHECK CONSISTENCY ......... */
+
+  /* Split the filter type into the stages of a pipeline, separated by commas */
+  for (nstages = 0, spec = F_type; spec != NULL; spec = next) {
+    if ((next = strchr (spec, ',')) != NULL)
+      *next++ = '\0';
+    if (nstages == MAX_STAGES)
+      error_terminate ("\nToo many filter stages! Aborted.\n", 2);
+    if (!stage_parse (&stage[nstages], spec, upsample, modified_IRS, ratio_L, ratio_M)) {
+      fprintf (stderr, "\nInvalid option in filter stage \"%s\"! Aborted.\n", spec);
+      exit (2);
+    }
+
+    /* Verify that a valid filter was selected */
+    if (!valid_filter (stage[nstages].name, stage[nstages].modified_IRS)) {
+      if (stage[nstages].modified_IRS && (strcmp (stage[nstages].name, "irs8") == 0 || strcmp (stage[nstages].name, "IRS8") == 0))
+        fprintf (stderr, "\nModified IRS is NOT available at 8 kHz! Aborted.\n");
+      else
+        fprintf (stderr, "\nInvalid filter chosen! Aborted.\n");
+      exit (2);
+    }
+    nstages++;
+  }
+  if (nstages == 0) {
+    fprintf (stderr, "\nInvalid filter chosen! Aborted.\n");
+    exit (2);
+  }
+
+  /* Asynchronization is only available for a single filter */
+  if (async && nstages > 1)
+    error_terminate ("\nASYNC filtering not available for filter pipelines! Aborted.\n", 5);
+
+  /* The delay option is only available with asynchronous filtering */
+  if (delay != 0 && !async)
+    error_terminate ("\nDelay option only available for ASYNC filtering! Aborted.\n", 5);
+
+
+  /* ......... STARTING ......... */
+
+  /* Find starting byte in file */
+  start_byte = sizeof (short) * (long) (--N1) * (long) N;
+
+#ifdef SKIP_APPROACH_1
+  /* If samples are to be skipped in output file, does it here */
+  if (skip)
+    start_byte += skip * sizeof (short);
+#endif
+
+  /* Check if is to process the whole file */
+  if (N2 == 0) {
+    struct stat st;
+
+    /* ... find the input file size ... */
+    stat (FileIn, &st);
+    N2 = ceil ((st.st_size - start_byte) / (double) (N * sizeof (short)));
+  }
+  inp_size = N;                 /* samples */
+
+
+  /* Allocate memory for delay buffer & initialize it */
+  if (delay > 0) {
+    if ((zero = (short *) calloc (delay, sizeof (short))) == NULL) {
+      error_terminate ("Error allocating memory for delay buffer\n", 5);
+    } else
+      memset (zero, 0, delay * sizeof (short));
+  }
+
+  /* Initialize the filters; select the FIR kernel implementation */
+  for (i = 0; i < nstages; i++) {
+    stage_init (&stage[i]);
+    if (stage[i].kernel_type == FIR)
+      hq_select_kernel (stage[i].fir_state, fir_kernel);
+  }
+
+
+  /* MEMORY ALLOCATION */
+
+  /* Calculate Output buffer size and rate change factor of each stage; the output of a stage is the input of the next one */
+  for (out_size = inp_size, buf_size = 0, i = 0; i < nstages; i++) {
+    stage_size (&stage[i], out_size);
+    out_size = stage[i].out_size;
+    buf_size = max (buf_size, out_size);
+  }
+  factor = stage[0].factor;
 
   /* Check consistency once more */
   if (async && factor == 1)
@@ -720,8 +944,11 @@ int main (int argc, char *argv[]) {
   if ((InpBuff = (float *) calloc (inp_size, sizeof (float))) == NULL)
     error_terminate ("Can't allocate memory for input data buffer\n", 10);
 
-  /* Allocate memory for float output buffer */
-  if ((OutBuff = (float *) calloc (out_size, sizeof (float))) == NULL)
+  /* Allocate memory for float output buffers; stages write alternately into one of them */
+  if ((Buff[0] = (float *) calloc (buf_size, sizeof (float))) == NULL)
+    error_terminate ("Can't allocate memory for output data buffer\n", 10);
+  Buff[1] = NULL;
+  if (nstages > 1 && (Buff[1] = (float *) calloc (buf_size, sizeof (float))) == NULL)
     error_terminate ("Can't allocate memory for output data buffer\n", 10);
 
   /* Allocate memory for short input/output buffer */
@@ -732,13 +959,20 @@ int main (int argc, char *argv[]) {
 /*
  * ......... PRINT INFO ..........
  */
-  if (factor == 1)
-    fprintf (stderr, "No-rate change operation\n");
-  else {
-    fprintf (stderr, "%s operation, ", async ? "Asynchronization" : (upsample ? "Upsampling" : "Downsampling"));
-    fprintf (stderr, "factor %ld\n", async ? 1l : factor);
+  for (i = 0; i < nstages; i++) {
+    if (nstages > 1)
+      fprintf (stderr, "Stage %d: %s (%s), ", i + 1, stage[i].name, filter_type_str[(int) stage[i].kernel_type]);
+    if (stage[i].hswitch == 'R')
+      fprintf (stderr, "Resampling operation, factor %ld/%ld\n", stage[i].factor, stage[i].fir_state->down);
+    else if (stage[i].factor == 1)
+      fprintf (stderr, "No-rate change operation\n");
+    else {
+      fprintf (stderr, "%s operation, ", async ? "Asynchronization" : (stage[i].upsample ? "Upsampling" : "Downsampling"));
+      fprintf (stderr, "factor %ld\n", async ? 1l : stage[i].factor);
+    }
   }
-  if (modified_IRS)
+  for (i = 0; i < nstages && !stage[i].modified_IRS; i++);
+  if (i < nstages)
     fprintf (stderr, "Using modified IRS\n");
 
   if (delay > 0)
@@ -746,7 +980,15 @@ int main (int argc, char *argv[]) {
   else if (skip)
     fprintf (stderr, "Skipping %ld samples in output file\n", skip);
 
-  fprintf (stderr, "Filter structure: %s\n", filter_type_str[(int) kernel_type]);
+  if (nstages == 1)
+    fprintf (stderr, "Filter structure: %s\n", filter_type_str[(int) stage[0].kernel_type]);
+  for (i = 0; i < nstages; i++)
+    if (stage[i].hswitch == 'R')
+      fprintf (stderr, "Resampling low-pass: %ld coefficients, %ld per phase\n", stage[i].fir_state->lenh0, stage[i].fir_state->lenp);
+  for (i = 0; i < nstages && stage[i].kernel_type != FIR; i++);
+  if (i < nstages)
+    fprintf (stderr, "FIR kernel: %s%s%s\n", fir_kernel == FIR_KERNEL_REFERENCE ? "reference" : "polyphase",
+             fir_kernel == FIR_KERNEL_SIMD ? ", SIMD " : "", fir_kernel == FIR_KERNEL_SIMD ? hq_simd_name () : "");
 
 
 /*
@@ -784,9 +1026,6 @@ int main (int argc, char *argv[]) {
     if (!quiet)
       fprintf (stderr, "%c\r", funny[cur_blk % 8]);
 
-    /* Reset output buffer */
-    memset (OutBuff, '\0', out_size * sizeof (float));
-
     /* Read a block of samples */
     if ((smpno = fread (TmpBuff, sizeof (short), N, Fi)) == 0)
       KILL (FileIn, 5);
@@ -794,20 +1033,15 @@ int main (int argc, char *argv[]) {
     /* ... and convert short to float, normalizing */
     sh2fl_16bit (smpno, TmpBuff, InpBuff, 1);
 
-    /* Call the filtering routine */
-    switch (kernel_type) {
-    case FIR:
-      smpno = hq_kernel (smpno, InpBuff, fir_state, OutBuff);
-      break;
-    case IIR_PARALLEL:
-      smpno = stdpcm_kernel (smpno, InpBuff, parallel_iir_state, OutBuff);
-      break;
-    case IIR_CASCADE:
-      smpno = cascade_iir_kernel (smpno, InpBuff, cascade_iir_state, OutBuff);
-      break;
-    case IIR_DIRECT:
-      smpno = direct_iir_kernel (smpno, InpBuff, direct_iir_state, OutBuff);
-      break;
+    /* Call the filtering routine of each stage, the output of one stage being the input of the next */
+    for (OutBuff = InpBuff, i = 0; i < nstages; i++) {
+      /* Reset output buffer */
+      memset (Buff[i & 1], '\0', stage[i].out_size * sizeof (float));
+
+      t1 = clock ();
+      smpno = stage_kernel (&stage[i], smpno, OutBuff, Buff[i & 1]);
+      stage[i].cpu += clock () - t1;
+      OutBuff = Buff[i & 1];
     }
 
     /* Decimates to implement asynchronization process */
@@ -845,30 +1079,24 @@ int main (int argc, char *argv[]) {
   /* FINALIZATIONS */
   fprintf (stderr, "\n");
 
+  /* Processing time of each stage */
+  if (nstages > 1 && !quiet)
+    for (i = 0; i < nstages; i++)
+      fprintf (stderr, "Stage %d: %-10s %8.3f s\n", i + 1, stage[i].name, (double) stage[i].cpu / CLOCKS_PER_SEC);
+
   /* Close open files */
   fclose (Fi);
   fclose (Fo);
 
   /* Release some memory */
   free (TmpBuff);
-  free (OutBuff);
+  free (Buff[0]);
+  free (Buff[1]);
   free (InpBuff);
 
   /* Release filter structrues */
-  switch (kernel_type) {
-  case FIR:
-    hq_free (fir_state);
-    break;
-  case IIR_PARALLEL:
-    stdpcm_free (parallel_iir_state);
-    break;
-  case IIR_CASCADE:
-    cascade_iir_free (cascade_iir_state);
-    break;
-  case IIR_DIRECT:
-    direct_iir_free (direct_iir_state);
-    break;
-  }
+  for (i = 0; i < nstages; i++)
+    stage_free (&stage[i]);
 
   /* Release memory for delay buffer */
   if (delay > 0)
@@ -46,6 +46,10 @@ FUNCTIONS:
                                     (needed only if another signal should
                                     be processed with the same filter)
          = hq_free(...)          :  deallocate FIR-filter memory
+         = hq_select_kernel(...) :  select reference, polyphase or SIMD
+                                    kernel implementation
+         = hq_simd_name(...)     :  name of the SIMD instruction set used
+                                    by the SIMD kernels on this machine
 
   Local (Used by other sub-units of this module, should not be needed by
          the user's program. Prototypes here and in the sub-units that use
@@ -57,6 +61,15 @@ FUNCTIONS:
                                    up-sampling procedures;
          = fir_downsampling_kernel(...) : kernel function for all FIR
                                    down-sampling procedures;
+         = fir_poly_upsampling_kernel(...) : polyphase kernel function for
+                                   all FIR up-sampling procedures;
+         = fir_poly_downsampling_kernel(...) : polyphase kernel function for
+                                   all FIR down-sampling procedures;
+         = fir_rational_kernel(...) : polyphase kernel function for
+                                   rational (L/M) resampling;
+         = fir_dot_c(...), fir_dot_sse(...), fir_dot_avx2(...),
+           fir_dot_neon(...)     : inner products used by the polyphase
+                                   kernels;
 
 HISTORY:
     16.Dec.91 v0.1 First beta-version <hf@pkinbg.uucp>
@@ -71,6 +84,13 @@ HISTORY:
 				   OpenVMS/AXP <simao@ctd.comsat.com>
     03.Dec.04 v2.3 Added correction in fir_downsampling_kernel() for sample-based
 				   operation.	<Cyril Guillaume & Stephane Ragot - stephane.ragot@francetelecom.com>
+    17.Oct.26 v2.4 Added polyphase kernels with contiguous, time-reversed
+                   coefficient branches and SSE/AVX2/NEON inner products,
+                   selected at run time; the original kernels remain
+                   available as FIR_KERNEL_REFERENCE.
+    17.Oct.26 v2.5 Added the rational (L/M) resampling kernel.
+    17.Oct.26 v2.6 Delay line of lenp-1 samples for up-sampling and rational
+                   resampling instead of lenh0-1.
 
   =============================================================================
 */
@@ -81,9 +101,27 @@ HISTORY:
  */
 #include <stdio.h>
 #include <stdlib.h>             /* General utility definitions */
+#include <string.h>             /* memcpy(), memmove() */
 
 #include "firflt.h"             /* Global definitions for FIR-FIR filter */
 
+/* SIMD instruction sets available to the compiler */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FIR_HAVE_SSE
+#include <xmmintrin.h>
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FIR_HAVE_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FIR_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
+/* Number of input samples processed per chunk by the polyphase kernels */
+#define FIR_CHUNK 1024
+
 
 /*
  * ......... Local function prototypes .........
@@ -94,6 +132,12 @@ SCD_FIR *fir_initialization ARGS ((long lenh0, float h0[], double gain, long idw
 
 static long fir_upsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, long lenh0, float *h0_ptr, float *T_ptr, long iupfac));
 static long fir_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, long lenh0, float *h0_ptr, float *T_ptr, long downfac, long *k0_ptr));
+static long fir_poly_upsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, SCD_FIR * fir_ptr));
+static long fir_poly_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, SCD_FIR * fir_ptr));
+static long fir_rational_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr, SCD_FIR * fir_ptr));
+
+typedef float (*fir_dot_fn) ARGS ((const float *h, const float *x, long n));
+static fir_dot_fn fir_select_dot ARGS ((int kernel));
 
 
 /*
@@ -140,10 +184,24 @@ static long fir_downsampling_kernel ARGS ((long lenx, float *x_ptr, float *y_ptr
         History:
         ~~~~~~~~
         28.Feb.92 v1.0 Release of 1st version <hf@pkinbg.uucp>
+        17.Oct.26 v1.1 Dispatch to the polyphase kernels unless the
+                       reference kernel was selected.
+        17.Oct.26 v1.2 Dispatch to the rational (L/M) resampling kernel,
+                       which has no reference implementation.
 
  ============================================================================
 */
 long hq_kernel (long lseg, float *x_ptr, SCD_FIR * fir_ptr, float *y_ptr) {
+  if (fir_ptr->hswitch == 'R')
+    return fir_rational_kernel (lseg, x_ptr, y_ptr, fir_ptr);
+
+  if (fir_ptr->kernel != FIR_KERNEL_REFERENCE) {
+    if (fir_ptr->hswitch == 'U')
+      return fir_poly_upsampling_kernel (lseg, x_ptr, y_ptr, fir_ptr);
+    else
+      return fir_poly_downsampling_kernel (lseg, x_ptr, y_ptr, fir_ptr);
+  }
+
   if (fir_ptr->hswitch == 'U')  /* call up-sampling procedure */
     return fir_upsampling_kernel (      /* returns number of output samples */
                                    lseg,        /* In : length of input signal */
@@ -205,6 +263,8 @@ void hq_free (SCD_FIR * fir_ptr) {
 
   free (fir_ptr->T);            /* free state variables */
   free (fir_ptr->h0);           /* free state impulse response */
+  free (fir_ptr->hp);           /* free polyphase branches */
+  free (fir_ptr->buf);          /* free polyphase work buffer */
   free (fir_ptr);               /* free allocated struct */
 }
 
@@ -212,6 +272,100 @@ void hq_free (SCD_FIR * fir_ptr) {
 
 
 
+/*
+  ============================================================================
+
+        void hq_select_kernel (SCD_FIR *fir_ptr, int kernel);
+        ~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Select the implementation used by hq_kernel():
+
+        FIR_KERNEL_REFERENCE: the original scalar kernels, which walk the
+                              impulse response with a stride of the
+                              up-sampling factor;
+        FIR_KERNEL_POLYPHASE: polyphase kernels working on contiguous,
+                              time-reversed coefficient branches and a
+                              linear work buffer; the output is
+                              bit-exact with the reference kernels
+                              (default);
+        FIR_KERNEL_SIMD:      as FIR_KERNEL_POLYPHASE, with the inner
+                              products computed with SSE, AVX2 or NEON
+                              when available. As the order of
+                              the additions changes, the output may
+                              differ from the reference kernels in the
+                              least significant bits.
+
+        The state (delay line, phase) is shared by all implementations,
+        so the kernel can be changed between two calls of hq_kernel().
+
+        Parameters:
+        ~~~~~~~~~~~
+        fir_ptr: (InOut) pointer to struct SCD_FIR;
+        kernel:  (In)    one of the FIR_KERNEL_xxx values
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+void hq_select_kernel (SCD_FIR * fir_ptr, int kernel) {
+  fir_ptr->kernel = (char) kernel;
+}
+
+/* ...................... End of hq_select_kernel() ...................... */
+
+
+
+/*
+  ============================================================================
+
+        char *hq_simd_name (void);
+        ~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Return the name of the instruction set used by the
+        FIR_KERNEL_SIMD inner products on this machine ("AVX2", "SSE",
+        "NEON" or "none").
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+char *hq_simd_name (void) {
+  static char *name = NULL;
+
+  if (name == NULL) {
+    name = "none";
+#ifdef FIR_HAVE_SSE
+    name = "SSE";
+#endif
+#ifdef FIR_HAVE_AVX2
+    if (__builtin_cpu_supports ("avx2"))
+      name = "AVX2";
+#endif
+#ifdef FIR_HAVE_NEON
+    name = "NEON";
+#endif
+  }
+  return name;
+}
+
+/* ........................ End of hq_simd_name() ........................ */
+
+
+
 /*
   ============================================================================
 
@@ -238,12 +392,13 @@ void hq_free (SCD_FIR * fir_ptr) {
         History:
         ~~~~~~~~
         28.Feb.92 v1.0 Release of 1st version <hf@pkinbg.uucp>
+        17.Oct.26 v1.1 Clear the lenp-1 samples of the delay line.
 
  ============================================================================
 */
 void hq_reset (SCD_FIR * fir_ptr) {
   long k;
-  for (k = 0; k < fir_ptr->lenh0 - 1; k++)      /* clear delay line */
+  for (k = 0; k < fir_ptr->lenp - 1; k++)       /* clear delay line */
     fir_ptr->T[k] = 0.0;        /* (= state variables) */
   fir_ptr->k0 = 0;              /* default starting index in x-array */
 }
@@ -270,7 +425,10 @@ void hq_reset (SCD_FIR * fir_ptr) {
         gain: ........ (In) gain factor for FIR-coeffic.
         idwnup: ...... (In) Down-/Up-sampling factor
         hswitch: ..... (In) switch to up/downsampling
-                            procedure in "hq_kernel"
+                            procedure in "hq_kernel"; for 'R' (rational
+                            resampling), idwnup is the up-sampling factor
+                            L and the down-sampling factor M has to be
+                            set in the returned struct
 
         Return value:
         ~~~~~~~~~~~~~
@@ -283,13 +441,15 @@ void hq_reset (SCD_FIR * fir_ptr) {
         ~~~~~~~~
         28.Feb.92 v1.0 Release of 1st version <hf@pkinbg.uucp>
         12.Mar.92 v1.1 Corrected casting of malloc.
+        17.Oct.26 v1.2 Also set up the polyphase branches and work buffer.
+        17.Oct.26 v1.3 Delay line sized to the lenp-1 samples in use.
 
  ============================================================================
 */
 SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, int hswitch) {
   SCD_FIR *ptrFIR;              /* pointer to the new struct */
   float fak;
-  long k;
+  long k, iup, lenp, lenT;
 
 
 /*
@@ -301,8 +461,10 @@ SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, i
     return 0;
   }
 
-  /* Allocate memory for delay line */
-  if ((ptrFIR->T = (float *) malloc ((lenh0 - 1) * sizeof (fak))) == (float *) 0) {
+  /* Allocate memory for delay line; for up-sampling and rational resampling, only the last lenh0/idwnup-1 input samples are kept */
+  lenp = (hswitch == 'U' || hswitch == 'R') ? lenh0 / idwnup : lenh0;
+  lenT = lenp - 1;
+  if ((ptrFIR->T = (float *) malloc ((lenT > 0 ? lenT : 1) * sizeof (fak))) == (float *) 0) {
     free (ptrFIR);              /* deallocate struct FIR */
     return 0;
   }
@@ -314,6 +476,18 @@ SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, i
     return 0;
   }
 
+  /* Allocate memory for the polyphase branches and the work buffer */
+  ptrFIR->hp = (float *) malloc (((hswitch == 'U' || hswitch == 'R') ? idwnup * lenp : lenh0) * sizeof (fak));
+  ptrFIR->buf = (float *) malloc ((lenT + FIR_CHUNK) * sizeof (fak));
+  if (ptrFIR->hp == (float *) 0 || ptrFIR->buf == (float *) 0) {
+    free (ptrFIR->hp);
+    free (ptrFIR->buf);
+    free (ptrFIR->h0);          /* deallocate impulse response */
+    free (ptrFIR->T);           /* deallocate delay line */
+    free (ptrFIR);              /* deallocate struct FIR */
+    return 0;
+  }
+
 /*
  * ......... STORE VARIABLES INTO STATE VARIABLE .........
  */
@@ -325,6 +499,19 @@ SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, i
   for (k = 0; k <= ptrFIR->lenh0 - 1; k++)
     ptrFIR->h0[k] = gain * h0[k];
 
+  /* Split into time-reversed polyphase branches: branch iup holds h0[iup], h0[iup+idwnup], ... in reverse order, so that its inner product runs forward over the input */
+  ptrFIR->lenp = lenp;
+  if (hswitch == 'U' || hswitch == 'R') {
+    for (iup = 0; iup < idwnup; iup++)
+      for (k = 0; k < lenp; k++)
+        ptrFIR->hp[iup * lenp + k] = ptrFIR->h0[iup + (lenp - 1 - k) * idwnup];
+  } else {
+    for (k = 0; k < lenh0; k++)
+      ptrFIR->hp[k] = ptrFIR->h0[lenh0 - 1 - k];
+  }
+  ptrFIR->kernel = FIR_KERNEL_POLYPHASE;
+  ptrFIR->down = 1;
+
   /* Store down-/up-sampling factor */
   ptrFIR->dwn_up = idwnup;
 
@@ -332,7 +519,7 @@ SCD_FIR *fir_initialization (long lenh0, float h0[], double gain, long idwnup, i
   ptrFIR->hswitch = hswitch;
 
   /* Clear Delay Line */
-  for (k = 0; k < ptrFIR->lenh0 - 1; k++)
+  for (k = 0; k < lenT; k++)
     ptrFIR->T[k] = 0.0;
 
   /* Store default starting index for the x-array */
@@ -588,4 +775,365 @@ static long fir_upsampling_kernel (lenx, x, y, lenh0, h0, T, iupfac)
 /* ................. End of fir_upsampling_kernel() .................. */
 
 
+/*
+  ============================================================================
+
+        float fir_dot_c (const float *h, const float *x, long n);
+        ~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Inner product of n coefficients and n samples. The sum runs from
+        the last term to the first, i.e. from the most recent input sample
+        to the oldest, which is the order of the reference kernels; the
+        polyphase kernels using this function are hence bit-exact with
+        them.
+
+        fir_dot_sse(), fir_dot_avx2() and fir_dot_neon() compute the same
+        inner product with 4 resp. 8 partial sums in vector registers
+        (unaligned loads) and are only compiled if the instruction set is
+        available.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        The inner product.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static float fir_dot_c (const float *h, const float *x, long n) {
+  float acc = 0;
+  long k;
+
+  for (k = n - 1; k >= 0; k--)
+    acc += h[k] * x[k];
+  return acc;
+}
+
+#ifdef FIR_HAVE_SSE
+static float fir_dot_sse (const float *h, const float *x, long n) {
+  __m128 acc0 = _mm_setzero_ps (), acc1 = _mm_setzero_ps ();
+  float tmp[4], acc;
+  long k;
+
+  for (k = 0; k + 8 <= n; k += 8) {
+    acc0 = _mm_add_ps (acc0, _mm_mul_ps (_mm_loadu_ps (h + k), _mm_loadu_ps (x + k)));
+    acc1 = _mm_add_ps (acc1, _mm_mul_ps (_mm_loadu_ps (h + k + 4), _mm_loadu_ps (x + k + 4)));
+  }
+  if (k + 4 <= n) {
+    acc0 = _mm_add_ps (acc0, _mm_mul_ps (_mm_loadu_ps (h + k), _mm_loadu_ps (x + k)));
+    k += 4;
+  }
+  _mm_storeu_ps (tmp, _mm_add_ps (acc0, acc1));
+  acc = (tmp[0] + tmp[1]) + (tmp[2] + tmp[3]);
+  for (; k < n; k++)
+    acc += h[k] * x[k];
+  return acc;
+}
+#endif
+
+#ifdef FIR_HAVE_AVX2
+__attribute__ ((target ("avx2")))
+static float fir_dot_avx2 (const float *h, const float *x, long n) {
+  __m256 acc0 = _mm256_setzero_ps (), acc1 = _mm256_setzero_ps ();
+  __m128 s;
+  long k;
+  float acc;
+
+  for (k = 0; k + 16 <= n; k += 16) {
+    acc0 = _mm256_add_ps (acc0, _mm256_mul_ps (_mm256_loadu_ps (h + k), _mm256_loadu_ps (x + k)));
+    acc1 = _mm256_add_ps (acc1, _mm256_mul_ps (_mm256_loadu_ps (h + k + 8), _mm256_loadu_ps (x + k + 8)));
+  }
+  if (k + 8 <= n) {
+    acc0 = _mm256_add_ps (acc0, _mm256_mul_ps (_mm256_loadu_ps (h + k), _mm256_loadu_ps (x + k)));
+    k += 8;
+  }
+  acc0 = _mm256_add_ps (acc0, acc1);
+  s = _mm_add_ps (_mm256_castps256_ps128 (acc0), _mm256_extractf128_ps (acc0, 1));
+  s = _mm_add_ps (s, _mm_movehl_ps (s, s));
+  s = _mm_add_ss (s, _mm_shuffle_ps (s, s, 1));
+  acc = _mm_cvtss_f32 (s);
+  for (; k < n; k++)
+    acc += h[k] * x[k];
+  return acc;
+}
+#endif
+
+#ifdef FIR_HAVE_NEON
+static float fir_dot_neon (const float *h, const float *x, long n) {
+  float32x4_t acc0 = vdupq_n_f32 (0), acc1 = vdupq_n_f32 (0);
+  float32x2_t s;
+  float acc;
+  long k;
+
+  for (k = 0; k + 8 <= n; k += 8) {
+    acc0 = vmlaq_f32 (acc0, vld1q_f32 (h + k), vld1q_f32 (x + k));
+    acc1 = vmlaq_f32 (acc1, vld1q_f32 (h + k + 4), vld1q_f32 (x + k + 4));
+  }
+  if (k + 4 <= n) {
+    acc0 = vmlaq_f32 (acc0, vld1q_f32 (h + k), vld1q_f32 (x + k));
+    k += 4;
+  }
+  acc0 = vaddq_f32 (acc0, acc1);
+  s = vadd_f32 (vget_low_f32 (acc0), vget_high_f32 (acc0));
+  acc = vget_lane_f32 (vpadd_f32 (s, s), 0);
+  for (; k < n; k++)
+    acc += h[k] * x[k];
+  return acc;
+}
+#endif
+
+/* ....................... End of fir_dot_xxx() ....................... */
+
+
+/*
+  ============================================================================
+
+        fir_dot_fn fir_select_dot (int kernel);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Return the inner product function for the given kernel; for
+        FIR_KERNEL_SIMD the best instruction set supported by the CPU is
+        looked up once.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static fir_dot_fn fir_select_dot (int kernel) {
+  static fir_dot_fn simd_dot = NULL;
+
+  if (kernel != FIR_KERNEL_SIMD)
+    return fir_dot_c;
+
+  if (simd_dot == NULL) {
+    simd_dot = fir_dot_c;
+#ifdef FIR_HAVE_SSE
+    simd_dot = fir_dot_sse;
+#endif
+#ifdef FIR_HAVE_AVX2
+    if (__builtin_cpu_supports ("avx2"))
+      simd_dot = fir_dot_avx2;
+#endif
+#ifdef FIR_HAVE_NEON
+    simd_dot = fir_dot_neon;
+#endif
+  }
+  return simd_dot;
+}
+
+/* ..................... End of fir_select_dot() ..................... */
+
+
+/*
+  ============================================================================
+
+        long fir_poly_downsampling_kernel (long lenx, float *x_ptr,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  float *y_ptr, SCD_FIR *fir_ptr);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Polyphase version of fir_downsampling_kernel(). The delay line
+        and the input are copied chunk-wise into a linear work buffer,
+        so that each output sample is a single inner product of the
+        time-reversed impulse response with contiguous input samples;
+        only every downfac-th output sample is computed.
+
+        Parameters:
+        ~~~~~~~~~~~
+        lenx: ..... (In)    length of input signal
+        x: ........ (In)    array with input samples
+        y: ........ (Out)   array with output samples
+        fir_ptr: .. (InOut) pointer to struct SCD_FIR
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Number of filtered samples.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long fir_poly_downsampling_kernel (long lenx, float *x, float *y, SCD_FIR * fir_ptr) {
+  fir_dot_fn dot = fir_select_dot (fir_ptr->kernel);
+  long lenh0 = fir_ptr->lenh0, lenT = fir_ptr->lenh0 - 1;
+  long downfac = fir_ptr->dwn_up;
+  float *buf = fir_ptr->buf, *hp = fir_ptr->hp;
+  long c0, c, kx, ky;
+
+  /* delay line -> start of work buffer */
+  memcpy (buf, fir_ptr->T, lenT * sizeof (float));
+
+  ky = 0;
+  kx = fir_ptr->k0;             /* next input sample to be filtered */
+  for (c0 = 0; c0 < lenx; c0 += c) {
+    c = (lenx - c0 < FIR_CHUNK) ? lenx - c0 : FIR_CHUNK;
+    memcpy (buf + lenT, x + c0, c * sizeof (float));
+
+    /* buf[kx-c0] holds x[kx-lenh0+1] */
+    for (; kx < c0 + c; kx += downfac)
+      y[ky++] = dot (hp, buf + (kx - c0), lenh0);
+
+    /* keep the last lenh0-1 samples */
+    memmove (buf, buf + c, lenT * sizeof (float));
+  }
+
+  /* work buffer -> delay line; offset of the next sample to be filtered */
+  memcpy (fir_ptr->T, buf, lenT * sizeof (float));
+  fir_ptr->k0 = kx - lenx;
+
+  return ky;
+}
+
+/* ................ End of fir_poly_downsampling_kernel() ................ */
+
+
+/*
+  ============================================================================
+
+        long fir_poly_upsampling_kernel (long lenx, float *x_ptr,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  float *y_ptr, SCD_FIR *fir_ptr);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Polyphase version of fir_upsampling_kernel(). For each input
+        sample, the iupfac output samples are the inner products of the
+        iupfac contiguous, time-reversed branches of lenh0/iupfac
+        coefficients with the same lenh0/iupfac input samples, taken
+        from a linear work buffer holding the delay line and one chunk
+        of input.
+
+        Parameters:
+        ~~~~~~~~~~~
+        lenx: ..... (In)    length of input signal
+        x: ........ (In)    array with input samples
+        y: ........ (Out)   array with output samples
+        fir_ptr: .. (InOut) pointer to struct SCD_FIR
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Number of filtered samples.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long fir_poly_upsampling_kernel (long lenx, float *x, float *y, SCD_FIR * fir_ptr) {
+  fir_dot_fn dot = fir_select_dot (fir_ptr->kernel);
+  long lenp = fir_ptr->lenp, lenT = fir_ptr->lenp - 1;
+  long iupfac = fir_ptr->dwn_up;
+  float *buf = fir_ptr->buf, *hp = fir_ptr->hp;
+  long c0, c, k, iup, ky;
+
+  /* delay line -> start of work buffer */
+  memcpy (buf, fir_ptr->T, lenT * sizeof (float));
+
+  ky = 0;
+  for (c0 = 0; c0 < lenx; c0 += c) {
+    c = (lenx - c0 < FIR_CHUNK) ? lenx - c0 : FIR_CHUNK;
+    memcpy (buf + lenT, x + c0, c * sizeof (float));
+
+    /* buf[k] holds x[c0+k-lenp+1] */
+    for (k = 0; k < c; k++)
+      for (iup = 0; iup < iupfac; iup++)
+        y[ky++] = dot (hp + iup * lenp, buf + k, lenp);
+
+    /* keep the last lenp-1 samples */
+    memmove (buf, buf + c, lenT * sizeof (float));
+  }
+
+  /* work buffer -> delay line */
+  memcpy (fir_ptr->T, buf, lenT * sizeof (float));
+
+  return ky;
+}
+
+/* ................. End of fir_poly_upsampling_kernel() ................. */
+
+
+/*
+  ============================================================================
+
+        long fir_rational_kernel (long lenx, float *x_ptr, float *y_ptr,
+        ~~~~~~~~~~~~~~~~~~~~~~~~  SCD_FIR *fir_ptr);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Polyphase kernel for resampling by the rational factor L/M
+        (L = fir_ptr->dwn_up, M = fir_ptr->down). Output sample n
+        corresponds to sample n*M of the signal up-sampled by L, i.e. to
+        input sample floor(n*M/L) and polyphase branch (n*M) mod L; only
+        these output samples are computed, each as one inner product as in
+        fir_poly_upsampling_kernel(). The position of the next output
+        sample on the up-sampled time axis, relative to the start of the
+        next segment, is kept in fir_ptr->k0.
+
+        Parameters:
+        ~~~~~~~~~~~
+        lenx: ..... (In)    length of input signal
+        x: ........ (In)    array with input samples
+        y: ........ (Out)   array with output samples, at least
+                            ceil(lenx*L/M) long
+        fir_ptr: .. (InOut) pointer to struct SCD_FIR
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Number of filtered samples.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long fir_rational_kernel (long lenx, float *x, float *y, SCD_FIR * fir_ptr) {
+  fir_dot_fn dot = fir_select_dot (fir_ptr->kernel);
+  long lenp = fir_ptr->lenp, lenT = fir_ptr->lenp - 1;
+  long L = fir_ptr->dwn_up, M = fir_ptr->down;
+  float *buf = fir_ptr->buf, *hp = fir_ptr->hp;
+  long c0, c, t, kx, ky;
+
+  /* delay line -> start of work buffer */
+  memcpy (buf, fir_ptr->T, lenT * sizeof (float));
+
+  ky = 0;
+  t = fir_ptr->k0;              /* next output sample, on the up-sampled time axis */
+  for (c0 = 0; c0 < lenx; c0 += c) {
+    c = (lenx - c0 < FIR_CHUNK) ? lenx - c0 : FIR_CHUNK;
+    memcpy (buf + lenT, x + c0, c * sizeof (float));
+
+    /* buf[kx-c0] holds x[kx-lenp+1] */
+    for (; (kx = t / L) < c0 + c; t += M)
+      y[ky++] = dot (hp + (t - kx * L) * lenp, buf + (kx - c0), lenp);
+
+    /* keep the last lenp-1 samples */
+    memmove (buf, buf + c, lenT * sizeof (float));
+  }
+
+  /* work buffer -> delay line; offset of the next output sample */
+  memcpy (fir_ptr->T, buf, lenT * sizeof (float));
+  fir_ptr->k0 = t - lenx * L;
+
+  return ky;
+}
+
+/* .................... End of fir_rational_kernel() .................... */
+
+
 /* **************************** END OF FIR-LIB.C ************************** */
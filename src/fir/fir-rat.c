@@ -0,0 +1,264 @@
+/*                                                              v1.0 17.Oct.26
+  =============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+MODULE:         FIRFLT, RATIONAL (L/M) RESAMPLING
+
+DESCRIPTION:
+        This file contains the initialization of the resampler for an
+        arbitrary rational factor L/M (e.g. 160/441 for 44.1 kHz -> 16 kHz,
+        or 147/160 for 48 kHz -> 44.1 kHz), done in a single pass by the
+        polyphase kernel of fir-lib.c. The anti-aliasing low-pass prototype
+        is designed at initialization as a Kaiser-windowed sinc at the
+        up-sampled rate:
+
+        - pass-band edge at 0.90 and stop-band edge at 1.00 times the
+          Nyquist frequency of the lower of the input and output rates;
+        - RAT_ATTENUATION dB of stop-band attenuation;
+        - RAT_TAPS_PER_PHASE_MAX coefficients per polyphase branch at most,
+          the transition band is widened if this limit is reached.
+
+        The group delay is (L*lenp-1)/(2*L) input samples, lenp being the
+        number of coefficients per branch.
+
+FUNCTIONS:
+  Global (have prototype in firflt.h)
+         = rat_resampling_init(...): initialize L/M resampler
+
+  Local (should be used only here -- prototypes only in this file)
+         = fill_rat_lowpass(...): design the Kaiser-windowed sinc
+                                   prototype for an L/M resampler
+         = rat_bessel_i0(...)    : modified Bessel function of order 0
+
+HISTORY:
+    17.Oct.26    v1.0   First version
+
+  =============================================================================
+*/
+
+
+/*
+ * ......... INCLUDES .........
+ */
+#include <stdio.h>
+#include <stdlib.h>             /* General utility definitions */
+#include <math.h>
+
+#include "firflt.h"             /* Global definitions for FIR-FIR filter */
+
+
+/*
+ * ......... Design parameters .........
+ */
+#define RAT_ATTENUATION        80.0     /* stop-band attenuation [dB] */
+#define RAT_PASSBAND           0.90     /* pass-band edge, rel. to lower Nyquist */
+#define RAT_TAPS_PER_PHASE_MAX 512      /* upper limit of lenp */
+#define RAT_PI                 3.14159265358979323846
+
+
+/*
+ * ......... Local function prototypes .........
+ */
+static double rat_bessel_i0 ARGS ((double x));
+static void fill_rat_lowpass ARGS ((float **h0, long *lenh0, long L, long M));
+
+
+/*
+ * ..... Private function prototypes defined in other sub-unit .....
+ */
+extern SCD_FIR *fir_initialization ARGS ((long lenh0, float h0[], double gain, long idwnup, int hswitch));
+
+
+/*
+ * ...................... BEGIN OF FUNCTIONS .........................
+ */
+
+
+/*
+  ============================================================================
+
+        SCD_FIR *rat_resampling_init (long L, long M);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Initialization routine for resampling by the rational factor L/M:
+        the output sampling rate is L/M times the input sampling rate. The
+        factor is reduced to lowest terms first, so the sampling rates
+        themselves may be given (e.g. L=16000, M=44100).
+
+        Parameters:
+        ~~~~~~~~~~~
+        L: ... (In) up-sampling factor (numerator), > 0
+        M: ... (In) down-sampling factor (denominator), > 0
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Returns a pointer to struct SCD_FIR, or NULL for invalid factors
+        or if there is not enough memory.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+SCD_FIR *rat_resampling_init (long L, long M) {
+  SCD_FIR *ptrFIR;
+  float *h0;                    /* pointer to array with FIR coeff. */
+  long lenh0;                   /* number of FIR coefficients */
+  long a, b, r;
+
+  if (L <= 0 || M <= 0)
+    return 0;
+
+  /* Reduce L/M to lowest terms */
+  for (a = L, b = M; b != 0; a = b, b = r)
+    r = a % b;
+  L /= a;
+  M /= a;
+
+  /* allocate array for FIR coeff. and fill with coefficients */
+  fill_rat_lowpass (&h0, &lenh0, L, M);
+  if (h0 == (float *) 0)
+    return 0;
+
+  ptrFIR = fir_initialization ( /* Returns: pointer to SCD_FIR-struct */
+                                lenh0,  /* In: number of FIR-coefficients */
+                                h0,     /* In: pointer to array with FIR-cof. */
+                                (double) L,     /* In: gain factor for FIR-coeffic. */
+                                L,      /* In: Up-sampling factor */
+                                'R'     /* In: switch to rational resampling kernel */
+    );
+  free (h0);
+
+  /* Store down-sampling factor */
+  if (ptrFIR != (SCD_FIR *) 0)
+    ptrFIR->down = M;
+
+  return ptrFIR;
+}
+
+/* .................... End of rat_resampling_init() .................... */
+
+
+/*
+  ============================================================================
+
+        double rat_bessel_i0 (double x);
+        ~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Modified Bessel function of the first kind of order 0, by its
+        power series (used for the Kaiser window).
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static double rat_bessel_i0 (double x) {
+  double sum = 1.0, term = 1.0, q = x * x / 4.0;
+  long k;
+
+  for (k = 1; term > 1e-12 * sum; k++) {
+    term *= q / ((double) k * k);
+    sum += term;
+  }
+  return sum;
+}
+
+/* ...................... End of rat_bessel_i0() ...................... */
+
+
+/*
+  ============================================================================
+
+        void fill_rat_lowpass (float **h0, long *lenh0, long L, long M);
+        ~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Allocate and design the low-pass prototype of an L/M resampler,
+        at the up-sampled rate, normalized to unity DC gain. The length
+        is a multiple of L, so that all polyphase branches have the same
+        number of coefficients.
+
+        Parameters:
+        ~~~~~~~~~~~
+        h0: ...... (Out) pointer to the allocated coefficients, NULL if
+                         there is not enough memory
+        lenh0: ... (Out) number of coefficients
+        L, M: .... (In)  resampling factor, in lowest terms
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static void fill_rat_lowpass (float **h0, long *lenh0, long L, long M) {
+  double R = (L > M) ? L : M;   /* the lower Nyquist frequency is 1/(2R) */
+  double fp, fs, fc, df, beta, c, t, w, sum;
+  long n, lenp;
+
+  /* Kaiser design formulas; frequencies normalized to the up-sampled rate */
+  fs = 0.5 / R;
+  fp = RAT_PASSBAND * fs;
+  df = fs - fp;
+  lenp = (long) ceil ((RAT_ATTENUATION - 7.95) / (14.36 * df) / L);
+  if (lenp > RAT_TAPS_PER_PHASE_MAX) {
+    lenp = RAT_TAPS_PER_PHASE_MAX;
+    df = (RAT_ATTENUATION - 7.95) / (14.36 * lenp * L);
+    fp = fs - df;
+  }
+  if (lenp < 2)
+    lenp = 2;
+  fc = 0.5 * (fp + fs);
+  beta = 0.1102 * (RAT_ATTENUATION - 8.7);
+
+  *lenh0 = lenp * L;
+  if ((*h0 = (float *) malloc (*lenh0 * sizeof (float))) == (float *) 0)
+    return;
+
+  /* windowed sinc, symmetric around c */
+  c = 0.5 * (*lenh0 - 1);
+  sum = 0;
+  for (n = 0; n < *lenh0; n++) {
+    t = n - c;
+    w = rat_bessel_i0 (beta * sqrt (1.0 - (t / c) * (t / c))) / rat_bessel_i0 (beta);
+    (*h0)[n] = (float) (w * ((t == 0) ? 2 * fc : sin (2 * RAT_PI * fc * t) / (RAT_PI * t)));
+    sum += (*h0)[n];
+  }
+
+  /* unity DC gain; the gain L is applied by fir_initialization() */
+  for (n = 0; n < *lenh0; n++)
+    (*h0)[n] = (float) ((*h0)[n] / sum);
+}
+
+/* ..................... End of fill_rat_lowpass() ..................... */
+
+
+/* **************************** END OF FIR-RAT.C ************************** */
@@ -5,4 +5,5 @@
 #include "fir-lib.c"
 #include "fir-pso.c"
 #include "fir-LP.c"
+#include "fir-rat.c"
 /* end of firflt.c */
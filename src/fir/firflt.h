@@ -18,6 +18,9 @@
    15.May.07	v2.4+	Added protoype for the [20Hz-20kHz] filter 
 						and the 1.5kHz, 14kHz. 20kHz LP filters	<Ericsson>
    31.Dec.2008  v2.5    Added LP filters (12kHz) for fs=48kHz < huawei >
+   17.Oct.2026  v2.6    Added polyphase and SIMD kernels, selectable with
+                        hq_select_kernel()
+   17.Oct.2026  v2.7    Added the rational L/M resampler rat_resampling_init()
 
   ============================================================================
 */
@@ -46,10 +49,23 @@ typedef struct {
   /* (needed in segmentwise filtering) */
   float *h0;                    /* pointer to array with FIR coeff.  */
   float *T;                     /* pointer to delay line */
-  char hswitch;                 /* switch to FIR-kernel */
+  char hswitch;                 /* switch to FIR-kernel: 'U', 'D' or 'R' (L/M) */
+  char kernel;                  /* FIR_KERNEL_REFERENCE, _POLYPHASE or _SIMD */
+  long lenp;                    /* number of coefficients per polyphase branch */
+  float *hp;                    /* polyphase branches, time-reversed */
+  float *buf;                   /* work buffer: delay line + one chunk of input */
+  long down;                    /* down-sampling factor M of L/M resamplers */
 } SCD_FIR;
 
 
+/* 
+ * ..... Kernel implementations selectable for hq_kernel() ..... 
+ */
+#define FIR_KERNEL_REFERENCE 0  /* original scalar kernels */
+#define FIR_KERNEL_POLYPHASE 1  /* polyphase kernels, scalar inner products (default) */
+#define FIR_KERNEL_SIMD      2  /* polyphase kernels, SSE/AVX2/NEON inner products */
+
+
 /* 
  * ..... Global function prototypes ..... 
  */
@@ -87,8 +103,11 @@ SCD_FIR *LP20_48kHz_init ARGS ((void));
 // FILTER_12k48k_HW
 SCD_FIR *LP12_48kHz_init ARGS ((void));
 // FILTER_12k48k_HW
+SCD_FIR *rat_resampling_init ARGS ((long L, long M));
 void hq_free ARGS ((SCD_FIR * fir_ptr));
 void hq_reset ARGS ((SCD_FIR * fir_ptr));
+void hq_select_kernel ARGS ((SCD_FIR * fir_ptr, int kernel));
+char *hq_simd_name ARGS ((void));
 
 #endif /* FIRFLT_FIRstruct_defined */
 
@@ -16,10 +16,12 @@
 			and <Volker.Springer@eedn.ericsson.se>
    31.Jan.2000  v3.01   [version no.aligned with g711.c] Updated list of 
                         compilers for smart prototypes
+   17.Oct.2026  v3.02   Added the reference functions alaw_compress_ref()
+                        etc. [version no.aligned with g711.c]
   ============================================================================
 */
 #ifndef G711_defined
-#define G711_defined 301
+#define G711_defined 302
 
 /* Smart function prototypes: for [ag]cc, VaxC, and [tb]cc */
 #if !defined(ARGS)
@@ -37,6 +39,12 @@ void alaw_expand ARGS ((long lseg, short *logbuf, short *linbuf));
 void ulaw_compress ARGS ((long lseg, short *linbuf, short *logbuf));
 void ulaw_expand ARGS ((long lseg, short *logbuf, short *linbuf));
 
+/* Sample by sample reference implementations of the functions above */
+void alaw_compress_ref ARGS ((long lseg, short *linbuf, short *logbuf));
+void alaw_expand_ref ARGS ((long lseg, short *logbuf, short *linbuf));
+void ulaw_compress_ref ARGS ((long lseg, short *linbuf, short *logbuf));
+void ulaw_expand_ref ARGS ((long lseg, short *logbuf, short *linbuf));
+
 /* Definitions for better user interface (?!) */
 #define IS_LIN 1
 #define IS_LOG 0
@@ -1,4 +1,4 @@
-/*                                                        02.Feb.2010 v3.3
+/*                                                        17.Oct.2026 v3.4
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
   G711DEMO.C
@@ -39,6 +39,10 @@
                 read from a file.
   -skip         is the number of samples to skip before the beginning
                 of the 1st block.
+  -selftest     checks the (table-driven/SIMD) G.711 functions against
+                the reference ones for all 65536 input values, reports
+                the CPU time of both and quits; exits with 1 if there is
+                any difference, 0 otherwise.
 
   Example:
   $ G711 u lili voice.ref voice.rel 256 3 45
@@ -146,6 +150,7 @@
                    size is not a multiple of the file
                    size. <simao.campos@labs.comsat.com>
   02.Feb.2010 v3.3 Modified maximum string length (y.hiwasaki)
+  17.Oct.2026 v3.4 Added option -selftest.
   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ugstdemo.h"           /* UGST defines for demo programs */
 
@@ -179,7 +184,7 @@
   --------------------------------------------------------------------------
 */
 void display_usage () {
-  fprintf (stderr, "\n  G711DEMO.C   --- Version v3.3 of 02.Feb.2010 \n");
+  fprintf (stderr, "\n  G711DEMO.C   --- Version v3.4 of 17.Oct.2026 \n");
   fprintf (stderr, "\n");
   fprintf (stderr, "  Description:\n");
   fprintf (stderr, "  ~~~~~~~~~~~~\n");
@@ -208,6 +213,8 @@ void display_usage () {
   fprintf (stderr, "  -?         displays this message.\n");
   fprintf (stderr, "  -r         disables even-bit swap by A-law encoding and decoding.\n");
   fprintf (stderr, "  -skip      is the number of samples to skip.\n");
+  fprintf (stderr, "  -selftest  checks the G.711 functions against the reference ones\n");
+  fprintf (stderr, "             for all 65536 input values, and quits.\n");
   fprintf (stderr, "\n");
 
   /* Quit program */
@@ -217,6 +224,71 @@ void display_usage () {
 /* ..................... End of display_usage() .......................... */
 
 
+/*
+  --------------------------------------------------------------------------
+   int selftest()
+
+   Runs each G.711 function and its reference implementation on all the
+   65536 16-bit values, processed in vectors of varying length so that
+   both the vector kernels and the sample by sample tails are exercised.
+   Prints the number of differences and the CPU time of both, and
+   returns the number of functions that differ.
+
+   Created 17.Oct.2026
+  --------------------------------------------------------------------------
+*/
+#define SELFTEST_RUNS 100
+int selftest () {
+  static char *name[4] = { "alaw_compress", "alaw_expand", "ulaw_compress", "ulaw_expand" };
+  void (*fast[4]) ARGS ((long, short *, short *)) = { alaw_compress, alaw_expand, ulaw_compress, ulaw_expand };
+  void (*ref[4]) ARGS ((long, short *, short *)) = { alaw_compress_ref, alaw_expand_ref, ulaw_compress_ref, ulaw_expand_ref };
+  short *inp, *out, *out_ref;
+  long i, k, len, diff;
+  int f, failed = 0;
+  clock_t t1, t2;
+  double t_fast, t_ref;
+
+  inp = (short *) malloc (65536 * sizeof (short));
+  out = (short *) malloc (65536 * sizeof (short));
+  out_ref = (short *) malloc (65536 * sizeof (short));
+  if (inp == NULL || out == NULL || out_ref == NULL)
+    error_terminate ("Can't allocate memory for the self-test\n", 10);
+  for (i = 0; i < 65536; i++)
+    inp[i] = (short) (i - 32768);
+
+  for (f = 0; f < 4; f++) {
+    /* Bit-exactness, in vectors of 1 to 67 samples */
+    ref[f] (65536, inp, out_ref);
+    for (i = 0, len = 1; i < 65536; i += len, len = len % 67 + 1)
+      fast[f] (i + len > 65536 ? 65536 - i : len, inp + i, out + i);
+    for (diff = i = 0; i < 65536; i++)
+      diff += out[i] != out_ref[i];
+
+    /* CPU time */
+    t1 = clock ();
+    for (k = 0; k < SELFTEST_RUNS; k++)
+      ref[f] (65536, inp, out_ref);
+    t2 = clock ();
+    t_ref = (t2 - t1) / (double) CLOCKS_PER_SEC;
+    t1 = clock ();
+    for (k = 0; k < SELFTEST_RUNS; k++)
+      fast[f] (65536, inp, out);
+    t2 = clock ();
+    t_fast = (t2 - t1) / (double) CLOCKS_PER_SEC;
+
+    printf ("%-14s %6ld differences, CPU time %.3f s (reference: %.3f s)\n", name[f], diff, t_fast, t_ref);
+    failed += diff != 0;
+  }
+
+  free (inp);
+  free (out);
+  free (out_ref);
+  return failed;
+}
+
+/* ....................... End of selftest() .......................... */
+
+
 /*
    **************************************************************************
    ***                                                                    ***
@@ -259,6 +331,9 @@ int main (int argc, char *argv[]) {
 
         /* Update argc */
         argc--;
+      } else if (strcmp (argv[1], "-selftest") == 0) {
+        /* Check against the reference functions and quit */
+        exit (selftest ()? 1 : 0);
       } else if (strcmp (argv[1], "-skip") == 0) {
         /* Get skip length */
         skip = atol (argv[2]);
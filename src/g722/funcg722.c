@@ -42,6 +42,8 @@ History:
                       reformated <simao@ctd.comsat.com>
 10.Jan.07  v3.0       Updated with STL2005 v2.2 basic operators
                       <{balazs.kovesi,stephane.ragot}@orange-ftgroup.com>
+17.Oct.26  v3.1       Circular (mirrored) QMF delay lines in qmf_tx() and
+                      qmf_rx(), bit-exact with v3.0
   ============================================================================
 */
 
@@ -1412,6 +1414,11 @@ static Word16 coef_qmf[24] = {
      G722 QMF analysis (encoder) filter. Uses coefficients in array
      coef_qmf[] defined above.
 
+     The 24 samples of the delay line are stored twice in
+     s->qmf_tx_delayx[], from s->qmf_tx_pos (most recent sample first)
+     and 24 samples further, so that the filter reads them in one run
+     and a new pair of samples only moves s->qmf_tx_pos back by 2.
+
     Inputs :
      xin0 - first sample for the QMF filter (read-only)
      xin1 - secon sample for the QMF filter (read-only)
@@ -1425,22 +1432,28 @@ static Word16 coef_qmf[24] = {
 */
 #define delayx s->qmf_tx_delayx
 void qmf_tx (Word16 xin0, Word16 xin1, Word16 * xl, Word16 * xh, g722_state * s) {
-  Word16 i;
+  Word16 i, pos;
   Word32 accuma, accumb;
   Word32 comp_low, comp_high;
   Word16 *pcoef, *pdelayx;
 
-  /* Saving past samples in delay line */
-  delayx[1] = xin1;
-  delayx[0] = xin0;
+  /* Saving past samples in delay line, and in its mirror image */
+  pos = s->qmf_tx_pos;
+  delayx[pos + 1] = xin1;
+  delayx[pos] = xin0;
+  delayx[pos + 25] = xin1;
+  delayx[pos + 24] = xin0;
 #ifdef WMOPS
   move16 ();
   move16 ();
+  move16 ();
+  move16 ();
+  move16 ();
 #endif
 
   /* QMF filtering */
   pcoef = coef_qmf;
-  pdelayx = delayx;
+  pdelayx = delayx + pos;
 #ifdef WMOPS
   move16 ();
   move16 ();
@@ -1452,13 +1465,19 @@ void qmf_tx (Word16 xin0, Word16 xin1, Word16 * xl, Word16 * xh, g722_state * s)
     accumb = L_mac0 (accumb, *pcoef++, *pdelayx++);
   }
 
-  /* Descaling and shift of the delay line */
-  for (i = 0; i < 22; i++) {
-    delayx[23 - i] = delayx[21 - i];
+  /* Descaling and move of the start of the delay line, instead of a
+     shift of its samples */
+  pos = sub (pos, 2);
 #ifdef WMOPS
-    move16 ();
+  test ();
 #endif
+  if (pos < 0) {
+    pos = add (pos, 24);
   }
+  s->qmf_tx_pos = pos;
+#ifdef WMOPS
+  move16 ();
+#endif
 
   comp_low = L_add (accuma, accumb);
   comp_low = L_add (comp_low, comp_low);
@@ -1477,7 +1496,8 @@ void qmf_tx (Word16 xin0, Word16 xin1, Word16 * xl, Word16 * xh, g722_state * s)
     Function Name : qmf_rx
 
      G722 QMF synthesis (decoder) filter. Uses coefficients in array
-     coef_qmf[] defined above.
+     coef_qmf[] defined above. The delay line s->qmf_rx_delayx[] is
+     circular, as in qmf_tx().
 
     Inputs :
      xout0 - first sample out of the QMF filter (write-only)
@@ -1492,23 +1512,29 @@ void qmf_tx (Word16 xin0, Word16 xin1, Word16 * xl, Word16 * xh, g722_state * s)
 */
 #define delayx s->qmf_rx_delayx
 void qmf_rx (Word16 rl, Word16 rh, Word16 * xout1, Word16 * xout2, g722_state * s) {
-  Word16 i;
+  Word16 i, pos;
   Word32 accuma, accumb;
   Word32 comp_low, comp_high;
   Word16 *pcoef, *pdelayx;
 
   /* compute sum and difference from lower-band (rl) and higher-band (rh) signals */
   /* update delay line */
-  delayx[1] = add (rl, rh);
-  delayx[0] = sub (rl, rh);
+  pos = s->qmf_rx_pos;
+  delayx[pos + 1] = add (rl, rh);
+  delayx[pos] = sub (rl, rh);
+  delayx[pos + 25] = delayx[pos + 1];
+  delayx[pos + 24] = delayx[pos];
 #ifdef WMOPS
   move16 ();
   move16 ();
+  move16 ();
+  move16 ();
+  move16 ();
 #endif
 
   /* qmf_rx filtering */
   pcoef = coef_qmf;
-  pdelayx = delayx;
+  pdelayx = delayx + pos;
 #ifdef WMOPS
   move16 ();
   move16 ();
@@ -1520,13 +1546,18 @@ void qmf_rx (Word16 rl, Word16 rh, Word16 * xout1, Word16 * xout2, g722_state *
     accumb = L_mac0 (accumb, *pcoef++, *pdelayx++);
   }
 
-  /* shift delay line */
-  for (i = 0; i < 22; i++) {
-    delayx[23 - i] = delayx[21 - i];
+  /* move the start of the delay line, instead of shifting it */
+  pos = sub (pos, 2);
 #ifdef WMOPS
-    move16 ();
+  test ();
 #endif
+  if (pos < 0) {
+    pos = add (pos, 24);
   }
+  s->qmf_rx_pos = pos;
+#ifdef WMOPS
+  move16 ();
+#endif
   comp_low = L_shl (accuma, 4);
   comp_high = L_shl (accumb, 4);
 
@@ -0,0 +1,232 @@
+/*                                                         17/Oct/2026 v1.3 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+MODULE:         MULTI-INSTANCE FUNCTIONS FOR THE UGST G.722 MODULE
+
+DESCRIPTION:
+        g722_batch_encode() and g722_batch_decode() run g722_encode() and
+        g722_decode() on a number of independent streams (jobs), each with
+        its own buffers and g722_state, spread over a pool of threads. A
+        thread takes the next job from a shared queue when it is done with
+        the previous one, so streams of different lengths balance out.
+        Each stream is processed entirely by one thread, with the same
+        calls as when it is processed alone: the output is bit-exact.
+
+        The basic operators set the global flags Overflow and Carry, which
+        the G.722 functions never read. When the complexity counters
+        (WMOPS, see count.h) are compiled in, they are global too, and all
+        the jobs are then processed by the calling thread, unless the
+        counters are thread-local (BASOP_THREADS, see typedef.h). In that
+        case, with more than one thread, the jobs are run by new threads
+        only: each one counts its jobs in the counter group "g722_encode"
+        or "g722_decode", one frame per job, and adds them to the merged
+        report with WMOPS_merge() before it exits. WMOPS_output_merged()
+        then prints the complexity of all the jobs; with setFrameRate()
+        set to the sampling rate and the samples of a job, the averages
+        are the WMOPS of one stream.
+
+        The threads are those of ugst_pool_run() (ugst-pool.c).
+
+HISTORY:
+        17.Oct.26 v1.0 First version
+        17.Oct.26 v1.1 Threads also with WMOPS when the counters are
+                       thread-local (BASOP_THREADS)
+        17.Oct.26 v1.2 Pool of threads of ugst-pool.c
+        17.Oct.26 v1.3 WMOPS of the threads merged (they were not reported)
+=============================================================================*/
+
+#include <stdlib.h>
+
+#include "g722.h"
+#include "ugst-pool.h"
+
+/* WMOPS is set by count.h unless counting is compiled out */
+#if defined(WMOPS) && !defined(BASOP_THREADS)
+#define G722_ONE_THREAD
+#elif defined(WMOPS)
+#define G722_WMOPS_THREADS
+#endif
+
+/* Local definitions */
+#define DEC_BLK 8192            /* codewords per call to g722_decode() */
+
+/* Jobs of one call */
+typedef struct {
+  g722_job *job;                /* the streams to process */
+  int decode;                   /* 0 for encoding, 1 for decoding */
+} g722_batch;
+
+
+/*
+  ============================================================================
+
+       void g722_run_job (void *ctx, long k);
+       ~~~~~~~~~~~~~~~~~
+
+       Encode or decode stream k of the batch `ctx' (a g722_batch).
+       Decoding is done in blocks of DEC_BLK codewords, as g722_decode()
+       takes a 16-bit number of codewords.
+
+  ============================================================================
+*/
+static void g722_run_job (void *ctx, long k) {
+  g722_batch *batch = (g722_batch *) ctx;
+  g722_job *job = &batch->job[k];
+  Word32 i, n;
+
+  if (!batch->decode) {
+    g722_encode (job->inp, job->out, job->nsmp, job->state);
+    return;
+  }
+  for (i = 0; i < job->nsmp; i += n) {
+    n = (job->nsmp - i < DEC_BLK) ? job->nsmp - i : DEC_BLK;
+    g722_decode (job->inp + i, job->out + 2 * i, job->mode, (short) n, job->state);
+  }
+}
+
+/* ....................... End of g722_run_job() ....................... */
+
+
+#ifdef G722_WMOPS_THREADS
+/*
+  ============================================================================
+
+       void g722_wmops_job (void *ctx, long k);
+       ~~~~~~~~~~~~~~~~~~~
+
+       g722_run_job() counted as one frame.
+
+  ============================================================================
+*/
+static void g722_wmops_job (void *ctx, long k) {
+  Reset_WMOPS_counter ();
+  g722_run_job (ctx, k);
+  fwc ();
+}
+
+/* ....................... End of g722_wmops_job() ....................... */
+
+
+/*
+  ============================================================================
+
+       void g722_wmops_begin (void *ctx);
+       void g722_wmops_end (void *ctx);
+       ~~~~~~~~~~~~~~~~~~~~
+
+       Start and exit of a thread of the batch `ctx' (a g722_batch):
+       counter group of the batch, and merged report.
+
+  ============================================================================
+*/
+static void g722_wmops_begin (void *ctx) {
+  g722_batch *batch = (g722_batch *) ctx;
+
+  setCounter (getCounterId (batch->decode ? "g722_decode" : "g722_encode"));
+  Init_WMOPS_counter ();
+}
+
+static void g722_wmops_end (void *ctx) {
+  (void) ctx;
+  WMOPS_merge ();
+}
+
+/* ....................... End of g722_wmops_end() ....................... */
+#endif /* G722_WMOPS_THREADS */
+
+
+/*
+  ============================================================================
+
+       int g722_batch_run (g722_job *job, long njobs, int threads,
+       ~~~~~~~~~~~~~~~~~~  int decode);
+
+       Process all the jobs with `threads' threads (the calling one
+       included), see ugst_pool_run(); with thread-local WMOPS counters,
+       with `threads' new threads, see ugst_pool_run_hooks(). Returns the
+       number of threads used.
+
+  ============================================================================
+*/
+static int g722_batch_run (g722_job * job, long njobs, int threads, int decode) {
+  g722_batch batch;
+
+  batch.job = job;
+  batch.decode = decode;
+#ifdef G722_ONE_THREAD
+  threads = 1;
+#endif
+#ifdef G722_WMOPS_THREADS
+  if (threads > 1)
+    return (ugst_pool_run_hooks (g722_wmops_job, g722_wmops_begin, g722_wmops_end, &batch, njobs, threads));
+#endif
+  return (ugst_pool_run (g722_run_job, &batch, njobs, threads));
+}
+
+/* ....................... End of g722_batch_run() ....................... */
+
+
+/*
+  ============================================================================
+
+       int g722_batch_encode (g722_job *job, long njobs, int threads);
+       ~~~~~~~~~~~~~~~~~~~~~
+
+       Encode `njobs' independent streams: for each job, the job->nsmp
+       (even) samples of job->inp are encoded into job->nsmp/2 codewords
+       in job->out, using and updating the encoder state job->state.
+       The states must be distinct, and reset (or carried over from a
+       previous call) by the caller.
+
+       Returns the number of threads used.
+
+  ============================================================================
+*/
+int g722_batch_encode (g722_job * job, long njobs, int threads) {
+  return (g722_batch_run (job, njobs, threads, 0));
+}
+
+/* ..................... End of g722_batch_encode() ..................... */
+
+
+/*
+  ============================================================================
+
+       int g722_batch_decode (g722_job *job, long njobs, int threads);
+       ~~~~~~~~~~~~~~~~~~~~~
+
+       Decode `njobs' independent streams: for each job, the job->nsmp
+       codewords of job->inp are decoded in mode job->mode into
+       2*job->nsmp samples in job->out, using and updating the decoder
+       state job->state. The states must be distinct, and reset (or
+       carried over from a previous call) by the caller.
+
+       Returns the number of threads used.
+
+  ============================================================================
+*/
+int g722_batch_decode (g722_job * job, long njobs, int threads) {
+  return (g722_batch_run (job, njobs, threads, 1));
+}
+
+/* ..................... End of g722_batch_decode() ..................... */
+
+/* ******************** End of g722-batch.c ***************************** */
@@ -0,0 +1,233 @@
+/*                                                         17/Oct/2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Check and benchmark of the multi-instance G.722 functions of
+	g722-batch.c against g722_encode()/g722_decode(). A number of
+	independent streams of pseudo-random 16 kHz samples (bursts of
+	random levels, up to full scale) are encoded and decoded, in
+	blocks, once stream by stream with the functions of g722.c and
+	once with g722_batch_encode()/g722_batch_decode() over a pool of
+	threads; stream c is decoded in mode 1 + c%3. The elapsed time of
+	both paths, the throughput of the batch path and the number of
+	differing samples and codewords are reported; the program exits
+	with an error if there is any difference. When the complexity
+	counters are compiled in (and thread-local), the WMOPS of the batch
+	functions, merged over the threads, are printed too.
+
+  HISTORY :
+	17.Oct.26 v1.0 First version
+	17.Oct.26 v1.1 Report of the WMOPS of the batch functions
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UGST modules */
+#include "ugstdemo.h"
+
+#include "g722.h"
+
+static void display_usage () {
+  printf ("G722-BENCH.C - Version 1.1 of 17.Oct.2026 \n\n");
+
+  printf (" Check and benchmark of the multi-instance G.722 functions\n");
+  printf ("\n");
+  printf (" Usage:\n");
+  printf (" $ g722-bench [-options]\n");
+  printf ("\n");
+  printf (" Options:\n");
+  printf ("  -n L ........ number of samples per stream (default: 32000)\n");
+  printf ("  -ch C ....... number of streams (default: 32)\n");
+  printf ("  -blk B ...... block size, in samples per stream (default: whole streams, at most 65534)\n");
+  printf ("  -threads T .. number of threads of the batch functions (default: 4)\n");
+  printf ("\n");
+}
+
+
+/* simple deterministic pseudo-random generator, uniform in [0,32768) */
+static long bench_rand (unsigned long *seed) {
+  *seed = (*seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+  return (long) (*seed >> 16);
+}
+
+
+/* elapsed time in seconds (CPU time where no monotonic clock is available) */
+static double bench_time () {
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+
+int main (int argc, char *argv[]) {
+  long L = 32000;               /* samples per stream */
+  long nch = 32;                /* number of streams */
+  long blk = 0;                 /* block size */
+  int threads = 4, used = 1;
+  long i, j, c, count, ndiff = 0;
+  unsigned long seed = 1;
+  short *pcm, *cod1, *cod2, *out1, *out2;
+  g722_state *enc, *dec;
+  g722_job *job;
+  double t1, tRef, tBatch;
+
+  /* ......... GET PARAMETERS ......... */
+  while (argc > 1 && argv[1][0] == '-') {
+    if (strcmp (argv[1], "-n") == 0) {
+      L = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-ch") == 0) {
+      nch = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-blk") == 0) {
+      blk = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-threads") == 0) {
+      threads = atoi (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+      exit (2);
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+      exit (-1);
+    }
+  }
+  L &= ~1L;                     /* the QMF takes pairs of samples */
+  if (blk == 0 || blk > L)
+    blk = L;
+  if (blk > 65534)              /* g722_decode() takes a short codeword count */
+    blk = 65534;
+  blk &= ~1L;
+  if (L < 2 || nch < 1 || blk < 2 || threads < 1) {
+    fprintf (stderr, "ERROR! Invalid parameters\n\n");
+    display_usage ();
+    exit (-1);
+  }
+
+  /* one buffer per stream, stream after stream */
+  pcm = (short *) malloc (L * nch * sizeof (short));
+  cod1 = (short *) malloc (L / 2 * nch * sizeof (short));
+  cod2 = (short *) malloc (L / 2 * nch * sizeof (short));
+  out1 = (short *) malloc (L * nch * sizeof (short));
+  out2 = (short *) malloc (L * nch * sizeof (short));
+  enc = (g722_state *) malloc (nch * sizeof (g722_state));
+  dec = (g722_state *) malloc (nch * sizeof (g722_state));
+  job = (g722_job *) malloc (nch * sizeof (g722_job));
+  if (pcm == NULL || cod1 == NULL || cod2 == NULL || out1 == NULL || out2 == NULL || enc == NULL || dec == NULL || job == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+
+  /* samples: bursts of random magnitude ranges */
+  for (c = 0; c < nch; c++) {
+    long amax = 1;
+    for (j = 0; j < L; j++) {
+      if (j % 97 == 0)
+        amax = 1 + bench_rand (&seed) % ((bench_rand (&seed) & 1) ? 32767 : 1024);
+      pcm[c * L + j] = (short) ((bench_rand (&seed) * 2 + (bench_rand (&seed) & 1)) % (2 * amax + 1) - amax);
+    }
+  }
+
+  /* ... stream by stream, with g722.c */
+  t1 = bench_time ();
+  for (c = 0; c < nch; c++) {
+    g722_reset_encoder (&enc[c]);
+    g722_reset_decoder (&dec[c]);
+    for (j = 0; j < L; j += count) {
+      count = (L - j < blk) ? L - j : blk;
+      g722_encode (pcm + c * L + j, cod1 + (c * L + j) / 2, count, &enc[c]);
+      g722_decode (cod1 + (c * L + j) / 2, out1 + c * L + j, (short) (1 + c % 3), (short) (count / 2), &dec[c]);
+    }
+  }
+  tRef = bench_time () - t1;
+
+  /* ... all streams at once */
+#if defined(WMOPS) && defined(BASOP_THREADS)
+  setFrameRate (16000, (int) blk);       /* one frame per job */
+#endif
+  t1 = bench_time ();
+  for (c = 0; c < nch; c++) {
+    g722_reset_encoder (&enc[c]);
+    g722_reset_decoder (&dec[c]);
+  }
+  for (j = 0; j < L; j += count) {
+    count = (L - j < blk) ? L - j : blk;
+    for (c = 0; c < nch; c++) {
+      job[c].inp = pcm + c * L + j;
+      job[c].out = cod2 + (c * L + j) / 2;
+      job[c].nsmp = count;
+      job[c].state = &enc[c];
+    }
+    g722_batch_encode (job, nch, threads);
+    for (c = 0; c < nch; c++) {
+      job[c].inp = cod2 + (c * L + j) / 2;
+      job[c].out = out2 + c * L + j;
+      job[c].nsmp = count / 2;
+      job[c].mode = (short) (1 + c % 3);
+      job[c].state = &dec[c];
+    }
+    used = g722_batch_decode (job, nch, threads);
+  }
+  tBatch = bench_time () - t1;
+
+  for (i = 0; i < L / 2 * nch; i++)
+    ndiff += (cod1[i] != cod2[i]);
+  for (i = 0; i < L * nch; i++)
+    ndiff += (out1[i] != out2[i]);
+
+  printf ("%8s %8s %12s %12s %9s %12s %8s\n", "streams", "threads", "g722.c [s]", "batch [s]", "speed-up", "batch [x RT]", "ndiff");
+  printf ("%8ld %8d %12.3f %12.3f %9.1f %12.1f %8ld\n", nch, used, tRef, tBatch, (tBatch > 0) ? tRef / tBatch : 0.0, (tBatch > 0) ? L * nch / 16000.0 / tBatch : 0.0, ndiff);
+
+#if defined(WMOPS) && defined(BASOP_THREADS)
+  if (used > 1) {
+    printf ("\nComplexity of the batch functions, all threads [WMOPS per stream]:\n");
+    WMOPS_output_merged (0);
+  }
+#endif
+
+  if (ndiff) {
+    fprintf (stderr, "\nERROR: the batch functions differ from g722_encode()/g722_decode()\n");
+  }
+
+  free (pcm);
+  free (cod1);
+  free (cod2);
+  free (out1);
+  free (out2);
+  free (enc);
+  free (dec);
+  free (job);
+  return (ndiff ? 1 : 0);
+}
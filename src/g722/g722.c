@@ -39,6 +39,7 @@ History:
                       reformated <simao@ctd.comsat.com>
 10.Jan.07  v3.0       Updated with STL2005 v2.2 basic operators
                       <{balazs.kovesi,stephane.ragot}@orange-ftgroup.com>
+17.Oct.26  v3.1       Reset of the circular QMF delay lines
   ============================================================================
 */
 #include "g722.h"
@@ -53,12 +54,16 @@ void g722_reset_encoder (g722_state * encoder) {
   move16 ();
   move16 ();
 #endif
-  for (j = 0; j < 24; j++) {
+  for (j = 0; j < 48; j++) {
     encoder->qmf_tx_delayx[j] = 0;
 #ifdef WMOPS
     move16 ();
 #endif
   }
+  encoder->qmf_tx_pos = 0;
+#ifdef WMOPS
+  move16 ();
+#endif
   il = lsbcod (xl, 1, encoder);
   ih = hsbcod (xh, 1, encoder);
 }
@@ -123,12 +128,16 @@ void g722_reset_decoder (g722_state * decoder) {
   move16 ();
   move16 ();
 #endif
-  for (j = 0; j < 24; j++) {
+  for (j = 0; j < 48; j++) {
     decoder->qmf_rx_delayx[j] = 0;
 #ifdef WMOPS
     move16 ();
 #endif
   }
+  decoder->qmf_rx_pos = 0;
+#ifdef WMOPS
+  move16 ();
+#endif
   rl = lsbdec (il, (Word16) 0, 1, decoder);
   rh = hsbdec (ih, 1, decoder);
 }
@@ -14,10 +14,12 @@
                       reformated <simao@ctd.comsat.com>
 10.Jan.07  v3.0       Updated with STL2005 v2.1 basic operators
                       <{balazs.kovesi,stephane.ragot}@orange-ftgroup.com>
+17.Oct.26  v3.1       Circular QMF delay lines; multi-instance functions
+                      g722_batch_encode()/g722_batch_decode()
   ============================================================================
 */
 #ifndef G722_H
-#define G722_H 200
+#define G722_H 310
 
 /* DEFINITION FOR SMART PROTOTYPES */
 #ifndef ARGS
@@ -54,8 +56,10 @@ typedef struct {
   Word16 sh;
   Word16 sph;
   Word16 szh;
-  Word16 qmf_tx_delayx[24];
-  Word16 qmf_rx_delayx[24];
+  Word16 qmf_tx_delayx[48];     /* circular, stored twice (see qmf_tx()) */
+  Word16 qmf_rx_delayx[48];
+  Word16 qmf_tx_pos;            /* position of the most recent sample */
+  Word16 qmf_rx_pos;
 } g722_state;
 
 /* Include function prototypes for G722 functions */
@@ -67,5 +71,17 @@ Word32 g722_encode ARGS ((short *incode, short *code, Word32 nsmp, g722_state *
 void g722_reset_decoder ARGS ((g722_state * decoder));
 short g722_decode ARGS ((short *code, short *outcode, short mode, short nsmp, g722_state * decoder));
 
+/* One independent stream for the multi-instance functions (g722-batch.c) */
+typedef struct {
+  short *inp;                   /* samples (encoder) or codewords (decoder) */
+  short *out;                   /* codewords (encoder) or samples (decoder) */
+  Word32 nsmp;                  /* number of input samples or codewords */
+  short mode;                   /* decoder operation mode (1, 2 or 3) */
+  g722_state *state;            /* state of this stream */
+} g722_job;
+
+int g722_batch_encode ARGS ((g722_job * job, long njobs, int threads));
+int g722_batch_decode ARGS ((g722_job * job, long njobs, int threads));
+
 #endif /* G722_H */
 /* ................. End of file g722.h .................................. */
@@ -40,6 +40,11 @@
   -enc        run only the encoder [default: encoder and decoder]
   -dec        run only the decoder [default: encoder and decoder]
   -noreset    don't apply reset to the encoder/decoder
+  -batch #    process # copies of the input as independent streams with
+              the multi-instance functions g722_batch_encode() and
+              g722_batch_decode(), check that all of them give the same
+              result, and save it
+  -threads #  number of threads for option -batch [default: 1]
   -q          quiet operation (don't print progress flag)
   -?/-help    print help message
 
@@ -63,6 +68,8 @@
                        size was not a multiple of the block size
                        N. <simao>
   10.Jan.07    v3.0    Added some castings to avoid warnings
+  17.Oct.26    v3.1    Added options -batch and -threads, to run the
+                       multi-instance functions of g722-batch.c
   ============================================================================
 */
 
@@ -122,6 +129,10 @@ void display_usage () {
   printf ("  -enc        run only the encoder [default: encoder and decoder]\n");
   printf ("  -dec        run only the decoder [default: encoder and decoder]\n");
   printf ("  -noreset    don't apply reset to the encoder/decoder\n");
+  printf ("  -batch #    process # copies of the input as independent streams\n");
+  printf ("              with the multi-instance functions, check that all of\n");
+  printf ("              them give the same result, and save it\n");
+  printf ("  -threads #  number of threads for option -batch [default: 1]\n");
   printf ("  -?/-help    print help message\n");
   printf ("  -q          quiet operation (don't print progress flag)\n");
 
@@ -159,6 +170,13 @@ int main (int argc, char *argv[]) {
 #endif
   Word16 *inp_buf, *cod_buf, *out_buf;
 
+  /* Streams for option -batch */
+  long nch = 0, i;
+  int threads = 1;
+  g722_state *encoder_batch = NULL, *decoder_batch = NULL;
+  g722_job *job = NULL;
+  Word16 *binp_buf = NULL, *bcod_buf = NULL, *bout_buf = NULL, *bres_buf;
+
   /* File variables */
   char FileIn[80], FileOut[80];
   FILE *inp, *out;
@@ -220,6 +238,24 @@ int main (int argc, char *argv[]) {
         /* Define Frame size for rate change during operation */
         N = atoi (argv[2]);
 
+        /* Move argv over the option to the next argument */
+        argv += 2;
+        argc -= 2;
+      } else if (strcmp (argv[1], "-batch") == 0) {
+        /* Number of copies for the multi-instance functions */
+        nch = atol (argv[2]);
+        if (nch < 1)
+          error_terminate ("Number of batch streams must be positive; aborting\n", 2);
+
+        /* Move argv over the option to the next argument */
+        argv += 2;
+        argc -= 2;
+      } else if (strcmp (argv[1], "-threads") == 0) {
+        /* Number of threads for the multi-instance functions */
+        threads = atoi (argv[2]);
+        if (threads < 1)
+          error_terminate ("Number of threads must be positive; aborting\n", 2);
+
         /* Move argv over the option to the next argument */
         argv += 2;
         argc -= 2;
@@ -322,6 +358,22 @@ int main (int argc, char *argv[]) {
     g722_reset_decoder (&decoder);
 #endif
 
+  /* Streams for option -batch: 2*N samples per buffer and per stream */
+  if (nch > 0) {
+    encoder_batch = (g722_state *) calloc (nch, sizeof (g722_state));
+    decoder_batch = (g722_state *) calloc (nch, sizeof (g722_state));
+    job = (g722_job *) calloc (nch, sizeof (g722_job));
+    binp_buf = (Word16 *) calloc (2 * N * nch, sizeof (Word16));
+    bcod_buf = (Word16 *) calloc (2 * N * nch, sizeof (Word16));
+    bout_buf = (Word16 *) calloc (2 * N * nch, sizeof (Word16));
+    if (encoder_batch == NULL || decoder_batch == NULL || job == NULL || binp_buf == NULL || bcod_buf == NULL || bout_buf == NULL)
+      error_terminate ("Error alocating batch buffers\n", 3);
+    for (i = 0; i < nch; i++) {
+      g722_reset_encoder (&encoder_batch[i]);
+      g722_reset_decoder (&decoder_batch[i]);
+    }
+  }
+
   /* Adjust number of samples if decode only and frame size too big */
   if (decode && !encode && N > 8192)
     N /= 2;
@@ -332,7 +384,46 @@ int main (int argc, char *argv[]) {
     if (!quiet)
       fprintf (stderr, "%c\r", funny[(iter / read1) % 8]);
 
-    if (encode) {
+    if (nch > 0) {
+      /* Process nch copies of the block as independent streams */
+      for (i = 0; i < nch; i++)
+        memcpy (binp_buf + i * 2 * N, incode, read1 * sizeof (Word16));
+      bres_buf = binp_buf;
+
+      if (encode) {
+        for (i = 0; i < nch; i++) {
+          job[i].inp = binp_buf + i * 2 * N;
+          job[i].out = bcod_buf + i * 2 * N;
+          job[i].nsmp = read1;
+          job[i].state = &encoder_batch[i];
+        }
+        g722_batch_encode (job, nch, threads);
+        read1 /= 2;
+        bres_buf = bcod_buf;
+      }
+
+      if (decode) {
+        for (i = 0; i < nch; i++) {
+          job[i].inp = bres_buf + i * 2 * N;
+          job[i].out = bout_buf + i * 2 * N;
+          job[i].nsmp = read1;
+          job[i].mode = mode;
+          job[i].state = &decoder_batch[i];
+        }
+        g722_batch_decode (job, nch, threads);
+        read1 *= 2;
+        bres_buf = bout_buf;
+      }
+
+      /* All the streams must give the same result */
+      for (i = 1; i < nch; i++)
+        if (memcmp (bres_buf + i * 2 * N, bres_buf, read1 * sizeof (Word16)) != 0)
+          error_terminate ("Batch streams differ; aborting\n", 11);
+      memcpy (out_buf, bres_buf, read1 * sizeof (Word16));
+      smpno = read1;
+    }
+
+    else if (encode) {
       /* Encode */
       smpno = g722_encode (inp_buf, code, read1, &encoder);
 
@@ -344,7 +435,7 @@ int main (int argc, char *argv[]) {
         error_terminate ("Error encoding!\n", 10);
     }
 
-    if (decode) {
+    if (decode && nch == 0) {
       /* Decode */
       smpno = g722_decode (cod_buf, outcode, mode, (short) read1, &decoder);
 
@@ -381,6 +472,14 @@ int main (int argc, char *argv[]) {
   }
 #endif
 
+  /* Free memory of option -batch */
+  free (encoder_batch);
+  free (decoder_batch);
+  free (job);
+  free (binp_buf);
+  free (bcod_buf);
+  free (bout_buf);
+
   /* Close input and output files */
   fclose (out);
   fclose (inp);
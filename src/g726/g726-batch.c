@@ -0,0 +1,899 @@
+/*                                                           v1.0 17.Oct.2026
+=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+
+MODULE:         G726-BATCH.C, MULTI-CHANNEL G.726 ENCODER AND DECODER
+
+DESCRIPTION:
+   Encoder and decoder for many independent G.726 channels at once, with
+   the same output, bit by bit, as G726_encode() and G726_decode() run
+   on each channel separately. The state of all channels is kept in a
+   G726_batch, as one array per state variable (structure of arrays),
+   and each sample time is processed for all channels in one loop over
+   the channels, without dependencies between its iterations: the
+   channels are the lanes of the loop, for compilers that vectorize it.
+   The blocks of G.726 (G726_fmult(), G726_log(),
+   ...) are computed by local functions that take and return values
+   rather than pointers, so that they are inlined in that loop; each one
+   is the same computation as the G726_xxx() function of g726.c it is
+   named after.
+
+   All channels share the law and the rate. Input and output samples
+   are interleaved by channel: sample j of channel c is buf[j*nch+c].
+
+FUNCTIONS:
+Public (prototypes in g726.h):
+  G726_batch_create ... allocate the state of a batch of channels;
+  G726_batch_free ..... release it;
+  G726_batch_reset .... reset all channels;
+  G726_batch_get ...... copy the state of a channel to a G726_state;
+  G726_batch_set ...... copy a G726_state to the state of a channel;
+  G726_batch_encode ... G.726 encoder for all channels;
+  G726_batch_decode ... G.726 decoder for all channels.
+
+HISTORY:
+17.Oct.2026 v1.0  First version
+
+=============================================================================
+*/
+
+/*
+ *  .................. INCLUDES ..................
+ */
+#include <stdlib.h>
+#include "g726.h"
+
+
+/*
+ *  .................. LOCAL DEFINITIONS ..................
+ */
+
+/* Lane functions are to be inlined in the loop over the channels */
+#if defined(__GNUC__) || defined(__clang__)
+#define G726B_INLINE static __inline__ __attribute__ ((always_inline))
+#elif defined(_MSC_VER)
+#define G726B_INLINE static __forceinline
+#else
+#define G726B_INLINE static
+#endif
+
+/* Number of arrays in a G726_batch */
+#define G726B_NVAR 24
+
+/* Tables of G726_reconst(), G726_functw() and G726_functf(), by rate;
+   int, so that the lookups of all channels can be vectorized */
+static const int g726b_dqln5[32] = { 2048, 4030, 28, 104, 169, 224, 274, 318, 358, 395, 429,
+  459, 488, 514, 539, 566, 566, 539, 514, 488, 459, 429, 395, 358, 318, 274, 224,
+  169, 104, 28, 4030, 2048
+};
+static const int g726b_dqln4[16] = { 2048, 4, 135, 213, 273, 323, 373, 425, 425, 373, 323, 273, 213, 135, 4, 2048 };
+static const int g726b_dqln3[8] = { 2048, 135, 273, 373, 373, 273, 135, 2048 };
+static const int g726b_dqln2[4] = { 116, 365, 365, 116 };
+static const int g726b_wi5[16] = { 14, 14, 24, 39, 40, 41, 58, 100, 141, 179, 219, 280, 358, 440, 529, 696 };
+static const int g726b_wi4[8] = { 4084, 18, 41, 64, 112, 198, 355, 1122 };
+static const int g726b_wi3[4] = { 4092, 30, 137, 582 };
+static const int g726b_wi2[2] = { 4074, 439 };
+static const int g726b_fi5[16] = { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6, 6 };
+static const int g726b_fi4[8] = { 0, 0, 0, 1, 1, 1, 3, 7 };
+static const int g726b_fi3[4] = { 0, 1, 2, 7 };
+static const int g726b_fi2[2] = { 0, 7 };
+
+
+/*
+ *  .................. LOCAL FUNCTIONS ..................
+ */
+
+/*
+  The functions below compute on int the values that g726.c keeps in
+  shorts and longs (they all fit in 32 bits), with a cast to short where
+  g726.c stores a result in a short. They have no branches nor loops:
+  the exponent searches are bit counts, and the choices are conditional
+  expressions or masks, so that the loop over the channels can be
+  turned into vector code. The `law' (A law if '1') and `rate'
+  (2..5 bits) arguments are constants after inlining.
+*/
+
+/* Number of significant bits of 0 <= x < 32768 (0 for x == 0) */
+G726B_INLINE int g726b_nbits (int x) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (x == 0) ? 0 : 32 - __builtin_clz ((unsigned) x);
+#else
+  return (x >= 1) + (x >= 2) + (x >= 4) + (x >= 8) + (x >= 16) + (x >= 32) + (x >= 64) + (x >= 128) + (x >= 256) + (x >= 512) + (x >= 1024) + (x >= 2048) + (x >= 4096) + (x >= 8192) + (x >= 16384);
+#endif
+}
+
+/* G726_trigb(): 0 if tr == 1, else x (as a mask, so that it is not
+   compiled to a conditional store) */
+G726B_INLINE int g726b_trigb (int tr, int x) {
+  return x & (tr - 1);
+}
+
+/* G726_fmult(): returns WAn */
+G726B_INLINE int g726b_fmult (int An, int SRn) {
+  int an, srn1, ans, anmag, anexp, anmant, srnexp, srnmant;
+  int wans, wanexp, wanmant, wanmag;
+
+  an = An & 65535;
+  srn1 = SRn & 65535;
+  ans = (an & 32768) >> 15;
+  anmag = (ans == 0) ? (an >> 2) : ((16384 - (an >> 2)) & 8191);
+  anexp = g726b_nbits (anmag);
+  anmant = (anmag == 0) ? (1 << 5) : ((anmag << 6) >> anexp);
+  srnexp = (srn1 >> 6) & 15;
+  srnmant = srn1 & 63;
+  wans = (srn1 >> 10) ^ ans;
+  wanexp = srnexp + anexp;
+  wanmant = ((srnmant * anmant) + 48) >> 4;
+  wanmag = (wanexp <= 26) ? (wanmant << 7) >> (26 - wanexp) : ((wanmant << 7) << (wanexp - 26)) & 32767;
+  return (short) ((wans == 0) ? wanmag : ((65536 - wanmag) & 65535));
+}
+
+/* G726_expand(): returns sl */
+G726B_INLINE int g726b_expand (int s, int law) {
+  int s1, sig, iexp, mant, ss;
+
+  s1 = (short) (s ^ 128);
+  if (law == '1') {
+    sig = (s1 >= 128) ? 4096 : 0;
+    s1 = (s1 >= 128) ? s1 - 128 : s1;
+    iexp = s1 >> 4;
+    mant = s1 & 15;
+    ss = (iexp == 0) ? ((mant << 1) + 1 + sig) : ((1 << (iexp - 1)) * ((mant << 1) + 33) + sig);
+    return (ss < 4096) ? ((ss & 4095) << 1) : ((16384 - ((ss & 4095) << 1)) & 16383);
+  }
+  sig = (s1 >= 128) ? 8192 : 0;
+  s1 = ((s1 >= 128) ? s1 - 128 : s1) ^ 127;
+  iexp = s1 >> 4;
+  mant = s1 & 15;
+  ss = (iexp == 0) ? ((mant << 1) + sig) : ((1 << iexp) * ((mant << 1) + 33) - 33 + sig);
+  return (ss < 8192) ? (ss & 8191) : ((16384 - (ss & 8191)) & 16383);
+}
+
+/* G726_subta(): returns d */
+G726B_INLINE int g726b_subta (int sl, int se) {
+  int sli, sei;
+
+  sli = ((sl >> 13) == 0) ? sl : (sl + 49152);
+  sei = ((se >> 14) == 0) ? se : (se + 32768);
+  return (short) ((sli + 65536 - sei) & 65535);
+}
+
+/* G726_log() and G726_subtb(): returns dln; the sign of d is `d < 0' */
+G726B_INLINE int g726b_logsub (int d, int y) {
+  int dqm, exp_, mant;
+
+  dqm = (d < 0) ? ((65536 - d) & 32767) : d;
+  exp_ = g726b_nbits (dqm >> 1);
+  mant = ((dqm << 7) >> exp_) & 127;
+  return ((exp_ << 7) + mant + 4096 - (y >> 2)) & 4095;
+}
+
+/* G726_quan(): returns i; the decision levels below dln = 2048 are
+   counted, rather than searched */
+G726B_INLINE int g726b_quan (int rate, int dln, int ds) {
+  int i, lo = (dln < 2048);
+
+  if (rate == 4) {
+    i = lo ? 1 + (dln >= 80) + (dln >= 178) + (dln >= 246) + (dln >= 300) + (dln >= 349) + (dln >= 400) : 15 - 14 * (dln >= 3972);
+    i = ds ? 15 - i : i;
+    return (i == 0) ? 15 : i;
+  } else if (rate == 3) {
+    i = (lo & (dln >= 8)) ? 1 + (dln >= 218) + (dln >= 331) : 7;
+    i = ds ? 7 - i : i;
+    return (i == 0) ? 7 : i;
+  } else if (rate == 2) {
+    i = lo & (dln >= 261);
+    return ds ? 3 - i : i;
+  }
+  i = lo ? 2 + (dln >= 68) + (dln >= 139) + (dln >= 198) + (dln >= 250) + (dln >= 298) + (dln >= 339) + (dln >= 378) + (dln >= 413) + (dln >= 445) + (dln >= 475) + (dln >= 502) + (dln >= 528) + (dln >= 553) : 31 - 30 * (dln >= 3974) + (dln >= 4080);
+  i = ds ? 31 - i : i;
+  return (i == 0) ? 31 : i;
+}
+
+/* G726_reconst(), G726_functw() and G726_functf() tables */
+G726B_INLINE int g726b_dqln (int rate, int i) {
+  return (rate == 5) ? g726b_dqln5[i] : (rate == 4) ? g726b_dqln4[i] : (rate == 3) ? g726b_dqln3[i] : g726b_dqln2[i];
+}
+
+G726B_INLINE int g726b_wi (int rate, int im) {
+  return (rate == 5) ? g726b_wi5[im] : (rate == 4) ? g726b_wi4[im] : (rate == 3) ? g726b_wi3[im] : g726b_wi2[im];
+}
+
+G726B_INLINE int g726b_fi (int rate, int im) {
+  return (rate == 5) ? g726b_fi5[im] : (rate == 4) ? g726b_fi4[im] : (rate == 3) ? g726b_fi3[im] : g726b_fi2[im];
+}
+
+/* G726_adda() and G726_antilog(): returns dq */
+G726B_INLINE int g726b_antilog (int dqln, int y, int dqs) {
+  int dql, dex, dqt, dqmag;
+
+  dql = (dqln + (y >> 2)) & 4095;
+  dex = (dql >> 7) & 15;
+  dqt = (dql & 127) + 128;
+  dqmag = (dql >> 11) ? 0 : ((dqt << 7) >> (14 - dex));
+  return (short) ((dqs << 15) + dqmag);
+}
+
+/* G726_filtd() and G726_limb(): returns yup */
+G726B_INLINE int g726b_yup (int wi, int y) {
+  int dif, difsx, yut;
+
+  dif = ((wi << 5) + 131072 - y) & 131071;
+  difsx = ((dif >> 16) == 0) ? (dif >> 5) : ((dif >> 5) + 4096);
+  yut = (y + difsx) & 8191;
+  return (((yut + 15840) & 16383) >> 13) ? 544 : ((((yut + 11264) & 16383) >> 13) == 0) ? 5120 : yut;
+}
+
+/* G726_filte(): returns ylp */
+G726B_INLINE int g726b_filte (int yup, int yl) {
+  int dif, difsx;
+
+  dif = (yup + ((1048576 - yl) >> 6)) & 16383;
+  difsx = ((dif >> 13) == 0) ? dif : (dif + 507904);
+  return (yl + difsx) & 524287;
+}
+
+/* G726_mix(): returns y */
+G726B_INLINE int g726b_mix (int al, int yu, int yl) {
+  int dif, difs, difm, prodm, prod;
+
+  dif = (yu + 16384 - (yl >> 6)) & 16383;
+  difs = (dif >> 13);
+  difm = (difs == 0) ? dif : ((16384 - dif) & 8191);
+  prodm = ((difm * al) >> 6);
+  prod = (difs == 0) ? prodm : ((16384 - prodm) & 16383);
+  return ((yl >> 6) + prod) & 8191;
+}
+
+/* G726_filta(): returns dmsp */
+G726B_INLINE int g726b_filta (int fi, int dms) {
+  int dif, difsx;
+
+  dif = ((fi << 9) + 8192 - dms) & 8191;
+  difsx = ((dif >> 12) == 0) ? (dif >> 5) : ((dif >> 5) + 3840);
+  return (difsx + dms) & 4095;
+}
+
+/* G726_filtb(): returns dmlp */
+G726B_INLINE int g726b_filtb (int fi, int dml) {
+  int dif, difsx;
+
+  dif = ((fi << 11) + 32768 - dml) & 32767;
+  difsx = ((dif >> 14) == 0) ? (dif >> 7) : ((dif >> 7) + 16128);
+  return (difsx + dml) & 16383;
+}
+
+/* G726_subtc(), G726_filtc() and G726_triga(): returns apr */
+G726B_INLINE int g726b_apr (int dmsp, int dmlp, int tdp, int y, int ap, int tr) {
+  int dif, difm, ax, difsx;
+
+  dif = ((dmsp << 2) + 32768 - dmlp) & 32767;
+  difm = ((dif >> 14) == 0) ? dif : ((32768 - dif) & 16383);
+  ax = 1 - ((y >= 1536) & (difm < (dmlp >> 3)) & (tdp == 0));
+  dif = ((ax << 9) + 2048 - ap) & 2047;
+  difsx = ((dif >> 10) == 0) ? (dif >> 4) : ((dif >> 4) + 896);
+  return g726b_trigb (tr, (difsx + ap) & 1023) | (tr << 8);
+}
+
+/* G726_addb() or G726_addc(): 2's complement sum of dq (signed
+   magnitude) and se or sez, in 0..65535 */
+G726B_INLINE int g726b_add (int dq, int se) {
+  int dqi, sei;
+
+  dqi = (((dq >> 15) & 1) == 0) ? (dq & 65535) : ((65536 - (dq & 32767)) & 65535);
+  sei = ((se >> 14) == 0) ? se : ((1 << 15) + se);
+  return (dqi + sei) & 65535;
+}
+
+/* G726_floata() and G726_floatb(): float of a signed magnitude */
+G726B_INLINE int g726b_float (int s, int mag) {
+  int exp_ = g726b_nbits (mag);
+  int mant = (mag == 0) ? (1 << 5) : ((mag << 6) >> exp_);
+
+  return (short) ((s << 10) + (exp_ << 6) + mant);
+}
+
+/* G726_upa2() and G726_limc(): returns a2p */
+G726B_INLINE int g726b_a2p (int pk0, int pk1, int pk2, int a2, int a1, int sigpk) {
+  int a11, a21, uga2a, fa1, fa, uga2b, uga2, ula2, a2t;
+
+  a11 = a1 & 65535;
+  a21 = a2 & 65535;
+  uga2a = ((pk0 ^ pk2) == 0) ? 16384 : 114688;
+  fa1 = (a1 >= 0) ? ((a11 <= 8191) ? (a11 << 2) : (8191 << 2)) : ((a11 >= 57345) ? ((a11 << 2) & 131071) : (24577 << 2));
+  fa = (pk0 ^ pk1) ? fa1 : ((131072 - fa1) & 131071);
+  uga2b = (uga2a + fa) & 131071;
+  uga2 = (sigpk == 1) ? 0 : ((uga2b >> 16) ? ((uga2b >> 7) + 64512) : (uga2b >> 7));
+  ula2 = (a2 >= 0) ? ((65536 - (a21 >> 7)) & 65535) : ((65536 - ((a21 >> 7) + 65024)) & 65535);
+  a2t = (a21 + ((uga2 + ula2) & 65535)) & 65535;
+  return (short) (((a2t >= 32768) & (a2t <= 53248)) ? 53248 : ((a2t >= 12288) & (a2t <= 32767)) ? 12288 : a2t);
+}
+
+/* G726_upa1() and G726_limd(): returns a1p */
+G726B_INLINE int g726b_a1p (int pk0, int pk1, int a1, int sigpk, int a2p) {
+  int a11, a2p1, uga1, ash, ula1, a1t, a1ul, a1ll;
+
+  a11 = a1 & 65535;
+  uga1 = (sigpk == 1) ? 0 : (((pk0 ^ pk1) == 0) ? 192 : 65344);
+  ash = (a11 >> 8);
+  ula1 = (((a11 >> 15) == 0) ? (65536 - ash) : (65536 - (ash + 65280))) & 65535;
+  a1t = (a11 + ((uga1 + ula1) & 65535)) & 65535;
+  a2p1 = a2p & 65535;
+  a1ul = (15360 + 65536 - a2p1) & 65535;
+  a1ll = (a2p1 + 65536 - 15360) & 65535;
+  return (short) (((a1t >= 32768) & (a1t <= a1ll)) ? a1ll : ((a1t >= a1ul) & (a1t <= 32767)) ? a1ul : a1t);
+}
+
+/* G726_xor(), G726_upb() and G726_trigb(): returns bnr */
+G726B_INLINE int g726b_upb (int rate, int dqn, int b, int dq, int tr) {
+  int bb, u, ugb, ulb, leak = (rate != 5) ? 8 : 9, param = (rate != 5) ? 65280 : 65408;
+
+  u = ((dq >> 15) & 1) ^ (dqn >> 10);
+  bb = b & 65535;
+  ugb = ((dq & 32767) == 0) ? 0 : ((u == 0) ? 128 : 65408);
+  ulb = ((bb >> 15) == 0) ? ((65536 - (bb >> leak)) & 65535) : ((65536 - ((bb >> leak) + param)) & 65535);
+  return g726b_trigb (tr, (short) ((bb + ((ugb + ulb) & 65535)) & 65535));
+}
+
+/* G726_trans(): returns tr */
+G726B_INLINE int g726b_trans (int td, int yl, int dq) {
+  int ylint = yl >> 15, ylfrac = (yl >> 10) & 31;
+  int thr2, dqthr;
+
+  thr2 = (ylint > 9) ? 31744 : ((ylfrac + 32) << (ylint & 15));
+  dqthr = (thr2 + (thr2 >> 1)) >> 1;
+  return ((dq & 32767) > dqthr) & (td == 1);
+}
+
+/* G726_compress(): returns sp; the exponent searches of g726.c are
+   replaced by bit counts */
+G726B_INLINE int g726b_compress (int sr, int law) {
+  int is, im, imag, n, iesp;
+
+  is = (sr < 0);
+  im = is ? ((65536 - (sr & 65535)) & 32767) : sr;
+  if (law == '1') {
+    im = (sr == -32768) ? 2 : im;
+    imag = is ? ((im + 1) >> 1) - 1 : (im >> 1);
+    imag = (imag > 4095) ? 4095 : imag;
+    n = g726b_nbits (imag);
+    iesp = (n > 5) ? n - 5 : 0;
+    imag = ((imag << (13 - ((n > 6) ? n : 6))) & 4095) >> 8;
+    return (imag + (iesp << 4) + (is << 7)) ^ 128;
+  }
+  imag = ((im > 8158) ? 8158 : im) + 1;
+  iesp = g726b_nbits (imag + 32) - 6;
+  imag = (imag - (1 << (iesp + 5)) + 32) >> (iesp + 1);
+  return (imag + (iesp << 4) + (is << 7)) ^ 128 ^ 127;
+}
+
+/* G726_sync(): returns sd */
+G726B_INLINE int g726b_sync (int rate, int i, int sp, int dlnx, int dsx, int law) {
+  int id, im, ss, mask, up, dn, lo = (dlnx < 2048);
+
+  if (rate == 4) {
+    im = ((i >> 3) == 0) ? (i + 8) : (i & 7);
+    id = lo ? 9 + (dlnx >= 80) + (dlnx >= 178) + (dlnx >= 246) + (dlnx >= 300) + (dlnx >= 349) + (dlnx >= 400) : 7 + 2 * (dlnx >= 3972);
+    id = dsx ? 15 - id : id;
+    id = (id == 8) ? 7 : id;
+  } else if (rate == 3) {
+    im = ((i >> 2) == 0) ? (i + 4) : (i & 3);
+    id = (lo & (dlnx >= 8)) ? 5 + (dlnx >= 218) + (dlnx >= 331) : 3;
+    id = dsx ? 7 - id : id;
+    id = (id == 4) ? 3 : id;
+  } else if (rate == 2) {
+    im = ((i >> 1) == 0) ? (i + 2) : (i & 1);
+    id = 2 + (lo & (dlnx >= 261));
+    id = dsx ? 3 - id : id;
+  } else {
+    im = ((i >> 4) == 0) ? (i + 16) : (i & 15);
+    id = lo ? 18 + (dlnx >= 68) + (dlnx >= 139) + (dlnx >= 198) + (dlnx >= 250) + (dlnx >= 298) + (dlnx >= 339) + (dlnx >= 378) + (dlnx >= 413) + (dlnx >= 445) + (dlnx >= 475) + (dlnx >= 502) + (dlnx >= 528) + (dlnx >= 553) : 15 + 2 * (dlnx >= 3974) + (dlnx >= 4080);
+    id = dsx ? 31 - id : id;
+    id = (id == 16) ? 15 : id;
+  }
+
+  /* Choose sd as sp, sp+ or sp-: at most one of the cases of g726.c
+     applies, so that their steps can be added */
+  ss = (sp & 128) >> 7;
+  mask = (sp & 127);
+  up = (id > im);
+  dn = (id < im);
+  if (law == '1') {
+    id = -(up & (ss == 1) & (mask != 0)) + (up & (ss == 0) & (mask != 127)) + (dn & (ss == 1) & (mask != 127)) - (dn & (ss == 0) & (mask != 0));
+    ss ^= (up & (ss == 1) & (mask == 0)) | (dn & (ss == 0) & (mask == 0));
+  } else {
+    id = (up & (ss == 1) & (mask != 127)) - (up & (ss == 1) & (mask == 127)) - (up & (ss == 0) & (mask != 0)) - (dn & (ss == 1) & (mask != 0)) + (dn & (ss == 0) & (mask != 127));
+    ss ^= (up & (ss == 1) & (mask == 127)) | (dn & (ss == 0) & (mask == 127));
+  }
+  return mask + id + (ss << 7);
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void g726b_lane (G726_batch *b, long c, short *inp, short *out,
+        ~~~~~~~~~~~~~~~  int law, int rate, int enc);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        One sample time of channel `c': inp[c] is the A or mu law sample
+        (enc != 0) or the ADPCM code (enc == 0), and the ADPCM code or
+        the A or mu law sample is saved in out[c]. The steps are those of
+        G726_encode()/G726_decode() after the delays with r = 0 (a reset
+        is done by G726_batch_reset()).
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+G726B_INLINE void g726b_lane (G726_batch * b, long c, const short *inp, short *out, int law, int rate, int enc) {
+  int sr2, sr1, a1, a2, dq1, dq2, dq3, dq4, dq5, dq6, b1, b2, b3, b4, b5, b6;
+  int se, sez, sezl, dms, dml, ap, y, yl, yup, i, im, dq, fi;
+  int td, tr, pk0, pk1, pk2, sigpk, sr, a2p, tdp, sp, d, x;
+
+  /* 4.2.6, `known-state' part: delays and signal estimate */
+  sr2 = b->sr1[c];
+  b->sr1[c] = sr1 = b->sr0[c];
+  a2 = b->a2r[c];
+  a1 = b->a1r[c];
+  dq6 = b->dq5[c];
+  b->dq5[c] = dq5 = b->dq4[c];
+  b->dq4[c] = dq4 = b->dq3[c];
+  b->dq3[c] = dq3 = b->dq2[c];
+  b->dq2[c] = dq2 = b->dq1[c];
+  b->dq1[c] = dq1 = b->dq0[c];
+  b1 = b->b1r[c];
+  b2 = b->b2r[c];
+  b3 = b->b3r[c];
+  b4 = b->b4r[c];
+  b5 = b->b5r[c];
+  b6 = b->b6r[c];
+  sezl = (g726b_fmult (b1, dq1) + g726b_fmult (b2, dq2) + g726b_fmult (b3, dq3) + g726b_fmult (b4, dq4) + g726b_fmult (b5, dq5) + g726b_fmult (b6, dq6)) & 65535;
+  se = ((sezl + g726b_fmult (a2, sr2) + g726b_fmult (a1, sr1)) & 65535) >> 1;
+  sez = sezl >> 1;
+
+  /* 4.2.5 and 4.2.4, `known-state' parts */
+  dms = b->dmsp[c];
+  dml = b->dmlp[c];
+  ap = b->apr[c];
+  yl = b->ylp[c];
+  y = g726b_mix ((ap >= 256) ? 64 : (ap >> 2), b->yup[c], yl);
+
+  /* 4.2.1 and 4.2.2 (encoder) or input code (decoder) */
+  if (enc) {
+    x = (law == '1') ? inp[c] ^ 85 : inp[c];
+    d = g726b_subta (g726b_expand (x, law), se);
+    i = g726b_quan (rate, g726b_logsub (d, y), d < 0);
+    out[c] = (short) i;
+  } else
+    i = inp[c];
+
+  /* 4.2.3 */
+  dq = g726b_antilog (g726b_dqln (rate, i), y, i >> (rate - 1));
+
+  /* 4.2.5 and 4.2.4, remaining parts */
+  im = ((i >> (rate - 1)) == 0) ? (i & ((1 << (rate - 1)) - 1)) : (((1 << rate) - 1 - i) & ((1 << (rate - 1)) - 1));
+  fi = g726b_fi (rate, im);
+  b->dmsp[c] = g726b_filta (fi, dms);
+  b->dmlp[c] = g726b_filtb (fi, dml);
+  b->yup[c] = yup = g726b_yup (g726b_wi (rate, im), y);
+  b->ylp[c] = g726b_filte (yup, yl);
+
+  /* 4.2.7, `known-state' part */
+  td = b->tdr[c];
+  tr = g726b_trans (td, yl, dq);
+
+  /* 4.2.6: pk's, sr0 and dq0 */
+  pk2 = b->pk1[c];
+  b->pk1[c] = pk1 = b->pk0[c];
+  x = g726b_add (dq, sez);
+  b->pk0[c] = pk0 = x >> 15;
+  sigpk = (x == 0) ? 1 : 0;
+  x = g726b_add (dq, se);
+  sr = (short) x;
+  b->sr0[c] = g726b_float (x >> 15, ((x >> 15) == 0) ? x : ((65536 - x) & 32767));
+  b->dq0[c] = g726b_float ((dq >> 15) & 1, dq & 32767);
+
+  /* 4.2.8 (decoder) */
+  if (!enc) {
+    sp = g726b_compress (sr, law);
+    d = g726b_subta (g726b_expand (sp, law), se);
+    x = g726b_sync (rate, i, sp, g726b_logsub (d, y), d < 0, law);
+    out[c] = (short) ((law == '1') ? x ^ 85 : x);
+  }
+
+  /* 4.2.6 and 4.2.7: predictor update, tone detector, speed control */
+  a2p = g726b_a2p (pk0, pk1, pk2, a2, a1, sigpk);
+  b->a2r[c] = g726b_trigb (tr, a2p);
+  b->a1r[c] = g726b_trigb (tr, g726b_a1p (pk0, pk1, a1, sigpk, a2p));
+  tdp = ((a2p & 65535) >= 32768) & ((a2p & 65535) < 53760);
+  b->tdr[c] = g726b_trigb (tr, tdp);
+  b->apr[c] = g726b_apr (b->dmsp[c], b->dmlp[c], tdp, y, ap, tr);
+  b->b1r[c] = g726b_upb (rate, dq1, b1, dq, tr);
+  b->b2r[c] = g726b_upb (rate, dq2, b2, dq, tr);
+  b->b3r[c] = g726b_upb (rate, dq3, b3, dq, tr);
+  b->b4r[c] = g726b_upb (rate, dq4, b4, dq, tr);
+  b->b5r[c] = g726b_upb (rate, dq5, b5, dq, tr);
+  b->b6r[c] = g726b_upb (rate, dq6, b6, dq, tr);
+}
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void g726b_run (G726_batch *b, short *inp_buf, short *out_buf,
+        ~~~~~~~~~~~~~~  long smpno, int law, int rate, int enc);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        All samples of all channels, for constant `law', `rate' and
+        `enc': the loop over the channels has no dependencies between
+        iterations (each channel has its own entry in each array of the
+        state), which is told to the compiler for vectorization.
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+G726B_INLINE void g726b_run (G726_batch * b, short *inp_buf, short *out_buf, long smpno, int law, int rate, int enc) {
+  G726_batch v = *b;            /* array pointers, kept in registers */
+  long j, c, nch = b->nch;
+
+  for (j = 0; j < smpno; j++, inp_buf += nch, out_buf += nch) {
+#if defined(__clang__)
+#pragma clang loop vectorize(assume_safety)
+#elif defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+    for (c = 0; c < nch; c++)
+      g726b_lane (&v, c, inp_buf, out_buf, law, rate, enc);
+  }
+}
+
+/* One instance of g726b_run() per law and rate */
+#define G726B_RUN(law, enc) \
+  switch (rate) { \
+  case 2: g726b_run (b, inp_buf, out_buf, smpno, law, 2, enc); break; \
+  case 3: g726b_run (b, inp_buf, out_buf, smpno, law, 3, enc); break; \
+  case 4: g726b_run (b, inp_buf, out_buf, smpno, law, 4, enc); break; \
+  default: g726b_run (b, inp_buf, out_buf, smpno, law, 5, enc); break; \
+  }
+
+
+/*
+ *  .................. FUNCTIONS ..................
+ */
+
+/*
+  ----------------------------------------------------------------------------
+
+        G726_batch *G726_batch_create (long nch);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Allocate the state of `nch' independent G.726 channels, all of
+        them in the reset state.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        Pointer to the state, or NULL if nch < 1 or there is not enough
+        memory.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+G726_batch *G726_batch_create (long nch) {
+  G726_batch *b;
+  int *mem;
+
+  if (nch < 1)
+    return NULL;
+  if ((b = (G726_batch *) calloc (1, sizeof (G726_batch))) == NULL)
+    return NULL;
+  if ((mem = (int *) calloc (G726B_NVAR * nch, sizeof (int))) == NULL) {
+    free (b);
+    return NULL;
+  }
+
+  b->nch = nch;
+  b->sr0 = mem;
+  b->sr1 = b->sr0 + nch;
+  b->a1r = b->sr1 + nch;
+  b->a2r = b->a1r + nch;
+  b->b1r = b->a2r + nch;
+  b->b2r = b->b1r + nch;
+  b->b3r = b->b2r + nch;
+  b->b4r = b->b3r + nch;
+  b->b5r = b->b4r + nch;
+  b->b6r = b->b5r + nch;
+  b->dq5 = b->b6r + nch;
+  b->dq4 = b->dq5 + nch;
+  b->dq3 = b->dq4 + nch;
+  b->dq2 = b->dq3 + nch;
+  b->dq1 = b->dq2 + nch;
+  b->dq0 = b->dq1 + nch;
+  b->dmsp = b->dq0 + nch;
+  b->dmlp = b->dmsp + nch;
+  b->apr = b->dmlp + nch;
+  b->yup = b->apr + nch;
+  b->tdr = b->yup + nch;
+  b->pk0 = b->tdr + nch;
+  b->pk1 = b->pk0 + nch;
+  b->ylp = b->pk1 + nch;
+
+  G726_batch_reset (b);
+  return b;
+}
+
+/* ..................... end of G726_batch_create() ..................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_free (G726_batch *b);
+        ~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Release the state allocated by G726_batch_create().
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_free (G726_batch * b) {
+  if (b == NULL)
+    return;
+  free (b->sr0);
+  free (b);
+}
+
+/* ...................... end of G726_batch_free() ...................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_reset (G726_batch *b);
+        ~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Reset all channels, with the values of the delays of
+        G726_encode() and G726_decode() for r == 1.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_reset (G726_batch * b) {
+  long c;
+
+  for (c = 0; c < b->nch; c++) {
+    b->sr0[c] = b->sr1[c] = 32;
+    b->dq5[c] = b->dq4[c] = b->dq3[c] = b->dq2[c] = b->dq1[c] = b->dq0[c] = 32;
+    b->a1r[c] = b->a2r[c] = 0;
+    b->b1r[c] = b->b2r[c] = b->b3r[c] = b->b4r[c] = b->b5r[c] = b->b6r[c] = 0;
+    b->dmsp[c] = b->dmlp[c] = b->apr[c] = b->tdr[c] = 0;
+    b->pk0[c] = b->pk1[c] = 0;
+    b->yup[c] = 544;
+    b->ylp[c] = 34816;
+  }
+}
+
+/* ..................... end of G726_batch_reset() ...................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_get (G726_batch *b, long ch, G726_state *state);
+        ~~~~~~~~~~~~~~~~~~~
+        void G726_batch_set (G726_batch *b, long ch, G726_state *state);
+        ~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Copy the state of channel `ch' (0..nch-1) of the batch to
+        `state', or from `state' to the channel, e.g. to continue with
+        G726_encode()/G726_decode() a channel started in a batch, or the
+        other way round.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_get (G726_batch * b, long ch, G726_state * state) {
+  state->sr0 = (short) b->sr0[ch];
+  state->sr1 = (short) b->sr1[ch];
+  state->a1r = (short) b->a1r[ch];
+  state->a2r = (short) b->a2r[ch];
+  state->b1r = (short) b->b1r[ch];
+  state->b2r = (short) b->b2r[ch];
+  state->b3r = (short) b->b3r[ch];
+  state->b4r = (short) b->b4r[ch];
+  state->b5r = (short) b->b5r[ch];
+  state->b6r = (short) b->b6r[ch];
+  state->dq5 = (short) b->dq5[ch];
+  state->dq4 = (short) b->dq4[ch];
+  state->dq3 = (short) b->dq3[ch];
+  state->dq2 = (short) b->dq2[ch];
+  state->dq1 = (short) b->dq1[ch];
+  state->dq0 = (short) b->dq0[ch];
+  state->dmsp = (short) b->dmsp[ch];
+  state->dmlp = (short) b->dmlp[ch];
+  state->apr = (short) b->apr[ch];
+  state->yup = (short) b->yup[ch];
+  state->tdr = (short) b->tdr[ch];
+  state->pk0 = (short) b->pk0[ch];
+  state->pk1 = (short) b->pk1[ch];
+  state->ylp = b->ylp[ch];
+}
+
+void G726_batch_set (G726_batch * b, long ch, G726_state * state) {
+  b->sr0[ch] = state->sr0;
+  b->sr1[ch] = state->sr1;
+  b->a1r[ch] = state->a1r;
+  b->a2r[ch] = state->a2r;
+  b->b1r[ch] = state->b1r;
+  b->b2r[ch] = state->b2r;
+  b->b3r[ch] = state->b3r;
+  b->b4r[ch] = state->b4r;
+  b->b5r[ch] = state->b5r;
+  b->b6r[ch] = state->b6r;
+  b->dq5[ch] = state->dq5;
+  b->dq4[ch] = state->dq4;
+  b->dq3[ch] = state->dq3;
+  b->dq2[ch] = state->dq2;
+  b->dq1[ch] = state->dq1;
+  b->dq0[ch] = state->dq0;
+  b->dmsp[ch] = state->dmsp;
+  b->dmlp[ch] = state->dmlp;
+  b->apr[ch] = state->apr;
+  b->yup[ch] = state->yup;
+  b->tdr[ch] = state->tdr;
+  b->pk0[ch] = state->pk0;
+  b->pk1[ch] = state->pk1;
+  b->ylp[ch] = (int) state->ylp;
+}
+
+/* ............... end of G726_batch_get()/G726_batch_set() ............... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_encode (short *inp_buf, short *out_buf,
+        ~~~~~~~~~~~~~~~~~~~~~~  long smpno, char *law, short rate,
+                                short r, G726_batch *b);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        G.726 encoder for all the channels of `b'. Takes `smpno' samples
+        per channel of A or mu law from `inp_buf', interleaved by channel
+        (sample j of channel c in inp_buf[j*nch+c]), and saves the ADPCM
+        codes in `out_buf', with the same layout. For each channel, the
+        output is the same as that of G726_encode() with the same `law',
+        `rate' (2..5 bits) and `r'; unlike G726_encode(), `inp_buf' is
+        not changed for A law.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_encode (short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch * b) {
+  if (r)
+    G726_batch_reset (b);
+  if (*law == '1')
+    G726B_RUN ('1', 1)
+  else
+    G726B_RUN ('0', 1)
+}
+
+/* ..................... end of G726_batch_encode() ..................... */
+
+
+/*
+  ----------------------------------------------------------------------------
+
+        void G726_batch_decode (short *inp_buf, short *out_buf,
+        ~~~~~~~~~~~~~~~~~~~~~~  long smpno, char *law, short rate,
+                                short r, G726_batch *b);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        G.726 decoder for all the channels of `b'. Takes `smpno' ADPCM
+        codes per channel from `inp_buf', interleaved by channel, and
+        saves the A or mu law samples in `out_buf', with the same layout.
+        For each channel, the output is the same as that of
+        G726_decode() with the same `law', `rate' and `r'.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        Prototype:      in file g726.h
+        ~~~~~~~~~~
+
+        History:
+        ~~~~~~~~
+        17.Oct.26 v1.0 Created.
+
+ ----------------------------------------------------------------------------
+*/
+void G726_batch_decode (short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch * b) {
+  if (r)
+    G726_batch_reset (b);
+  if (*law == '1')
+    G726B_RUN ('1', 0)
+  else
+    G726B_RUN ('0', 0)
+}
+
+/* ..................... end of G726_batch_decode() ..................... */
+
+/* ************************* END OF G726-BATCH.C ************************* */
@@ -0,0 +1,233 @@
+/*                                                         17/Oct/2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Check and benchmark of the multi-channel G.726 functions of
+	g726-batch.c against G726_encode()/G726_decode(). A number of
+	independent channels of pseudo-random A or mu law samples (bursts of
+	random levels, so that the quantizer and the predictors visit most
+	of their states) are encoded and decoded, in blocks, once channel by
+	channel with the functions of g726.c and once all together with the
+	batch functions; random ADPCM codes are also decoded, to exercise the
+	synchronous coding adjustment. For each law and rate, the CPU time of
+	both paths and the number of differing samples are reported; the
+	program exits with an error if there is any difference.
+
+  HISTORY :
+	17.Oct.26 v1.0 First version
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UGST modules */
+#include "ugstdemo.h"
+
+#include "g726.h"
+
+static void display_usage () {
+  printf ("G726-BENCH.C - Version 1.0 of 17.Oct.2026 \n\n");
+
+  printf (" Check and benchmark of the multi-channel G.726 functions\n");
+  printf ("\n");
+  printf (" Usage:\n");
+  printf (" $ g726-bench [-options]\n");
+  printf ("\n");
+  printf (" Options:\n");
+  printf ("  -n L ........ number of samples per channel (default: 8000)\n");
+  printf ("  -ch C ....... number of channels (default: 16)\n");
+  printf ("  -blk B ...... block size, in samples per channel (default: 160)\n");
+  printf ("  -rate R ..... only this rate, in bits (2..5) or kbit/s (default: all)\n");
+  printf ("\n");
+}
+
+
+/* simple deterministic pseudo-random generator, uniform in [0,32768) */
+static long bench_rand (unsigned long *seed) {
+  *seed = (*seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+  return (long) (*seed >> 16);
+}
+
+
+int main (int argc, char *argv[]) {
+  long L = 8000;                /* samples per channel */
+  long nch = 16;                /* number of channels */
+  long blk = 160;               /* block size */
+  int rate_only = 0;
+  long i, j, k, c, count, ndiff;
+  unsigned long seed;
+  short *pcm, *adpcm, *codes, *out1, *out2, *out3, *ch_in, *ch_out;
+  G726_state *state;
+  G726_batch *benc, *bdec;
+  char law[2] = "0";
+  int ilaw, rate;
+  clock_t t1;
+  double tRef, tBatch;
+  int status = 0;
+
+  /* ......... GET PARAMETERS ......... */
+  while (argc > 1 && argv[1][0] == '-') {
+    if (strcmp (argv[1], "-n") == 0) {
+      L = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-ch") == 0) {
+      nch = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-blk") == 0) {
+      blk = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-rate") == 0) {
+      rate_only = atoi (argv[2]);
+      rate_only = (rate_only >= 16) ? rate_only / 8 : rate_only;
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+      exit (2);
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+      exit (-1);
+    }
+  }
+  if (L < 1 || nch < 1 || blk < 1 || (rate_only != 0 && (rate_only < 2 || rate_only > 5))) {
+    fprintf (stderr, "ERROR! Invalid parameters\n\n");
+    display_usage ();
+    exit (-1);
+  }
+
+  /* channel-interleaved buffers, and one channel for g726.c */
+  pcm = (short *) malloc (L * nch * sizeof (short));
+  adpcm = (short *) malloc (L * nch * sizeof (short));
+  codes = (short *) malloc (L * nch * sizeof (short));
+  out1 = (short *) malloc (L * nch * sizeof (short));
+  out2 = (short *) malloc (L * nch * sizeof (short));
+  out3 = (short *) malloc (L * nch * sizeof (short));
+  ch_in = (short *) malloc (L * sizeof (short));
+  ch_out = (short *) malloc (L * sizeof (short));
+  state = (G726_state *) malloc (nch * sizeof (G726_state));
+  benc = G726_batch_create (nch);
+  bdec = G726_batch_create (nch);
+  if (pcm == NULL || adpcm == NULL || codes == NULL || out1 == NULL || out2 == NULL || out3 == NULL || ch_in == NULL || ch_out == NULL || state == NULL || benc == NULL || bdec == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+
+  printf ("%4s %5s %12s %12s %9s %8s\n", "law", "rate", "g726.c [s]", "batch [s]", "speed-up", "ndiff");
+
+  for (ilaw = 0; ilaw < 2; ilaw++) {
+    law[0] = ilaw ? '1' : '0';
+    for (rate = 2; rate <= 5; rate++) {
+      if (rate_only && rate != rate_only)
+        continue;
+
+      /* log samples: bursts of random magnitude ranges, random signs */
+      seed = 1 + 2 * rate + ilaw;
+      for (c = 0; c < nch; c++) {
+        long mmax = 1;
+        for (j = 0; j < L; j++) {
+          if (j % 97 == 0)
+            mmax = 1 + bench_rand (&seed) % 128;
+          k = bench_rand (&seed);
+          pcm[j * nch + c] = (short) (((k & 1) ? 128 : 0) + 127 - (k >> 1) % mmax);
+          codes[j * nch + c] = (short) (bench_rand (&seed) & ((1 << rate) - 1));
+        }
+      }
+
+      /* ... channel by channel, with g726.c */
+      t1 = clock ();
+      for (c = 0; c < nch; c++) {
+        for (j = 0; j < L; j++)
+          ch_in[j] = pcm[j * nch + c];
+        for (j = 0; j < L; j += count) {
+          count = (L - j < blk) ? L - j : blk;
+          G726_encode (ch_in + j, ch_out + j, count, law, (short) rate, (short) (j == 0), &state[c]);
+        }
+        for (j = 0; j < L; j++)
+          adpcm[j * nch + c] = ch_out[j];
+        for (j = 0; j < L; j += count) {
+          count = (L - j < blk) ? L - j : blk;
+          G726_decode (ch_out + j, ch_in + j, count, law, (short) rate, (short) (j == 0), &state[c]);
+        }
+        for (j = 0; j < L; j++)
+          out1[j * nch + c] = ch_in[j];
+        for (j = 0; j < L; j++)
+          ch_in[j] = codes[j * nch + c];
+        for (j = 0; j < L; j += count) {
+          count = (L - j < blk) ? L - j : blk;
+          G726_decode (ch_in + j, ch_out + j, count, law, (short) rate, (short) (j == 0), &state[c]);
+        }
+        for (j = 0; j < L; j++)
+          out3[j * nch + c] = ch_out[j];
+      }
+      tRef = (clock () - t1) / (double) CLOCKS_PER_SEC;
+
+      /* ... all channels at once */
+      t1 = clock ();
+      for (j = 0; j < L; j += count) {
+        count = (L - j < blk) ? L - j : blk;
+        G726_batch_encode (pcm + j * nch, out2 + j * nch, count, law, (short) rate, (short) (j == 0), benc);
+      }
+      ndiff = 0;
+      for (i = 0; i < L * nch; i++)
+        ndiff += (out2[i] != adpcm[i]);
+      for (j = 0; j < L; j += count) {
+        count = (L - j < blk) ? L - j : blk;
+        G726_batch_decode (out2 + j * nch, pcm + j * nch, count, law, (short) rate, (short) (j == 0), bdec);
+      }
+      for (i = 0; i < L * nch; i++)
+        ndiff += (pcm[i] != out1[i]);
+      for (j = 0; j < L; j += count) {
+        count = (L - j < blk) ? L - j : blk;
+        G726_batch_decode (codes + j * nch, out2 + j * nch, count, law, (short) rate, (short) (j == 0), bdec);
+      }
+      tBatch = (clock () - t1) / (double) CLOCKS_PER_SEC;
+      for (i = 0; i < L * nch; i++)
+        ndiff += (out2[i] != out3[i]);
+
+      printf ("%4s %5d %12.3f %12.3f %9.1f %8ld\n", ilaw ? "A" : "u", 8 * rate, tRef, tBatch, (tBatch > 0) ? tRef / tBatch : 0.0, ndiff);
+      if (ndiff)
+        status = 1;
+    }
+  }
+
+  if (status) {
+    fprintf (stderr, "\nERROR: the batch functions differ from G726_encode()/G726_decode()\n");
+  }
+
+  G726_batch_free (benc);
+  G726_batch_free (bdec);
+  free (pcm);
+  free (adpcm);
+  free (codes);
+  free (out1);
+  free (out2);
+  free (out3);
+  free (ch_in);
+  free (ch_out);
+  free (state);
+  return status;
+}
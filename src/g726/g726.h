@@ -10,10 +10,11 @@
    History:
    28.Feb.92	v1.0	First version <simao@cpqd.br>
    06.May.94    v2.0    Smart prototypes that work with many compilers <simao>
+   17.Oct.26    v2.1    Added the multi-channel (batch) encoder and decoder
   ============================================================================
 */
 #ifndef G726_defined
-#define G726_defined 200
+#define G726_defined 210
 
 /* Smart function prototypes: for [ag]cc, VaxC, and [tb]cc */
 #if !defined(ARGS)
@@ -50,9 +51,33 @@ typedef struct {
   long ylp;                     /* Slow quantizer scale factor */
 } G726_state;
 
+/* State of a batch of G726 channels: one array of nch entries per
+   variable of G726_state (see g726-batch.c), all of them int so that
+   the channels are lanes of the same width */
+typedef struct {
+  long nch;                     /* Number of channels */
+  int *sr0, *sr1;
+  int *a1r, *a2r;
+  int *b1r, *b2r, *b3r, *b4r, *b5r, *b6r;
+  int *dq5, *dq4, *dq3, *dq2, *dq1, *dq0;
+  int *dmsp, *dmlp;
+  int *apr;
+  int *yup;
+  int *tdr;
+  int *pk0, *pk1;
+  int *ylp;
+} G726_batch;
+
 /* Function prototypes */
 void G726_encode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_state * state));
 void G726_decode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_state * state));
+G726_batch *G726_batch_create ARGS ((long nch));
+void G726_batch_free ARGS ((G726_batch * b));
+void G726_batch_reset ARGS ((G726_batch * b));
+void G726_batch_get ARGS ((G726_batch * b, long ch, G726_state * state));
+void G726_batch_set ARGS ((G726_batch * b, long ch, G726_state * state));
+void G726_batch_encode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch * b));
+void G726_batch_decode ARGS ((short *inp_buf, short *out_buf, long smpno, char *law, short rate, short r, G726_batch * b));
 void G726_expand ARGS ((short *s, char *law, short *sl));
 void G726_subta ARGS ((short *sl, short *se, short *d));
 void G726_log ARGS ((short *d, short *dl, short *ds));
@@ -1,4 +1,4 @@
-/*                                                           03.Feb.2010 v1.4
+/*                                                           17.Oct.2026 v1.5
   ============================================================================
 
   G726DEMO.C
@@ -53,6 +53,9 @@
 	      (reset ON).
   Options:
   -noreset    don't apply reset to the encoder/decoder
+  -batch n    process n copies of the input at once with the
+              multi-channel (batch) functions, check that all of them
+              give the same result, and save it
   -?/-help    print help message
 
 
@@ -98,6 +101,8 @@
   03/Feb/2010 v1.4 Modified maximum string length, removed implicit
                    casting of toupper(), and type of "rate" is int
                    (y.hiwasaki)
+  17/Oct/2026 v1.5 Added option -batch, to run the multi-channel
+                   functions G726_batch_encode()/G726_batch_decode()
 ============================================================================
 */
 
@@ -134,7 +139,7 @@
  -------------------------------------------------------------------------
 */
 void display_usage () {
-  printf ("G726DEMO - Version 1.4 of 03.Feb.2010 \n\n");
+  printf ("G726DEMO - Version 1.5 of 17.Oct.2026 \n\n");
 
   printf ("> Description:\n");
   printf ("   Demonstration program for UGST/ITU-T G.726 module. Takes the\n");
@@ -183,6 +188,9 @@ void display_usage () {
   printf ("             unknown state. It defaults to 1 (reset ON). \n");
   printf (" Options: \n");
   printf (" -noreset    don't apply reset to the encoder/decoder\n");
+  printf (" -batch n    process n copies of the input at once with the\n");
+  printf ("             multi-channel (batch) functions, check that all of\n");
+  printf ("             them give the same result, and save it\n");
   printf (" -? or -help print this help message\n\n");
 
   /* Quit program */
@@ -202,6 +210,9 @@ void display_usage () {
 */
 int main (int argc, char *argv[]) {
   G726_state encoder_state, decoder_state;
+  G726_batch *encoder_batch = NULL, *decoder_batch = NULL;
+  short *binp_buf = NULL, *bout_buf = NULL, *btmp_buf = NULL;
+  long nch = 0, i, j;
   long N = 256, N1 = 1, N2 = 0, cur_blk, smpno;
   short *tmp_buf, *inp_buf, *out_buf, reset = 1;
   short inp_type, out_type;
@@ -236,6 +247,15 @@ int main (int argc, char *argv[]) {
         /* Update argc/argv to next valid option/argument */
         argv++;
         argc--;
+      } else if (strcmp (argv[1], "-batch") == 0) {
+        /* Number of copies for the batch functions */
+        nch = atol (argv[2]);
+        if (nch < 1)
+          error_terminate ("Number of batch channels must be positive! Aborted...\n", 10);
+
+        /* Move argv over the option to the next argument */
+        argv += 2;
+        argc -= 2;
       } else if (strcmp (argv[1], "-q") == 0) {
         /* Don't print progress indicator */
         quiet = 1;
@@ -312,6 +332,16 @@ int main (int argc, char *argv[]) {
     error_terminate ("Error in memory allocation!\n", 1);
   if ((tmp_buf = (short *) calloc (N, sizeof (short))) == NULL)
     error_terminate ("Error in memory allocation!\n", 1);
+  if (nch > 0) {
+    if ((encoder_batch = G726_batch_create (nch)) == NULL || (decoder_batch = G726_batch_create (nch)) == NULL)
+      error_terminate ("Error in memory allocation!\n", 1);
+    if ((binp_buf = (short *) calloc (N * nch, sizeof (short))) == NULL)
+      error_terminate ("Error in memory allocation!\n", 1);
+    if ((bout_buf = (short *) calloc (N * nch, sizeof (short))) == NULL)
+      error_terminate ("Error in memory allocation!\n", 1);
+    if ((btmp_buf = (short *) calloc (N * nch, sizeof (short))) == NULL)
+      error_terminate ("Error in memory allocation!\n", 1);
+  }
 
 /*
  * ......... FILE PREPARATION .........
@@ -350,8 +380,31 @@ int main (int argc, char *argv[]) {
     /* Check if reset is needed */
     reset = (reset == 1 && cur_blk == 0) ? 1 : 0;
 
-    /* Carry out the desired operation */
-    if (inp_type == IS_LOG && out_type == IS_ADPCM) {
+    /* Carry out the desired operation, on nch copies of the block ... */
+    if (nch > 0) {
+      for (j = 0; j < smpno; j++)
+        for (i = 0; i < nch; i++)
+          binp_buf[j * nch + i] = inp_buf[j];
+
+      if (inp_type == IS_LOG && out_type == IS_ADPCM) {
+        G726_batch_encode (binp_buf, bout_buf, smpno, law, (short) rate, reset, encoder_batch);
+      } else if (inp_type == IS_ADPCM && out_type == IS_LOG) {
+        G726_batch_decode (binp_buf, bout_buf, smpno, law, (short) rate, reset, decoder_batch);
+      } else if (inp_type == IS_LOG && out_type == IS_LOG) {
+        G726_batch_encode (binp_buf, btmp_buf, smpno, law, (short) rate, reset, encoder_batch);
+        G726_batch_decode (btmp_buf, bout_buf, smpno, law, (short) rate, reset, decoder_batch);
+      }
+
+      for (j = 0; j < smpno; j++) {
+        out_buf[j] = bout_buf[j * nch];
+        for (i = 1; i < nch; i++)
+          if (bout_buf[j * nch + i] != out_buf[j])
+            error_terminate ("Batch channels differ! Aborted...\n", 11);
+      }
+    }
+
+    /* ... or on the block itself */
+    else if (inp_type == IS_LOG && out_type == IS_ADPCM) {
       G726_encode (inp_buf, out_buf, smpno, law, (short) rate, reset, &encoder_state);
     } else if (inp_type == IS_ADPCM && out_type == IS_LOG) {
       G726_decode (inp_buf, out_buf, smpno, law, (short) rate, reset, &decoder_state);
@@ -373,6 +426,16 @@ int main (int argc, char *argv[]) {
   fclose (Fi);
   fclose (Fo);
 
+  /* Release memory */
+  G726_batch_free (encoder_batch);
+  G726_batch_free (decoder_batch);
+  free (binp_buf);
+  free (bout_buf);
+  free (btmp_buf);
+  free (inp_buf);
+  free (out_buf);
+  free (tmp_buf);
+
   /* Exit with success for non-vms systems */
 #ifndef VMS
   return (0);
@@ -1,4 +1,4 @@
-/*                                                            02.Feb.2010 v1.1
+/*                                                            17.Oct.2026 v1.3
   ============================================================================
 
   IRSDEMO.C
@@ -21,11 +21,17 @@
   ofile: .. OUTPUT FILE with short data (binary files)
   lseg: ... number of samples per processing block
             (default is LSEG0=256)
+  or
+  $ IRSDEMO [-options] -batch ifile1 ofile1 ifile2 ofile2 ...
 
   Options:
   ~~~~~~~~
   -skip no ... skips saving to file the first `no' processed samples
   -lseg l .... defines as `l' the number of samples per processing block
+  -tdf2 ...... use transposed direct-form II 2nd order sections
+  -batch ..... filter all the input files of the command line in
+               lockstep (several files per SIMD instruction); the
+               outputs are the same as when filtering them one by one
 
   Compilation:
   ~~~~~~~~~~~
@@ -94,6 +100,8 @@
   ~~~~~~~~
   22.Sep.1994 v1.0 Created
   02.Feb.2010 v1.1 Modified maximum string length (y.hiwasaki)
+  17.Oct.2026 v1.2 Added options -tdf2 and -batch
+  17.Oct.2026 v1.3 Batch mode moved to cascade_iir_batch() (iir-batch.c)
 
   ============================================================================
 */
@@ -142,7 +150,7 @@
  ============================================================================
 */
 void display_usage () {
-  printf ("IRSDEMO.C - Version 1.1 of 02.Feb.2010 \n\n");
+  printf ("IRSDEMO.C - Version 1.3 of 17.Oct.2026 \n\n");
 
   printf (" Example program for testing the correct implementation of theIIR\n");
   printf (" IRS filtering without rate conversion using the IIR-IRS module.\n");
@@ -153,6 +161,8 @@ void display_usage () {
   printf ("  $ IRSDEMO ! ---> HELP text is printed to screen\n");
   printf ("  or\n");
   printf ("  $ IRSDEMO [-options] ifile ofile [lseg]\n");
+  printf ("  or\n");
+  printf ("  $ IRSDEMO [-options] -batch ifile1 ofile1 ifile2 ofile2 ...\n");
   printf ("  where:\n");
   printf ("  ifile: .. INPUT  FILE with short data (binary files)\n");
   printf ("  ofile: .. OUTPUT FILE with short data (binary files)\n");
@@ -163,6 +173,9 @@ void display_usage () {
   printf ("  ~~~~~~~~\n");
   printf ("  -skip no ... skip saving to file first `no' processed samples \n");
   printf ("  -lseg l .... set `l' as the no.of samples per processing block\n");
+  printf ("  -tdf2 ...... use transposed direct-form II sections\n");
+  printf ("  -batch ..... filter pairs of files ifile1 ofile1 ifile2 ofile2 ...\n");
+  printf ("               in lockstep (SIMD), same results as one by one\n");
 
   /* Quit program */
   exit (-128);
@@ -207,6 +220,8 @@ int main (int argc, char *argv[]) {
   long noverflows1 = 0;
   long nsam = 0;
   long skip = 0;
+  int form = CASCADE_IIR_DF1;
+  int batch = 0;
 
   /* ......... PRINT INFOS ......... */
 
@@ -240,6 +255,20 @@ int main (int argc, char *argv[]) {
         /* Update argc/argv to next valid option/argument */
         argv += 2;
         argc -= 2;
+      } else if (strcmp (argv[1], "-tdf2") == 0) {
+        /* Transposed direct-form II sections */
+        form = CASCADE_IIR_TDF2;
+
+        /* Update argc/argv to next valid option/argument */
+        argv++;
+        argc--;
+      } else if (strcmp (argv[1], "-batch") == 0) {
+        /* Filter several files in lockstep */
+        batch = 1;
+
+        /* Update argc/argv to next valid option/argument */
+        argv++;
+        argc--;
       } else if (strcmp (argv[1], "-?") == 0 || strcmp (argv[1], "-help") == 0) {
         /* Print help */
         display_usage ();
@@ -250,6 +279,15 @@ int main (int argc, char *argv[]) {
   }
 
 
+  /* ......... BATCH MODE: FILTER ALL FILES AND QUIT ......... */
+  if (batch) {
+    if (argc < 3 || (argc - 1) % 2 != 0 || (argc - 1) / 2 > CASCADE_IIR_BATCH_MAX)
+      error_terminate ("\n   -batch needs 1 to 64 pairs of input/output files\n", 1);
+    cascade_iir_batch ((int) (argc - 1) / 2, &argv[1], lseg, skip, form, iir_irs_8khz_init, (int) 1);
+    return 0;
+  }
+
+
   /* ......... GETTING PARAMETERS ......... */
 #ifdef VMS
   sprintf (&mrs[4], "%d", 2 * 256);     /* mrs definition for VMS */
@@ -277,6 +315,7 @@ int main (int argc, char *argv[]) {
 
   if ((typ1_ptr = iir_irs_8khz_init ()) == 0)
     error_terminate ("Filter 1: initialization failure iir_irs_8khz()", 1);
+  cascade_iir_select_form (typ1_ptr, form);
 
 
 /*
@@ -0,0 +1,158 @@
+/*                                                         v1.0 17.Oct.2026
+  =============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+MODULE:         IIR-BATCH.C, IIR FILTER MODULE,
+                Sub-unit with the filtering of several files in lockstep
+                by cascade-form IIR filters without rate conversion.
+
+DESCRIPTION:
+
+        This file contains the batch mode shared by the demo programs
+        of the cascade-form IIR filters (c712demo, cirsdemo). It reads
+        and writes 16-bit files, hence it needs ugst-utl.c besides
+        iir-lib.c.
+
+FUNCTIONS    : - cascade_iir_batch = filter pairs of files in lockstep
+
+HISTORY:
+
+    17.Oct.2026 v1.0 Created, from filter_batch() of c712demo.c and
+                     cirsdemo.c
+
+  =============================================================================
+*/
+
+/* General includes */
+#include <stdio.h>              /* UNIX Standard I/O Definitions */
+#include <stdlib.h>             /* General utility definitions */
+#include "ugstdemo.h"           /* error_terminate(), RB, WB, clock() */
+#include "ugst-utl.h"           /* conversion float <-> short */
+
+/* This module's prototypes */
+#include "iirflt.h"
+
+
+/*
+  ============================================================================
+
+        void cascade_iir_batch (int nch, char **files, long lseg,
+        ~~~~~~~~~~~~~~~~~~~~~~  long skip, int form,
+                                CASCADE_IIR *(*init) (void), int round);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Filter `nch' files (at most CASCADE_IIR_BATCH_MAX) in lockstep
+        by cascade_iir_kernel_multi(), with one filter per file created
+        by init() and set to the 2nd order section structure `form';
+        files[] holds the nch pairs of input and output file names. The
+        first `skip' samples of each output are not saved; the outputs
+        are converted to 16 bit with fl2sh_16bit() and `round'. Files
+        shorter than the longest one are padded with zeros, which are
+        not saved.
+
+        Return value:
+        ~~~~~~~~~~~~~
+        None.
+
+        History:
+        ~~~~~~~~
+        17.Oct.2026 v1.0 Created, from filter_batch() of c712demo.c and
+                         cirsdemo.c
+
+ ============================================================================
+*/
+void cascade_iir_batch (int nch, char **files, long lseg, long skip, int form, CASCADE_IIR * (*init) (void), int round) {
+  CASCADE_IIR *iir[CASCADE_IIR_BATCH_MAX];
+  FILE *inpfilptr[CASCADE_IIR_BATCH_MAX], *outfilptr[CASCADE_IIR_BATCH_MAX];
+  float *x[CASCADE_IIR_BATCH_MAX], *y[CASCADE_IIR_BATCH_MAX];
+  long nread[CASCADE_IIR_BATCH_MAX], nskip[CASCADE_IIR_BATCH_MAX];
+  short *sh_buff;
+  long noverflows = 0, nsam = 0, nmax, n;
+  clock_t t1, t2;
+  int l;
+
+  if (nch < 1 || nch > CASCADE_IIR_BATCH_MAX)
+    error_terminate ("\n   Invalid number of files in batch mode", 1);
+  if ((sh_buff = (short *) malloc (lseg * sizeof (short))) == NULL)
+    error_terminate ("\n   Not enough memory", 1);
+
+  for (l = 0; l < nch; l++) {
+    if ((inpfilptr[l] = fopen (files[2 * l], RB)) == NULL)
+      error_terminate ("\n   Error opening input file", 1);
+    if ((outfilptr[l] = fopen (files[2 * l + 1], WB)) == NULL)
+      error_terminate ("\n   Error opening output file", 1);
+    x[l] = (float *) malloc (lseg * sizeof (float));
+    y[l] = (float *) malloc (lseg * sizeof (float));
+    if (x[l] == NULL || y[l] == NULL)
+      error_terminate ("\n   Not enough memory", 1);
+    if ((iir[l] = init ()) == 0)
+      error_terminate ("Filter 1: initialization failure", 1);
+    cascade_iir_select_form (iir[l], form);
+    nskip[l] = skip;
+  }
+
+  /* measure CPU-time */
+  t1 = clock ();
+
+  do {
+    /* Read a segment of each file, padding the shorter ones with zeros */
+    for (nmax = 0, l = 0; l < nch; l++) {
+      nread[l] = fread (sh_buff, sizeof (short), lseg, inpfilptr[l]);
+      for (n = nread[l]; n < lseg; n++)
+        sh_buff[n] = 0;
+      sh2fl_16bit (lseg, sh_buff, x[l], 1);
+      if (nread[l] > nmax)
+        nmax = nread[l];
+    }
+
+    /* IIR filtering of all files in lockstep */
+    cascade_iir_kernel_multi (nmax, nch, x, iir, y);
+
+    /* Save as many samples as read from each file (rate is 1:1) */
+    for (l = 0; l < nch; l++) {
+      noverflows += fl2sh_16bit (nread[l], y[l], sh_buff, round);
+      if (nread[l] > nskip[l]) {
+        nsam += fwrite (&sh_buff[nskip[l]], sizeof (short), (nread[l] - nskip[l]), outfilptr[l]);
+        nskip[l] = 0;
+      } else
+        nskip[l] -= nread[l];
+    }
+  } while (nmax == lseg);
+
+  /* Print time statistics - Include file I/O! */
+  t2 = clock ();
+  printf ("\nDONE: %f sec CPU-time for %ld generated samples in %d files\n", (t2 - t1) / (double) CLOCKS_PER_SEC, nsam, nch);
+
+  /* Print overflow statistics */
+  if (noverflows == 0)
+    printf ("\t # NO overflows occurred\n");
+  else {
+    printf ("\t # Overflow in %ld samples\n", noverflows);
+  }
+
+  /* Release memory and close files */
+  for (l = 0; l < nch; l++) {
+    cascade_iir_free (iir[l]);
+    free (x[l]);
+    free (y[l]);
+    fclose (outfilptr[l]);
+    fclose (inpfilptr[l]);
+  }
+  free (sh_buff);
+}
+
+/* ...................... End of cascade_iir_batch() ...................... */
+
+
+/* *************************** End of IIR-BATCH.C *************************** */
@@ -1,4 +1,4 @@
-/*                                                           v3.1 - 22/Feb/1996
+/*                                                           v3.2 - 17/Oct/2026
   =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -48,6 +48,10 @@ FUNCTIONS    : - stdpcm_kernel(...)   =  parallel-form IIR filter (kernel)
 	       - cascade_iir_kernel(...) = cascade-form IIR filter (kernel)
 	       - cascade_iir_free(...) = deallocate cascade filter memory
 	       - cascade_iir_reset(...) = clear cascade state variables
+	       - cascade_iir_select_form(...) = select direct form I or
+	                                  transposed direct form II sections
+	       - cascade_iir_kernel_multi(...) = cascade-form IIR filter for
+	                                  several channels in lockstep (SIMD)
 	       - direct_iir_kernel(...) = direct-form IIR filter (kernel)
 	       - direct_iir_free(...) = deallocate direct filter memory
 	       - direct_iir_reset(...) = clear direct state variables
@@ -61,6 +65,10 @@ HISTORY:
     22.Feb.96 v3.1 Changed inclusion of stdlib.h to inconditional, as
                    suggested by Kirchherr (FI/DBP Telekom) to run under
 		   OpenVMS/AXP <simao@ctd.comsat.com>
+    17.Oct.26 v3.2 Added transposed direct-form II cascade sections and
+                   the multi-channel cascade kernel, which filters 4 (SSE2)
+                   or 8 (AVX) channels in lockstep, bit-exact with the
+                   single-channel kernel.
 
   =============================================================================
 */
@@ -72,10 +80,25 @@ HISTORY:
 
 #include <stdlib.h>             /* General utility definitions */
 #include <math.h>               /* RTL Math Function Declarations */
+#include <string.h>             /* memcmp() */
 
 /* Definitions for IIR filters */
 #include "iirflt.h"
 
+/* SIMD instruction sets for the multi-channel cascade kernel */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IIR_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(IIR_HAVE_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define IIR_HAVE_AVX
+#include <immintrin.h>
+#endif
+
+#define CASCADE_LANES_MAX   8   /* max. number of channels in lockstep */
+#define CASCADE_NBLOCKS_MAX 32  /* max. number of sections in lockstep */
+#define CASCADE_CHUNK       256 /* samples per channel per lockstep pass */
+
 
 
 /*
@@ -94,6 +117,20 @@ static long cascade_form_iir_down_kernel ARGS ((long lenx, float *x, float *y, l
 
 static long cascade_form_iir_up_kernel ARGS ((long lenx, float *x, float *y, long iup, long nblocks, double gain, float (*a)[2], float (*b)[2], float (*T)[4]));
 
+static long cascade_tdf2_iir_down_kernel ARGS ((long lenx, float *x, float *y, long *k0, long idown, long nblocks, double gain, float (*a)[2], float (*b)[2], float (*T)[4]));
+
+static long cascade_tdf2_iir_up_kernel ARGS ((long lenx, float *x, float *y, long iup, long nblocks, double gain, float (*a)[2], float (*b)[2], float (*T)[4]));
+
+static int cascade_lanes ARGS ((void));
+static int cascade_iir_compatible ARGS ((CASCADE_IIR ** iir_ptr, int nch));
+static long cascade_iir_lockstep ARGS ((long lseg, int nch, float **x_ptr, CASCADE_IIR ** iir_ptr, float **y_ptr));
+#ifdef IIR_HAVE_SSE2
+static void cascade_lanes_sse2 ARGS ((long nstep, float *xl, float *yl, long nblocks, double gain, float (*a)[2], float (*b)[2], float *T, int form));
+#endif
+#ifdef IIR_HAVE_AVX
+static void cascade_lanes_avx ARGS ((long nstep, float *xl, float *yl, long nblocks, double gain, float (*a)[2], float (*b)[2], float *T, int form));
+#endif
+
 CASCADE_IIR *cascade_iir_init ARGS ((long nblocks, float (*a)[2], float (*b)[2], double gain, long idown, char hswitch));
 
 
@@ -565,6 +602,48 @@ void cascade_iir_reset (CASCADE_IIR * iir_ptr) {
 /* .................... End of cascade_iir_reset() ...................... */
 
 
+/*
+  ============================================================================
+
+  void cascade_iir_select_form (CASCADE_IIR *iir_ptr, int form);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Select the structure of the 2nd order sections used by
+  cascade_iir_kernel(): CASCADE_IIR_DF1 (direct form I, the default
+  and the reference) or CASCADE_IIR_TDF2 (transposed direct form II,
+  which needs only 2 state variables per section). The transfer
+  function is the same, but the results are not bit-exact with the
+  reference. The state variables are cleared, so the form should be
+  selected before filtering the first sample.
+
+  Parameters:
+  ~~~~~~~~~~~
+  CASCADE_IIR *iir_ptr: ... pointer to struct CASCADE_IIR previously
+                            initialized by a call to one of the
+                            initialization routines.
+  int form: ............... CASCADE_IIR_DF1 or CASCADE_IIR_TDF2
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Nothing.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+void cascade_iir_select_form (CASCADE_IIR * iir_ptr, int form) {
+  iir_ptr->form = (form == CASCADE_IIR_TDF2) ? CASCADE_IIR_TDF2 : CASCADE_IIR_DF1;
+  cascade_iir_reset (iir_ptr);
+}
+
+/* ................. End of cascade_iir_select_form() .................. */
+
+
 /*
   ============================================================================
 
@@ -575,7 +654,8 @@ void cascade_iir_reset (CASCADE_IIR * iir_ptr) {
   ~~~~~~~~~~~~
 
   Basic cascade-form IIR filtering routine, for both up- and
-  down-sampling.
+  down-sampling, using the section structure selected by
+  cascade_iir_select_form().
 
   Parameters:
   ~~~~~~~~~~~
@@ -594,10 +674,18 @@ void cascade_iir_reset (CASCADE_IIR * iir_ptr) {
   History:
   ~~~~~~~~
   30.Oct.94 v1.0 Release of 1st version <simao@ctd.comsat.com>
+  17.Oct.26 v1.1 Dispatch to the transposed direct-form II kernels
 
  ============================================================================
 */
 long cascade_iir_kernel (long lseg, float *x_ptr, CASCADE_IIR * iir_ptr, float *y_ptr) {
+  if (iir_ptr->form == CASCADE_IIR_TDF2) {
+    if (iir_ptr->hswitch == 'U')
+      return cascade_tdf2_iir_up_kernel (lseg, x_ptr, y_ptr, iir_ptr->idown, iir_ptr->nblocks, iir_ptr->gain, iir_ptr->a, iir_ptr->b, iir_ptr->T);
+    else
+      return cascade_tdf2_iir_down_kernel (lseg, x_ptr, y_ptr, &(iir_ptr->k0), iir_ptr->idown, iir_ptr->nblocks, iir_ptr->gain, iir_ptr->a, iir_ptr->b, iir_ptr->T);
+  }
+
   if (iir_ptr->hswitch == 'U')
     return cascade_form_iir_up_kernel ( /* returns number of output samples */
                                         lseg,   /* In : input signal leng. */
@@ -783,6 +871,146 @@ static long cascade_form_iir_up_kernel (long lenx, float *x, float *y, long iup,
 /* ............... End of cascade_form_iir_up_kernel() ............... */
 
 
+/*
+  ============================================================================
+
+  long cascade_tdf2_iir_down_kernel(long lenx, float *x,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ float *y, long *k0,
+                                    long idown, long nblocks,
+                                    double gain, float (*a)[2],
+                                    float (*b)[2], float (*T)[4]);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Function for filtering a sequence of input samples by a
+  cascade-form IIR-filter with down-sampling, the 2nd order sections
+  being implemented in the transposed direct form II.
+
+  Parameters:
+  ~~~~~~~~~~~
+  lenx: ........ (In) length of input array x[]
+  x: ........... (In) array with input samples
+  y: ........... (Out) array with output samples
+  k0: .......... (In/Out) pointer to modulo counter
+  idown: ....... (In) down-sampling factor
+  nblocks: ..... (In) number of coeff. sets
+  gain: ........ (In) gain factor
+  a: ........... (In) numerator coefficients
+  b: ........... (In) denominator coefficients
+  T: ........... (In/Out) state variables; only T[][0] and T[][1] are used
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of samples filtered.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long cascade_tdf2_iir_down_kernel (long lenx, float *x, float *y, long *k0, long idown, long nblocks, double gain, float (*a)[2], float (*b)[2], float (*T)[4]) {
+  long kx, ky, n;
+  double xj, yj;
+
+
+  ky = 0;                       /* starting index in output array (y) */
+  for (kx = 0; kx < lenx; kx++) {       /* loop over all input samples */
+    xj = x[kx];                 /* direct path */
+    for (n = 0; n < nblocks; n++) {     /* loop over all second order filter */
+      yj = xj + T[n][0];
+      T[n][0] = T[n][1] + a[n][0] * xj - b[n][0] * yj;
+      T[n][1] = a[n][1] * xj - b[n][1] * yj;
+
+      /* The yj of this stage is the xj of the next */
+      xj = yj;
+    }
+
+    if (*k0 % idown == 0) {     /* compute output only every "idown" * samples */
+      /* Apply gain and update y-samples' counter */
+      y[ky] = yj * gain;
+      ky++;
+    }
+    (*k0)++;
+  }
+  *k0 %= idown;                 /* avoid overflow by (*k0)++ */
+  return ky;
+}
+
+/* .............. End of cascade_tdf2_iir_down_kernel() .............. */
+
+
+/*
+  ============================================================================
+
+  long cascade_tdf2_iir_up_kernel(long lenx, float *x,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ float *y, long iup, long nblocks,
+                                  double gain, float (*a)[2],
+                                  float (*b)[2], float (*T)[4]);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Function for filtering a sequence of input samples by a
+  cascade-form IIR-filter with up-sampling, the 2nd order sections
+  being implemented in the transposed direct form II.
+
+  Parameters:
+  ~~~~~~~~~~~
+  lenx: ........ (In) length of input array x[]
+  x: ........... (In) array with input samples
+  y: ........... (Out) array with output samples
+  iup: ......... (In) up-sampling factor
+  nblocks: ..... (In) number of coeff. sets
+  gain: ........ (In) gain factor
+  a: ........... (In) numerator coefficients
+  b: ........... (In) denominator coefficients
+  T: ........... (In/Out) state variables; only T[][0] and T[][1] are used
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of samples filtered.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long cascade_tdf2_iir_up_kernel (long lenx, float *x, float *y, long iup, long nblocks, double gain, float (*a)[2], float (*b)[2], float (*T)[4]) {
+  long kx, ky, n;
+  double xj, yj;
+
+  kx = 0;                       /* starting index in input array (x) */
+  for (ky = 0; ky < iup * lenx; ky++) { /* loop over all input samples */
+    /* Take one input sample every "iup" samples, else a zero-valued one */
+    if (ky % iup == 0)
+      xj = x[kx];
+    else
+      xj = 0.;
+
+    /* Filter samples through all cascade stages */
+    for (n = 0; n < nblocks; n++) {
+      yj = xj + T[n][0];
+      T[n][0] = T[n][1] + a[n][0] * xj - b[n][0] * yj;
+      T[n][1] = a[n][1] * xj - b[n][1] * yj;
+
+      /* The yj of this stage is the xj of the next */
+      xj = yj;
+    }
+
+    /* Apply the gain and update x counter if needed */
+    y[ky] = yj * gain;
+    if (ky % iup == 0)
+      kx++;
+  }
+  return ky;
+}
+
+/* ............... End of cascade_tdf2_iir_up_kernel() ............... */
+
+
 /*
   ============================================================================
 
@@ -851,6 +1079,7 @@ CASCADE_IIR *cascade_iir_init (long nblocks, float (*a)[2], float (*b)[2], doubl
 
   /* Store switch to IIR-kernel procedure */
   ptrIIR->hswitch = hswitch;
+  ptrIIR->form = CASCADE_IIR_DF1;
 
   /* Clear state variables */
   T_ptr = ptrIIR->T;
@@ -910,6 +1139,422 @@ void cascade_iir_free (CASCADE_IIR * iir_ptr) {
 /* ....................... End of cascade_iir_free() ....................... */
 
 
+/*
+  ============================================================================
+
+  long cascade_iir_kernel_multi (long lseg, int nch, float **x_ptr,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  CASCADE_IIR **iir_ptr, float **y_ptr);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Cascade-form IIR filtering of `nch' independent channels (or
+  segments of a file) of `lseg' samples each, channel `i' being
+  filtered by iir_ptr[i] from x_ptr[i] into y_ptr[i]. Groups of 8
+  (AVX) or 4 (SSE2) consecutive channels with the same filter (same
+  coefficients, gain, rate change and section form) are filtered in
+  lockstep, one channel per SIMD lane; the results are bit-exact with
+  cascade_iir_kernel(), which is used for all other channels.
+
+  Parameters:
+  ~~~~~~~~~~~
+  lseg: ...... number of input samples per channel
+  nch: ....... number of channels
+  x_ptr: ..... array of nch pointers to the input samples
+  iir_ptr: ... array of nch pointers to IIR-structs (CASCADE_IIR *)
+  y_ptr: ..... array of nch pointers to the output samples
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of output samples of the last channel (the same
+  for all channels in the same phase of a down-sampling filter).
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+long cascade_iir_kernel_multi (long lseg, int nch, float **x_ptr, CASCADE_IIR ** iir_ptr, float **y_ptr) {
+  long ky = 0;
+  int ch, lanes;
+
+  for (ch = 0; ch < nch; ch += lanes) {
+    lanes = cascade_lanes ();
+    if (lanes == 8 && (nch - ch < 8 || !cascade_iir_compatible (iir_ptr + ch, 8)))
+      lanes = 4;
+    if (lanes == 4 && (nch - ch < 4 || !cascade_iir_compatible (iir_ptr + ch, 4)))
+      lanes = 1;
+
+    if (lanes > 1)
+      ky = cascade_iir_lockstep (lseg, lanes, x_ptr + ch, iir_ptr + ch, y_ptr + ch);
+    else
+      ky = cascade_iir_kernel (lseg, x_ptr[ch], iir_ptr[ch], y_ptr[ch]);
+  }
+  return ky;
+}
+
+/* ................. End of cascade_iir_kernel_multi() .................. */
+
+
+/*
+  ============================================================================
+
+  int cascade_lanes (void);
+  ~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Number of channels the processor can filter in lockstep: 8 with
+  AVX, 4 with SSE2, 1 (no lockstep) otherwise.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static int cascade_lanes () {
+#ifdef IIR_HAVE_AVX
+  if (__builtin_cpu_supports ("avx"))
+    return 8;
+#endif
+#ifdef IIR_HAVE_SSE2
+  return 4;
+#else
+  return 1;
+#endif
+}
+
+/* ...................... End of cascade_lanes() ....................... */
+
+
+/*
+  ============================================================================
+
+  int cascade_iir_compatible (CASCADE_IIR **iir_ptr, int nch);
+  ~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Check whether the `nch' filters can run in lockstep, i.e. have the
+  same sections (coefficients and form), gain and rate change, and
+  not more than CASCADE_NBLOCKS_MAX sections.
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns 1 if so, 0 otherwise.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static int cascade_iir_compatible (CASCADE_IIR ** iir_ptr, int nch) {
+  CASCADE_IIR *iir = iir_ptr[0];
+  int l;
+
+  if (iir->nblocks < 1 || iir->nblocks > CASCADE_NBLOCKS_MAX)
+    return 0;
+
+  for (l = 1; l < nch; l++) {
+    if (iir_ptr[l]->nblocks != iir->nblocks || iir_ptr[l]->idown != iir->idown || iir_ptr[l]->hswitch != iir->hswitch || iir_ptr[l]->form != iir->form || iir_ptr[l]->gain != iir->gain)
+      return 0;
+    if (memcmp (iir_ptr[l]->a, iir->a, iir->nblocks * sizeof (iir->a[0])) != 0 || memcmp (iir_ptr[l]->b, iir->b, iir->nblocks * sizeof (iir->b[0])) != 0)
+      return 0;
+  }
+  return 1;
+}
+
+/* .................. End of cascade_iir_compatible() .................. */
+
+
+/*
+  ============================================================================
+
+  long cascade_iir_lockstep (long lseg, int nch, float **x_ptr,
+  ~~~~~~~~~~~~~~~~~~~~~~~~~  CASCADE_IIR **iir_ptr, float **y_ptr);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Filter `nch' (4 or 8) compatible channels in lockstep. The input
+  samples (with the zero-valued samples of the up-sampling) and the
+  state variables are interleaved channel by channel, filtered by the
+  SIMD kernel CASCADE_CHUNK samples at a time, and the output samples
+  (every idown-th one when down-sampling) de-interleaved back into
+  the channels' output arrays.
+
+  Return value:
+  ~~~~~~~~~~~~~
+  Returns the number of output samples of the last channel.
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static long cascade_iir_lockstep (long lseg, int nch, float **x_ptr, CASCADE_IIR ** iir_ptr, float **y_ptr) {
+  float xl[CASCADE_CHUNK * CASCADE_LANES_MAX];  /* interleaved input */
+  float yl[CASCADE_CHUNK * CASCADE_LANES_MAX];  /* interleaved output */
+  float T[CASCADE_NBLOCKS_MAX * 4 * CASCADE_LANES_MAX]; /* interleaved state */
+  long ky[CASCADE_LANES_MAX];
+  CASCADE_IIR *iir = iir_ptr[0];
+  long iup, idown, nstep, cnt, k, i, n;
+  int j, l;
+
+  /* Up-sampling filters see iup-1 zero-valued samples after each input */
+  iup = (iir->hswitch == 'U') ? iir->idown : 1;
+  idown = (iir->hswitch == 'U') ? 1 : iir->idown;
+  nstep = lseg * iup;
+
+  /* Gather state variables: T[(n*4+j)*nch+l] is T[n][j] of channel l */
+  for (n = 0; n < iir->nblocks; n++)
+    for (j = 0; j < 4; j++)
+      for (l = 0; l < nch; l++)
+        T[(n * 4 + j) * nch + l] = iir_ptr[l]->T[n][j];
+  for (l = 0; l < nch; l++)
+    ky[l] = 0;
+
+  for (k = 0; k < nstep; k += cnt) {
+    cnt = (nstep - k < CASCADE_CHUNK) ? nstep - k : CASCADE_CHUNK;
+
+    /* Interleave input samples */
+    for (i = 0; i < cnt; i++)
+      for (l = 0; l < nch; l++)
+        xl[i * nch + l] = ((k + i) % iup == 0) ? x_ptr[l][(k + i) / iup] : 0;
+
+    /* Filter all channels in lockstep */
+#ifdef IIR_HAVE_AVX
+    if (nch == 8)
+      cascade_lanes_avx (cnt, xl, yl, iir->nblocks, iir->gain, iir->a, iir->b, T, iir->form);
+    else
+#endif
+#ifdef IIR_HAVE_SSE2
+      cascade_lanes_sse2 (cnt, xl, yl, iir->nblocks, iir->gain, iir->a, iir->b, T, iir->form);
+#endif
+
+    /* De-interleave output samples, only every "idown" samples */
+    for (l = 0; l < nch; l++)
+      for (i = 0; i < cnt; i++) {
+        if (iir->hswitch == 'U')
+          y_ptr[l][ky[l]++] = yl[i * nch + l];
+        else {
+          if (iir_ptr[l]->k0 % idown == 0)
+            y_ptr[l][ky[l]++] = yl[i * nch + l];
+          iir_ptr[l]->k0++;
+        }
+      }
+  }
+
+  /* Scatter state variables back */
+  for (n = 0; n < iir->nblocks; n++)
+    for (j = 0; j < 4; j++)
+      for (l = 0; l < nch; l++)
+        iir_ptr[l]->T[n][j] = T[(n * 4 + j) * nch + l];
+  if (iir->hswitch != 'U')
+    for (l = 0; l < nch; l++)
+      iir_ptr[l]->k0 %= idown;  /* avoid overflow by k0++ */
+
+  return ky[nch - 1];
+}
+
+/* ................... End of cascade_iir_lockstep() ................... */
+
+
+#ifdef IIR_HAVE_SSE2
+/*
+  ============================================================================
+
+  void cascade_lanes_sse2 (long nstep, float *xl, float *yl,
+  ~~~~~~~~~~~~~~~~~~~~~~~  long nblocks, double gain, float (*a)[2],
+                           float (*b)[2], float *T, int form);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  Filter 4 interleaved channels through the cascade of 2nd order
+  sections, one channel per lane. The arithmetic is the same as in the
+  scalar kernels: in direct form I, products of coefficients and state
+  variables in float, accumulation in double, state variables stored
+  as float; in transposed direct form II, all in double except the
+  stored state variables.
+
+  Parameters:
+  ~~~~~~~~~~~
+  nstep: ....... (In) number of samples per channel
+  xl: .......... (In) interleaved input samples, xl[4*k+l]
+  yl: .......... (Out) interleaved output samples, yl[4*k+l]
+  nblocks: ..... (In) number of coeff. sets
+  gain: ........ (In) gain factor
+  a: ........... (In) numerator coefficients
+  b: ........... (In) denominator coefficients
+  T: ........... (In/Out) interleaved state variables, T[(n*4+j)*4+l]
+  form: ........ (In) CASCADE_IIR_DF1 or CASCADE_IIR_TDF2
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+static void cascade_lanes_sse2 (long nstep, float *xl, float *yl, long nblocks, double gain, float (*a)[2], float (*b)[2], float *T, int form) {
+  __m128 t0, t1, t2, t3, p, q;
+  __m128d xlo, xhi, ylo, yhi, g;
+  float *Tn;
+  long k, n;
+
+  g = _mm_set1_pd (gain);
+  for (k = 0; k < nstep; k++) {
+    p = _mm_loadu_ps (xl + 4 * k);
+    xlo = _mm_cvtps_pd (p);
+    xhi = _mm_cvtps_pd (_mm_movehl_ps (p, p));
+    ylo = xlo;
+    yhi = xhi;
+
+    for (n = 0, Tn = T; n < nblocks; n++, Tn += 16) {
+      t0 = _mm_loadu_ps (Tn);
+      t1 = _mm_loadu_ps (Tn + 4);
+
+      if (form == CASCADE_IIR_TDF2) {
+        __m128d a0 = _mm_set1_pd (a[n][0]), a1 = _mm_set1_pd (a[n][1]);
+        __m128d b0 = _mm_set1_pd (b[n][0]), b1 = _mm_set1_pd (b[n][1]);
+        __m128d s0, s1;
+
+        /* yj = xj + T0; T0 = T1 + a0*xj - b0*yj; T1 = a1*xj - b1*yj */
+        ylo = _mm_add_pd (xlo, _mm_cvtps_pd (t0));
+        yhi = _mm_add_pd (xhi, _mm_cvtps_pd (_mm_movehl_ps (t0, t0)));
+        s0 = _mm_sub_pd (_mm_add_pd (_mm_cvtps_pd (t1), _mm_mul_pd (a0, xlo)), _mm_mul_pd (b0, ylo));
+        s1 = _mm_sub_pd (_mm_add_pd (_mm_cvtps_pd (_mm_movehl_ps (t1, t1)), _mm_mul_pd (a0, xhi)), _mm_mul_pd (b0, yhi));
+        _mm_storeu_ps (Tn, _mm_movelh_ps (_mm_cvtpd_ps (s0), _mm_cvtpd_ps (s1)));
+        s0 = _mm_sub_pd (_mm_mul_pd (a1, xlo), _mm_mul_pd (b1, ylo));
+        s1 = _mm_sub_pd (_mm_mul_pd (a1, xhi), _mm_mul_pd (b1, yhi));
+        _mm_storeu_ps (Tn + 4, _mm_movelh_ps (_mm_cvtpd_ps (s0), _mm_cvtpd_ps (s1)));
+      } else {
+        t2 = _mm_loadu_ps (Tn + 8);
+        t3 = _mm_loadu_ps (Tn + 12);
+
+        /* yj = xj + a0*T0 + a1*T1 - (b0*T2 + b1*T3) */
+        p = _mm_mul_ps (_mm_set1_ps (a[n][0]), t0);
+        q = _mm_mul_ps (_mm_set1_ps (a[n][1]), t1);
+        ylo = _mm_add_pd (_mm_add_pd (xlo, _mm_cvtps_pd (p)), _mm_cvtps_pd (q));
+        yhi = _mm_add_pd (_mm_add_pd (xhi, _mm_cvtps_pd (_mm_movehl_ps (p, p))), _mm_cvtps_pd (_mm_movehl_ps (q, q)));
+        p = _mm_add_ps (_mm_mul_ps (_mm_set1_ps (b[n][0]), t2), _mm_mul_ps (_mm_set1_ps (b[n][1]), t3));
+        ylo = _mm_sub_pd (ylo, _mm_cvtps_pd (p));
+        yhi = _mm_sub_pd (yhi, _mm_cvtps_pd (_mm_movehl_ps (p, p)));
+
+        /* Save samples in memory */
+        _mm_storeu_ps (Tn + 4, t0);
+        _mm_storeu_ps (Tn, _mm_movelh_ps (_mm_cvtpd_ps (xlo), _mm_cvtpd_ps (xhi)));
+        _mm_storeu_ps (Tn + 12, t2);
+        _mm_storeu_ps (Tn + 8, _mm_movelh_ps (_mm_cvtpd_ps (ylo), _mm_cvtpd_ps (yhi)));
+      }
+
+      /* The yj of this stage is the xj of the next */
+      xlo = ylo;
+      xhi = yhi;
+    }
+
+    /* Apply gain */
+    _mm_storeu_ps (yl + 4 * k, _mm_movelh_ps (_mm_cvtpd_ps (_mm_mul_pd (ylo, g)), _mm_cvtpd_ps (_mm_mul_pd (yhi, g))));
+  }
+}
+
+/* ..................... End of cascade_lanes_sse2() ..................... */
+#endif
+
+
+#ifdef IIR_HAVE_AVX
+/*
+  ============================================================================
+
+  void cascade_lanes_avx (long nstep, float *xl, float *yl,
+  ~~~~~~~~~~~~~~~~~~~~~~  long nblocks, double gain, float (*a)[2],
+                          float (*b)[2], float *T, int form);
+
+  Description:
+  ~~~~~~~~~~~~
+
+  As cascade_lanes_sse2(), for 8 interleaved channels with AVX
+  instructions (only called if the processor supports AVX).
+
+  History:
+  ~~~~~~~~
+  17.Oct.26 v1.0 Release of 1st version
+
+ ============================================================================
+*/
+__attribute__ ((target ("avx")))
+static void cascade_lanes_avx (long nstep, float *xl, float *yl, long nblocks, double gain, float (*a)[2], float (*b)[2], float *T, int form) {
+  __m256 t0, t1, t2, t3, p, q;
+  __m256d xlo, xhi, ylo, yhi, g;
+  float *Tn;
+  long k, n;
+
+  g = _mm256_set1_pd (gain);
+  for (k = 0; k < nstep; k++) {
+    p = _mm256_loadu_ps (xl + 8 * k);
+    xlo = _mm256_cvtps_pd (_mm256_castps256_ps128 (p));
+    xhi = _mm256_cvtps_pd (_mm256_extractf128_ps (p, 1));
+    ylo = xlo;
+    yhi = xhi;
+
+    for (n = 0, Tn = T; n < nblocks; n++, Tn += 32) {
+      t0 = _mm256_loadu_ps (Tn);
+      t1 = _mm256_loadu_ps (Tn + 8);
+
+      if (form == CASCADE_IIR_TDF2) {
+        __m256d a0 = _mm256_set1_pd (a[n][0]), a1 = _mm256_set1_pd (a[n][1]);
+        __m256d b0 = _mm256_set1_pd (b[n][0]), b1 = _mm256_set1_pd (b[n][1]);
+        __m256d s0, s1;
+
+        /* yj = xj + T0; T0 = T1 + a0*xj - b0*yj; T1 = a1*xj - b1*yj */
+        ylo = _mm256_add_pd (xlo, _mm256_cvtps_pd (_mm256_castps256_ps128 (t0)));
+        yhi = _mm256_add_pd (xhi, _mm256_cvtps_pd (_mm256_extractf128_ps (t0, 1)));
+        s0 = _mm256_sub_pd (_mm256_add_pd (_mm256_cvtps_pd (_mm256_castps256_ps128 (t1)), _mm256_mul_pd (a0, xlo)), _mm256_mul_pd (b0, ylo));
+        s1 = _mm256_sub_pd (_mm256_add_pd (_mm256_cvtps_pd (_mm256_extractf128_ps (t1, 1)), _mm256_mul_pd (a0, xhi)), _mm256_mul_pd (b0, yhi));
+        _mm256_storeu_ps (Tn, _mm256_insertf128_ps (_mm256_castps128_ps256 (_mm256_cvtpd_ps (s0)), _mm256_cvtpd_ps (s1), 1));
+        s0 = _mm256_sub_pd (_mm256_mul_pd (a1, xlo), _mm256_mul_pd (b1, ylo));
+        s1 = _mm256_sub_pd (_mm256_mul_pd (a1, xhi), _mm256_mul_pd (b1, yhi));
+        _mm256_storeu_ps (Tn + 8, _mm256_insertf128_ps (_mm256_castps128_ps256 (_mm256_cvtpd_ps (s0)), _mm256_cvtpd_ps (s1), 1));
+      } else {
+        t2 = _mm256_loadu_ps (Tn + 16);
+        t3 = _mm256_loadu_ps (Tn + 24);
+
+        /* yj = xj + a0*T0 + a1*T1 - (b0*T2 + b1*T3) */
+        p = _mm256_mul_ps (_mm256_set1_ps (a[n][0]), t0);
+        q = _mm256_mul_ps (_mm256_set1_ps (a[n][1]), t1);
+        ylo = _mm256_add_pd (_mm256_add_pd (xlo, _mm256_cvtps_pd (_mm256_castps256_ps128 (p))), _mm256_cvtps_pd (_mm256_castps256_ps128 (q)));
+        yhi = _mm256_add_pd (_mm256_add_pd (xhi, _mm256_cvtps_pd (_mm256_extractf128_ps (p, 1))), _mm256_cvtps_pd (_mm256_extractf128_ps (q, 1)));
+        p = _mm256_add_ps (_mm256_mul_ps (_mm256_set1_ps (b[n][0]), t2), _mm256_mul_ps (_mm256_set1_ps (b[n][1]), t3));
+        ylo = _mm256_sub_pd (ylo, _mm256_cvtps_pd (_mm256_castps256_ps128 (p)));
+        yhi = _mm256_sub_pd (yhi, _mm256_cvtps_pd (_mm256_extractf128_ps (p, 1)));
+
+        /* Save samples in memory */
+        _mm256_storeu_ps (Tn + 8, t0);
+        _mm256_storeu_ps (Tn, _mm256_insertf128_ps (_mm256_castps128_ps256 (_mm256_cvtpd_ps (xlo)), _mm256_cvtpd_ps (xhi), 1));
+        _mm256_storeu_ps (Tn + 24, t2);
+        _mm256_storeu_ps (Tn + 16, _mm256_insertf128_ps (_mm256_castps128_ps256 (_mm256_cvtpd_ps (ylo)), _mm256_cvtpd_ps (yhi), 1));
+      }
+
+      /* The yj of this stage is the xj of the next */
+      xlo = ylo;
+      xhi = yhi;
+    }
+
+    /* Apply gain */
+    _mm256_storeu_ps (yl + 8 * k, _mm256_insertf128_ps (_mm256_castps128_ps256 (_mm256_cvtpd_ps (_mm256_mul_pd (ylo, g))), _mm256_cvtpd_ps (_mm256_mul_pd (yhi, g)), 1));
+  }
+}
+
+/* ..................... End of cascade_lanes_avx() ..................... */
+#endif
+
+
 /* *********************************************************************** */
 
 /*
@@ -12,6 +12,9 @@
    30.Oct.94	v2.0	Name changed to iirflt.h/included cascade-form 
                         IIR filters <simao@ctd.comsat.com>
    31.Jul.95	v3.0	Added direct-form IIR filters <simao@ctd.comsat.com>
+   17.Oct.26	v3.1	Added transposed direct-form II cascade sections and
+                        multi-channel (SIMD) cascade-form filtering
+   17.Oct.26	v3.2	Added cascade_iir_batch() (iir-batch.c)
 
   ============================================================================
 */
@@ -58,8 +61,16 @@ typedef struct {
   float (*b)[2];                /* In : denominator coefficients */
   float (*T)[4];                /* In/Out : state variables, 1 for each stage */
   char hswitch;                 /* "U": upsampling; else downsampling */
+  char form;                    /* CASCADE_IIR_DF1 or CASCADE_IIR_TDF2 */
 } CASCADE_IIR;
 
+/* Structure of the 2nd order sections of a cascade-form IIR filter */
+#define CASCADE_IIR_DF1  0      /* direct form I, 4 state variables (default) */
+#define CASCADE_IIR_TDF2 1      /* transposed direct form II, 2 state variables */
+
+/* Max. number of files filtered in lockstep by cascade_iir_batch() */
+#define CASCADE_IIR_BATCH_MAX 64
+
 
 /*
  * ..... State variable structure for IIR filtering, direct form  .....
@@ -97,6 +108,8 @@ SCD_IIR *stdpcm_1_to_2_init ARGS ((void));
 long cascade_iir_kernel ARGS ((long lseg, float *x_ptr, CASCADE_IIR * iir_ptr, float *y_ptr));
 void cascade_iir_reset ARGS ((CASCADE_IIR * iir_ptr));
 void cascade_iir_free ARGS ((CASCADE_IIR * iir_ptr));
+void cascade_iir_select_form ARGS ((CASCADE_IIR * iir_ptr, int form));
+long cascade_iir_kernel_multi ARGS ((long lseg, int nch, float **x_ptr, CASCADE_IIR ** iir_ptr, float **y_ptr));
 
 /* Additions to the STL92: cascade IIR filter initialization */
 CASCADE_IIR *iir_G712_8khz_init ARGS ((void));
@@ -104,6 +117,9 @@ CASCADE_IIR *iir_irs_8khz_init ARGS ((void));
 CASCADE_IIR *iir_casc_lp_3_to_1_init ARGS ((void));
 CASCADE_IIR *iir_casc_lp_1_to_3_init ARGS ((void));
 
+/* Additions to the STL92: lockstep filtering of files (iir-batch.c, needs ugst-utl.c) */
+void cascade_iir_batch ARGS ((int nch, char **files, long lseg, long skip, int form, CASCADE_IIR * (*init) (void), int round));
+
 
 /* Additions to the STL92: direct IIR basic functions */
 long direct_iir_kernel ARGS ((long lseg, float *x_ptr, DIRECT_IIR * iir_ptr, float *y_ptr));
@@ -0,0 +1,252 @@
+/*                                                         17/Oct/2026 v1.0 */
+/*=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+  DESCRIPTION :
+	Benchmark of the direct convolution conv() against the partitioned FFT
+	convolution conv_fft() of reverb-lib.c, for a set of impulse response
+	lengths. A synthetic exponentially decaying noise impulse response and a
+	pseudo-random input signal are used, processed block-wise exactly as in
+	reverb.c. For each length, the CPU time of both paths and the largest
+	output difference are reported; the program exits with an error if any
+	difference exceeds the documented tolerance of +-1. With -stream, the
+	zero-latency streaming convolution conv_stream() is timed instead of
+	conv_fft(), fed with blocks of the given length.
+
+  HISTORY :
+	17.Oct.26 v1.0 First version
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* UGST modules */
+#include "ugstdemo.h"
+
+#include "reverb-lib.h"
+
+#define FFT_TOLERANCE 1         /* maximum allowed difference between both paths */
+
+static void display_usage () {
+  printf ("REVERB-BENCH.C - Version 1.0 of 17.Oct.2026 \n\n");
+
+  printf (" Benchmark of direct vs. partitioned FFT convolution\n");
+  printf ("\n");
+  printf (" Usage:\n");
+  printf (" $ reverb-bench [-options] [N1 N2 ...]\n");
+  printf (" where:\n");
+  printf ("  N1 N2 ...    impulse response lengths to test (default: 256 1024\n");
+  printf ("               4096 16384 65536)\n");
+  printf ("\n");
+  printf (" Options:\n");
+  printf ("  -n L ........ number of input samples to process (default: 48000)\n");
+  printf ("  -part B ..... partition length for the FFT path (default: automatic)\n");
+  printf ("  -stream L ... time the zero-latency streaming path with blocks of L\n");
+  printf ("                samples instead of the uniformly partitioned path\n");
+  printf ("  -head H ..... direct-form head length for -stream (default: 64)\n");
+  printf ("  -nodirect ... only time the FFT path (no difference check)\n");
+  printf ("\n");
+}
+
+
+/* simple deterministic pseudo-random generator, uniform in [-1,1) */
+static double bench_rand (unsigned long *seed) {
+  *seed = (*seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+  return (double) *seed / 1073741824.0 - 1.0;
+}
+
+
+int main (int argc, char *argv[]) {
+  static long default_len[] = { 256, 1024, 4096, 16384, 65536 };
+  long *len_list = default_len;
+  long nlen = sizeof (default_len) / sizeof (default_len[0]);
+  long L = 48000;               /* number of input samples */
+  long Bopt = 0;                /* forced partition length (0: automatic) */
+  long stream_blk = 0;          /* block length of the streaming path (0: uniform path) */
+  long head = 64;               /* direct-form head length of the streaming path */
+  int direct = 1;
+  long i, k, N, B, count, maxdiff, ndiff;
+  unsigned long seed;
+  float *IR;
+  short *in, *outDir, *outFft, *buffIn;
+  CONV_FFT_state *state;
+  CONV_STREAM_state *sstate;
+  clock_t t1, t2;
+  double tDir, tFft;
+  int status = 0;
+
+  /* ......... GET PARAMETERS ......... */
+  while (argc > 1 && argv[1][0] == '-') {
+    if (strcmp (argv[1], "-n") == 0) {
+      L = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-part") == 0) {
+      Bopt = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-stream") == 0) {
+      stream_blk = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-head") == 0) {
+      head = atol (argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if (strcmp (argv[1], "-nodirect") == 0) {
+      direct = 0;
+      argc--;
+      argv++;
+    } else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "-?") == 0) {
+      display_usage ();
+      exit (2);
+    } else {
+      fprintf (stderr, "ERROR! Invalid option \"%s\" in command line\n\n", argv[1]);
+      display_usage ();
+      exit (-1);
+    }
+  }
+  if (argc > 1) {
+    nlen = argc - 1;
+    len_list = (long *) malloc (nlen * sizeof (long));
+    for (i = 0; i < nlen; i++) {
+      len_list[i] = atol (argv[i + 1]);
+    }
+  }
+
+  /* pseudo-random input signal at a moderate level */
+  in = (short *) malloc (L * sizeof (short));
+  outDir = (short *) malloc (L * sizeof (short));
+  outFft = (short *) malloc (L * sizeof (short));
+  if (in == NULL || outDir == NULL || outFft == NULL) {
+    fprintf (stderr, "\nUnable to allocate enough memory\n");
+    exit (-1);
+  }
+  seed = 1;
+  for (k = 0; k < L; k++) {
+    in[k] = (short) (8000.0 * bench_rand (&seed));
+  }
+
+  printf ("%10s %6s %12s %12s %9s %8s %8s\n", "IR length", "B", "direct [s]", "fft [s]", "speed-up", "maxdiff", "ndiff");
+
+  for (i = 0; i < nlen; i++) {
+    N = len_list[i];
+
+    /* synthetic room impulse response: decaying noise with unit energy */
+    IR = (float *) malloc (N * sizeof (float));
+    buffIn = (short *) calloc ((direct ? 2 * N - 1 : 1), sizeof (short));
+    if (IR == NULL || buffIn == NULL) {
+      fprintf (stderr, "\nUnable to allocate enough memory\n");
+      exit (-1);
+    }
+    {
+      double energy = 0;
+      for (k = 0; k < N; k++) {
+        IR[k] = (float) (bench_rand (&seed) * exp (-6.9 * k / N));
+        energy += IR[k] * IR[k];
+      }
+      for (k = 0; k < N; k++) {
+        IR[k] = (float) (IR[k] / sqrt (energy));
+      }
+    }
+
+    /* direct path, block-wise as in reverb.c */
+    tDir = 0;
+    if (direct) {
+      t1 = clock ();
+      for (k = 0; k < L; k += count) {
+        count = (L - k < N) ? L - k : N;
+        memcpy (buffIn + N - 1, in + k, count * sizeof (short));
+        conv (IR, buffIn, outDir + k, 1.0, N, count);
+        shift (buffIn, N);
+      }
+      t2 = clock ();
+      tDir = (t2 - t1) / (double) CLOCKS_PER_SEC;
+    }
+
+    /* partitioned FFT path */
+    B = Bopt ? Bopt : conv_fft_partition (N);
+    t1 = clock ();
+    if (stream_blk > 0) {
+      if (B < head) {
+        B = head;
+      }
+      sstate = conv_stream_init (IR, N, head, B);
+      if (sstate == NULL) {
+        fprintf (stderr, "\nInvalid head/partition length %ld/%ld or not enough memory\n", head, B);
+        exit (-1);
+      }
+      for (k = 0; k < L; k += count) {
+        count = (L - k < stream_blk) ? L - k : stream_blk;
+        conv_stream (sstate, in + k, outFft + k, 1.0, count);
+      }
+      conv_stream_free (sstate);
+    } else {
+      state = conv_fft_init (IR, N, B);
+      if (state == NULL) {
+        fprintf (stderr, "\nInvalid partition length %ld or not enough memory\n", B);
+        exit (-1);
+      }
+      for (k = 0; k < L; k += count) {
+        count = (L - k < B) ? L - k : B;
+        conv_fft (state, in + k, outFft + k, 1.0, count);
+      }
+      conv_fft_free (state);
+    }
+    t2 = clock ();
+    tFft = (t2 - t1) / (double) CLOCKS_PER_SEC;
+
+    /* compare */
+    maxdiff = ndiff = 0;
+    if (direct) {
+      for (k = 0; k < L; k++) {
+        long d = labs ((long) outDir[k] - (long) outFft[k]);
+        if (d > maxdiff) {
+          maxdiff = d;
+        }
+        if (d) {
+          ndiff++;
+        }
+      }
+      if (maxdiff > FFT_TOLERANCE) {
+        status = 1;
+      }
+    }
+
+    printf ("%10ld %6ld %12.3f %12.3f %9.1f %8ld %8ld\n", N, B, tDir, tFft, (direct && tFft > 0) ? tDir / tFft : 0.0, maxdiff, ndiff);
+
+    free (IR);
+    free (buffIn);
+  }
+
+  if (status) {
+    fprintf (stderr, "\nERROR: difference between direct and FFT convolution exceeds +-%d\n", FFT_TOLERANCE);
+  }
+
+  free (in);
+  free (outDir);
+  free (outFft);
+  if (len_list != default_len) {
+    free (len_list);
+  }
+  return status;
+}
@@ -27,10 +27,25 @@
 	Global (have prototype in reverb-lib.h)
 		shift(...)		:		Shift coefficients of the input buffer for next block filtering
 		conv(...)		:		Convolves the impulse response of a room with the input file
+		conv_fft_init(...)	:		Allocates the state of the partitioned FFT convolution
+		conv_fft(...)		:		Convolves a block of the input file using partitioned FFT convolution
+		conv_fft_free(...)	:		Releases the state of the partitioned FFT convolution
+		conv_fft_partition(...)	:	Default partition length for a given impulse response length
+		conv_stream_init(...)	:	Allocates the state of the zero-latency streaming convolution
+		conv_stream(...)	:		Convolves a block of any length using the streaming convolution
+		conv_stream_free(...)	:	Releases the state of the zero-latency streaming convolution
+	Local
+		sat16(...)		:		Rounding and 16 bit saturation of one output sample
+		cfft(...)		:		In-place radix-2 complex FFT
+		rfft(...)		:		Real FFT of 2*B samples (packed format)
+		irfft(...)		:		Inverse real FFT of 2*B samples (packed format, unnormalized)
+		conv_fft_block(...)	:	Filters one block of the partitioned FFT convolution
 
   HISTORY :
 	02.Feb.05	v1.0	First Beta version
     10.jul.08   v1.01   Added 16 bit saturation and saturation warning
+    17.Oct.26   v1.02   Added uniformly partitioned overlap-save FFT convolution
+    17.Oct.26   v1.03   Added zero-latency non-uniform partitioned streaming convolution
 
   AUTHORS :
 	v1.0 Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -38,6 +53,31 @@
 
 */
 
+#include <stdlib.h>
+#include <math.h>
+
+#include "reverb-lib.h"
+
+#define REVERB_PI 3.14159265358979323846
+
+/* this routine rounds and saturates one output sample to 16 bits */
+/* it returns 1 if saturation occurred, 0 otherwise */
+static int sat16 (float acc, float alignFact, short *out) {
+  float tmpRvb;
+
+  tmpRvb = (float) (alignFact * acc + 0.5);     /* +0.5 : rounding for the 'short' truncation */
+
+  if (tmpRvb < -32768.0) {
+    *out = -32768;
+    return 1;
+  }
+  if (tmpRvb > 32767.0) {
+    *out = 32767;
+    return 1;
+  }
+  *out = (short) tmpRvb;
+  return 0;
+}
 
 
 /* this routine replaces the first N-1 samples of a buffer by the last N-1 samples */
@@ -65,19 +105,10 @@ long conv (float *IR, short *buffIn, short *buffRvb, float alignFact, long N, lo
     for (j = 0; j < N; j++) {
       tmpRvb += buffIn[N - 1 + k - j] * IR[j];
     }
-    tmpRvb = (float) (alignFact * tmpRvb + 0.5);        /* +0.5 : rounding for the 'short' truncation */
 
-    /* perform 16 bit saturation */
-    if (tmpRvb < -32768.0) {
-      buffRvb[k] = -32768;
+    /* perform rounding and 16 bit saturation */
+    if (sat16 (tmpRvb, alignFact, &buffRvb[k])) {
       sat_warning = k;
-    } else {
-      if (tmpRvb > 32767.0) {
-        buffRvb[k] = 32767;
-        sat_warning = k;
-      } else {
-        buffRvb[k] = (short) tmpRvb;
-      }
     }
   }
   return sat_warning;
@@ -97,3 +128,456 @@ void conv_old (float *IR, short *buffIn, short *buffRvb, float alignFact, long N
     buffRvb[k] = (short) (alignFact * tmpRvb + 0.5);    /* +0.5 : rounding during the 'short' truncation */
   }
 }
+
+
+/* ......................... PARTITIONED FFT CONVOLUTION ......................... */
+
+/* Uniformly partitioned overlap-save convolution: the impulse response is split
+   into P partitions of B samples, each transformed once with a 2*B-point real FFT.
+   For every block of B input samples, the spectrum of the last 2*B input samples
+   is pushed into a frequency-domain delay line (FDL) and multiplied-accumulated
+   with the partition spectra; the last B samples of the inverse FFT are the output.
+   Cost per output sample is O(log B + N/B) instead of O(N) for conv().
+
+   Spectra are stored in the packed real-FFT format of nfft=2*B floats:
+   [Re X(0), Re X(B), Re X(1), Im X(1), ..., Re X(B-1), Im X(B-1)] */
+
+
+/* this routine computes an in-place radix-2 complex FFT of M points */
+/* a holds M interleaved complex values; inverse is unnormalized */
+static void cfft (float *a, long M, float *tw, long *bitrev, int inverse) {
+  long i, j, k, len, half, step;
+  float wr, wi, tr, ti;
+
+  for (i = 0; i < M; i++) {
+    j = bitrev[i];
+    if (i < j) {
+      tr = a[2 * i];
+      ti = a[2 * i + 1];
+      a[2 * i] = a[2 * j];
+      a[2 * i + 1] = a[2 * j + 1];
+      a[2 * j] = tr;
+      a[2 * j + 1] = ti;
+    }
+  }
+
+  for (len = 2; len <= M; len <<= 1) {
+    half = len >> 1;
+    step = M / len;
+    for (j = 0; j < half; j++) {
+      wr = tw[2 * j * step];
+      wi = inverse ? -tw[2 * j * step + 1] : tw[2 * j * step + 1];
+      for (i = j; i < M; i += len) {
+        k = i + half;
+        tr = wr * a[2 * k] - wi * a[2 * k + 1];
+        ti = wr * a[2 * k + 1] + wi * a[2 * k];
+        a[2 * k] = a[2 * i] - tr;
+        a[2 * k + 1] = a[2 * i + 1] - ti;
+        a[2 * i] += tr;
+        a[2 * i + 1] += ti;
+      }
+    }
+  }
+}
+
+
+/* this routine computes the real FFT of 2*M samples in place (packed format) */
+static void rfft (float *a, long M, float *tw, float *rtw, long *bitrev) {
+  long k;
+  float zr, zi, yr, yi, er, ei, odr, odi, wr, wi, tr, ti;
+
+  /* FFT of the even/odd samples packed as M complex values */
+  cfft (a, M, tw, bitrev, 0);
+
+  /* DC and Nyquist bins */
+  tr = a[0];
+  a[0] = tr + a[1];
+  a[1] = tr - a[1];
+
+  /* split the even/odd spectra and recombine bins k and M-k */
+  for (k = 1; k <= M / 2; k++) {
+    zr = a[2 * k];
+    zi = a[2 * k + 1];
+    yr = a[2 * (M - k)];
+    yi = a[2 * (M - k) + 1];
+    er = 0.5f * (zr + yr);
+    ei = 0.5f * (zi - yi);
+    odr = 0.5f * (zi + yi);
+    odi = -0.5f * (zr - yr);
+    wr = rtw[2 * k];
+    wi = rtw[2 * k + 1];
+    tr = wr * odr - wi * odi;
+    ti = wr * odi + wi * odr;
+    a[2 * k] = er + tr;
+    a[2 * k + 1] = ei + ti;
+    a[2 * (M - k)] = er - tr;
+    a[2 * (M - k) + 1] = ti - ei;
+  }
+}
+
+
+/* this routine computes the inverse real FFT of 2*M samples in place (packed format) */
+/* the output is scaled by 2*M */
+static void irfft (float *a, long M, float *tw, float *rtw, long *bitrev) {
+  long k;
+  float xr, xi, yr, yi, er, ei, odr, odi, dr, di, wr, wi, tr;
+
+  /* DC and Nyquist bins */
+  tr = a[0];
+  a[0] = tr + a[1];
+  a[1] = tr - a[1];
+
+  /* rebuild the even/odd spectra from bins k and M-k */
+  for (k = 1; k <= M / 2; k++) {
+    xr = a[2 * k];
+    xi = a[2 * k + 1];
+    yr = a[2 * (M - k)];
+    yi = a[2 * (M - k) + 1];
+    er = xr + yr;
+    ei = xi - yi;
+    dr = xr - yr;
+    di = xi + yi;
+    wr = rtw[2 * k];
+    wi = rtw[2 * k + 1];
+    odr = dr * wr + di * wi;
+    odi = di * wr - dr * wi;
+    a[2 * k] = er - odi;
+    a[2 * k + 1] = ei + odr;
+    a[2 * (M - k)] = er + odi;
+    a[2 * (M - k) + 1] = odr - ei;
+  }
+
+  cfft (a, M, tw, bitrev, 1);
+}
+
+
+/* this routine returns the default partition length for an impulse response of N samples */
+/* longer partitions reduce the cost per sample, but the FFT and the delay line must stay cache resident */
+long conv_fft_partition (long N) {
+  long B;
+
+  B = 64;
+  while (B < N && B < 16384) {
+    B <<= 1;
+  }
+  return B;
+}
+
+
+/* this routine allocates and initializes the state of the partitioned FFT convolution */
+CONV_FFT_state *conv_fft_init (float *IR, long N, long B) {
+  CONV_FFT_state *state;
+  long p, k, j, bits, len;
+  float scale;
+
+  /* check consistency: B must be a power of two */
+  if (N <= 0 || B < 4 || (B & (B - 1)) != 0) {
+    return NULL;
+  }
+
+  state = (CONV_FFT_state *) calloc (1, sizeof (CONV_FFT_state));
+  if (state == NULL) {
+    return NULL;
+  }
+  state->N = N;
+  state->B = B;
+  state->P = (N + B - 1) / B;
+  state->nfft = 2 * B;
+  state->fdl_pos = 0;
+
+  state->H = (float *) calloc (state->P * state->nfft, sizeof (float));
+  state->X = (float *) calloc (state->P * state->nfft, sizeof (float));
+  state->buff = (float *) calloc (state->nfft, sizeof (float));
+  state->acc = (float *) calloc (state->nfft, sizeof (float));
+  state->tw = (float *) malloc (B * sizeof (float));
+  state->rtw = (float *) malloc ((B + 2) * sizeof (float));
+  state->bitrev = (long *) malloc (B * sizeof (long));
+  if (state->H == NULL || state->X == NULL || state->buff == NULL || state->acc == NULL || state->tw == NULL || state->rtw == NULL || state->bitrev == NULL) {
+    conv_fft_free (state);
+    return NULL;
+  }
+
+  /* twiddle factors of the B-point complex FFT */
+  for (k = 0; k < B / 2; k++) {
+    state->tw[2 * k] = (float) cos (2.0 * REVERB_PI * k / B);
+    state->tw[2 * k + 1] = (float) -sin (2.0 * REVERB_PI * k / B);
+  }
+
+  /* twiddle factors of the real-FFT split */
+  for (k = 0; k <= B / 2; k++) {
+    state->rtw[2 * k] = (float) cos (REVERB_PI * k / B);
+    state->rtw[2 * k + 1] = (float) -sin (REVERB_PI * k / B);
+  }
+
+  /* bit-reversal permutation */
+  for (bits = 0, len = 1; len < B; len <<= 1) {
+    bits++;
+  }
+  for (k = 0; k < B; k++) {
+    for (j = 0, p = 0; p < bits; p++) {
+      j |= ((k >> p) & 1) << (bits - 1 - p);
+    }
+    state->bitrev[k] = j;
+  }
+
+  /* spectra of the impulse response partitions, including the 1/nfft normalization of the inverse FFT */
+  scale = (float) (1.0 / state->nfft);
+  for (p = 0; p < state->P; p++) {
+    float *Hp = state->H + p * state->nfft;
+
+    for (k = 0; k < B && p * B + k < N; k++) {
+      Hp[k] = IR[p * B + k] * scale;
+    }
+    rfft (Hp, B, state->tw, state->rtw, state->bitrev);
+  }
+
+  return state;
+}
+
+
+/* this routine filters the input window of the FFT convolution */
+/* the new block must be in buff[B..2B); the result is in acc[B..2B) and the window slides by B */
+static void conv_fft_block (CONV_FFT_state * state) {
+  long B = state->B, nfft = state->nfft, P = state->P;
+  long k, p, pos;
+  float *buff = state->buff, *acc = state->acc, *Xn, *Hp, *Xp;
+
+  /* push the spectrum of the input window into the frequency-domain delay line */
+  state->fdl_pos = (state->fdl_pos + P - 1) % P;
+  Xn = state->X + state->fdl_pos * nfft;
+  for (k = 0; k < nfft; k++) {
+    Xn[k] = buff[k];
+  }
+  rfft (Xn, B, state->tw, state->rtw, state->bitrev);
+
+  /* slide the input window: the new block becomes the previous one */
+  for (k = 0; k < B; k++) {
+    buff[k] = buff[B + k];
+  }
+
+  /* multiply-accumulate every partition with the correspondingly delayed input spectrum */
+  for (k = 0; k < nfft; k++) {
+    acc[k] = 0;
+  }
+  for (p = 0, pos = state->fdl_pos; p < P; p++) {
+    Hp = state->H + p * nfft;
+    Xp = state->X + pos * nfft;
+    acc[0] += Hp[0] * Xp[0];
+    acc[1] += Hp[1] * Xp[1];
+    for (k = 2; k < nfft; k += 2) {
+      acc[k] += Hp[k] * Xp[k] - Hp[k + 1] * Xp[k + 1];
+      acc[k + 1] += Hp[k] * Xp[k + 1] + Hp[k + 1] * Xp[k];
+    }
+    if (++pos == P) {
+      pos = 0;
+    }
+  }
+
+  /* back to time domain: the last B samples are free of circular aliasing */
+  irfft (acc, B, state->tw, state->rtw, state->bitrev);
+}
+
+
+/* this routine convolves a block of L <= B new input samples with the impulse response */
+long conv_fft (CONV_FFT_state * state, short *buffIn, short *buffRvb, float alignFact, long L) {
+  long B = state->B;
+  long k;
+  long sat_warning;
+  float *buff = state->buff, *acc = state->acc;
+
+  /* append the new block to the input window (zero-padded if L < B) */
+  for (k = 0; k < L; k++) {
+    buff[B + k] = buffIn[k];
+  }
+  for (; k < B; k++) {
+    buff[B + k] = 0;
+  }
+
+  conv_fft_block (state);
+
+  /* perform rounding and 16 bit saturation */
+  sat_warning = -1;
+  for (k = 0; k < L; k++) {
+    if (sat16 (acc[B + k], alignFact, &buffRvb[k])) {
+      sat_warning = k;
+    }
+  }
+  return sat_warning;
+}
+
+
+/* this routine releases the state of the partitioned FFT convolution */
+void conv_fft_free (CONV_FFT_state * state) {
+  if (state == NULL) {
+    return;
+  }
+  free (state->H);
+  free (state->X);
+  free (state->buff);
+  free (state->acc);
+  free (state->tw);
+  free (state->rtw);
+  free (state->bitrev);
+  free (state);
+}
+
+
+/* ......................... ZERO-LATENCY STREAMING CONVOLUTION ......................... */
+
+/* Non-uniform partitioned convolution (Gardner): the first `head` samples of the
+   impulse response are convolved directly, sample by sample, so that every input
+   sample produces its output immediately. The tail is split into segments handled
+   by uniformly partitioned FFT convolutions whose partition length B doubles from
+   one segment to the next (two partitions per segment) up to maxB; the last segment
+   takes the remainder. A segment starting at offset >= B only contributes to outputs
+   after the input block it depends on is complete, so its block result is simply
+   overlap-added into a ring buffer ahead of the current time. The input can thus be
+   fed in blocks of any length, down to a single sample, with no added latency. */
+
+
+/* this routine allocates and initializes the state of the zero-latency streaming convolution */
+CONV_STREAM_state *conv_stream_init (float *IR, long N, long head, long maxB) {
+  CONV_STREAM_state *state;
+  long k, off, len, B, span;
+
+  /* check consistency: head and maxB must be powers of two */
+  if (N <= 0 || head < 4 || (head & (head - 1)) != 0 || maxB < head || (maxB & (maxB - 1)) != 0) {
+    return NULL;
+  }
+
+  state = (CONV_STREAM_state *) calloc (1, sizeof (CONV_STREAM_state));
+  if (state == NULL) {
+    return NULL;
+  }
+  state->N = N;
+  state->head = head;
+  state->h = (float *) calloc (head, sizeof (float));
+  state->hist = (float *) calloc (2 * head - 1, sizeof (float));
+  if (state->h == NULL || state->hist == NULL) {
+    conv_stream_free (state);
+    return NULL;
+  }
+  for (k = 0; k < head && k < N; k++) {
+    state->h[k] = IR[k];
+  }
+
+  /* tail segments: offset >= partition length is required for zero latency */
+  off = head;
+  B = head;
+  span = 0;
+  while (off < N) {
+    if (state->nstages == CONV_STREAM_MAX_STAGES) {
+      conv_stream_free (state);
+      return NULL;
+    }
+    len = (B == maxB || N - off < 2 * B) ? N - off : 2 * B;
+    state->stage[state->nstages] = conv_fft_init (IR + off, len, B);
+    if (state->stage[state->nstages] == NULL) {
+      conv_stream_free (state);
+      return NULL;
+    }
+    state->offset[state->nstages] = off;
+    state->fill[state->nstages] = 0;
+    state->nstages++;
+    if (off + B > span) {
+      span = off + B;
+    }
+    off += len;
+    if (B < maxB) {
+      B <<= 1;
+    }
+  }
+
+  /* ring buffer long enough for the farthest overlap-add position */
+  state->ring_len = head;
+  while (state->ring_len < span + head) {
+    state->ring_len <<= 1;
+  }
+  state->ring = (float *) calloc (state->ring_len, sizeof (float));
+  if (state->ring == NULL) {
+    conv_stream_free (state);
+    return NULL;
+  }
+  state->t = 0;
+
+  return state;
+}
+
+
+/* this routine convolves L new input samples with the impulse response without added latency */
+long conv_stream (CONV_STREAM_state * state, short *buffIn, short *buffRvb, float alignFact, long L) {
+  long H = state->head, mask = state->ring_len - 1;
+  long done, c, k, j, s, B, pos;
+  long sat_warning;
+  float *hist = state->hist, *h = state->h, *ring = state->ring;
+  float tmpRvb;
+  CONV_FFT_state *st;
+
+  sat_warning = -1;
+  for (done = 0; done < L; done += c) {
+    /* chunk up to the next boundary of the smallest partition */
+    c = H - (state->t & (H - 1));
+    if (c > L - done) {
+      c = L - done;
+    }
+
+    /* direct-form head, plus the tail contributions already accumulated in the ring */
+    for (k = 0; k < c; k++) {
+      hist[H - 1 + k] = buffIn[done + k];
+    }
+    for (k = 0; k < c; k++) {
+      pos = (state->t + k) & mask;
+      tmpRvb = ring[pos];
+      ring[pos] = 0;
+      for (j = 0; j < H; j++) {
+        tmpRvb += hist[H - 1 + k - j] * h[j];
+      }
+
+      /* perform rounding and 16 bit saturation */
+      if (sat16 (tmpRvb, alignFact, &buffRvb[done + k])) {
+        sat_warning = done + k;
+      }
+    }
+    for (k = 0; k < H - 1; k++) {
+      hist[k] = hist[k + c];
+    }
+
+    /* feed the tail stages; overlap-add each completed block ahead of the current time */
+    for (s = 0; s < state->nstages; s++) {
+      st = state->stage[s];
+      B = st->B;
+      for (k = 0; k < c; k++) {
+        st->buff[B + state->fill[s] + k] = buffIn[done + k];
+      }
+      state->fill[s] += c;
+      if (state->fill[s] == B) {
+        conv_fft_block (st);
+        pos = state->t + c - B + state->offset[s];
+        for (k = 0; k < B; k++) {
+          ring[(pos + k) & mask] += st->acc[B + k];
+        }
+        state->fill[s] = 0;
+      }
+    }
+
+    state->t = (state->t + c) & mask;
+  }
+  return sat_warning;
+}
+
+
+/* this routine releases the state of the zero-latency streaming convolution */
+void conv_stream_free (CONV_STREAM_state * state) {
+  long s;
+
+  if (state == NULL) {
+    return;
+  }
+  for (s = 0; s < state->nstages; s++) {
+    conv_fft_free (state->stage[s]);
+  }
+  free (state->h);
+  free (state->hist);
+  free (state->ring);
+  free (state);
+}
@@ -28,10 +28,19 @@
 	Global (have prototype in reverb-lib.h)
 		shift(...)		:		Shift coefficients of the input buffer for next block filtering
 		conv(...)		:		Convolves the impulse response of a room with the input file
+		conv_fft_init(...)	:		Allocates the state of the partitioned FFT convolution
+		conv_fft(...)		:		Convolves a block of the input file using partitioned FFT convolution
+		conv_fft_free(...)	:		Releases the state of the partitioned FFT convolution
+		conv_fft_partition(...)	:	Default partition length for a given impulse response length
+		conv_stream_init(...)	:	Allocates the state of the zero-latency streaming convolution
+		conv_stream(...)	:		Convolves a block of any length using the streaming convolution
+		conv_stream_free(...)	:	Releases the state of the zero-latency streaming convolution
 
   HISTORY :
 	02.Feb.05	v1.0	First Beta version
 	10.jul.08   v1.01   Added 16 bit saturation and saturation warning
+	17.Oct.26   v1.02   Added uniformly partitioned overlap-save FFT convolution
+	17.Oct.26   v1.03   Added zero-latency non-uniform partitioned streaming convolution
 
 
   AUTHORS :
@@ -39,6 +48,8 @@
     v1.01 Jonas Svedberg jonas.svedberg@ericsson.com
 */
 
+#ifndef REVERB_LIB_H
+#define REVERB_LIB_H
 
 /* this routine replaces the first N-1 samples of a buffer by the last N-1 samples */
 void shift (short *buff, long N);
@@ -54,3 +65,92 @@ long conv (float *IR,           /* impulse response buffer */
            long N,              /* length of the impulse response */
            long L               /* length of the input buffer to process */
   );
+
+
+/* state of the uniformly partitioned overlap-save FFT convolution */
+typedef struct {
+  long N;                       /* length of the impulse response */
+  long B;                       /* partition (block) length, power of two */
+  long P;                       /* number of partitions, ceil(N/B) */
+  long nfft;                    /* FFT length, 2*B */
+  long fdl_pos;                 /* position of the newest spectrum in the frequency-domain delay line */
+  float *H;                     /* P spectra of the impulse response partitions */
+  float *X;                     /* frequency-domain delay line: P spectra of past input blocks */
+  float *buff;                  /* time-domain input of the last two blocks */
+  float *acc;                   /* spectral accumulator / inverse FFT work buffer */
+  float *tw;                    /* twiddle factors of the B-point complex FFT */
+  float *rtw;                   /* twiddle factors of the real-FFT split */
+  long *bitrev;                 /* bit-reversal permutation of the B-point complex FFT */
+} CONV_FFT_state;
+
+
+/* this routine returns the default partition length for an impulse response of N samples */
+long conv_fft_partition (long N);
+
+
+/* this routine allocates and initializes the state of the partitioned FFT convolution */
+/* B is the partition length (power of two, >= 4); returns NULL on failure */
+CONV_FFT_state *conv_fft_init (float *IR,       /* impulse response buffer */
+                               long N,  /* length of the impulse response */
+                               long B   /* partition length */
+  );
+
+
+/* this routine convolves a block of L <= B new input samples with the impulse response */
+/* and stores the processed data into buffRvb; only the last call of a stream may have L < B */
+/* the output is the same overflow flag as for conv() */
+long conv_fft (CONV_FFT_state * state,  /* partitioned convolution state */
+               short *buffIn,   /* new input samples (no history) */
+               short *buffRvb,  /* reverberated data */
+               float alignFact, /* energy alignment factor */
+               long L           /* number of input samples to process */
+  );
+
+
+/* this routine releases the state of the partitioned FFT convolution */
+void conv_fft_free (CONV_FFT_state * state);
+
+
+#define CONV_STREAM_MAX_STAGES 32
+
+/* state of the zero-latency non-uniform partitioned (streaming) convolution */
+typedef struct {
+  long N;                       /* length of the impulse response */
+  long head;                    /* length of the direct-form head, also the smallest partition */
+  float *h;                     /* head of the impulse response */
+  float *hist;                  /* input history of the head: head-1 samples + one chunk */
+  long nstages;                 /* number of FFT stages for the tail */
+  CONV_FFT_state *stage[CONV_STREAM_MAX_STAGES];        /* uniformly partitioned convolution of each tail segment */
+  long offset[CONV_STREAM_MAX_STAGES];  /* start of each tail segment in the impulse response */
+  long fill[CONV_STREAM_MAX_STAGES];    /* number of samples in the current block of each stage */
+  float *ring;                  /* overlap-add ring buffer for the tail output */
+  long ring_len;                /* length of the ring buffer, power of two */
+  long t;                       /* number of samples processed so far (modulo ring_len) */
+} CONV_STREAM_state;
+
+
+/* this routine allocates and initializes the state of the zero-latency streaming convolution */
+/* head is the direct-form head length (power of two, >= 4), maxB the largest tail partition; */
+/* returns NULL on failure */
+CONV_STREAM_state *conv_stream_init (float *IR, /* impulse response buffer */
+                                     long N,    /* length of the impulse response */
+                                     long head, /* length of the direct-form head */
+                                     long maxB  /* largest partition length */
+  );
+
+
+/* this routine convolves L new input samples (any L >= 0) with the impulse response */
+/* without added latency, and stores the processed data into buffRvb */
+/* the output is the same overflow flag as for conv() */
+long conv_stream (CONV_STREAM_state * state,    /* streaming convolution state */
+                  short *buffIn,        /* new input samples (no history) */
+                  short *buffRvb,       /* reverberated data */
+                  float alignFact,      /* energy alignment factor */
+                  long L                /* number of input samples to process */
+  );
+
+
+/* this routine releases the state of the zero-latency streaming convolution */
+void conv_stream_free (CONV_STREAM_state * state);
+
+#endif /* REVERB_LIB_H */
@@ -26,6 +26,8 @@
 	02.Feb.05	v1.0	First Beta version
 	10.Jul.08 v1.01 Added 16 bit saturation and saturation warning
 	02.Feb.10 v1.02 Modified maximum string length to avoid buffer overrun
+	17.Oct.26 v1.03 Added partitioned FFT convolution (options -fft and -part)
+	17.Oct.26 v1.04 Added zero-latency streaming convolution (options -stream and -head)
 
   AUTHORS :
 	v1.0  Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
@@ -43,7 +45,7 @@
 #include "reverb-lib.h"
 
 static void display_usage () {
-  printf ("REVERB.C - Version 1.02 of 02.Feb.2010 \n\n");
+  printf ("REVERB.C - Version 1.04 of 17.Oct.2026 \n\n");
 
   printf (" Program to add reverberation to a signal\n");
   printf (" This program convolves a signal with the impulse response of a room\n");
@@ -61,6 +63,16 @@ static void display_usage () {
   printf (" Options:\n");
   printf ("  -align A...... multiplicative factor to apply to the reverberated sound\n");
   printf ("				   in order to align its energy level with a second file\n");
+  printf ("  -fft ......... use uniformly partitioned FFT convolution instead of\n");
+  printf ("				   direct convolution (output within +-1 of the direct path)\n");
+  printf ("  -part B....... partition length for -fft, or largest partition length\n");
+  printf ("				   for -stream (power of two, default depends on the\n");
+  printf ("				   impulse response length)\n");
+  printf ("  -stream L..... process blocks of L samples (any L >= 1) with the\n");
+  printf ("				   zero-latency non-uniform partitioned convolution\n");
+  printf ("				   (output within +-1 of the direct path)\n");
+  printf ("  -head H....... direct-form head length for -stream (power of two,\n");
+  printf ("				   default: 64)\n");
   printf ("\n");
 }
 
@@ -86,6 +98,13 @@ int main (int argc, char *argv[]) {
   long N;                       /* length of the impulse response */
   long count, global_count;
   long local_sat_pos;
+  int use_fft = 0;              /* use the partitioned FFT convolution */
+  long B = 0;                   /* partition length of the FFT convolution (0: default) */
+  long blk;                     /* number of samples read per block */
+  long stream_blk = 0;          /* block length of the streaming convolution (0: not used) */
+  long head = 64;               /* direct-form head length of the streaming convolution */
+  CONV_FFT_state *fft_state = NULL;
+  CONV_STREAM_state *stream_state = NULL;
 
   global_count = 0;
   local_sat_pos = -1;           /* local position of last saturation */
@@ -102,6 +121,38 @@ int main (int argc, char *argv[]) {
         /* Set the energy alignment factor */
         alignFact = (float) atof (argv[2]);
 
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-fft") == 0) {
+        /* Use the partitioned FFT convolution */
+        use_fft = 1;
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc--;
+        argv++;
+      } else if (strcmp (argv[1], "-part") == 0) {
+        /* Set the partition length of the FFT convolution */
+        B = atol (argv[2]);
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-stream") == 0) {
+        /* Use the zero-latency streaming convolution with the given block length */
+        stream_blk = atol (argv[2]);
+        if (stream_blk < 1) {
+          fprintf (stderr, "ERROR! Invalid block length %ld for -stream\n\n", stream_blk);
+          exit (-1);
+        }
+
+        /* Move arg{c,v} over the option to the next argument */
+        argc -= 2;
+        argv += 2;
+      } else if (strcmp (argv[1], "-head") == 0) {
+        /* Set the direct-form head length of the streaming convolution */
+        head = atol (argv[2]);
+
         /* Move arg{c,v} over the option to the next argument */
         argc -= 2;
         argv += 2;
@@ -162,8 +213,36 @@ int main (int argc, char *argv[]) {
     exit (-1);
   }
   /* allocate memory for the buffers */
-  buffIn = (short *) calloc (2 * N - 1, sizeof (short));        /* allocate memory for a block of the input file */
-  buffRvb = (short *) malloc (N * sizeof (short));      /* allocate memory for the processed block */
+  if (stream_blk > 0) {
+    if (B == 0) {
+      B = conv_fft_partition (N);
+    }
+    if (B < head) {
+      B = head;
+    }
+    stream_state = conv_stream_init (IR, N, head, B);
+    if (stream_state == NULL) {
+      fprintf (stderr, "\nInvalid head/partition length %ld/%ld (must be powers of two >= 4) or not enough memory\n", head, B);
+      exit (-1);
+    }
+    blk = stream_blk;
+    buffIn = (short *) calloc (blk, sizeof (short));    /* the streaming convolution keeps its own input history */
+  } else if (use_fft) {
+    if (B == 0) {
+      B = conv_fft_partition (N);
+    }
+    fft_state = conv_fft_init (IR, N, B);
+    if (fft_state == NULL) {
+      fprintf (stderr, "\nInvalid partition length %ld (must be a power of two >= 4) or not enough memory\n", B);
+      exit (-1);
+    }
+    blk = B;
+    buffIn = (short *) calloc (blk, sizeof (short));    /* the FFT convolution keeps its own input history */
+  } else {
+    blk = N;
+    buffIn = (short *) calloc (2 * N - 1, sizeof (short));      /* allocate memory for a block of the input file */
+  }
+  buffRvb = (short *) malloc (blk * sizeof (short));    /* allocate memory for the processed block */
 
   /* check consistency */
   if ((buffIn == NULL) || (buffRvb == NULL)) {
@@ -179,15 +258,28 @@ int main (int argc, char *argv[]) {
 
   /* Filter the sound File */
   while (!feof (ptr_fileIn)) {
-    count = (long) fread (buffIn + N - 1, sizeof (short), N, ptr_fileIn);       /* read a block of the input file */
+    if (stream_state != NULL) {
+      count = (long) fread (buffIn, sizeof (short), blk, ptr_fileIn);   /* read a block of the input file */
+      local_sat_pos = conv_stream (stream_state, buffIn, buffRvb, alignFact, count);    /* convolves a block of the input file with the impulse response */
+    } else if (use_fft) {
+      count = (long) fread (buffIn, sizeof (short), blk, ptr_fileIn);   /* read a block of the input file */
+      if (count == 0) {
+        break;
+      }
+      local_sat_pos = conv_fft (fft_state, buffIn, buffRvb, alignFact, count);  /* convolves a block of the input file with the impulse response */
+    } else {
+      count = (long) fread (buffIn + N - 1, sizeof (short), N, ptr_fileIn);     /* read a block of the input file */
 
-    local_sat_pos = conv (IR, buffIn, buffRvb, alignFact, N, count);    /* convolves a block of the input file with the impulse response */
+      local_sat_pos = conv (IR, buffIn, buffRvb, alignFact, N, count);  /* convolves a block of the input file with the impulse response */
+    }
     if (local_sat_pos >= 0) {
       fprintf (stderr, "\nWarning warning!! Saturation(s) in output file.  In  sample %ld\n", local_sat_pos + global_count);
     }
     global_count += count;
     fwrite (buffRvb, sizeof (short), count, ptr_fileOut);       /* output the processed block */
-    shift (buffIn, N);          /* shift a part of the input buffer (to keep the N-1 last samples of the input file for the next processing) */
+    if (stream_state == NULL && !use_fft) {
+      shift (buffIn, N);        /* shift a part of the input buffer (to keep the N-1 last samples of the input file for the next processing) */
+    }
   }
 
 
@@ -200,6 +292,8 @@ int main (int argc, char *argv[]) {
   free (buffIn);
   free (buffRvb);
   free (IR);
+  conv_fft_free (fft_state);
+  conv_stream_free (stream_state);
   /* close the opened files */
   fclose (ptr_fileIn);
   fclose (ptr_fileOut);
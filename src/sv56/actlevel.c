@@ -1,4 +1,4 @@
-/*                                                              V2.4 10.Jun.98
+/*                                                              V2.5 17.Oct.26
   ============================================================================
 
   ACTLEVEL.C
@@ -63,6 +63,10 @@
   -log file .. print the statistics log into file rather than stdout
   -q ......... quiet operation; don't print progress flag, results are
                printed all in one line.
+  -threads n . measure the files concurrently in `n' threads, one P.56
+               state per file; the results are reported in the order of
+               the command line, the same as with one thread [default: 1].
+               Needs POSIX threads (HAVE_PTHREAD), else ignored.
 
 
   Modules used:
@@ -125,6 +129,10 @@
                            characters and changing strcpy() to
                            strncpy() in the filename copy process.
                            <simao>
+  17.Oct.26     2.5        Added option -threads to measure several files
+                           concurrently; moved the measurement of one file
+                           to measure_file(). The threads are those of
+                           ugst_pool_run() (ugst-pool.c).
   ============================================================================
 */
 
@@ -150,17 +158,39 @@
 #include <sys/stat.h>
 #endif
 
+#include <errno.h>
+
 /* ... Include of speech-voltmeter-related routines ... */
 #include "sv-p56.h"
 
 /* ... Include of utilities ... */
 #include "ugst-utl.h"
+#include "ugst-pool.h"          /* thread pool of option -threads */
 
 /* ... Local definitions ... */
 #define DEF_BLK_LEN 256         /* samples per block */
 #define MIN_LOG_OFFSET 1.0e-20  /* To avoid sigularity with log(0.0) */
 
 
+/* Measurement of one file */
+typedef struct {
+  char *name;                   /* file name */
+  SVP56_state state;            /* P.56 state of this file */
+  double ActiveLeveldB;         /* active level of the file */
+  long N2;                      /* number of blocks measured */
+  int status;                   /* 0, or the exit value of the failure */
+  int err;                      /* errno of the failure */
+} ACT_FILE;
+
+/* Parameters shared by the threads of option -threads */
+typedef struct {
+  ACT_FILE *file;               /* the files to measure */
+  long nfiles;                  /* number of files */
+  long N, N2, start_byte, bitno;
+  double sf;
+} ACT_POOL;
+
+
 /*
   ============================================================================
 
@@ -189,7 +219,7 @@
   ============================================================================
 */
 void display_usage () {
-  printf ("ACTLEVEL.C - Version 2.0 of 01/Feb/1995 \n");
+  printf ("ACTLEVEL.C - Version 2.5 of 17/Oct/2026 \n");
   printf (" Calculate the active speech level of a file, relative to the\n");
   printf (" system overload point [dBov], using the P.56 algorithm.\n");
   printf (" Reports positive and negative peaks, RMS and active level, \n");
@@ -221,6 +251,8 @@ void display_usage () {
   printf ("  -log file ... log statistics into file rather than stdout\n");
   printf ("  -q ......... quiet operation; don't print progress flag, results\n");
   printf ("               are printed all in one line.\n");
+  printf ("  -threads n . measure the files concurrently in `n' threads\n");
+  printf ("               [default: 1]\n");
 
   /* Quit program */
   exit (-128);
@@ -410,32 +442,177 @@ void print_act_short_summary (FILE * out, char *file, SVP56_state state, double
    ***                                                                    ***
    **************************************************************************
 */
+/*
+  ============================================================================
+
+       int measure_file (ACT_FILE *f, long N, long N2, long start_byte,
+       ~~~~~~~~~~~~~~~~  long bitno, double sf, char progress);
+
+       Measure the active level of one file, from block start_byte on, in
+       N2 blocks of N samples (the whole file if N2 is 0). On error, the
+       exit value and errno of the failure are kept in f->status and f->err.
+       Uses no global data, so that several files can be measured at the
+       same time by different threads.
+
+       Parameter:
+       ~~~~~~~~~~
+       f .......... file to measure; the name is input, the rest output
+       N .......... number of samples per block
+       N2 ......... number of blocks, or 0 for the whole file
+       start_byte . offset of the first block in the file
+       bitno ...... number of bits per sample (input signal resolution)
+       sf ......... sampling rate, in Hz
+       progress ... if not 0, print the progress flag to stderr
+
+       Returns
+       ~~~~~~~
+       f->status
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation, from the body of main().
+
+  ============================================================================
+*/
+int measure_file (ACT_FILE * f, long N, long N2, long start_byte, long bitno, double sf, char progress) {
+  static char funny[] = "|/-\\|/-\\", funny_size = sizeof (funny);
+  short buffer[4096];
+  float Buf[4096];
+  FILE *Fi;
+  long i, l;
+
+  /* Reset variables for speech level measurements */
+  init_speech_voltmeter (&f->state, sf);
+  f->ActiveLeveldB = 0;
+  f->status = f->err = 0;
+
+  /* Opening input file; abort if there's any problem */
+  if ((Fi = fopen (f->name, RB)) == NULL) {
+    f->err = errno;
+    return (f->status = 2);
+  }
+
+  /* Check if is to process the whole file */
+  if (N2 == 0) {
+    struct stat st;
+    stat (f->name, &st);
+    N2 = ceil (st.st_size / (double) (N * sizeof (short)));
+  }
+  f->N2 = N2;
+
+  /* Move pointer to 1st block of interest */
+  if (fseek (Fi, start_byte, 0) < 0l) {
+    f->err = errno;
+    fclose (Fi);
+    return (f->status = 4);
+  }
+
+  /* ... MEASUREMENT OF ACTIVE SPEECH LEVEL ACCORDING P.56 ... */
+
+  /* Read samples ... */
+  if (progress)
+    fprintf (stderr, "  Processing \r");
+  for (i = 0; i < N2; i++) {
+    if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
+      /* ... Convert samples to float */
+      sh2fl ((long) l, buffer, Buf, bitno, 1);
+
+      /* ... Get the active level */
+      f->ActiveLeveldB = speech_voltmeter (Buf, (long) l, &f->state);
+
+      /* Print progress flag */
+      if (progress)
+        fprintf (stderr, "%c\r", funny[i % funny_size]);
+    } else {
+      f->err = errno;
+      fclose (Fi);
+      return (f->status = 5);
+    }
+  }
+  if (progress)
+    fprintf (stderr, "\n");
+
+  /* Close current file */
+  fclose (Fi);
+  return (0);
+}
+
+/* ........................ End of measure_file() ........................ */
+
+
+/*
+  ============================================================================
+
+       void measure_job (void *ctx, long k);
+       ~~~~~~~~~~~~~~~~
+
+       Job of the thread pool of option -threads: measure file k of the
+       pool `ctx' (an ACT_POOL).
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void measure_job (void *ctx, long k) {
+  ACT_POOL *pool = (ACT_POOL *) ctx;
+
+  measure_file (&pool->file[k], pool->N, pool->N2, pool->start_byte, pool->bitno, pool->sf, 0);
+}
+
+/* ....................... End of measure_job() ....................... */
+
+
+/*
+  ============================================================================
+
+       void measure_files (ACT_POOL *pool, int threads);
+       ~~~~~~~~~~~~~~~~~~
+
+       Measure all the files of the pool with `threads' threads, see
+       ugst_pool_run(). Without POSIX threads, or if a thread can not be
+       created, the remaining files are measured by the calling thread.
+
+       Log of changes
+       ~~~~~~~~~~~~~~
+       17.Oct.26	v1.0	Creation.
+
+  ============================================================================
+*/
+void measure_files (ACT_POOL * pool, int threads) {
+  ugst_pool_run (measure_job, pool, pool->nfiles, threads);
+}
+
+/* ....................... End of measure_files() ........................ */
+
+
 int main (int argc, char *argv[]) {
   /* Parameters for operation */
   double Overflow;              /* Max.positive value for AD_resolution bits */
-  long N = DEF_BLK_LEN, N1 = 1, N2 = 0, N2_ori, i, l;
+  long N = DEF_BLK_LEN, N1 = 1, N2 = 0, N2_ori, k;
+  int threads = 1;
 
   /* Intermediate storage variables for speech voltmeter */
   SVP56_state state;
+  ACT_FILE *file, one;
+  ACT_POOL pool;
 #ifdef LOCAL_PRINT
   double abs_max_dB;
 #endif
 
   /* File-related variables */
   char FileIn[150];
-  FILE *Fi;                     /* input file pointer */
   FILE *out = stdout;           /* where to print the statistical results */
 #ifdef VMS
   char mrs[15];
 #endif
 
   /* Other variables */
-  short buffer[4096];
-  float Buf[4096];
   long start_byte, bitno = 16;
   double sf = 16000;            /* Hz */
   double ActiveLeveldB, level = 0, gain = 0;
-  static char funny[] = "|/-\\|/-\\", funny_size = sizeof (funny), quiet = 0;
+  static char quiet = 0;
 #ifdef LOCAL_PRINT
   static char unity[5] = "dBov";
 #endif
@@ -521,6 +698,13 @@ int main (int argc, char *argv[]) {
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
+      } else if (strcmp (argv[1], "-threads") == 0) {
+        /* Measure files concurrently */
+        threads = atoi (argv[2]);
+
+        /* Update argc/argv to next valid option/argument */
+        argv += 2;
+        argc -= 2;
       } else if (strcmp (argv[1], "--") == 0) {
         /* No more options: */
         /* Move argv over the option to the next argument and quit loop */
@@ -547,62 +731,46 @@ int main (int argc, char *argv[]) {
   Overflow = pow ((double) 2.0, (double) (bitno - 1));
 
 
+  /* MEASURE ALL FILES CONCURRENTLY, IF ASKED FOR */
+  file = NULL;
+  if (threads > 1 && argc > 2)
+    file = (ACT_FILE *) calloc (argc - 1, sizeof (ACT_FILE));
+  if (file != NULL) {
+    pool.file = file;
+    pool.nfiles = argc - 1;
+    pool.N = N;
+    pool.N2 = N2_ori;
+    pool.start_byte = start_byte;
+    pool.bitno = bitno;
+    pool.sf = sf;
+    for (k = 0; k < pool.nfiles; k++)
+      file[k].name = argv[k + 1];
+    measure_files (&pool, threads);
+  }
+
   /* REPEAT FOR ALL FILES IN THE COMMAND LINE */
-  while (argc > 1) {
+  for (k = 0; argc > 1; k++) {
     /* Get new file name and update argument line pointer/counter */
     strncpy (FileIn, argv[1], sizeof (FileIn));
     argv++;
     argc--;
 
-    /* Reset variables for speech level measurements */
-    init_speech_voltmeter (&state, sf);
-
-    /* ......... FILE PREPARATION ......... */
-
-    /* Opening input file; abort if there's any problem */
-#ifdef VMS
-    sprintf (mrs, "mrs=%d", 2 * N);
-#endif
-    if ((Fi = fopen (FileIn, RB)) == NULL)
-      KILL (FileIn, 2);
-
-    /* Reinitialize number of blocks as specified initially */
-    N2 = N2_ori;
-
-    /* Check if is to process the whole file */
-    if (N2 == 0) {
-      struct stat st;
-      stat (FileIn, &st);
-      N2 = ceil (st.st_size / (double) (N * sizeof (short)));
+    /* Measure the file now, unless it has been already (with -threads;
+       if there was no memory for that, measure them one at a time) */
+    if (file == NULL) {
+      one.name = FileIn;
+      measure_file (&one, N, N2_ori, start_byte, bitno, sf, !quiet);
+    } else
+      one = file[k];
+
+    /* Abort at the first file in error, as if measured one at a time */
+    if (one.status != 0) {
+      errno = one.err;
+      KILL (FileIn, one.status);
     }
-
-    /* Move pointer to 1st block of interest */
-    if (fseek (Fi, start_byte, 0) < 0l)
-      KILL (FileIn, 4);
-
-
-    /* ... MEASUREMENT OF ACTIVE SPEECH LEVEL ACCORDING P.56 ... */
-
-    /* Read samples ... */
-    if (!quiet)
-      fprintf (stderr, "  Processing \r");
-    for (i = 0; i < N2; i++) {
-      if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
-        /* ... Convert samples to float */
-        sh2fl ((long) l, buffer, Buf, bitno, 1);
-
-        /* ... Get the active level */
-        ActiveLeveldB = speech_voltmeter (Buf, (long) l, &state);
-
-        /* Print progress flag */
-        if (!quiet)
-          fprintf (stderr, "%c\r", funny[i % funny_size]);
-      } else {
-        KILL (FileIn, 5);
-      }
-    }
-    if (!quiet)
-      fprintf (stderr, "\n");
+    state = one.state;
+    ActiveLeveldB = one.ActiveLeveldB;
+    N2 = one.N2;
 
 #ifdef LOCAL_PRINT
     /* Convert absolute maximum sample to dB */
@@ -679,12 +847,13 @@ int main (int argc, char *argv[]) {
     else
       print_act_short_summary (out, FileIn, state, ActiveLeveldB, Overflow, gain);
 #endif /* LOCAL_PRINT */
-
-    /* Close current file */
-    fclose (Fi);
   }
 
   /* FINALIZATIONS */
+  /* ... Release the measurements of option -threads */
+  if (file != NULL)
+    free (file);
+
   /* ... Close log file, if it is the case */
   if (out != stdout)
     fclose (out);
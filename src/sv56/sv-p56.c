@@ -1,4 +1,4 @@
-/*                                                             v2.3 19.MAY.05
+/*                                                             v2.4 17.OCT.26
 =============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -40,6 +40,10 @@ speech_voltmeter .............. measurement of the active speech level of
                                 data in a buffer according to P.56. Other
 				relevant statistics are also available.
 
+speech_voltmeter_ref .......... same as speech_voltmeter(), processing the
+                                data sample by sample and threshold by
+                                threshold as in the original implementation.
+
 HISTORY:
 
    07.Oct.91 v1.0 Release of 1st version to UGST.
@@ -57,6 +61,12 @@ HISTORY:
 				  suggested by Mr Kabal.
 				  Upper and lower bounds are updated during the interpolation.
 						<Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com>
+   17.Oct.26 v2.4 Block-based speech_voltmeter(): process 1 (peaks and sums)
+                  with SIMD instructions, and activity counting on a sliding
+                  maximum of the threshold level of the envelope instead of
+                  updating the 15 thresholds per sample. The state is
+                  bit-exact with the original implementation, kept as
+                  speech_voltmeter_ref().
 
 =============================================================================
 */
@@ -68,11 +78,29 @@ HISTORY:
 /* System includes ... */
 #include <math.h>
 
+/* SIMD instructions for the peak and sum measurements */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SV_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 /* Specific includes ... */
 #ifndef SPEECH_VOLTMETER_defined
 #include "sv-p56.h"
 #endif
 
+/*
+ * .................... LOCAL PROTOTYPES ....................
+ */
+static void svp56_process1 ARGS ((float *buffer, long smpno, SVP56_state * state));
+#ifdef SV_HAVE_SSE2
+static int svp56_process1_sse2 ARGS ((float *buffer, long smpno, SVP56_state * state));
+#endif
+static int svp56_process2 ARGS ((float *buffer, long smpno, SVP56_state * state, double g, long I));
+static void svp56_thresholds ARGS ((double x, SVP56_state * state, double g, unsigned long I));
+static double svp56_active_level ARGS ((SVP56_state * state));
+
+
 /*
  * .................... FUNCTIONS ....................
  */
@@ -305,13 +333,27 @@ void init_speech_voltmeter (SVP56_state * state, double sampl_freq) {
         state          I/O       state variable associated with `buffer'
 
 
+        The buffer is processed as a block: the peaks and sums of
+        Process 1 are measured in one pass (with SIMD instructions, if
+        available, whenever the sums remain exact, e.g. for data
+        converted from 16-bit samples), then the envelope recursion of
+        Process 2 is run sample by sample, in double precision as
+        before. Instead of comparing the envelope with the 15
+        thresholds for every sample, the highest threshold exceeded in
+        the last I+1 samples (which, with the hangover, is the number
+        of activity counters to increment) is kept as a sliding maximum,
+        and the activity counters are updated from its histogram at the
+        end of the block. The resulting state is the same, bit by bit,
+        as with speech_voltmeter_ref().
+
         Value returned:
         ~~~~~~~~~~~~~~~
         Returns the active speech level, in dBov, as a double.
 
         Functions used:
         ~~~~~~~~~~~~~~~
-        > bin_interp, from this module;
+        > bin_interp, svp56_process1, svp56_process2,
+          svp56_thresholds, svp56_active_level, from this module;
         > exp, fabs, log10, pow, from standard library <math.h>;
 
         Prototype:   in sv-p56.h
@@ -336,6 +378,8 @@ void init_speech_voltmeter (SVP56_state * state, double sampl_freq) {
 				DEC Alpha VMS workstation and extended
                                 to ther platforms as well. Exceptions are
                                 VMS and gcc on PC. <simao@ctd.comsat.com>
+        17.Oct.26     2.4       Block-based processing; the sample by sample
+                                version is speech_voltmeter_ref().
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 */
 #define T        0.03           /* in [s] */
@@ -347,10 +391,69 @@ void init_speech_voltmeter (SVP56_state * state, double sampl_freq) {
 #define MIN_LOG_OFFSET 1.0e-20
 
 double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
-  int I, j;
+  long I;
+  double g;
+
+
+  /* Some initializations */
+  I = floor (H * state->f + 0.5);
+  g = exp (-1.0 / (state->f * T));
+
+  /* Implements Process 1 of P.56 */
+  svp56_process1 (buffer, smpno, state);
+
+  /* Implements Process 2 of P.56; falls back to the sample by sample threshold loop if the state is not one the block algorithm can represent */
+  if (!svp56_process2 (buffer, smpno, state, g, I)) {
+    long k;
+
+    for (k = 0; k < smpno; k++)
+      svp56_thresholds ((double) buffer[k], state, g, (unsigned long) I);
+  }
+
+  /* Computes the statistics */
+  return svp56_active_level (state);
+}
+
+/* .................... End of speech_voltmeter() ........................ */
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        double speech_voltmeter_ref (float *buffer, long smpno,
+        ~~~~~~~~~~~~~~~~~~~~~~~~~~~  SVP56_state *state);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Same as speech_voltmeter(), processing the data sample by
+        sample and, for each sample, threshold by threshold, as in the
+        original implementation of the module. Kept as a reference.
+
+        Variables:
+        ~~~~~~~~~~
+        Name:         Type:   Use:
+        buffer          I        input samples vector
+        smpno           I        number of samples in vector `buffer'
+        state          I/O       state variable associated with `buffer'
+
+        Value returned:
+        ~~~~~~~~~~~~~~~
+        Returns the active speech level, in dBov, as a double.
+
+        Prototype:   in sv-p56.h
+        ~~~~~~~~~~
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Sample by sample loop of speech_voltmeter()
+                                v2.2, moved to its own function.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+double speech_voltmeter_ref (float *buffer, long smpno, SVP56_state * state) {
+  unsigned long I;
   long k;
-  double g, x, AdB, CdB, AmdB, CmdB, ActiveSpeechLevel;
-  double LongTermLevel, Delta[15];
+  double g, x;
 
 
   /* Some initializations */
@@ -376,23 +479,391 @@ double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
     (state->n)++;
 
     /* Implements Process 2 of P.56 */
-    state->p = g * (state->p) + (1 - g) * ((x > 0) ? x : -x);
-    state->q = g * (state->q) + (1 - g) * (state->p);
-
-    /* Applies threshold to the envelope q */
-    for (j = 0; j < THRES_NO; j++) {
-      if ((state->q) >= state->c[j]) {
-        state->a[j]++;
-        state->hang[j] = 0;
-      }
-      if (((state->q) < state->c[j]) && (state->hang[j] < I)) {
-        state->a[j]++;
-        state->hang[j] += 1;
-      }
-      /* if (((state->q)<state->c[j])&&(state->hang[j]=I)), do nothing */
-    }                           /* [j] */
+    svp56_thresholds (x, state, g, I);
   }                             /* [k] */
 
+  /* Computes the statistics */
+  return svp56_active_level (state);
+}
+
+/* .................. End of speech_voltmeter_ref() ...................... */
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        void svp56_thresholds (double x, SVP56_state *state, double g,
+        ~~~~~~~~~~~~~~~~~~~~~  unsigned long I);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Process 2 of P.56 for one sample x: updates the envelope q with
+        the smoothing coefficient g and applies the thresholds to it,
+        with a hangover of I samples. Used by speech_voltmeter_ref()
+        and, when the block algorithm cannot be used, by
+        speech_voltmeter().
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Threshold loop of speech_voltmeter() v2.2,
+                                moved to its own function.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+static void svp56_thresholds (double x, SVP56_state * state, double g, unsigned long I) {
+  int j;
+
+  state->p = g * (state->p) + (1 - g) * ((x > 0) ? x : -x);
+  state->q = g * (state->q) + (1 - g) * (state->p);
+
+  /* Applies threshold to the envelope q */
+  for (j = 0; j < THRES_NO; j++) {
+    if ((state->q) >= state->c[j]) {
+      state->a[j]++;
+      state->hang[j] = 0;
+    }
+    if (((state->q) < state->c[j]) && (state->hang[j] < I)) {
+      state->a[j]++;
+      state->hang[j] += 1;
+    }
+    /* if (((state->q)<state->c[j])&&(state->hang[j]=I)), do nothing */
+  }                             /* [j] */
+}
+
+/* .................... End of svp56_thresholds() ...................... */
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        void svp56_process1 (float *buffer, long smpno, SVP56_state *state);
+        ~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Process 1 of P.56 for a block of samples: updates the absolute,
+        positive and negative peaks, the sum and the sum of squares of
+        the samples and the sample counter.
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Release of first version
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+static void svp56_process1 (float *buffer, long smpno, SVP56_state * state) {
+  long k;
+  double x;
+
+#ifdef SV_HAVE_SSE2
+  if (svp56_process1_sse2 (buffer, smpno, state))
+    return;
+#endif
+
+  for (k = 0; k < smpno; k++) {
+    x = (double) buffer[k];
+    if (fabs (x) > state->max)
+      state->max = fabs (x);
+    if (x > state->maxP)
+      state->maxP = x;
+    if (x < state->maxN)
+      state->maxN = x;
+    (state->sq) += x * x;
+    (state->s) += x;
+    (state->n)++;
+  }
+}
+
+/* ..................... End of svp56_process1() ....................... */
+
+
+#ifdef SV_HAVE_SSE2
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        int svp56_process1_sse2 (float *buffer, long smpno,
+        ~~~~~~~~~~~~~~~~~~~~~~~  SVP56_state *state);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Process 1 of P.56 with SSE2 instructions, 4 samples at a time.
+        Peaks do not depend on the order of the samples (the sign of a
+        zero peak, which does, is taken from the first zero sample as in
+        the sample by sample loop). The sums do, unless all of them are
+        exact: this is the case when the samples are multiples of 2^-15
+        in the range -1..1 (as obtained from 16-bit or shorter data),
+        the previous sums are multiples of 2^-15 and 2^-30, and the sum
+        of squares stays below 2^23. The block is then summed in any
+        order with the same result, bit by bit, as sample by sample.
+
+        Value returned:
+        ~~~~~~~~~~~~~~~
+        Returns 1 if the block was processed, 0 (state unchanged) if the
+        sums would not be exact.
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Release of first version
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+static int svp56_process1_sse2 (float *buffer, long smpno, SVP56_state * state) {
+  __m128 v, vabs, vmax, vmaxP, vmaxN, vscaled, vlattice, sign;
+  __m128d s0, s1, sq0, sq1, lo, hi;
+  float bmax, bmaxP, bmaxN, f4[4];
+  double s[2], sq[2], bs, bsq;
+  long k, n4 = smpno & ~3L;
+
+  if (n4 == 0)
+    return 0;
+
+  sign = _mm_set1_ps (-0.0f);
+  vmax = _mm_setzero_ps ();
+  vmaxP = vmaxN = _mm_loadu_ps (buffer);
+  vlattice = _mm_castsi128_ps (_mm_set1_epi32 (-1));
+  s0 = s1 = sq0 = sq1 = _mm_setzero_pd ();
+
+  for (k = 0; k < n4; k += 4) {
+    v = _mm_loadu_ps (buffer + k);
+
+    /* Peaks */
+    vabs = _mm_andnot_ps (sign, v);
+    vmax = _mm_max_ps (vmax, vabs);
+    vmaxP = _mm_max_ps (vmaxP, v);
+    vmaxN = _mm_min_ps (vmaxN, v);
+
+    /* Samples must be integer multiples of 2^-15 for exact sums */
+    vscaled = _mm_mul_ps (v, _mm_set1_ps (32768.0f));
+    vlattice = _mm_and_ps (vlattice, _mm_cmpeq_ps (vscaled, _mm_cvtepi32_ps (_mm_cvtps_epi32 (vscaled))));
+
+    /* Sums, in double */
+    lo = _mm_cvtps_pd (v);
+    hi = _mm_cvtps_pd (_mm_movehl_ps (v, v));
+    s0 = _mm_add_pd (s0, lo);
+    s1 = _mm_add_pd (s1, hi);
+    sq0 = _mm_add_pd (sq0, _mm_mul_pd (lo, lo));
+    sq1 = _mm_add_pd (sq1, _mm_mul_pd (hi, hi));
+  }
+
+  /* Reduce lanes */
+  _mm_storeu_ps (f4, vmax);
+  bmax = f4[0];
+  for (k = 1; k < 4; k++)
+    if (f4[k] > bmax)
+      bmax = f4[k];
+  _mm_storeu_ps (f4, vmaxP);
+  bmaxP = f4[0];
+  for (k = 1; k < 4; k++)
+    if (f4[k] > bmaxP)
+      bmaxP = f4[k];
+  _mm_storeu_ps (f4, vmaxN);
+  bmaxN = f4[0];
+  for (k = 1; k < 4; k++)
+    if (f4[k] < bmaxN)
+      bmaxN = f4[k];
+  _mm_storeu_pd (s, _mm_add_pd (s0, s1));
+  _mm_storeu_pd (sq, _mm_add_pd (sq0, sq1));
+  bs = s[0] + s[1];
+  bsq = sq[0] + sq[1];
+  if (_mm_movemask_ps (vlattice) != 0xF)
+    return 0;
+
+  /* Remaining samples */
+  for (k = n4; k < smpno; k++) {
+    if (buffer[k] * 32768.0f != floor (buffer[k] * 32768.0f))
+      return 0;
+    if (fabs (buffer[k]) > bmax)
+      bmax = fabs (buffer[k]);
+    if (buffer[k] > bmaxP)
+      bmaxP = buffer[k];
+    if (buffer[k] < bmaxN)
+      bmaxN = buffer[k];
+    bs += (double) buffer[k];
+    bsq += (double) buffer[k] * buffer[k];
+  }
+
+  /* All partial sums must be exact */
+  if (bmax > 1.0f || state->s * 32768.0 != floor (state->s * 32768.0) || state->sq * 1073741824.0 != floor (state->sq * 1073741824.0) || state->sq + (double) smpno * bmax * bmax >= 8388608.0 || fabs (state->s) + (double) smpno >= 274877906944.0)
+    return 0;
+
+  /* Update the state */
+  if (bmax > state->max)
+    state->max = bmax;
+  if (bmaxP > state->maxP) {
+    state->maxP = bmaxP;
+    if (bmaxP == 0)             /* sign of the first zero sample */
+      for (k = 0; k < smpno; k++)
+        if (buffer[k] == 0) {
+          state->maxP = buffer[k];
+          break;
+        }
+  }
+  if (bmaxN < state->maxN) {
+    state->maxN = bmaxN;
+    if (bmaxN == 0)             /* sign of the first zero sample */
+      for (k = 0; k < smpno; k++)
+        if (buffer[k] == 0) {
+          state->maxN = buffer[k];
+          break;
+        }
+  }
+  state->s += bs;
+  state->sq += bsq;
+  state->n += smpno;
+  return 1;
+}
+
+/* ................... End of svp56_process1_sse2() ..................... */
+#endif
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        int svp56_process2 (float *buffer, long smpno, SVP56_state *state,
+        ~~~~~~~~~~~~~~~~~~  double g, long I);
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Process 2 of P.56 for a block of samples: envelope recursion and
+        activity counting for all thresholds.
+
+        A sample is counted as active for threshold c[j] if the envelope
+        q was >= c[j] in this or one of the I previous samples (hangover).
+        Since the thresholds increase with j, the counters incremented
+        are a[0..L-1], L being the highest number of thresholds exceeded
+        by q in the last I+1 samples. L is found as a sliding maximum,
+        with a queue of (time, level) pairs of strictly decreasing
+        levels; the histogram of L gives the counters at the end of the
+        block. The hangover counts are converted to the queue at the
+        start of the block and back at the end, hang[j] being the number
+        of samples since q last exceeded c[j], limited to I.
+
+        Value returned:
+        ~~~~~~~~~~~~~~~
+        Returns 1 if the block was processed, 0 (state unchanged) if the
+        thresholds are not increasing or the hangover counts are not
+        consistent with a state produced by init_speech_voltmeter() and
+        speech_voltmeter().
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Release of first version
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+#define QUEUE_LEN 16            /* power of 2, > THRES_NO */
+
+static int svp56_process2 (float *buffer, long smpno, SVP56_state * state, double g, long I) {
+  long tq[QUEUE_LEN];           /* times of the queue entries */
+  int lq[QUEUE_LEN];            /* levels of the queue entries */
+  unsigned long hist[THRES_NO + 1];     /* histogram of the sliding max. level */
+  unsigned head = 0, tail = 0;  /* oldest entry, one past the newest entry */
+  unsigned long acc;
+  long k;
+  int j, level;
+  double x, p, q, *c = state->c;
+
+  /* Check that the state can be represented by the queue */
+  for (j = 0; j < THRES_NO; j++) {
+    if (state->hang[j] > (unsigned long) I)
+      return 0;
+    if (j > 0 && (state->c[j] <= state->c[j - 1] || state->hang[j] < state->hang[j - 1]))
+      return 0;
+  }
+
+  /* Hangover counts to queue (times relative to the first sample) */
+  for (j = THRES_NO - 1; j >= 0; j--)
+    if (state->hang[j] < (unsigned long) I && (tail == head || tq[(tail - 1) % QUEUE_LEN] != -1 - (long) state->hang[j])) {
+      tq[tail % QUEUE_LEN] = -1 - (long) state->hang[j];
+      lq[tail % QUEUE_LEN] = j + 1;
+      tail++;
+    }
+
+  for (j = 0; j <= THRES_NO; j++)
+    hist[j] = 0;
+
+  p = state->p;
+  q = state->q;
+  for (k = 0; k < smpno; k++) {
+    /* Envelope */
+    x = (double) buffer[k];
+    p = g * p + (1 - g) * ((x > 0) ? x : -x);
+    q = g * q + (1 - g) * p;
+
+    /* Number of thresholds exceeded by q: binary search over the 15 increasing thresholds, without branches */
+    level = (q >= c[7]) ? 8 : 0;
+    level += (q >= c[level + 3]) ? 4 : 0;
+    level += (q >= c[level + 1]) ? 2 : 0;
+    level += (q >= c[level]) ? 1 : 0;
+
+    /* Push it, dropping entries it supersedes; expire old entries */
+    if (level > 0) {
+      while (tail != head && lq[(tail - 1) % QUEUE_LEN] <= level)
+        tail--;
+      tq[tail % QUEUE_LEN] = k;
+      lq[tail % QUEUE_LEN] = level;
+      tail++;
+    }
+    while (tail != head && k - tq[head % QUEUE_LEN] > I)
+      head++;
+
+    /* Sliding maximum: the oldest entry has the highest level */
+    hist[(tail != head) ? lq[head % QUEUE_LEN] : 0]++;
+  }
+  state->p = p;
+  state->q = q;
+
+  /* Activity counts: a[j] counts the samples with sliding max. > j */
+  for (acc = 0, j = THRES_NO; j > 0; j--) {
+    acc += hist[j];
+    state->a[j - 1] += acc;
+  }
+
+  /* Queue back to hangover counts */
+  for (j = 0; j < THRES_NO; j++) {
+    while (tail != head && lq[(tail - 1) % QUEUE_LEN] <= j)
+      tail--;
+    if (tail == head || (smpno - 1) - tq[(tail - 1) % QUEUE_LEN] >= I)
+      state->hang[j] = I;
+    else
+      state->hang[j] = (smpno - 1) - tq[(tail - 1) % QUEUE_LEN];
+  }
+  return 1;
+}
+
+#undef QUEUE_LEN
+/* ..................... End of svp56_process2() ....................... */
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        double svp56_active_level (SVP56_state *state);
+        ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+        Description:
+        ~~~~~~~~~~~~
+
+        Computes the statistics of the state (DC level, rms level,
+        activity factor) and the active speech level from the activity
+        counters, interpolating between thresholds by bin_interp().
+
+        Value returned:
+        ~~~~~~~~~~~~~~~
+        Returns the active speech level, in dBov, as a double.
+
+        Log of changes:
+        ~~~~~~~~~~~~~~~
+        17.Oct.26     1.0       Moved out of speech_voltmeter() v2.2.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+static double svp56_active_level (SVP56_state * state) {
+  int j;
+  double AdB, CdB, AmdB, CmdB, ActiveSpeechLevel;
+  double LongTermLevel, Delta[15];
+
+
   /* Computes the statistics */
   state->DClevel = (state->s) / (state->n);
   LongTermLevel = 10 * log10 ((state->sq) / (state->n) + MIN_LOG_OFFSET);
@@ -440,4 +911,4 @@ double speech_voltmeter (float *buffer, long smpno, SVP56_state * state) {
 #undef H
 #undef T
 #undef THRES_NO
-/* .................... End of speech_voltmeter() ........................ */
+/* .................. End of svp56_active_level() ...................... */
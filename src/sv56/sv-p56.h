@@ -1,6 +1,6 @@
 /*
   ============================================================================
-   File: SV-P56.H                                             01.SEP.1995 v2.2
+   File: SV-P56.H                                             17.OCT.2026 v2.4
   ============================================================================
 
                       UGST/ITU-T SPEECH VOLTMETER MODULE
@@ -23,11 +23,13 @@
                         <tdsimao@venus.cpqd.ansp.br>
    01.Sep.95    v2.2    Updated version number to match sv-p56.c and added 
                         smart prototypes <simao@ctd.comsat.com>
+   17.Oct.26    v2.4    Prototype of speech_voltmeter_ref(), the sample by
+                        sample version of the block-based speech_voltmeter()
 
   ============================================================================
 */
 #ifndef SPEECH_VOLTMETER_defined
-#define SPEECH_VOLTMETER_defined 220
+#define SPEECH_VOLTMETER_defined 240
 
 /* DEFINITION FOR SMART PROTOTYPES */
 #ifndef ARGS
@@ -61,6 +63,7 @@ typedef struct {
 double bin_interp ARGS ((double upcount, double lwcount, double upthr, double lwthr, double Margin, double tol));
 void init_speech_voltmeter ARGS ((SVP56_state * state, double sampl_freq));
 double speech_voltmeter ARGS ((float *buffer, long smpno, SVP56_state * state));
+double speech_voltmeter_ref ARGS ((float *buffer, long smpno, SVP56_state * state));
 
 
 /* Definitions for getting statistics from a `SVP56_state' variable */
@@ -1,4 +1,4 @@
-/*                                                              v3.5 02.Feb.10
+/*                                                              v3.7 17.Oct.26
   ============================================================================
 
   SV56DEMO.C
@@ -69,8 +69,17 @@
   -q ............. quit operation - does not print the progress flag.
                    Saves time and avoids trash in batch processings.
   -qq ............ print short statistics summary; no progress flag.
+  -ref ........... measure with the sample by sample reference speech
+                   voltmeter (speech_voltmeter_ref()); the results are
+                   the same as with the default block-based one.
   -rms ........... normalizes the output file using the RMS long-term level,
                    instead of the active speech level.
+  -stream ........ read the input file only once: the samples measured are
+                   kept in memory (up to the -spill limit, the rest in a
+                   temporary file) and equalized from there, rather than
+                   read again from the input file. The output is the same.
+  -spill n ....... keep at most `n' samples in memory in -stream mode;
+                   implies -stream [default: 8388608 samples, i.e. 16 MB]
   -sf f .......... set sampling frequency to `f' Hz; equivalent to parameter
                    SampleRate above.
   -blk len  ...... is the block size in number of samples;
@@ -155,6 +164,10 @@
                            a multiple of the block size <simao>.
   02.Feb.10     3.5        Modified maximum string length to avoid
                            buffer overruns (y.hiwasaki)
+  17.Oct.26     3.6        Added option -ref to use the sample by sample
+                           reference speech voltmeter.
+  17.Oct.26     3.7        Added options -stream and -spill to read the
+                           input file only once.
 
   ============================================================================
 */
@@ -188,6 +201,18 @@
 
 /* Local definitions */
 #define MIN_LOG_OFFSET 1.0e-20  /* To avoid sigularity with log(0.0) */
+#define SPILL_DEFAULT  8388608L /* Default in-memory samples for -stream */
+
+
+/* Store of the measured samples for the -stream mode */
+typedef struct {
+  short *mem;                   /* in-memory part */
+  long nmem;                    /* samples held in memory */
+  long size;                    /* allocated length of mem */
+  long maxmem;                  /* upper limit of the in-memory part */
+  FILE *spill;                  /* temporary file for samples beyond maxmem */
+  long pos;                     /* read position in mem */
+} SV_STORE;
 
 /*
  -------------------------------------------------------------------------
@@ -202,7 +227,7 @@
  -------------------------------------------------------------------------
 */
 void display_usage () {
-  printf ("SV56DEMO.C: Version 3.5 of 02.Feb.2010 \n\n");
+  printf ("SV56DEMO.C: Version 3.7 of 17.Oct.2026 \n\n");
   printf ("  Program to level-equalize a speech file \"NdB\" dBs below\n");
   printf ("  the overload point for a linear n-bit (default: 16 bit) system.\n");
   printf ("  using the P.56 speech voltmeter algorithm.\n");
@@ -243,6 +268,11 @@ void display_usage () {
   printf ("  -q .......... quiet operation - does not print the progress flag.\n");
   printf ("                Saves time and avoids trash in batch processings.\n");
   printf ("  -qq ......... print short statistics summary; no progress flag.\n");
+  printf ("  -ref ........ use the sample by sample reference speech voltmeter\n");
+  printf ("  -stream ..... read the input file only once, equalizing from a\n");
+  printf ("                copy in memory (or a temporary file past -spill)\n");
+  printf ("  -spill n .... max. samples in memory for -stream, implies -stream\n");
+  printf ("                [default: 8388608 samples]\n");
 
   /* Quit program */
   exit (-128);
@@ -251,6 +281,91 @@ void display_usage () {
 /* .................... End of display_usage() ........................... */
 
 
+/*
+ -------------------------------------------------------------------------
+ int store_put (SV_STORE *st, short *buf, long l);
+ ~~~~~~~~~~~~~
+ Append l samples to the -stream store: to memory while below the
+ in-memory limit, to a temporary file after that. Returns 0 on success,
+ or -1 if the temporary file could not be created or written.
+
+ History:
+ ~~~~~~~~
+ 17.Oct.26 v1.0 Created.
+ -------------------------------------------------------------------------
+*/
+int store_put (SV_STORE * st, short *buf, long l) {
+  long k, size;
+  short *mem;
+
+  /* In-memory part, grown geometrically up to the limit */
+  k = st->maxmem - st->nmem;
+  if (k > l)
+    k = l;
+  if (k > 0 && st->spill == NULL) {
+    if (st->nmem + k > st->size) {
+      for (size = st->size ? st->size : 65536; size < st->nmem + k; size *= 2);
+      if (size > st->maxmem)
+        size = st->maxmem;
+      if ((mem = (short *) realloc (st->mem, size * sizeof (short))) == NULL) {
+        /* Keep what fits, the rest goes to the temporary file */
+        st->maxmem = st->nmem;
+        k = 0;
+      } else {
+        st->mem = mem;
+        st->size = size;
+      }
+    }
+    memcpy (st->mem + st->nmem, buf, k * sizeof (short));
+    st->nmem += k;
+    buf += k;
+    l -= k;
+  }
+
+  /* Remainder goes to the temporary file */
+  if (l > 0) {
+    if (st->spill == NULL && (st->spill = tmpfile ()) == NULL)
+      return -1;
+    if (fwrite (buf, sizeof (short), l, st->spill) != (size_t) l)
+      return -1;
+  }
+  return 0;
+}
+
+/* .................... End of store_put() ........................... */
+
+
+/*
+ -------------------------------------------------------------------------
+ long store_get (SV_STORE *st, short *buf, long n);
+ ~~~~~~~~~~~~~~
+ Read back up to n samples from the -stream store, in the order they were
+ stored, first from memory then from the temporary file. Returns the
+ number of samples read, 0 at the end of the store.
+
+ History:
+ ~~~~~~~~
+ 17.Oct.26 v1.0 Created.
+ -------------------------------------------------------------------------
+*/
+long store_get (SV_STORE * st, short *buf, long n) {
+  long k = st->nmem - st->pos;
+
+  if (k > n)
+    k = n;
+  if (k > 0) {
+    memcpy (buf, st->mem + st->pos, k * sizeof (short));
+    st->pos += k;
+  } else
+    k = 0;
+  if (k < n && st->spill != NULL)
+    k += (long) fread (buf + k, sizeof (short), n - k, st->spill);
+  return k;
+}
+
+/* .................... End of store_get() ........................... */
+
+
 /*
   ============================================================================
 
@@ -439,10 +554,12 @@ int main (int argc, char *argv[]) {
 #endif
 
   /* Other variables */
-  char quiet = 0, use_active_level = 1, long_summary = 1;
+  char quiet = 0, use_active_level = 1, long_summary = 1, stream = 0;
+  SV_STORE store;
+  double (*voltmeter) (float *, long, SVP56_state *) = speech_voltmeter;
   short buffer[4096];
   float Buf[4096];
-  long NrSat = 0, start_byte, bitno = 16;
+  long NrSat = 0, start_byte, bitno = 16, spill = SPILL_DEFAULT;
   double sf = 16000, factor;
   double ActiveLeveldB, DesiredSpeechLeveldB;
   static char funny[5] = { '/', '-', '\\', '|', '-' };
@@ -534,6 +651,28 @@ int main (int argc, char *argv[]) {
         quiet = 1;
         long_summary = 0;
 
+        /* Move argv over the option to the next argument */
+        argv++;
+        argc--;
+      } else if (strcmp (argv[1], "-stream") == 0) {
+        /* Read the input file only once */
+        stream = 1;
+
+        /* Move argv over the option to the next argument */
+        argv++;
+        argc--;
+      } else if (strcmp (argv[1], "-spill") == 0) {
+        /* Change the in-memory limit of the stream mode */
+        spill = atol (argv[2]);
+        stream = 1;
+
+        /* Update argc/argv to next valid option/argument */
+        argv += 2;
+        argc -= 2;
+      } else if (strcmp (argv[1], "-ref") == 0) {
+        /* Use the sample by sample reference implementation */
+        voltmeter = speech_voltmeter_ref;
+
         /* Move argv over the option to the next argument */
         argv++;
         argc--;
@@ -577,6 +716,10 @@ int main (int argc, char *argv[]) {
   /* reset variables for speech level measurements */
   init_speech_voltmeter (&state, sf);
 
+  /* empty store for the stream mode */
+  memset (&store, 0, sizeof (store));
+  store.maxmem = spill > 0 ? spill : 0;
+
 
 /*
  * ......... FILE PREPARATION .........
@@ -608,11 +751,15 @@ int main (int argc, char *argv[]) {
   for (i = 0; i < N2; i++) {
     /* Read samples ... */
     if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
+      /* ... Keep a copy to equalize from, in stream mode */
+      if (stream && store_put (&store, buffer, (long) l) < 0)
+        KILL ("temporary file", 6);
+
       /* ... Convert samples to float */
       sh2fl ((long) l, buffer, Buf, bitno, 1);
 
       /* ... Get the active level */
-      ActiveLeveldB = speech_voltmeter (Buf, (long) l, &state);
+      ActiveLeveldB = voltmeter (Buf, (long) l, &state);
 
       /* Print some preliminary information */
       if (!quiet)
@@ -644,13 +791,20 @@ int main (int argc, char *argv[]) {
 
   /* EQUALIZATION: hard clipping (with truncation) */
 
-  /* Move pointer to 1st desired block */
-  if (fseek (Fi, start_byte, 0) < 0l)
+  /* Move pointer to 1st desired block, or to the start of the store */
+  if (stream) {
+    if (store.spill != NULL && fseek (store.spill, 0l, 0) < 0l)
+      KILL ("temporary file", 4);
+  } else if (fseek (Fi, start_byte, 0) < 0l)
     KILL (FileIn, 4);
 
   /* Get data of interest, equalize and de-normalize */
   for (i = 0; i < N2; i++) {
-    if ((l = fread (buffer, sizeof (short), N, Fi)) > 0) {
+    if (stream)
+      l = store_get (&store, buffer, N);
+    else
+      l = fread (buffer, sizeof (short), N, Fi);
+    if (l > 0) {
       /* convert samples to float */
       sh2fl ((long) l, buffer, Buf, bitno, 1);
 
@@ -682,6 +836,10 @@ int main (int argc, char *argv[]) {
   /* Close files ... */
   fclose (Fi);
   fclose (Fo);
+  if (store.spill != NULL)
+    fclose (store.spill);
+  if (store.mem != NULL)
+    free (store.mem);
   if (out != stdout)
     fclose (out);
 #if !defined(VMS)
@@ -1,4 +1,4 @@
-/*                                                          02/Feb/2010 v1.3 */
+/*                                                          17/Oct/2026 v1.4 */
 /*=============================================================================
 
                           U    U   GGG    SSSS  TTTTT
@@ -38,6 +38,10 @@
                   modified maximum string length to avoid buffer overruns
                   (y.hiwasaki)
 
+  17.Oct.26 v1.4  G.192 bitstreams with sync headers are mapped in memory
+                  and indexed (g192bs.c); frames are truncated in place,
+                  without a read per frame, and without frame size limit.
+
   AUTHORS :
 	Cyril Guillaume & Stephane Ragot -- stephane.ragot@francetelecom.com
 
@@ -51,6 +55,7 @@
 /* UGST modules */
 #include "../utl/ugstdemo.h"
 #include "../eid/softbit.h"
+#include "../eid/g192bs.h"
 #include "trunc-lib.h"
 
 /* G.192 constants */
@@ -61,7 +66,7 @@
 #define MAX_BST_LENGTH 2560
 
 static void display_usage () {
-  printf ("TRUNCATE.C - Version 1.3 of 02.Feb.2010 \n\n");
+  printf ("TRUNCATE.C - Version 1.4 of 17.Oct.2026 \n\n");
 
   printf (" Bitstream truncation program\n");
   printf (" This program truncates a bitstream to obtain intermediate bitrates\n");
@@ -141,11 +146,13 @@ int main (int argc, char *argv[]) {
   FILE *pfilout;                /* output bitstream file */
   FILE *pfilrate = NULL;        /* bitrate file */
   FILE *pfiltmp;                /* temporary bitstream file */
+  G192_BS *bs = NULL;           /* mapped input bitstream (G.192 with sync header) */
   char filin[MAX_STRLEN];       /* name of the input bitstream file */
   char filout[MAX_STRLEN];      /* name of the output bitstream file */
 
   /* buffers */
   short bstIn[MAX_BST_LENGTH];  /* input frame */
+  short *inpFrame;              /* input frame payload */
   short *outFrame;              /* output frame */
 
   /* Algorithm variables */
@@ -163,6 +170,7 @@ int main (int argc, char *argv[]) {
   short nbWords;
   short nbBitsOut;
   int nbWrd;
+  long iframe = 0;
 
 
   /* ......... GET PARAMETERS ......... */
@@ -270,6 +278,15 @@ int main (int argc, char *argv[]) {
     /* open converted bitstream as input bitstream file */
     rewind (pfiltmp);
     pfilin = pfiltmp;
+  } else {
+    /* G.192 with sync header: map and index the frames */
+    if ((bs = open_g192_bs (filin)) != NULL && index_g192_frames (bs) >= 0) {
+      fclose (pfilin);
+      pfilin = NULL;
+    } else {
+      close_g192_bs (bs);
+      bs = NULL;
+    }
   }
 
   /* check output bistream file */
@@ -289,7 +306,30 @@ int main (int argc, char *argv[]) {
   /* ......... PROCESSING .......... */
 
   /* loop over bitstream file */
-  while ((fread (&sync, 2, 1, pfilin) != 0) && (fread (&nbWords, 2, 1, pfilin) != 0)) { /* read the sync and framelength words */
+  while (1) {
+    if (bs != NULL) {
+      /* mapped bitstream: next frame of the index */
+      if (iframe == bs->nframes) {
+        if (bs->tail >= 2) {
+          /* invalid sync word or incomplete frame */
+          sync = ((short *) bs->data)[bs->frame_pos[iframe - 1] + bs->frame_len[iframe - 1] + 2];
+          nbWrd = -1;
+        } else
+          break;
+      } else {
+        inpFrame = (short *) bs->data + bs->frame_pos[iframe++];
+        sync = inpFrame[0];
+        nbWords = inpFrame[1];
+        nbWrd = (int) nbWords;
+        inpFrame += 2;
+      }
+    } else {
+      /* read the sync and framelength words */
+      if ((fread (&sync, 2, 1, pfilin) == 0) || (fread (&nbWords, 2, 1, pfilin) == 0))
+        break;
+      nbWrd = (int) nbWords;
+      inpFrame = bstIn;
+    }
 
     /* check sync word */
     if (!((sync <= SYNC_WORD_MAX) && (sync >= SYNC_WORD_MIN) || (sync == BAD_FRAME))) {
@@ -297,11 +337,11 @@ int main (int argc, char *argv[]) {
       exit (-1);
     }
 
-    nbWrd = (int) nbWords;
-
     /* read frame */
-    if (((int) fread (bstIn, 2, nbWrd, pfilin)) != nbWrd) {
+    if (nbWrd < 0 || (pfilin != NULL && ((int) fread (bstIn, 2, nbWrd, pfilin)) != nbWrd)) {
       fprintf (stderr, "Warning: Incomplete last frame, ignored");
+      if (bs != NULL)
+        break;
     } else {
       if (mode == 0) {
         /* read bitrate file */
@@ -325,17 +365,24 @@ int main (int argc, char *argv[]) {
         nbBitsOut = nbWrd;
         fprintf (stderr, "Warning: Desired bitrate is greater than input bitrate, input bitrate is chosen;\n");
       }
-      /* allocate memory for the output frame */
-      outFrame = malloc (sizeof (outFrame[0]) * (nbBitsOut + 2));
+      if (bs != NULL) {
+        /* write the header, then the truncated payload in place */
+        fwrite (&sync, sizeof (short), 1, pfilout);
+        fwrite (&nbBitsOut, sizeof (short), 1, pfilout);
+        fwrite (inpFrame, sizeof (short), nbBitsOut, pfilout);
+      } else {
+        /* allocate memory for the output frame */
+        outFrame = malloc (sizeof (outFrame[0]) * (nbBitsOut + 2));
 
-      /* truncate the frame according to the desired bitrate */
-      trunca (sync, nbBitsOut, bstIn, outFrame);
+        /* truncate the frame according to the desired bitrate */
+        trunca (sync, nbBitsOut, inpFrame, outFrame);
 
-      /* write output bitstream */
-      fwrite (outFrame, sizeof (outFrame[0]), nbBitsOut + 2, pfilout);
+        /* write output bitstream */
+        fwrite (outFrame, sizeof (outFrame[0]), nbBitsOut + 2, pfilout);
 
-      /* free memory for next iteration */
-      free (outFrame);
+        /* free memory for next iteration */
+        free (outFrame);
+      }
 
       nbframe++;
     }
@@ -348,7 +395,9 @@ int main (int argc, char *argv[]) {
   /* FINALIZATIONS */
 
   /* close the opened files */
-  fclose (pfilin);
+  if (pfilin != NULL)
+    fclose (pfilin);
+  close_g192_bs (bs);
   fclose (pfilout);
   if (pfilrate != NULL)
     fclose (pfilrate);
@@ -0,0 +1,247 @@
+/*                                                            v1.1  17.Oct.26
+=============================================================================
+
+                          U    U   GGG    SSSS  TTTTT
+                          U    U  G       S       T
+                          U    U  G  GG   SSSS    T
+                          U    U  G   G       S   T
+                           UUU     GG     SSS     T
+
+                   ========================================
+                    ITU-T - USER'S GROUP ON SOFTWARE TOOLS
+                   ========================================
+
+
+       =============================================================
+       COPYRIGHT NOTE: This source code, and all of its derivations,
+       is subject to the "ITU-T General Public License". Please have
+       it  read  in    the  distribution  disk,   or  in  the  ITU-T
+       Recommendation G.191 on "SOFTWARE TOOLS FOR SPEECH AND  AUDIO
+       CODING STANDARDS".
+       =============================================================
+
+
+MODULE:         UGST-POOL.C, POOL OF WORKER THREADS
+
+PROTOTYPE:      in ugst-pool.h
+
+FUNCTIONS:
+
+    ugst_pool_run: .......... run njobs independent jobs over a pool of
+                              threads
+    ugst_pool_run_hooks: .... same, in new threads only, with functions
+                              called when each thread starts and exits
+
+    The jobs are numbered 0 .. njobs-1 and taken in that order from a
+    shared queue: a thread takes the next job when it is done with the
+    previous one, so that jobs of different lengths balance out. With
+    ugst_pool_run(), the calling thread is one of the threads of the
+    pool. POSIX threads are used when HAVE_PTHREAD is defined;
+    otherwise, or if a thread can not be created, the jobs are run by
+    the calling thread.
+
+HISTORY:
+    17.Oct.26  v1.0  First version, from the thread pools of g722-batch.c,
+                     actlevel.c and eid_par.c
+    17.Oct.26  v1.1  Added ugst_pool_run_hooks(), for per-thread set-up such
+                     as the WMOPS counters of the basic operators
+=============================================================================
+*/
+
+#include <stdlib.h>
+
+#include "ugst-pool.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/* Work queue shared by the threads */
+typedef struct {
+  ugst_pool_job job;            /* job function */
+  ugst_pool_hook begin, end;    /* thread start and exit functions, or NULL */
+  void *ctx;                    /* its context */
+  long njobs;                   /* number of jobs */
+  long next;                    /* next job to be run */
+#ifdef HAVE_PTHREAD
+  pthread_mutex_t lock;         /* protects next */
+#endif
+} ugst_pool;
+
+
+/*
+  ============================================================================
+
+       void *ugst_pool_worker (void *arg);
+       ~~~~~~~~~~~~~~~~~~~~~~
+
+       Run the jobs of the pool `arg' (an ugst_pool), taking the next
+       one from the queue until there are no more left.
+
+  ============================================================================
+*/
+static void *ugst_pool_worker (void *arg) {
+  ugst_pool *pool = (ugst_pool *) arg;
+  long k;
+
+  for (;;) {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock (&pool->lock);
+#endif
+    k = pool->next++;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock (&pool->lock);
+#endif
+    if (k >= pool->njobs)
+      break;
+    pool->job (pool->ctx, k);
+  }
+  return (NULL);
+}
+
+/* ....................... End of ugst_pool_worker() ....................... */
+
+
+/*
+  ============================================================================
+
+       void *ugst_pool_thread (void *arg);
+       ~~~~~~~~~~~~~~~~~~~~~~
+
+       Body of the threads created for the pool `arg' (an ugst_pool):
+       ugst_pool_worker() between the begin and end functions.
+
+  ============================================================================
+*/
+static void *ugst_pool_thread (void *arg) {
+  ugst_pool *pool = (ugst_pool *) arg;
+
+  if (pool->begin != NULL)
+    pool->begin (pool->ctx);
+  ugst_pool_worker (pool);
+  if (pool->end != NULL)
+    pool->end (pool->ctx);
+  return (NULL);
+}
+
+/* ....................... End of ugst_pool_thread() ....................... */
+
+
+/*
+  ============================================================================
+
+       int ugst_pool_start (ugst_pool *pool, int threads, int caller);
+       ~~~~~~~~~~~~~~~~~~~
+
+       Run the jobs of the pool with `threads' threads. If `caller' is
+       set, the calling thread is one of them; otherwise `threads' new
+       threads are created and the calling thread waits for them. In
+       both cases, the jobs left when no more threads can be created
+       are run by the calling thread. Returns the number of threads
+       that have run jobs.
+
+  ============================================================================
+*/
+static int ugst_pool_start (ugst_pool * pool, int threads, int caller) {
+  int started = 0;
+#ifdef HAVE_PTHREAD
+  pthread_t tid[UGST_POOL_MAX_THREADS];
+  int t;
+#endif
+
+  pool->next = 0;
+
+#ifdef HAVE_PTHREAD
+  if (threads > pool->njobs)
+    threads = (int) pool->njobs;
+  pthread_mutex_init (&pool->lock, NULL);
+  for (t = caller ? 1 : 0; t < threads && t < UGST_POOL_MAX_THREADS; t++) {
+    if (pthread_create (&tid[started], NULL, ugst_pool_thread, pool) != 0)
+      break;
+    started++;
+  }
+  if (caller || started == 0)
+    ugst_pool_worker (pool);
+  for (t = 0; t < started; t++)
+    pthread_join (tid[t], NULL);
+  pthread_mutex_destroy (&pool->lock);
+#else
+  (void) threads;
+  ugst_pool_worker (pool);
+#endif
+
+  return ((caller || started == 0) ? started + 1 : started);
+}
+
+/* ....................... End of ugst_pool_start() ....................... */
+
+
+/*
+  ============================================================================
+
+       int ugst_pool_run (ugst_pool_job job, void *ctx, long njobs,
+       ~~~~~~~~~~~~~~~~~  int threads);
+
+       Description:
+       ~~~~~~~~~~~~
+       Run job(ctx, k) for k = 0 .. njobs-1 with `threads' threads (the
+       calling one included, at most UGST_POOL_MAX_THREADS and njobs),
+       and return when all the jobs are done. The jobs must be
+       independent of each other.
+
+       Return value:
+       ~~~~~~~~~~~~~
+       Number of threads used.
+
+  ============================================================================
+*/
+int ugst_pool_run (ugst_pool_job job, void *ctx, long njobs, int threads) {
+  ugst_pool pool;
+
+  pool.job = job;
+  pool.begin = pool.end = NULL;
+  pool.ctx = ctx;
+  pool.njobs = njobs;
+  return (ugst_pool_start (&pool, threads, 1));
+}
+
+/* ....................... End of ugst_pool_run() ....................... */
+
+
+/*
+  ============================================================================
+
+       int ugst_pool_run_hooks (ugst_pool_job job, ugst_pool_hook begin,
+       ~~~~~~~~~~~~~~~~~~~~~~~  ugst_pool_hook end, void *ctx,
+                                long njobs, int threads);
+
+       Description:
+       ~~~~~~~~~~~~
+       As ugst_pool_run(), but the jobs are run by `threads' new
+       threads, and the calling thread only waits for them. Each new
+       thread calls begin(ctx) before its first job and end(ctx) after
+       its last one (either may be NULL), e.g. to set up and then
+       collect thread-local data. Without POSIX threads, or if no
+       thread can be created, the jobs are run by the calling thread,
+       and begin() and end() are not called.
+
+       Return value:
+       ~~~~~~~~~~~~~
+       Number of threads used.
+
+  ============================================================================
+*/
+int ugst_pool_run_hooks (ugst_pool_job job, ugst_pool_hook begin, ugst_pool_hook end, void *ctx, long njobs, int threads) {
+  ugst_pool pool;
+
+  pool.job = job;
+  pool.begin = begin;
+  pool.end = end;
+  pool.ctx = ctx;
+  pool.njobs = njobs;
+  return (ugst_pool_start (&pool, threads, 0));
+}
+
+/* ....................... End of ugst_pool_run_hooks() ....................... */
+
+/* ************************* End of ugst-pool.c ************************* */
@@ -0,0 +1,41 @@
+/*
+  ============================================================================
+   File: UGST-POOL.H                                               17.Oct.26
+  ============================================================================
+
+                         UGST/ITU-T UTILITIES MODULE
+
+                   PROTOTYPES FOR THE POOL OF WORKER THREADS
+
+   History:
+   17.Oct.26    v1.0    First version
+   17.Oct.26    v1.1    Added ugst_pool_run_hooks()
+  ============================================================================
+*/
+#ifndef UGST_POOL_defined
+#define UGST_POOL_defined 110
+
+/* macros for smart prototypes */
+#ifndef ARGS
+#if (defined(__STDC__) || defined(VMS) || defined(__DECC)  || defined(MSDOS) || defined(__MSDOS__))
+#define ARGS(x) x
+#else /* Unix: no parameters in prototype! */
+#define ARGS(x) ()
+#endif
+#endif
+
+/* Upper limit for the number of threads of a pool */
+#define UGST_POOL_MAX_THREADS 64
+
+/* Job number k of a pool; ctx is the pointer given to ugst_pool_run() */
+typedef void (*ugst_pool_job) ARGS ((void *ctx, long k));
+
+/* Called by a new thread of a pool when it starts, and before it exits */
+typedef void (*ugst_pool_hook) ARGS ((void *ctx));
+
+/* ugst-pool.c */
+int ugst_pool_run ARGS ((ugst_pool_job job, void *ctx, long njobs, int threads));
+int ugst_pool_run_hooks ARGS ((ugst_pool_job job, ugst_pool_hook begin, ugst_pool_hook end, void *ctx, long njobs, int threads));
+
+#endif /* UGST_POOL_defined */
+/* ........................ End of UGST-POOL.H ........................ */
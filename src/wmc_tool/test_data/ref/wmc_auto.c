@@ -46,6 +46,7 @@ int cntr_push_pop = 0; /* global counter for checking balanced push_wmops()/pop_
 #define MAX_NUM_RECORDS              300 /* Initial maximum number of records -> might be increased during runtime, if needed */
 #define MAX_NUM_RECORDS_REALLOC_STEP 50  /* When re-allocating the list of records, increase the number of records by this number */
 #define MAX_CALL_TREE_DEPTH          100 /* maximum depth of the function call tree */
+#define MIN_WMOPS_HASH_SIZE          1024 /* Initial size of the hash table of WMOPS records (power of 2) -> doubled to keep it at most half full */
 #define DOUBLE_MAX                   0x80000000
 #define FAC                          ( FRAMES_PER_SECOND / 1e6 )
 
@@ -87,6 +88,7 @@ static double min_cnt;
 static double inst_cnt_wc[NUM_INST];
 static long fnum_cnt_wc;
 static int *wmops_caller_stack = NULL, wmops_caller_stack_index, max_wmops_caller_stack_index = 0;
+static int *wmops_hash = NULL, wmops_hash_size = 0; /* hash table of WMOPS records indexed by label, -1 = empty slot */
 static int *heap_allocation_call_tree = NULL, heap_allocation_call_tree_size = 0, heap_allocation_call_tree_max_size = 0;
 
 static BASIC_OP op_weight = {
@@ -155,6 +157,63 @@ long funcid_total_wmops_at_last_call_to_else;
 int call_occurred = 1;
 char func_name_where_last_call_to_else_occurred[MAX_FUNCTION_NAME_LENGTH + 1];
 
+/* hash of a function label (FNV-1a) */
+static unsigned int hash_wmops_label( const char *label )
+{
+    unsigned int h = 2166136261u;
+
+    while ( *label )
+    {
+        h = ( h ^ (unsigned char) *label++ ) * 16777619u;
+    }
+
+    return h;
+}
+
+/* (re)build the hash table of WMOPS records, with at least twice as many slots as records */
+static void rehash_wmops( void )
+{
+    int i, slot;
+
+    if ( wmops_hash_size < MIN_WMOPS_HASH_SIZE )
+    {
+        wmops_hash_size = MIN_WMOPS_HASH_SIZE;
+    }
+    while ( wmops_hash_size < 2 * num_wmops_records )
+    {
+        wmops_hash_size *= 2;
+    }
+
+    if ( wmops_hash != NULL )
+    {
+        free( wmops_hash );
+    }
+    wmops_hash = (int *) malloc( wmops_hash_size * sizeof( int ) );
+
+    if ( wmops_hash == NULL )
+    {
+        fprintf( stderr, "Error: Unable to Allocate the Hash Table of WMOPS Records!" );
+        exit( -1 );
+    }
+
+    for ( i = 0; i < wmops_hash_size; i++ )
+    {
+        wmops_hash[i] = -1;
+    }
+
+    for ( i = 0; i < num_wmops_records; i++ )
+    {
+        slot = hash_wmops_label( wmops[i].label ) & ( wmops_hash_size - 1 );
+        while ( wmops_hash[slot] >= 0 )
+        {
+            slot = ( slot + 1 ) & ( wmops_hash_size - 1 );
+        }
+        wmops_hash[slot] = i;
+    }
+
+    return;
+}
+
 void reset_wmops( void )
 {
     int i, j;
@@ -225,6 +284,9 @@ void reset_wmops( void )
         Reset_BASOP_WMOPS_counter( i );
     }
 
+    /* allocate the (empty) hash table of WMOPS records */
+    rehash_wmops();
+
     /* allocate the list of wmops callers to track the sequence of function calls */
     wmops_caller_stack_index = 0;
     max_wmops_caller_stack_index = MAX_NUM_RECORDS;
@@ -255,7 +317,7 @@ void reset_wmops( void )
 void push_wmops_fct( const char *label, ... )
 {
     int new_flag;
-    int i, j, index_record;
+    int i, j, index_record, slot;
     long tot;
     va_list arg;
     char func_name[MAX_FUNCTION_NAME_LENGTH] = "";
@@ -269,17 +331,14 @@ void push_wmops_fct( const char *label, ... )
     }
     va_end( arg );
 
-    /* Check, if this is a new function label */
-    new_flag = 1;
-    for ( i = 0; i < num_wmops_records; i++ )
+    /* Check, if this is a new function label (look-up in the hash table, with linear probing) */
+    slot = hash_wmops_label( func_name ) & ( wmops_hash_size - 1 );
+    while ( ( i = wmops_hash[slot] ) >= 0 && strcmp( wmops[i].label, func_name ) != 0 )
     {
-        if ( strcmp( wmops[i].label, func_name ) == 0 )
-        {
-            new_flag = 0;
-            break;
-        }
+        slot = ( slot + 1 ) & ( wmops_hash_size - 1 );
     }
-    index_record = i;
+    new_flag = ( i < 0 );
+    index_record = new_flag ? num_wmops_records : i;
 
     /* Create a new WMOPS record in the list */
     if ( new_flag )
@@ -323,6 +382,16 @@ void push_wmops_fct( const char *label, ... )
         strcpy( wmops[index_record].label, func_name );
 
         num_wmops_records++;
+
+        /* add the new record to the hash table (in the empty slot found above), or rebuild a bigger table */
+        if ( 2 * num_wmops_records > wmops_hash_size )
+        {
+            rehash_wmops();
+        }
+        else
+        {
+            wmops_hash[slot] = index_record;
+        }
     }
 
     /* Update the WMOPS context info of the old record before switching to the new one */
@@ -708,6 +777,14 @@ void print_wmops( void )
         free( wmops );
     }
 
+    /* De-allocate the hash table of wmops records */
+    if ( wmops_hash != NULL )
+    {
+        free( wmops_hash );
+        wmops_hash = NULL;
+        wmops_hash_size = 0;
+    }
+
     /* De-allocate the list of wmops caller functions */
     if ( wmops_caller_stack != NULL )
     {
@@ -771,7 +848,7 @@ static FILE *fid_csv_filename = NULL;
 
 typedef struct
 {
-    char function_name[MAX_FUNCTION_NAME_LENGTH + 1];
+    const char *function_name; /* interned function name (see intern_fct_name()), NULL = end of list */
     int16_t *stack_ptr;
 } caller_info;
 
@@ -783,6 +860,8 @@ static int16_t *ptr_max_stack = 0;     /* Pointer to the maximum stack pointer (
 static int32_t wc_stack_frame = 0;     /* Frame corresponding to the worst-case stack usage */
 static int current_calls = 0, max_num_calls = MAX_NUM_RECORDS;
 static char location_max_stack[256] = "undefined";
+static char **fct_names = NULL; /* hash table of interned function names (open addressing), NULL = empty slot; never de-allocated */
+static int fct_names_size = 0, n_fct_names = 0;
 
 typedef struct
 {
@@ -799,11 +878,23 @@ typedef struct
     int frame_allocated;            /* Frame number in which the Memory Block has been allocated (-1 if not allocated at the moment) */
     int OOB_Flag;
     int noccurances; /* Number of times that the memory block has been allocated in a frame */
+    int next_record;  /* Next record of the same allocation site (-1 if none) */
 } allocator_record;
 
+typedef struct
+{
+    unsigned long hash; /* hash of the allocation site: function name, line number and size string (see malloc_hash()) */
+    int first_record;   /* first and last records of the site in allocation_list, -1 = empty slot */
+    int last_record;
+} allocation_site;
+
 allocator_record *allocation_list = NULL;
 
 static int Num_Records, Max_Num_Records;
+static allocation_site *alloc_sites = NULL;            /* hash table of allocation sites (open addressing) */
+static int alloc_sites_size = 0, n_alloc_sites = 0;
+static int *block_ptr_hash = NULL;                     /* hash table of the allocated blocks indexed by block pointer (open addressing), -1 = empty slot */
+static int block_ptr_hash_size = 0, n_block_ptr_hash = 0;
 static size_t Stat_Cnt_Size = USE_BYTES;
 static const char *Count_Unit[] = { "bytes", "words", "words", "words" };
 
@@ -812,10 +903,21 @@ static int32_t current_heap_size;
 static int *list_wc_intra_frame_heap, n_items_wc_intra_frame_heap, max_items_wc_intra_frame_heap, size_wc_intra_frame_heap, location_wc_intra_frame_heap;
 static int *list_current_inter_frame_heap, n_items_current_inter_frame_heap, max_items_current_inter_frame_heap, size_current_inter_frame_heap;
 static int *list_wc_inter_frame_heap, n_items_wc_inter_frame_heap, max_items_wc_inter_frame_heap, size_wc_inter_frame_heap, location_wc_inter_frame_heap;
+static int32_t peak_heap_size_frame, wc_peak_heap_size_frame, wc_peak_heap_frame; /* peak heap size in the current frame, largest of them and its frame */
+static double sum_peak_heap_size_frame;                                            /* sum of the peak heap sizes of all frames */
+static long num_peak_heap_frames;                                                  /* number of frames in the sum */
+
+#ifdef MEM_COUNT_TIMELINE
+const char *timeline_filename = "mem_heap_timeline.csv";
+static FILE *fid_timeline_filename = NULL;
+#endif
 
 /* Local Functions */
 static unsigned long malloc_hash( const char *func_name, int func_lineno, char *size_str );
-allocator_record *get_mem_record( unsigned long *hash, const char *func_name, int func_lineno, char *size_str, int *index_record );
+static allocation_site *get_alloc_site( unsigned long hash );
+static void add_block_ptr( int index_record );
+static int remove_block_ptr( const void *ptr );
+static const char *intern_fct_name( const char *fctname );
 static void *mem_alloc_block( size_t size, const char *size_str );
 
 /*-------------------------------------------------------------------*
@@ -876,10 +978,33 @@ void reset_mem( Counting_Size cnt_size )
     Num_Records = 0;
     Max_Num_Records = MAX_NUM_RECORDS;
 
+    /* empty hash tables of allocation sites and allocated blocks (allocated at first use) */
+    if ( alloc_sites != NULL )
+    {
+        free( alloc_sites );
+        alloc_sites = NULL;
+    }
+    alloc_sites_size = 0;
+    n_alloc_sites = 0;
+
+    if ( block_ptr_hash != NULL )
+    {
+        free( block_ptr_hash );
+        block_ptr_hash = NULL;
+    }
+    block_ptr_hash_size = 0;
+    n_block_ptr_hash = 0;
+
     wc_ram_size = 0;
     wc_ram_frame = -1;
     current_heap_size = 0;
 
+    peak_heap_size_frame = 0;
+    wc_peak_heap_size_frame = 0;
+    wc_peak_heap_frame = -1;
+    sum_peak_heap_size_frame = 0.0;
+    num_peak_heap_frames = 0;
+
     /* heap allocation tree */
     heap_allocation_call_tree_max_size = MAX_NUM_RECORDS;
     if ( heap_allocation_call_tree == NULL )
@@ -940,6 +1065,26 @@ void reset_mem( Counting_Size cnt_size )
     }
 #endif
 
+#ifdef MEM_COUNT_TIMELINE
+    /* Check, if the timeline file has already been opened */
+    if ( fid_timeline_filename == NULL )
+    {
+        fid_timeline_filename = fopen( timeline_filename, "wb" );
+
+        if ( fid_timeline_filename == NULL )
+        {
+            fprintf( stderr, "\nCannot open %s!\n\n", timeline_filename );
+            exit( -1 );
+        }
+    }
+    else
+    {
+        /* reset file */
+        rewind( fid_timeline_filename );
+    }
+    fprintf( fid_timeline_filename, "frame,peak_heap,heap\n" );
+#endif
+
     return;
 }
 
@@ -991,9 +1136,8 @@ int push_stack( const char *filename, const char *fctname )
         exit( -1 );
     }
 
-    /* Save the Name of the Calling Function in the Table */
-    strncpy( stack_callers[0][current_calls].function_name, fctname, MAX_FUNCTION_NAME_LENGTH );
-    stack_callers[0][current_calls].function_name[MAX_FUNCTION_NAME_LENGTH] = 0; /* Nul Terminate */
+    /* Save the (Interned) Name of the Calling Function in the Table */
+    stack_callers[0][current_calls].function_name = intern_fct_name( fctname );
 
     /* Save the Stack Pointer */
     stack_callers[0][current_calls].stack_ptr = ptr_current_stack;
@@ -1019,7 +1163,7 @@ int push_stack( const char *filename, const char *fctname )
         /* Terminate the List with 0 (for printing purposes) */
         if ( current_calls < max_num_calls )
         {
-            stack_callers[1][current_calls].function_name[0] = 0;
+            stack_callers[1][current_calls].function_name = NULL;
         }
     }
 
@@ -1067,7 +1211,7 @@ int pop_stack( const char *filename, const char *fctname )
     }
 
     /* Erase Entry */
-    caller_info_ptr->function_name[0] = 0;
+    caller_info_ptr->function_name = NULL;
 
     /* Retrieve previous stack pointer */
     if ( current_calls == 0 )
@@ -1101,13 +1245,14 @@ static void print_stack_call_tree( void )
     for ( call_level = 0; call_level < max_num_calls; call_level++ )
     {
         /* Done? */
-        if ( caller_info_ptr->function_name[0] == 0 )
+        if ( caller_info_ptr->function_name == NULL )
         {
             break;
         }
 
         /* Print Name */
         strncpy( fctname, caller_info_ptr->function_name, MAX_FUNCTION_NAME_LENGTH );
+        fctname[MAX_FUNCTION_NAME_LENGTH - 2] = '\0';
         strcat( fctname, "()" );
         fprintf( stdout, "%-42s", fctname );
 
@@ -1150,6 +1295,7 @@ void *mem_alloc(
     int32_t current_stack_size;
     unsigned long hash;
     allocator_record *ptr_record;
+    allocation_site *ptr_site;
 
     if ( size == 0 )
     {
@@ -1157,18 +1303,17 @@ void *mem_alloc(
         exit( -1 );
     }
 
-    /* Search for an existing record (that has been de-allocated before) */
-    index_record = 0;
-    while ( ( ptr_record = get_mem_record( &hash, func_name, func_lineno, size_str, &index_record ) ) != NULL )
+    /* Search for an existing record of the same allocation site (that has been de-allocated before) */
+    hash = malloc_hash( func_name, func_lineno, size_str );
+    ptr_site = get_alloc_site( hash );
+    ptr_record = NULL;
+    for ( index_record = ptr_site->first_record; index_record >= 0; index_record = allocation_list[index_record].next_record )
     {
-        if ( ptr_record->frame_allocated == -1 )
+        if ( allocation_list[index_record].block_ptr == NULL && allocation_list[index_record].frame_allocated == -1 )
         {
+            ptr_record = &( allocation_list[index_record] );
             break;
         }
-        else
-        {
-            index_record++;
-        }
     }
 
     /* Create new record */
@@ -1176,9 +1321,15 @@ void *mem_alloc(
     {
         if ( Num_Records >= Max_Num_Records )
         {
-            /* There is no room for a new record -> reallocate memory */
-            Max_Num_Records += MAX_NUM_RECORDS_REALLOC_STEP;
+            /* There is no room for a new record -> reallocate memory (the list is doubled, so that the number of re-allocations stays small) */
+            Max_Num_Records += ( Max_Num_Records > MAX_NUM_RECORDS_REALLOC_STEP ) ? Max_Num_Records : MAX_NUM_RECORDS_REALLOC_STEP;
             allocation_list = realloc( allocation_list, Max_Num_Records * sizeof( allocator_record ) );
+
+            if ( allocation_list == NULL )
+            {
+                fprintf( stderr, "Error: Unable to Re-Allocate List of Memory Blocks!" );
+                exit( -1 );
+            }
         }
 
         ptr_record = &( allocation_list[Num_Records] );
@@ -1193,8 +1344,27 @@ void *mem_alloc(
         ptr_record->wc_heap_size_intra_frame = -1;
         ptr_record->wc_heap_size_inter_frame = -1;
 
+        /* Save all auxiliary information about the allocation site (the same for all the records of the site) */
+        strncpy( ptr_record->name, func_name, MAX_FUNCTION_NAME_LENGTH );
+        ptr_record->name[MAX_FUNCTION_NAME_LENGTH] = '\0';
+        strncpy( ptr_record->params, size_str, MAX_PARAMS_LENGTH ); /* Note: The size string starts with either 'm' or 'c' to indicate 'm'alloc or 'c'alloc */
+        ptr_record->params[MAX_PARAMS_LENGTH] = '\0';
+        ptr_record->lineno = func_lineno;
+
         index_record = Num_Records;
         Num_Records++;
+
+        /* Append the record to the list of records of the allocation site */
+        ptr_record->next_record = -1;
+        if ( ptr_site->last_record >= 0 )
+        {
+            allocation_list[ptr_site->last_record].next_record = index_record;
+        }
+        else
+        {
+            ptr_site->first_record = index_record;
+        }
+        ptr_site->last_record = index_record;
     }
 
     /* Allocate memory block for the new record, add signature before the beginning and after the memory block and fill it with magic value */
@@ -1206,12 +1376,9 @@ void *mem_alloc(
         exit( -1 );
     }
 
-    /* Save all auxiliary information about the memory block */
-    strncpy( ptr_record->name, func_name, MAX_FUNCTION_NAME_LENGTH );
-    ptr_record->name[MAX_FUNCTION_NAME_LENGTH] = '\0';
-    strncpy( ptr_record->params, size_str, MAX_PARAMS_LENGTH ); /* Note: The size string starts with either 'm' or 'c' to indicate 'm'alloc or 'c'alloc */
-    ptr_record->params[MAX_PARAMS_LENGTH] = '\0';
-    ptr_record->lineno = func_lineno;
+    /* Add the memory block to the hash table of allocated blocks */
+    add_block_ptr( index_record );
+
     ptr_record->block_size = size;
     ptr_record->total_block_size += size;
 
@@ -1230,6 +1397,10 @@ void *mem_alloc(
 
     /* Update Heap Size in the current frame */
     current_heap_size += ptr_record->block_size;
+    if ( current_heap_size > peak_heap_size_frame )
+    {
+        peak_heap_size_frame = current_heap_size;
+    }
 
     /* Check, if this is the new Worst-Case RAM (stack + heap) */
     current_stack_size = ( int32_t )( ( ( ptr_base_stack - ptr_current_stack ) * sizeof( int16_t ) ) );
@@ -1478,37 +1649,269 @@ static unsigned long malloc_hash( const char *func_name, int func_lineno, char *
 }
 
 /*-------------------------------------------------------------------*
- * get_mem_record()
+ * get_alloc_site()
  *
- * Search for memory record in the internal list, return NULL if not found
- * Start from index_record
+ * Find the allocation site with the given hash in the hash table of allocation sites, or create it
+ * The table is kept at most half full: it is re-built with twice as many slots, when needed
  *--------------------------------------------------------------------*/
 
-allocator_record *get_mem_record( unsigned long *hash, const char *func_name, int func_lineno, char *size_str, int *index_record )
+static allocation_site *get_alloc_site( unsigned long hash )
 {
-    int i;
+    int i, slot, old_size;
+    allocation_site *old_sites;
 
-    if ( *index_record < 0 || *index_record > Num_Records )
+    /* re-build the table, if needed */
+    if ( 2 * ( n_alloc_sites + 1 ) > alloc_sites_size )
     {
-        return NULL;
+        old_sites = alloc_sites;
+        old_size = alloc_sites_size;
+
+        alloc_sites_size = ( old_size > 0 ) ? 2 * old_size : 2 * MAX_NUM_RECORDS;
+        alloc_sites = (allocation_site *) malloc( alloc_sites_size * sizeof( allocation_site ) );
+
+        if ( alloc_sites == NULL )
+        {
+            fprintf( stderr, "Error: Unable to Allocate the Table of Allocation Sites!" );
+            exit( -1 );
+        }
+
+        for ( slot = 0; slot < alloc_sites_size; slot++ )
+        {
+            alloc_sites[slot].first_record = -1;
+        }
+
+        for ( i = 0; i < old_size; i++ )
+        {
+            if ( old_sites[i].first_record >= 0 )
+            {
+                slot = (int) ( old_sites[i].hash % alloc_sites_size );
+                while ( alloc_sites[slot].first_record >= 0 )
+                {
+                    slot = ( slot + 1 ) % alloc_sites_size;
+                }
+                alloc_sites[slot] = old_sites[i];
+            }
+        }
+
+        if ( old_sites != NULL )
+        {
+            free( old_sites );
+        }
+    }
+
+    /* look for the site (linear probing) */
+    slot = (int) ( hash % alloc_sites_size );
+    while ( alloc_sites[slot].first_record >= 0 && alloc_sites[slot].hash != hash )
+    {
+        slot = ( slot + 1 ) % alloc_sites_size;
+    }
+
+    /* new site -> take the empty slot (the first record is set by the caller) */
+    if ( alloc_sites[slot].first_record < 0 )
+    {
+        alloc_sites[slot].hash = hash;
+        alloc_sites[slot].last_record = -1;
+        n_alloc_sites++;
+    }
+
+    return &( alloc_sites[slot] );
+}
+
+/*-------------------------------------------------------------------*
+ * hash_block_ptr()
+ *
+ * Slot of a memory block pointer in the hash table of allocated blocks
+ * (bits mixed as in the MurmurHash3 finalizer, since the low bits of the pointers are mostly constant)
+ *--------------------------------------------------------------------*/
+
+static int hash_block_ptr( const void *ptr )
+{
+    uint64_t h = (uint64_t) (uintptr_t) ptr;
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+
+    return (int) ( h & (uint64_t) ( block_ptr_hash_size - 1 ) );
+}
+
+/*-------------------------------------------------------------------*
+ * add_block_ptr()
+ *
+ * Add the memory block of a record to the hash table of allocated blocks
+ * The table is kept at most half full: it is re-built with twice as many slots, when needed
+ *--------------------------------------------------------------------*/
+
+static void add_block_ptr( int index_record )
+{
+    int i, slot;
+
+    if ( 2 * ( n_block_ptr_hash + 1 ) > block_ptr_hash_size )
+    {
+        /* re-build the table from the list of records (including the new block) */
+        block_ptr_hash_size = ( block_ptr_hash_size > 0 ) ? 2 * block_ptr_hash_size : 1024;
+        if ( block_ptr_hash != NULL )
+        {
+            free( block_ptr_hash );
+        }
+        block_ptr_hash = (int *) malloc( block_ptr_hash_size * sizeof( int ) );
+
+        if ( block_ptr_hash == NULL )
+        {
+            fprintf( stderr, "Error: Unable to Allocate the Table of Memory Blocks!" );
+            exit( -1 );
+        }
+
+        memset( block_ptr_hash, -1, block_ptr_hash_size * sizeof( int ) );
+        n_block_ptr_hash = 0;
+
+        for ( i = 0; i < Num_Records; i++ )
+        {
+            if ( allocation_list[i].block_ptr != NULL )
+            {
+                slot = hash_block_ptr( allocation_list[i].block_ptr );
+                while ( block_ptr_hash[slot] >= 0 )
+                {
+                    slot = ( slot + 1 ) & ( block_ptr_hash_size - 1 );
+                }
+                block_ptr_hash[slot] = i;
+                n_block_ptr_hash++;
+            }
+        }
+
+        return;
+    }
+
+    slot = hash_block_ptr( allocation_list[index_record].block_ptr );
+    while ( block_ptr_hash[slot] >= 0 )
+    {
+        slot = ( slot + 1 ) & ( block_ptr_hash_size - 1 );
+    }
+    block_ptr_hash[slot] = index_record;
+    n_block_ptr_hash++;
+
+    return;
+}
+
+/*-------------------------------------------------------------------*
+ * remove_block_ptr()
+ *
+ * Find the record of a memory block in the hash table of allocated blocks and remove it from the table
+ * Return the index of the record, -1 if not found
+ *--------------------------------------------------------------------*/
+
+static int remove_block_ptr( const void *ptr )
+{
+    int slot, next, home, index_record;
+
+    if ( block_ptr_hash == NULL )
+    {
+        return -1;
+    }
+
+    slot = hash_block_ptr( ptr );
+    while ( ( index_record = block_ptr_hash[slot] ) >= 0 && allocation_list[index_record].block_ptr != ptr )
+    {
+        slot = ( slot + 1 ) & ( block_ptr_hash_size - 1 );
+    }
+
+    if ( index_record < 0 )
+    {
+        return -1;
+    }
+
+    /* empty the slot, and move back the next entries of the cluster that could not be found anymore (no tombstones) */
+    next = slot;
+    while ( 1 )
+    {
+        next = ( next + 1 ) & ( block_ptr_hash_size - 1 );
+        if ( block_ptr_hash[next] < 0 )
+        {
+            break;
+        }
+
+        home = hash_block_ptr( allocation_list[block_ptr_hash[next]].block_ptr );
+        if ( ( ( next - home ) & ( block_ptr_hash_size - 1 ) ) >= ( ( next - slot ) & ( block_ptr_hash_size - 1 ) ) )
+        {
+            block_ptr_hash[slot] = block_ptr_hash[next];
+            slot = next;
+        }
     }
+    block_ptr_hash[slot] = -1;
+    n_block_ptr_hash--;
+
+    return index_record;
+}
+
+/*-------------------------------------------------------------------*
+ * intern_fct_name()
+ *
+ * Return the unique copy of a function name, stored in the hash table of function names,
+ * so that the lists of stack callers hold pointers rather than copies of the names
+ *--------------------------------------------------------------------*/
+
+static const char *intern_fct_name( const char *fctname )
+{
+    int i, slot, old_size;
+    unsigned long hash;
+    char **old_names;
+
+    /* re-build the table, if needed (at most half full) */
+    if ( 2 * ( n_fct_names + 1 ) > fct_names_size )
+    {
+        old_names = fct_names;
+        old_size = fct_names_size;
+
+        fct_names_size = ( old_size > 0 ) ? 2 * old_size : 1024;
+        fct_names = (char **) calloc( fct_names_size, sizeof( char * ) );
+
+        if ( fct_names == NULL )
+        {
+            fprintf( stderr, "Error: Unable to Allocate the Table of Function Names!" );
+            exit( -1 );
+        }
+
+        for ( i = 0; i < old_size; i++ )
+        {
+            if ( old_names[i] != NULL )
+            {
+                slot = (int) ( malloc_hash( old_names[i], 0, NULL ) & ( fct_names_size - 1 ) );
+                while ( fct_names[slot] != NULL )
+                {
+                    slot = ( slot + 1 ) & ( fct_names_size - 1 );
+                }
+                fct_names[slot] = old_names[i];
+            }
+        }
 
-    /* calculate hash */
-    *hash = malloc_hash( func_name, func_lineno, size_str );
+        if ( old_names != NULL )
+        {
+            free( old_names );
+        }
+    }
 
-    for ( i = *index_record; i < Num_Records; i++ )
+    hash = malloc_hash( fctname, 0, NULL );
+    slot = (int) ( hash & ( fct_names_size - 1 ) );
+    while ( fct_names[slot] != NULL )
     {
-        /* check, if memory block is not allocated at the moment and the hash matches */
-        if ( allocation_list[i].block_ptr == NULL && *hash == allocation_list[i].hash )
+        if ( strcmp( fct_names[slot], fctname ) == 0 )
         {
-            *index_record = i;
-            return &( allocation_list[i] );
+            return fct_names[slot];
         }
+        slot = ( slot + 1 ) & ( fct_names_size - 1 );
+    }
+
+    /* new name -> store a copy */
+    fct_names[slot] = (char *) malloc( strlen( fctname ) + 1 );
+    if ( fct_names[slot] == NULL )
+    {
+        fprintf( stderr, "Error: Unable to Allocate the Table of Function Names!" );
+        exit( -1 );
     }
+    strcpy( fct_names[slot], fctname );
+    n_fct_names++;
 
-    /* not found */
-    *index_record = -1;
-    return NULL;
+    return fct_names[slot];
 }
 
 
@@ -1523,21 +1926,16 @@ allocator_record *get_mem_record( unsigned long *hash, const char *func_name, in
 
 void mem_free( const char *func_name, int func_lineno, void *ptr )
 {
-    int i, index_record;
+    int index_record;
     char *tmp_ptr;
     allocator_record *ptr_record;
 
-    /* Search for the Block Pointer in the List */
+    /* Search for the Block Pointer in the Hash Table of Allocated Blocks (and remove it) */
     ptr_record = NULL;
-    index_record = -1;
-    for ( i = 0; i < Num_Records; i++ )
-    {
-        if ( ptr == allocation_list[i].block_ptr )
-        { /* Yes, Found it */
-            ptr_record = &( allocation_list[i] );
-            index_record = i;
-            break;
-        }
+    index_record = remove_block_ptr( ptr );
+    if ( index_record >= 0 )
+    { /* Yes, Found it */
+        ptr_record = &( allocation_list[index_record] );
     }
 
     if ( ptr_record == NULL )
@@ -1773,6 +2171,19 @@ void update_mem( void )
         }
     }
 
+    /* peak heap size of the frame (timeline) */
+    sum_peak_heap_size_frame += peak_heap_size_frame;
+    num_peak_heap_frames++;
+    if ( peak_heap_size_frame > wc_peak_heap_size_frame )
+    {
+        wc_peak_heap_size_frame = peak_heap_size_frame;
+        wc_peak_heap_frame = update_cnt;
+    }
+#ifdef MEM_COUNT_TIMELINE
+    fprintf( fid_timeline_filename, "%ld,%d,%d\n", update_cnt, peak_heap_size_frame >> Stat_Cnt_Size, current_heap_size >> Stat_Cnt_Size );
+#endif
+    peak_heap_size_frame = current_heap_size; /* the blocks still allocated are part of the next frame */
+
     /* reset heap allocation call tree */
     heap_allocation_call_tree_size = 0;
 
@@ -2105,6 +2516,12 @@ void print_mem( ROM_Size_Lookup_Table Const_Data_PROM_Table[] )
         fprintf( stdout, "Maximum inter-frame heap size: 0\n" );
     }
 
+    if ( wc_peak_heap_frame >= 0 )
+    {
+        fprintf( stdout, "Peak heap size per frame: %d %s at most in frame %d, %.1f %s on average\n", wc_peak_heap_size_frame >> Stat_Cnt_Size, Count_Unit[Stat_Cnt_Size], wc_peak_heap_frame,
+                 sum_peak_heap_size_frame / num_peak_heap_frames / ( 1 << Stat_Cnt_Size ), Count_Unit[Stat_Cnt_Size] );
+    }
+
 #ifdef MEM_COUNT_DETAILS
     /* Print detailed information about worst-case stack usage */
     if ( ptr_base_stack - ptr_max_stack > 0 )
@@ -2139,6 +2556,23 @@ void print_mem( ROM_Size_Lookup_Table Const_Data_PROM_Table[] )
         free( allocation_list );
     }
 
+    /* De-allocate hash tables of allocation sites and allocated blocks */
+    if ( alloc_sites != NULL )
+    {
+        free( alloc_sites );
+        alloc_sites = NULL;
+    }
+    alloc_sites_size = 0;
+    n_alloc_sites = 0;
+
+    if ( block_ptr_hash != NULL )
+    {
+        free( block_ptr_hash );
+        block_ptr_hash = NULL;
+    }
+    block_ptr_hash_size = 0;
+    n_block_ptr_hash = 0;
+
     /* De-allocate list of stack records */
     if ( stack_callers[0] != NULL )
     {
@@ -2179,6 +2613,14 @@ void print_mem( ROM_Size_Lookup_Table Const_Data_PROM_Table[] )
     }
 #endif
 
+#ifdef MEM_COUNT_TIMELINE
+    if ( fid_timeline_filename != NULL )
+    {
+        fclose( fid_timeline_filename );
+        fid_timeline_filename = NULL;
+    }
+#endif
+
     return;
 }
 
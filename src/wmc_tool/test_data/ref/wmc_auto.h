@@ -652,6 +652,7 @@ typedef struct ROM_Size_Lookup_Table
 
 /*#define MEM_ALIGN_64BITS */ /* Define this when using 64 Bits values in the code (ex: double), otherwise it will align on 32 Bits */
 /*#define MEM_COUNT_DETAILS*/
+/*#define MEM_COUNT_TIMELINE*/ /* Define this to write the peak heap size of each frame to mem_heap_timeline.csv */
 
 typedef enum
 {
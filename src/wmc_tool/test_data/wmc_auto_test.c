@@ -0,0 +1,202 @@
+/*------------------------------------------------------------------------------------------*
+ * Run-time test of the instrumentation library (wmc_auto.c, wmc_auto.h exported by wmc_tool -c)
+ *
+ * An instrumented program counts the operations of many functions, with labels built at run
+ * time, and allocates and frees many heap blocks over several frames. The reports of
+ * print_wmops() and print_mem() are written to wmc_auto_test.log and checked against the
+ * expected counts. Returns 0 if all the checks pass.
+ *------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "wmc_auto.h"
+
+/*------------------------------------------------------------------------------------------*
+ * Local constants
+ *------------------------------------------------------------------------------------------*/
+
+#define NUM_FRAMES    10
+#define NUM_FUNCTIONS 700  /* more than half the initial size of the hash table of WMOPS records */
+#define NUM_BLOCKS    2000 /* blocks allocated and freed within each frame */
+#define KEEP_SIZE     1000 /* block kept from frame KEEP_FIRST to frame KEEP_LAST */
+#define KEEP_FIRST    2
+#define KEEP_LAST     5
+#define LOG_FILE      "wmc_auto_test.log"
+
+/* size of block k: 8, 16, 24, 32, 8, ... bytes, i.e. NUM_BLOCKS / 4 * 80 bytes per frame */
+#define BLOCK_SIZE( k ) ( 8 * ( ( k ) % 4 + 1 ) )
+#define FRAME_HEAP      ( NUM_BLOCKS / 4 * 80 )
+
+
+/*------------------------------------------------------------------------------------------*
+ * run_frame()
+ *
+ * One frame of the instrumented program: function k counts k+1 additions; the functions are
+ * called, and the blocks freed, in reverse order in even frames, and the blocks freed in a
+ * scattered order in odd frames
+ *------------------------------------------------------------------------------------------*/
+
+static void run_frame(
+    int frame,
+    void **blocks,
+    void **keep )
+{
+    int i, k;
+    char label[32];
+
+    push_wmops( "frame" );
+
+    for ( i = 0; i < NUM_FUNCTIONS; i++ )
+    {
+        k = ( frame % 2 ) ? NUM_FUNCTIONS - 1 - i : i;
+        sprintf( label, "fct_%d", k );
+        push_wmops( label );
+        ADD( k + 1 );
+        pop_wmops();
+    }
+
+    if ( frame == KEEP_FIRST )
+    {
+        *keep = malloc_( KEEP_SIZE );
+    }
+
+    for ( k = 0; k < NUM_BLOCKS; k++ )
+    {
+        blocks[k] = ( k % 2 ) ? calloc_( 1, BLOCK_SIZE( k ) ) : malloc_( BLOCK_SIZE( k ) );
+    }
+    for ( i = 0; i < NUM_BLOCKS; i++ )
+    {
+        k = ( frame % 2 ) ? ( 7 * i ) % NUM_BLOCKS : NUM_BLOCKS - 1 - i;
+        free_( blocks[k] );
+    }
+
+    if ( frame == KEEP_LAST )
+    {
+        free_( *keep );
+    }
+
+    pop_wmops();
+
+    return;
+}
+
+
+/*------------------------------------------------------------------------------------------*
+ * check_log()
+ *
+ * Check the reports of print_wmops() and print_mem() in the log file
+ *------------------------------------------------------------------------------------------*/
+
+static int check_log( void )
+{
+    FILE *f;
+    char line[512], label[64];
+    int errors = 0, found_fct = 0, found_peak = 0, found_inter = 0;
+    int k, size, frame;
+    float calls, wmops[6], average;
+
+    if ( ( f = fopen( LOG_FILE, "r" ) ) == NULL )
+    {
+        fprintf( stderr, "Cannot read %s\n", LOG_FILE );
+        return 1;
+    }
+
+    while ( fgets( line, sizeof( line ), f ) != NULL )
+    {
+        if ( sscanf( line, " fct_%d %f %f %f %f %f %f %f", &k, &calls, &wmops[0], &wmops[1], &wmops[2], &wmops[3], &wmops[4], &wmops[5] ) == 8 )
+        {
+            /* one call per frame, k+1 additions per call, the same in every frame */
+            found_fct++;
+            if ( calls != 1.0f || fabs( wmops[2] - ( k + 1 ) * FRAMES_PER_SECOND / 1e6 ) > 0.0006 || wmops[0] != wmops[1] )
+            {
+                fprintf( stderr, "Wrong WMOPS record: %s", line );
+                errors++;
+            }
+        }
+        else if ( sscanf( line, "Peak heap size per frame: %d bytes at most in frame %d, %f bytes on average", &size, &frame, &average ) == 3 )
+        {
+            found_peak = 1;
+            if ( size != FRAME_HEAP + KEEP_SIZE || frame != KEEP_FIRST ||
+                 average != (float) ( FRAME_HEAP + ( KEEP_LAST - KEEP_FIRST + 1 ) * KEEP_SIZE / (double) NUM_FRAMES ) )
+            {
+                fprintf( stderr, "Wrong peak heap size per frame: %s", line );
+                errors++;
+            }
+        }
+        else if ( sscanf( line, "Maximum inter-frame heap size: %d bytes in frame %d", &size, &frame ) == 2 )
+        {
+            found_inter = 1;
+            if ( size != KEEP_SIZE || frame != KEEP_FIRST )
+            {
+                fprintf( stderr, "Wrong inter-frame heap size: %s", line );
+                errors++;
+            }
+        }
+        else if ( sscanf( line, " %63s %f", label, &calls ) == 2 && strcmp( label, "frame" ) == 0 && calls != 1.0f )
+        {
+            fprintf( stderr, "Wrong WMOPS record: %s", line );
+            errors++;
+        }
+    }
+    fclose( f );
+
+    if ( found_fct != NUM_FUNCTIONS )
+    {
+        fprintf( stderr, "%d WMOPS records of functions instead of %d\n", found_fct, NUM_FUNCTIONS );
+        errors++;
+    }
+    if ( !found_peak || !found_inter )
+    {
+        fprintf( stderr, "Peak or inter-frame heap size not reported\n" );
+        errors++;
+    }
+
+    return errors;
+}
+
+
+/*------------------------------------------------------------------------------------------*
+ * main()
+ *------------------------------------------------------------------------------------------*/
+
+int main( void )
+{
+    int frame, errors;
+    void **blocks, *keep = NULL;
+
+    if ( ( blocks = (void **) malloc( NUM_BLOCKS * sizeof( void * ) ) ) == NULL )
+    {
+        return 1;
+    }
+
+    reset_wmops();
+    reset_mem( USE_BYTES );
+
+    for ( frame = 0; frame < NUM_FRAMES; frame++ )
+    {
+        run_frame( frame, blocks, &keep );
+        update_mem();
+        update_wmops();
+    }
+
+    /* write the reports to the log file */
+    if ( freopen( LOG_FILE, "w", stdout ) == NULL )
+    {
+        return 1;
+    }
+    print_wmops();
+    print_mem( NULL );
+    fclose( stdout );
+
+    free( blocks );
+
+    if ( ( errors = check_log() ) > 0 )
+    {
+        fprintf( stderr, "%d errors in %s\n", errors, LOG_FILE );
+        return 1;
+    }
+
+    return 0;
+}
@@ -1093,7 +1093,7 @@ static TOOL_ERROR Output_Wmops_File( char *PathName, float frames_per_sec, bool
             if (strstr(wmops_auto_file[j], "#define FRAMES_PER_SECOND") != NULL)
             {
                 /* replace the declaration of FRAMES_PER_SECOND with user-defined value */
-                sprintf(temp_str, "#define FRAMES_PER_SECOND %-8.1f", frames_per_sec);
+                sprintf(temp_str, "#define FRAMES_PER_SECOND            %.1f\r\n", frames_per_sec);
                 strcpy(text + offset, temp_str);
                 offset += (int) strlen(temp_str);
             }